@@ -0,0 +1,50 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+namespace benchmark {
+
+/*!
+ * Creates a random stochastic matrix in which each state has the given number of choices and each choice has (at most) the given number of successors.
+ * If there is more than one choice per state, the matrix has a non-trivial row grouping.
+ * The successors of a state are mostly local (i.e. close to the state) so that the matrix has a structure that is similar to the one of typical models.
+ */
+inline storm::storage::SparseMatrix<double> createRandomMatrix(uint64_t numberOfStates, uint64_t choicesPerState, uint64_t successorsPerChoice,
+                                                               uint64_t seed = 42) {
+    std::mt19937_64 generator(seed);
+    std::uniform_int_distribution<uint64_t> localDistribution(0, 100);
+    std::uniform_int_distribution<uint64_t> globalDistribution(0, numberOfStates - 1);
+    bool const hasRowGrouping = choicesPerState > 1;
+    uint64_t const numberOfRows = numberOfStates * choicesPerState;
+    storm::storage::SparseMatrixBuilder<double> builder(numberOfRows, numberOfStates, numberOfRows * successorsPerChoice, true, hasRowGrouping,
+                                                        hasRowGrouping ? numberOfStates : 0);
+    std::vector<uint64_t> successors;
+    uint64_t row = 0;
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        if (hasRowGrouping) {
+            builder.newRowGroup(row);
+        }
+        for (uint64_t choice = 0; choice < choicesPerState; ++choice, ++row) {
+            successors.clear();
+            for (uint64_t successor = 0; successor < successorsPerChoice; ++successor) {
+                // Every tenth transition leads to an arbitrary state.
+                successors.push_back(successor % 10 == 9 ? globalDistribution(generator) : (state + localDistribution(generator)) % numberOfStates);
+            }
+            std::sort(successors.begin(), successors.end());
+            successors.erase(std::unique(successors.begin(), successors.end()), successors.end());
+            for (auto successor : successors) {
+                builder.addNextValue(row, successor, 1.0 / successors.size());
+            }
+        }
+    }
+    return builder.build();
+}
+
+}  // namespace benchmark
+}  // namespace storm
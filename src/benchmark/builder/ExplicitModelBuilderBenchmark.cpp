@@ -0,0 +1,45 @@
+#include "benchmark/storm_benchmark.h"
+#include "storm-config.h"
+
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/models/sparse/Model.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/prism/Program.h"
+
+namespace {
+
+struct PrismModel {
+    std::string name;
+    std::string file;
+};
+
+std::vector<PrismModel> const prismModels = {{"Dtmc_brp-16-2", STORM_TEST_RESOURCES_DIR "/dtmc/brp-16-2.pm"},
+                                             {"Dtmc_crowds-5-5", STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm"},
+                                             {"Dtmc_leader-3-5", STORM_TEST_RESOURCES_DIR "/dtmc/leader-3-5.pm"},
+                                             {"Mdp_coin2-2", STORM_TEST_RESOURCES_DIR "/mdp/coin2-2.nm"},
+                                             {"Mdp_csma2_2", STORM_TEST_RESOURCES_DIR "/mdp/csma2_2.nm"},
+                                             {"Mdp_leader4", STORM_TEST_RESOURCES_DIR "/mdp/leader4.nm"}};
+
+bool registerExplicitModelBuilderBenchmarks() {
+    for (auto const& model : prismModels) {
+        storm::benchmark::registerBenchmark("ExplicitModelBuilder." + model.name, [file = model.file](storm::benchmark::State& state) {
+            storm::prism::Program program = storm::parser::PrismParser::parse(file);
+            uint64_t numberOfStates = 0;
+            uint64_t numberOfTransitions = 0;
+            while (state.keepRunning()) {
+                auto builtModel = storm::builder::ExplicitModelBuilder<double>(program).build();
+                numberOfStates = builtModel->getNumberOfStates();
+                numberOfTransitions = builtModel->getNumberOfTransitions();
+            }
+            state.setItemsProcessed(state.getIterations() * numberOfStates);
+            state.setCounter("states", numberOfStates);
+            state.setCounter("transitions", numberOfTransitions);
+        });
+    }
+    return true;
+}
+
+[[maybe_unused]] bool const explicitModelBuilderBenchmarksRegistered = registerExplicitModelBuilderBenchmarks();
+
+}  // namespace
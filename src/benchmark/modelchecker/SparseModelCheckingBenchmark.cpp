@@ -0,0 +1,52 @@
+#include "benchmark/storm_benchmark.h"
+#include "storm-config.h"
+
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm/api/storm.h"
+#include "storm/environment/Environment.h"
+#include "storm/modelchecker/results/CheckResult.h"
+#include "storm/models/sparse/Model.h"
+#include "storm/storage/jani/Property.h"
+
+namespace {
+
+struct ModelCheckingQuery {
+    std::string name;
+    std::string file;
+    std::string property;
+};
+
+std::vector<ModelCheckingQuery> const queries = {
+    {"Dtmc_brp-16-2", STORM_TEST_RESOURCES_DIR "/dtmc/brp-16-2.pm", "P=? [ F \"target\" ]"},
+    {"Dtmc_crowds-5-5", STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm", "P=? [ F \"observe0Greater1\" ]"},
+    {"Mdp_csma2_2", STORM_TEST_RESOURCES_DIR "/mdp/csma2_2.nm", "Pmax=? [ F \"all_delivered\" ]"},
+    {"Mdp_leader4", STORM_TEST_RESOURCES_DIR "/mdp/leader4.nm", "Pmin=? [ F \"elected\" ]"}};
+
+/*!
+ * Measures the entire pipeline, i.e., parsing the model and the property, building the model and checking the property.
+ */
+bool registerSparseModelCheckingBenchmarks() {
+    for (auto const& query : queries) {
+        storm::benchmark::registerBenchmark("SparseModelChecking." + query.name, [query](storm::benchmark::State& state) {
+            storm::Environment env;
+            uint64_t numberOfStates = 0;
+            while (state.keepRunning()) {
+                storm::prism::Program program = storm::api::parseProgram(query.file);
+                auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(query.property, program));
+                auto model = storm::api::buildSparseModel<double>(program, formulas);
+                auto result = storm::api::verifyWithSparseEngine<double>(env, model, storm::api::createTask<double>(formulas.front(), true));
+                if (!result) {
+                    state.skipWithError("Model checking did not yield a result.");
+                    return;
+                }
+                numberOfStates = model->getNumberOfStates();
+            }
+            state.setCounter("states", numberOfStates);
+        });
+    }
+    return true;
+}
+
+[[maybe_unused]] bool const sparseModelCheckingBenchmarksRegistered = registerSparseModelCheckingBenchmarks();
+
+}  // namespace
@@ -0,0 +1,39 @@
+#include "benchmark/storm_benchmark.h"
+#include "storm-config.h"
+
+#include "storm-parsers/parser/DirectEncodingParser.h"
+#include "storm/models/sparse/Model.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+
+namespace {
+
+struct DrnModel {
+    std::string name;
+    std::string file;
+};
+
+std::vector<DrnModel> const drnModels = {{"Ctmc_cluster2", STORM_TEST_RESOURCES_DIR "/ctmc/cluster2.drn"},
+                                         {"Dtmc_crowds-5-5", STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.drn"},
+                                         {"Mdp_two_dice", STORM_TEST_RESOURCES_DIR "/mdp/two_dice.drn"}};
+
+bool registerDirectEncodingParserBenchmarks() {
+    for (auto const& model : drnModels) {
+        storm::benchmark::registerBenchmark("DirectEncodingParser." + model.name, [file = model.file](storm::benchmark::State& state) {
+            uint64_t numberOfStates = 0;
+            uint64_t numberOfTransitions = 0;
+            while (state.keepRunning()) {
+                auto parsedModel = storm::parser::DirectEncodingParser<double>::parseModel(file);
+                numberOfStates = parsedModel->getNumberOfStates();
+                numberOfTransitions = parsedModel->getNumberOfTransitions();
+            }
+            state.setItemsProcessed(state.getIterations() * numberOfTransitions);
+            state.setCounter("states", numberOfStates);
+            state.setCounter("transitions", numberOfTransitions);
+        });
+    }
+    return true;
+}
+
+[[maybe_unused]] bool const directEncodingParserBenchmarksRegistered = registerDirectEncodingParserBenchmarks();
+
+}  // namespace
@@ -0,0 +1,96 @@
+#include "benchmark/storm_benchmark.h"
+
+#include <random>
+
+#include "storm/storage/BitVector.h"
+
+namespace {
+
+storm::storage::BitVector createRandomBitVector(uint64_t length, double density, uint64_t seed) {
+    std::mt19937_64 generator(seed);
+    std::bernoulli_distribution distribution(density);
+    storm::storage::BitVector result(length);
+    for (uint64_t index = 0; index < length; ++index) {
+        if (distribution(generator)) {
+            result.set(index);
+        }
+    }
+    return result;
+}
+
+uint64_t const BitVectorLength = 1ull << 24;
+
+}  // namespace
+
+STORM_BENCHMARK(BitVector, And) {
+    auto first = createRandomBitVector(BitVectorLength, 0.5, 1);
+    auto second = createRandomBitVector(BitVectorLength, 0.5, 2);
+    while (state.keepRunning()) {
+        auto result = first & second;
+    }
+    state.setItemsProcessed(state.getIterations() * BitVectorLength);
+}
+
+STORM_BENCHMARK(BitVector, OrInPlace) {
+    auto first = createRandomBitVector(BitVectorLength, 0.5, 1);
+    auto second = createRandomBitVector(BitVectorLength, 0.5, 2);
+    while (state.keepRunning()) {
+        first |= second;
+    }
+    state.setItemsProcessed(state.getIterations() * BitVectorLength);
+}
+
+STORM_BENCHMARK(BitVector, Complement) {
+    auto vector = createRandomBitVector(BitVectorLength, 0.5, 1);
+    while (state.keepRunning()) {
+        vector.complement();
+    }
+    state.setItemsProcessed(state.getIterations() * BitVectorLength);
+}
+
+STORM_BENCHMARK(BitVector, IsSubsetOf) {
+    auto first = createRandomBitVector(BitVectorLength, 0.5, 1);
+    auto second = first | createRandomBitVector(BitVectorLength, 0.5, 2);
+    bool result = true;
+    while (state.keepRunning()) {
+        result &= first.isSubsetOf(second);
+    }
+    if (!result) {
+        state.skipWithError("Unexpected result.");
+    }
+    state.setItemsProcessed(state.getIterations() * BitVectorLength);
+}
+
+STORM_BENCHMARK(BitVector, GetNumberOfSetBits) {
+    auto vector = createRandomBitVector(BitVectorLength, 0.5, 1);
+    uint64_t sum = 0;
+    while (state.keepRunning()) {
+        sum += vector.getNumberOfSetBits();
+    }
+    state.setItemsProcessed(state.getIterations() * BitVectorLength);
+    state.setCounter("setBits", static_cast<double>(sum / state.getIterations()));
+}
+
+STORM_BENCHMARK(BitVector, IterateSparse) {
+    auto vector = createRandomBitVector(BitVectorLength, 0.01, 1);
+    uint64_t sum = 0;
+    while (state.keepRunning()) {
+        for (auto index : vector) {
+            sum += index;
+        }
+    }
+    state.setItemsProcessed(state.getIterations() * BitVectorLength);
+    state.setCounter("checksum", static_cast<double>(sum % 1000));
+}
+
+STORM_BENCHMARK(BitVector, IterateDense) {
+    auto vector = createRandomBitVector(BitVectorLength, 0.5, 1);
+    uint64_t sum = 0;
+    while (state.keepRunning()) {
+        for (auto index : vector) {
+            sum += index;
+        }
+    }
+    state.setItemsProcessed(state.getIterations() * BitVectorLength);
+    state.setCounter("checksum", static_cast<double>(sum % 1000));
+}
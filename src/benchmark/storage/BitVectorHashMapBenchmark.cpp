@@ -0,0 +1,68 @@
+#include "benchmark/storm_benchmark.h"
+
+#include <random>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/BitVectorHashMap.h"
+#include "storm/storage/ConcurrentBitVectorHashMap.h"
+
+namespace {
+
+uint64_t const NumberOfKeys = 1000000;
+uint64_t const KeyLength = 128;
+
+/*!
+ * Creates keys that resemble compressed states, i.e. bit vectors in which only some of the bits vary.
+ */
+std::vector<storm::storage::BitVector> createKeys() {
+    std::mt19937_64 generator(42);
+    std::vector<storm::storage::BitVector> keys;
+    keys.reserve(NumberOfKeys);
+    for (uint64_t index = 0; index < NumberOfKeys; ++index) {
+        storm::storage::BitVector key(KeyLength);
+        key.setFromInt(0, 64, generator());
+        key.setFromInt(64, 20, index % (1ull << 20));
+        keys.push_back(std::move(key));
+    }
+    return keys;
+}
+
+}  // namespace
+
+STORM_BENCHMARK(BitVectorHashMap, FindOrAdd) {
+    auto keys = createKeys();
+    while (state.keepRunning()) {
+        storm::storage::BitVectorHashMap<uint64_t> map(KeyLength, 1000);
+        for (uint64_t index = 0; index < NumberOfKeys; ++index) {
+            map.findOrAdd(keys[index], index);
+        }
+    }
+    state.setItemsProcessed(state.getIterations() * NumberOfKeys);
+}
+
+STORM_BENCHMARK(BitVectorHashMap, Find) {
+    auto keys = createKeys();
+    storm::storage::BitVectorHashMap<uint64_t> map(KeyLength, 1000);
+    for (uint64_t index = 0; index < NumberOfKeys; ++index) {
+        map.findOrAdd(keys[index], index);
+    }
+    uint64_t sum = 0;
+    while (state.keepRunning()) {
+        for (auto const& key : keys) {
+            sum += map.getValue(key);
+        }
+    }
+    state.setItemsProcessed(state.getIterations() * NumberOfKeys);
+    state.setCounter("checksum", static_cast<double>(sum % 1000));
+}
+
+STORM_BENCHMARK(ConcurrentBitVectorHashMap, FindOrAdd) {
+    auto keys = createKeys();
+    while (state.keepRunning()) {
+        storm::storage::ConcurrentBitVectorHashMap<uint64_t> map(KeyLength, 1000);
+        for (uint64_t index = 0; index < NumberOfKeys; ++index) {
+            map.findOrAdd(keys[index], index);
+        }
+    }
+    state.setItemsProcessed(state.getIterations() * NumberOfKeys);
+}
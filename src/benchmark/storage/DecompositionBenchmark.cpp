@@ -0,0 +1,41 @@
+#include "benchmark/RandomMatrix.h"
+#include "benchmark/storm_benchmark.h"
+
+#include "storm/storage/MaximalEndComponentDecomposition.h"
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
+
+STORM_BENCHMARK(StronglyConnectedComponentDecomposition, RandomDtmc) {
+    auto matrix = storm::benchmark::createRandomMatrix(1000000, 1, 3);
+    uint64_t numberOfSccs = 0;
+    while (state.keepRunning()) {
+        storm::storage::StronglyConnectedComponentDecomposition<double> decomposition(matrix);
+        numberOfSccs = decomposition.size();
+    }
+    state.setItemsProcessed(state.getIterations() * matrix.getRowGroupCount());
+    state.setCounter("sccs", numberOfSccs);
+}
+
+STORM_BENCHMARK(StronglyConnectedComponentDecomposition, RandomDtmcNonTrivialOnly) {
+    auto matrix = storm::benchmark::createRandomMatrix(1000000, 1, 3);
+    storm::storage::StronglyConnectedComponentDecompositionOptions options;
+    options.dropNaiveSccs();
+    uint64_t numberOfSccs = 0;
+    while (state.keepRunning()) {
+        storm::storage::StronglyConnectedComponentDecomposition<double> decomposition(matrix, options);
+        numberOfSccs = decomposition.size();
+    }
+    state.setItemsProcessed(state.getIterations() * matrix.getRowGroupCount());
+    state.setCounter("sccs", numberOfSccs);
+}
+
+STORM_BENCHMARK(MaximalEndComponentDecomposition, RandomMdp) {
+    auto matrix = storm::benchmark::createRandomMatrix(200000, 3, 3);
+    auto backwardTransitions = matrix.transpose(true);
+    uint64_t numberOfMecs = 0;
+    while (state.keepRunning()) {
+        storm::storage::MaximalEndComponentDecomposition<double> decomposition(matrix, backwardTransitions);
+        numberOfMecs = decomposition.size();
+    }
+    state.setItemsProcessed(state.getIterations() * matrix.getRowGroupCount());
+    state.setCounter("mecs", numberOfMecs);
+}
@@ -0,0 +1,47 @@
+#include "benchmark/RandomMatrix.h"
+#include "benchmark/storm_benchmark.h"
+
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/storage/SparseMatrix.h"
+
+STORM_BENCHMARK(SparseMatrix, MultiplyWithVector) {
+    auto matrix = storm::benchmark::createRandomMatrix(1000000, 1, 4);
+    std::vector<double> x(matrix.getColumnCount(), 0.5);
+    std::vector<double> result(matrix.getRowCount());
+    while (state.keepRunning()) {
+        matrix.multiplyWithVector(x, result);
+    }
+    state.setItemsProcessed(state.getIterations() * matrix.getEntryCount());
+    state.setCounter("entries", matrix.getEntryCount());
+}
+
+STORM_BENCHMARK(SparseMatrix, MultiplyWithVectorAndSummand) {
+    auto matrix = storm::benchmark::createRandomMatrix(1000000, 1, 4);
+    std::vector<double> x(matrix.getColumnCount(), 0.5);
+    std::vector<double> summand(matrix.getRowCount(), 0.1);
+    std::vector<double> result(matrix.getRowCount());
+    while (state.keepRunning()) {
+        matrix.multiplyWithVector(x, result, &summand);
+    }
+    state.setItemsProcessed(state.getIterations() * matrix.getEntryCount());
+    state.setCounter("entries", matrix.getEntryCount());
+}
+
+STORM_BENCHMARK(SparseMatrix, MultiplyAndReduce) {
+    auto matrix = storm::benchmark::createRandomMatrix(250000, 4, 4);
+    std::vector<double> x(matrix.getColumnCount(), 0.5);
+    std::vector<double> result(matrix.getRowGroupCount());
+    while (state.keepRunning()) {
+        matrix.multiplyAndReduce(storm::solver::OptimizationDirection::Maximize, matrix.getRowGroupIndices(), x, nullptr, result, nullptr);
+    }
+    state.setItemsProcessed(state.getIterations() * matrix.getEntryCount());
+    state.setCounter("entries", matrix.getEntryCount());
+}
+
+STORM_BENCHMARK(SparseMatrix, Transpose) {
+    auto matrix = storm::benchmark::createRandomMatrix(250000, 4, 4);
+    while (state.keepRunning()) {
+        auto transposed = matrix.transpose(true);
+    }
+    state.setItemsProcessed(state.getIterations() * matrix.getEntryCount());
+}
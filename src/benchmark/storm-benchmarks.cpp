@@ -0,0 +1,11 @@
+#include "benchmark/storm_benchmark.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/utility/initialize.h"
+
+int main(int argc, char** argv) {
+    storm::settings::initializeAll("Storm Benchmark Suite", "storm-benchmarks");
+    storm::utility::initializeLogger();
+    // Only enable error output by default.
+    storm::utility::setLogLevel(l3pp::LogLevel::ERR);
+    return storm::benchmark::runBenchmarks(argc, argv);
+}
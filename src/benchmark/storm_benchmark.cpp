@@ -0,0 +1,358 @@
+#include "benchmark/storm_benchmark.h"
+
+#include <algorithm>
+#include <cmath>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <regex>
+#include <sstream>
+
+#include "storm-version-info/storm-version.h"
+#include "storm/adapters/JsonAdapter.h"
+#include "storm/io/file.h"
+#include "storm/utility/threads.h"
+
+namespace storm {
+namespace benchmark {
+
+State::State(uint64_t iterations)
+    : iterations(iterations), completedIterations(0), started(false), timing(false), elapsedTime(Clock::duration::zero()) {
+    // Intentionally left empty.
+}
+
+bool State::keepRunning() {
+    if (!started) {
+        started = true;
+        resumeTiming();
+    } else {
+        ++completedIterations;
+    }
+    if (completedIterations < iterations && !error) {
+        return true;
+    }
+    pauseTiming();
+    return false;
+}
+
+void State::pauseTiming() {
+    if (timing) {
+        elapsedTime += Clock::now() - startOfTiming;
+        timing = false;
+    }
+}
+
+void State::resumeTiming() {
+    if (!timing) {
+        startOfTiming = Clock::now();
+        timing = true;
+    }
+}
+
+void State::setItemsProcessed(uint64_t items) {
+    itemsProcessed = items;
+}
+
+void State::setCounter(std::string const& name, double value) {
+    counters[name] = value;
+}
+
+void State::skipWithError(std::string const& message) {
+    pauseTiming();
+    error = message;
+}
+
+uint64_t State::getIterations() const {
+    return iterations;
+}
+
+uint64_t State::getCompletedIterations() const {
+    return completedIterations;
+}
+
+State::Clock::duration State::getElapsedTime() const {
+    return elapsedTime;
+}
+
+std::optional<uint64_t> const& State::getItemsProcessed() const {
+    return itemsProcessed;
+}
+
+std::map<std::string, double> const& State::getCounters() const {
+    return counters;
+}
+
+std::optional<std::string> const& State::getError() const {
+    return error;
+}
+
+namespace {
+
+struct Benchmark {
+    std::string name;
+    BenchmarkFunction function;
+};
+
+std::vector<Benchmark>& getRegisteredBenchmarks() {
+    // Function-local static to avoid problems with the initialization order of the registering static variables.
+    static std::vector<Benchmark> benchmarks;
+    return benchmarks;
+}
+
+struct Options {
+    std::string filter = ".*";
+    double minimalTime = 0.5;
+    uint64_t repetitions = 1;
+    std::optional<std::string> jsonOutputFile;
+    bool list = false;
+};
+
+struct RunResult {
+    uint64_t iterations;
+    double secondsPerIteration;
+    std::optional<double> itemsPerSecond;
+    std::map<std::string, double> counters;
+    std::optional<std::string> error;
+};
+
+void printUsage(std::string const& programName) {
+    std::cout << "Usage: " << programName << " [options]\n"
+              << "Options:\n"
+              << "  --filter=<regex>        Only run the benchmarks whose name matches the given regular expression.\n"
+              << "  --min-time=<seconds>    Minimal time that each benchmark is run (default: 0.5).\n"
+              << "  --repetitions=<n>       Number of repetitions of each benchmark (default: 1).\n"
+              << "  --json=<file>           Writes the results in JSON format to the given file.\n"
+              << "  --list                  Only lists the names of the benchmarks.\n"
+              << "  --help                  Prints this help message.\n";
+}
+
+std::optional<Options> parseOptions(int argc, char** argv) {
+    Options options;
+    for (int i = 1; i < argc; ++i) {
+        std::string const argument(argv[i]);
+        auto getValue = [&argument]() { return argument.substr(argument.find('=') + 1); };
+        if (argument.rfind("--filter=", 0) == 0) {
+            options.filter = getValue();
+        } else if (argument.rfind("--min-time=", 0) == 0) {
+            options.minimalTime = std::stod(getValue());
+        } else if (argument.rfind("--repetitions=", 0) == 0) {
+            options.repetitions = std::max<uint64_t>(1, std::stoull(getValue()));
+        } else if (argument.rfind("--json=", 0) == 0) {
+            options.jsonOutputFile = getValue();
+        } else if (argument == "--list") {
+            options.list = true;
+        } else {
+            if (argument != "--help") {
+                std::cerr << "Unknown argument: " << argument << '\n';
+            }
+            printUsage(argv[0]);
+            return std::nullopt;
+        }
+    }
+    return options;
+}
+
+RunResult run(Benchmark const& benchmark, uint64_t iterations) {
+    State state(iterations);
+    try {
+        benchmark.function(state);
+    } catch (std::exception const& e) {
+        state.skipWithError(e.what());
+    }
+    if (!state.getError() && state.getCompletedIterations() != iterations) {
+        state.skipWithError("The benchmark did not run the expected number of iterations.");
+    }
+
+    RunResult result;
+    result.iterations = state.getCompletedIterations();
+    double const seconds = std::chrono::duration<double>(state.getElapsedTime()).count();
+    result.secondsPerIteration = result.iterations > 0 ? seconds / result.iterations : 0.0;
+    if (state.getItemsProcessed() && seconds > 0.0) {
+        result.itemsPerSecond = *state.getItemsProcessed() / seconds;
+    }
+    result.counters = state.getCounters();
+    result.error = state.getError();
+    return result;
+}
+
+/*!
+ * Runs the benchmark with an increasing number of iterations until the measured time is at least the given minimal time.
+ */
+RunResult runCalibrated(Benchmark const& benchmark, double minimalTime) {
+    uint64_t const maximalIterations = 1000000000;
+    uint64_t iterations = 1;
+    while (true) {
+        RunResult result = run(benchmark, iterations);
+        double const seconds = result.secondsPerIteration * result.iterations;
+        if (result.error || seconds >= minimalTime || iterations >= maximalIterations) {
+            return result;
+        }
+        // Aim a bit higher than the minimal time so that the next run most likely suffices.
+        double const factor = seconds > 0.0 ? std::clamp(1.4 * minimalTime / seconds, 2.0, 10.0) : 10.0;
+        iterations = std::min<uint64_t>(maximalIterations, static_cast<uint64_t>(std::ceil(iterations * factor)));
+    }
+}
+
+std::string formatTime(double seconds) {
+    std::stringstream stream;
+    stream << std::fixed << std::setprecision(3);
+    if (seconds >= 1.0) {
+        stream << seconds << " s";
+    } else if (seconds >= 1e-3) {
+        stream << seconds * 1e3 << " ms";
+    } else if (seconds >= 1e-6) {
+        stream << seconds * 1e6 << " us";
+    } else {
+        stream << seconds * 1e9 << " ns";
+    }
+    return stream.str();
+}
+
+void printResult(std::string const& name, RunResult const& result) {
+    std::cout << std::left << std::setw(60) << name << ' ';
+    if (result.error) {
+        std::cout << "ERROR: " << *result.error << '\n';
+        return;
+    }
+    std::cout << std::right << std::setw(14) << formatTime(result.secondsPerIteration) << std::setw(12) << result.iterations;
+    if (result.itemsPerSecond) {
+        std::cout << "  " << std::scientific << std::setprecision(3) << *result.itemsPerSecond << " items/s" << std::defaultfloat;
+    }
+    for (auto const& [counterName, value] : result.counters) {
+        std::cout << "  " << counterName << "=" << value;
+    }
+    std::cout << '\n';
+}
+
+storm::json<double> resultToJson(std::string const& name, std::string const& runName, uint64_t repetitionIndex, RunResult const& result) {
+    storm::json<double> entry;
+    entry["name"] = runName;
+    entry["run_name"] = name;
+    entry["run_type"] = "iteration";
+    entry["repetition_index"] = repetitionIndex;
+    if (result.error) {
+        entry["error_occurred"] = true;
+        entry["error_message"] = *result.error;
+        return entry;
+    }
+    entry["iterations"] = result.iterations;
+    entry["real_time"] = result.secondsPerIteration * 1e9;
+    entry["time_unit"] = "ns";
+    if (result.itemsPerSecond) {
+        entry["items_per_second"] = *result.itemsPerSecond;
+    }
+    for (auto const& [counterName, value] : result.counters) {
+        entry[counterName] = value;
+    }
+    return entry;
+}
+
+storm::json<double> aggregateToJson(std::string const& name, std::vector<RunResult> const& results) {
+    double sum = 0.0;
+    double minimum = results.front().secondsPerIteration;
+    double maximum = results.front().secondsPerIteration;
+    for (auto const& result : results) {
+        sum += result.secondsPerIteration;
+        minimum = std::min(minimum, result.secondsPerIteration);
+        maximum = std::max(maximum, result.secondsPerIteration);
+    }
+    double const mean = sum / results.size();
+    double squaredDeviations = 0.0;
+    for (auto const& result : results) {
+        squaredDeviations += (result.secondsPerIteration - mean) * (result.secondsPerIteration - mean);
+    }
+    storm::json<double> entry;
+    entry["name"] = name + "_mean";
+    entry["run_name"] = name;
+    entry["run_type"] = "aggregate";
+    entry["repetitions"] = results.size();
+    entry["real_time"] = mean * 1e9;
+    entry["real_time_min"] = minimum * 1e9;
+    entry["real_time_max"] = maximum * 1e9;
+    entry["real_time_stddev"] = (results.size() > 1 ? std::sqrt(squaredDeviations / (results.size() - 1)) : 0.0) * 1e9;
+    entry["time_unit"] = "ns";
+    return entry;
+}
+
+storm::json<double> getContext() {
+    storm::json<double> context;
+    std::time_t const now = std::time(nullptr);
+    char date[64];
+    std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S%z", std::localtime(&now));
+    context["date"] = std::string(date);
+    context["storm_version"] = storm::StormVersion::shortVersionString();
+    context["git_revision"] = storm::StormVersion::gitRevisionHash;
+    context["compiler"] = storm::StormVersion::cxxCompiler;
+    context["compiler_flags"] = storm::StormVersion::cxxFlags;
+    context["num_cpus"] = storm::utility::getNumberOfThreads();
+    return context;
+}
+
+}  // namespace
+
+bool registerBenchmark(std::string const& name, BenchmarkFunction const& function) {
+    getRegisteredBenchmarks().push_back({name, function});
+    return true;
+}
+
+int runBenchmarks(int argc, char** argv) {
+    auto options = parseOptions(argc, argv);
+    if (!options) {
+        return 1;
+    }
+    std::regex const filter(options->filter);
+    std::vector<Benchmark> benchmarks;
+    for (auto const& benchmark : getRegisteredBenchmarks()) {
+        if (std::regex_search(benchmark.name, filter)) {
+            benchmarks.push_back(benchmark);
+        }
+    }
+    std::sort(benchmarks.begin(), benchmarks.end(), [](Benchmark const& lhs, Benchmark const& rhs) { return lhs.name < rhs.name; });
+
+    if (options->list) {
+        for (auto const& benchmark : benchmarks) {
+            std::cout << benchmark.name << '\n';
+        }
+        return 0;
+    }
+
+    std::cout << std::left << std::setw(60) << "Benchmark" << ' ' << std::right << std::setw(14) << "Time" << std::setw(12) << "Iterations" << '\n';
+    std::cout << std::string(86, '-') << '\n';
+    storm::json<double> jsonResults = storm::json<double>::array();
+    bool errorOccurred = false;
+    for (auto const& benchmark : benchmarks) {
+        std::vector<RunResult> results;
+        results.push_back(runCalibrated(benchmark, options->minimalTime));
+        // Subsequent repetitions use the same number of iterations as the calibrated run.
+        while (results.size() < options->repetitions && !results.front().error) {
+            results.push_back(run(benchmark, results.front().iterations));
+        }
+        for (uint64_t repetition = 0; repetition < results.size(); ++repetition) {
+            std::string const runName = results.size() > 1 ? benchmark.name + "/repetition:" + std::to_string(repetition) : benchmark.name;
+            printResult(runName, results[repetition]);
+            jsonResults.push_back(resultToJson(benchmark.name, runName, repetition, results[repetition]));
+            errorOccurred |= results[repetition].error.has_value();
+        }
+        if (results.size() > 1) {
+            auto aggregate = aggregateToJson(benchmark.name, results);
+            std::cout << std::left << std::setw(60) << (benchmark.name + "_mean") << ' ' << std::right << std::setw(14)
+                      << formatTime(aggregate["real_time"].get<double>() * 1e-9) << '\n';
+            jsonResults.push_back(std::move(aggregate));
+        }
+    }
+
+    if (options->jsonOutputFile) {
+        storm::json<double> output;
+        output["context"] = getContext();
+        output["benchmarks"] = std::move(jsonResults);
+        std::ofstream stream;
+        storm::utility::openFile(*options->jsonOutputFile, stream, false, true);
+        stream << storm::dumpJson(output) << '\n';
+        storm::utility::closeFile(stream);
+    }
+    return errorOccurred ? 1 : 0;
+}
+
+}  // namespace benchmark
+}  // namespace storm
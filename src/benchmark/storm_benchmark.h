@@ -0,0 +1,118 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace storm {
+namespace benchmark {
+
+/*!
+ * The state of a single benchmark run. The benchmarked code is executed as long as keepRunning() returns true, i.e.
+ *
+ *     STORM_BENCHMARK(Group, Name) {
+ *         // set up (not measured)
+ *         while (state.keepRunning()) {
+ *             // measured code
+ *         }
+ *     }
+ */
+class State {
+   public:
+    using Clock = std::chrono::steady_clock;
+
+    /*!
+     * @param iterations the number of times the benchmarked code is to be executed.
+     */
+    explicit State(uint64_t iterations);
+
+    /*!
+     * Returns true iff the benchmarked code has to be executed (once more). The first call starts the time measurement.
+     */
+    bool keepRunning();
+
+    /*!
+     * Pauses the time measurement, e.g. to exclude the preparation of the next iteration.
+     */
+    void pauseTiming();
+
+    /*!
+     * Resumes the time measurement after pauseTiming() was called.
+     */
+    void resumeTiming();
+
+    /*!
+     * Sets the number of items (e.g. states or matrix entries) that were processed in total. This is used to report a throughput.
+     */
+    void setItemsProcessed(uint64_t items);
+
+    /*!
+     * Sets a user-defined counter that is reported together with the results, e.g. the size of the considered model.
+     */
+    void setCounter(std::string const& name, double value);
+
+    /*!
+     * Stops the benchmark and marks the run as erroneous. The benchmark function should return immediately afterwards.
+     */
+    void skipWithError(std::string const& message);
+
+    /*!
+     * @return the number of times the benchmarked code is to be executed.
+     */
+    uint64_t getIterations() const;
+
+    /*!
+     * @return the number of completed iterations
+     */
+    uint64_t getCompletedIterations() const;
+
+    /*!
+     * @return the measured time
+     */
+    Clock::duration getElapsedTime() const;
+
+    std::optional<uint64_t> const& getItemsProcessed() const;
+    std::map<std::string, double> const& getCounters() const;
+    std::optional<std::string> const& getError() const;
+
+   private:
+    uint64_t iterations;
+    uint64_t completedIterations;
+    bool started;
+    bool timing;
+    Clock::time_point startOfTiming;
+    Clock::duration elapsedTime;
+    std::optional<uint64_t> itemsProcessed;
+    std::map<std::string, double> counters;
+    std::optional<std::string> error;
+};
+
+using BenchmarkFunction = std::function<void(State&)>;
+
+/*!
+ * Registers a benchmark with the given name. Benchmarks are typically registered via the STORM_BENCHMARK macro.
+ * @return true (so that the result can be used to initialize a static variable)
+ */
+bool registerBenchmark(std::string const& name, BenchmarkFunction const& function);
+
+/*!
+ * Runs the registered benchmarks according to the given command line arguments and prints the results.
+ * @return the exit code of the benchmark program
+ */
+int runBenchmarks(int argc, char** argv);
+
+}  // namespace benchmark
+}  // namespace storm
+
+/*!
+ * Defines and registers a benchmark with the name "group.name". Within the body, the benchmark state is available as `state`.
+ */
+#define STORM_BENCHMARK(group, name)                                                                                 \
+    static void group##_##name##_Benchmark(storm::benchmark::State& state);                                          \
+    [[maybe_unused]] static bool const group##_##name##_Registered =                                                 \
+        storm::benchmark::registerBenchmark(#group "." #name, group##_##name##_Benchmark);                           \
+    static void group##_##name##_Benchmark(storm::benchmark::State& state)
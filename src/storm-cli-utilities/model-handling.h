@@ -469,6 +469,14 @@ inline storm::builder::BuilderOptions createBuildOptionsSparseFromSettings(Symbo
         options.setExplorationChecks();
     }
     options.setReservedBitsForUnboundedVariables(buildSettings.getBitsForUnboundedVariables());
+    if (buildSettings.isJitSet()) {
+        options.setJitCompilation();
+        options.setJitCompiler(buildSettings.getJitCompiler());
+        if (buildSettings.isJitCacheDirectorySet()) {
+            options.setJitCacheDirectory(buildSettings.getJitCacheDirectory());
+        }
+    }
+    options.setBytecodeEvaluation(buildSettings.isBytecodeSet());
 
     options.setAddOutOfBoundsState(buildSettings.isBuildOutOfBoundsStateSet());
     if (buildSettings.isBuildFullModelSet()) {
@@ -507,7 +515,10 @@ std::shared_ptr<storm::models::ModelBase> buildModelExplicit(storm::settings::mo
     } else if (ioSettings.isExplicitDRNSet()) {
         storm::parser::DirectEncodingParserOptions options;
         options.buildChoiceLabeling = buildSettings.isBuildChoiceLabelsSet();
+        options.numberOfThreads = ioSettings.getNumberOfDrnParserThreads();
         result = storm::api::buildExplicitDRNModel<ValueType>(ioSettings.getExplicitDRNFilename(), options);
+    } else if (ioSettings.isExplicitDRBSet()) {
+        result = storm::api::buildExplicitDRBModel<ValueType>(ioSettings.getExplicitDRBFilename());
     } else {
         STORM_LOG_THROW(ioSettings.isExplicitIMCASet(), storm::exceptions::InvalidSettingsException, "Unexpected explicit model input type.");
         result = storm::api::buildExplicitIMCAModel<ValueType>(ioSettings.getExplicitIMCAFilename());
@@ -529,7 +540,7 @@ std::shared_ptr<storm::models::ModelBase> buildModel(SymbolicInput const& input,
             auto options = createBuildOptionsSparseFromSettings(input);
             result = buildModelSparse<ValueType>(input, options);
         }
-    } else if (ioSettings.isExplicitSet() || ioSettings.isExplicitDRNSet() || ioSettings.isExplicitIMCASet()) {
+    } else if (ioSettings.isExplicitSet() || ioSettings.isExplicitDRNSet() || ioSettings.isExplicitDRBSet() || ioSettings.isExplicitIMCASet()) {
         STORM_LOG_THROW(mpi.engine == storm::utility::Engine::Sparse, storm::exceptions::InvalidSettingsException,
                         "Can only use sparse engine with explicit input.");
         result = buildModelExplicit<ValueType>(ioSettings, storm::settings::getModule<storm::settings::modules::BuildSettings>());
@@ -643,6 +654,9 @@ void exportSparseModel(std::shared_ptr<storm::models::sparse::Model<ValueType>>
                                                    input.model ? input.model.get().getParameterNames() : std::vector<std::string>(),
                                                    !ioSettings.isExplicitExportPlaceholdersDisabled());
                 break;
+            case storm::exporter::ModelExportFormat::Drb:
+                storm::api::exportSparseModelAsDrb(model, ioSettings.getExportBuildFilename());
+                break;
             case storm::exporter::ModelExportFormat::Json:
                 storm::api::exportSparseModelAsJson(model, ioSettings.getExportBuildFilename());
                 break;
@@ -1099,6 +1113,54 @@ void computeStateValues(std::string const& description, std::function<std::uniqu
     }
 }
 
+/*!
+ * Checks all (potentially preprocessed) time-bounded reachability properties given in `input` for each of the given time bounds, which replace the time
+ * bounds of the properties. The results for all time bounds of a property are computed in a single pass.
+ * @param sparseModel The (continuous-time) model to check
+ * @param input Where the properties are read from
+ * @param timeBounds The time bounds in ascending order
+ */
+template<typename ValueType>
+void verifyPropertiesForTimeBounds(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& sparseModel, SymbolicInput const& input,
+                                   ModelProcessingInformation const& mpi, std::vector<double> const& timeBounds) {
+    auto const& properties = input.preprocessedProperties ? input.preprocessedProperties.get() : input.properties;
+    for (auto const& property : properties) {
+        printModelCheckingProperty(property);
+        storm::utility::Stopwatch watch(true);
+        std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> results;
+        try {
+            auto const& states = property.getFilter().getStatesFormula();
+            bool filterForInitialStates = states->isInitialFormula();
+            results = storm::api::verifyForTimeBoundsWithSparseEngine<ValueType>(
+                mpi.env, sparseModel, storm::api::createTask<ValueType>(property.getRawFormula(), filterForInitialStates), timeBounds);
+
+            std::unique_ptr<storm::modelchecker::CheckResult> filter;
+            if (filterForInitialStates) {
+                filter = std::make_unique<storm::modelchecker::ExplicitQualitativeCheckResult>(sparseModel->getInitialStates());
+            } else if (!states->isTrueFormula()) {  // No need to apply filter if it is the formula 'true'
+                filter = storm::api::verifyWithSparseEngine<ValueType>(mpi.env, sparseModel, storm::api::createTask<ValueType>(states, false));
+            }
+            if (filter) {
+                for (auto& result : results) {
+                    result->filter(filter->asQualitativeCheckResult());
+                }
+            }
+        } catch (storm::exceptions::BaseException const& ex) {
+            STORM_LOG_WARN("Cannot handle property: " << ex.what());
+            results.clear();
+        }
+        watch.stop();
+        if (results.empty()) {
+            printResult<ValueType>(nullptr, property);
+            continue;
+        }
+        for (uint64_t boundIndex = 0; boundIndex < results.size(); ++boundIndex) {
+            STORM_PRINT("Time bound " << timeBounds[boundIndex] << ": ");
+            printResult<ValueType>(results[boundIndex], property, boundIndex + 1 == results.size() ? &watch : nullptr);
+        }
+    }
+}
+
 inline std::vector<storm::expressions::Expression> parseConstraints(storm::expressions::ExpressionManager const& expressionManager,
                                                                     std::string const& constraintsString) {
     std::vector<storm::expressions::Expression> constraints;
@@ -1200,6 +1262,19 @@ void verifyWithExplorationEngine(SymbolicInput const& input, ModelProcessingInfo
         });
 }
 
+template<typename ValueType>
+void verifyWithSmcEngine(SymbolicInput const& input, ModelProcessingInformation const& mpi) {
+    STORM_LOG_ASSERT(input.model, "Expected symbolic model description.");
+    STORM_LOG_THROW((std::is_same<ValueType, double>::value), storm::exceptions::NotSupportedException,
+                    "Statistical model checking does not support other data-types than floating points.");
+    verifyProperties<ValueType>(
+        input, [&input, &mpi](std::shared_ptr<storm::logic::Formula const> const& formula, std::shared_ptr<storm::logic::Formula const> const& states) {
+            STORM_LOG_THROW(states->isInitialFormula(), storm::exceptions::NotSupportedException,
+                            "Statistical model checking can only filter initial states.");
+            return storm::api::verifyWithSmcEngine<ValueType>(mpi.env, input.model.get(), storm::api::createTask<ValueType>(formula, true));
+        });
+}
+
 template<typename ValueType>
 void verifyWithSparseEngine(std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input, ModelProcessingInformation const& mpi) {
     auto sparseModel = model->as<storm::models::sparse::Model<ValueType>>();
@@ -1264,7 +1339,9 @@ void verifyWithSparseEngine(std::shared_ptr<storm::models::ModelBase> const& mod
         }
         ++exportCount;
     };
-    if (!(ioSettings.isComputeSteadyStateDistributionSet() || ioSettings.isComputeExpectedVisitingTimesSet())) {
+    if (ioSettings.isTimeBoundsSet()) {
+        verifyPropertiesForTimeBounds<ValueType>(sparseModel, input, mpi, ioSettings.getTimeBounds());
+    } else if (!(ioSettings.isComputeSteadyStateDistributionSet() || ioSettings.isComputeExpectedVisitingTimesSet())) {
         verifyProperties<ValueType>(input, verificationCallback, postprocessingCallback);
     }
     if (ioSettings.isComputeSteadyStateDistributionSet()) {
@@ -1415,6 +1492,8 @@ void processInputWithValueTypeAndDdlib(SymbolicInput const& input, ModelProcessi
         verifyWithAbstractionRefinementEngine<DdType, VerificationValueType>(input, mpi);
     } else if (mpi.engine == storm::utility::Engine::Exploration) {
         verifyWithExplorationEngine<VerificationValueType>(input, mpi);
+    } else if (mpi.engine == storm::utility::Engine::Smc) {
+        verifyWithSmcEngine<VerificationValueType>(input, mpi);
     } else {
         std::shared_ptr<storm::models::ModelBase> model =
             buildPreprocessExportModelWithValueTypeAndDdlib<DdType, BuildValueType, VerificationValueType>(input, mpi);
@@ -115,6 +115,8 @@ void processOptions() {
         bool const probabilityAnalysis{ioSettings.isPropertySet() || !isImportanceMeasureSet};
         size_t const chunksize{faultTreeSettings.getChunksize()};
         bool const isModularisation{faultTreeSettings.useModularisation()};
+        size_t const modularisationThreads{faultTreeSettings.getModularisationThreads()};
+        bool const isMergeIsomorphicModules{faultTreeSettings.isMergeIsomorphicModules()};
 
         std::vector<double> timepoints{};
         if (isTimepoints) {
@@ -143,7 +145,7 @@ void processOptions() {
         auto const additionalRelevantEventNames{faultTreeSettings.getRelevantEvents()};
         storm::dft::api::analyzeDFTBdd<ValueType>(dft, isExportToBddDot, filename, isMTTF, mttfPrecision, mttfStepsize, mttfAlgorithm, isMinimalCutSets,
                                                   probabilityAnalysis, isModularisation, importanceMeasureName, timepoints, manuallyInputtedProperties,
-                                                  additionalRelevantEventNames, chunksize);
+                                                  additionalRelevantEventNames, chunksize, modularisationThreads, isMergeIsomorphicModules);
 
         // don't perform other analysis if analyzeWithBdds is set
         if (dftIOSettings.isAnalyzeWithBdds()) {
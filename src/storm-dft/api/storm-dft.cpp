@@ -24,17 +24,20 @@ void analyzeDFTBdd(std::shared_ptr<storm::dft::storage::DFT<double>> const& dft,
                    double const mttfPrecision, double const mttfStepsize, std::string const mttfAlgorithmName, bool const calculateMCS,
                    bool const calculateProbability, bool const useModularisation, std::string const importanceMeasureName,
                    std::vector<double> const& timepoints, std::vector<std::shared_ptr<storm::logic::Formula const>> const& properties,
-                   std::vector<std::string> const& additionalRelevantEventNames, size_t const chunksize) {
+                   std::vector<std::string> const& additionalRelevantEventNames, size_t const chunksize, size_t const numberOfThreads,
+                   bool const mergeIsomorphicModules) {
     if (calculateMttf) {
         if (mttfAlgorithmName == "proceeding") {
-            std::cout << "The numerically approximated MTTF is " << storm::dft::utility::MTTFHelperProceeding(dft, mttfStepsize, mttfPrecision) << '\n';
+            std::cout << "The numerically approximated MTTF is "
+                      << storm::dft::utility::MTTFHelperProceeding(dft, mttfStepsize, mttfPrecision, numberOfThreads, mergeIsomorphicModules) << '\n';
         } else if (mttfAlgorithmName == "variableChange") {
-            std::cout << "The numerically approximated MTTF is " << storm::dft::utility::MTTFHelperVariableChange(dft, mttfStepsize) << '\n';
+            std::cout << "The numerically approximated MTTF is "
+                      << storm::dft::utility::MTTFHelperVariableChange(dft, mttfStepsize, numberOfThreads, mergeIsomorphicModules) << '\n';
         }
     }
 
     if (useModularisation && calculateProbability) {
-        storm::dft::modelchecker::DftModularizationChecker checker{dft};
+        storm::dft::modelchecker::DftModularizationChecker checker{dft, numberOfThreads, mergeIsomorphicModules};
         if (chunksize == 1) {
             for (auto const& timebound : timepoints) {
                 auto const probability{checker.getProbabilityAtTimebound(timebound)};
@@ -166,7 +169,8 @@ void analyzeDFTBdd(std::shared_ptr<storm::dft::storage::DFT<storm::RationalFunct
                    bool const calculateMttf, double const mttfPrecision, double const mttfStepsize, std::string const mttfAlgorithmName,
                    bool const calculateMCS, bool const calculateProbability, bool const useModularisation, std::string const importanceMeasureName,
                    std::vector<double> const& timepoints, std::vector<std::shared_ptr<storm::logic::Formula const>> const& properties,
-                   std::vector<std::string> const& additionalRelevantEventNames, size_t const chunksize) {
+                   std::vector<std::string> const& additionalRelevantEventNames, size_t const chunksize, size_t const numberOfThreads,
+                   bool const mergeIsomorphicModules) {
     STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "BDD analysis is not supportet for this data type.");
 }
 
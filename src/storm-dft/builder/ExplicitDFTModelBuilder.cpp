@@ -934,10 +934,11 @@ StateType ExplicitDFTModelBuilder<ValueType, StateType>::getOrAddStateIndex(DFTS
                 // Create pseudo state now
                 STORM_LOG_ASSERT(iter->second.first->getId() == stateId, "Ids do not match.");
                 STORM_LOG_ASSERT(iter->second.first->status() == state->status(), "Pseudo states do not coincide.");
-                state->setId(stateId);
                 // Update mapping to map to concrete state now
-                // TODO: just change pointer?
-                statesNotExplored[stateId] = std::make_pair(state, iter->second.second);
+                // The given state is reused by the generator, so we store a copy
+                DFTStatePointer storedState = state->copy();
+                storedState->setId(stateId);
+                iter->second.first = storedState;
                 // We do not push the new state on the exploration queue as the pseudo state was already pushed
                 STORM_LOG_TRACE("Created pseudo state " << dft.getStateString(state));
             }
@@ -946,15 +947,17 @@ StateType ExplicitDFTModelBuilder<ValueType, StateType>::getOrAddStateIndex(DFTS
         // State does not exist yet
         STORM_LOG_ASSERT(state->isPseudoState() == changed, "State type (pseudo/concrete) wrong.");
         // Create new state
-        state->setId(newIndex++);
-        stateId = stateStorage.stateToId.findOrAdd(state->status(), state->getId());
-        STORM_LOG_ASSERT(stateId == state->getId(), "Ids do not match.");
+        // The given state is reused by the generator, so we store a copy. Only new states are copied.
+        DFTStatePointer storedState = state->copy();
+        storedState->setId(newIndex++);
+        stateId = stateStorage.stateToId.findOrAdd(storedState->status(), storedState->getId());
+        STORM_LOG_ASSERT(stateId == storedState->getId(), "Ids do not match.");
         // Insert state as not yet explored
         ExplorationHeuristicPointer nullHeuristic;
-        statesNotExplored[stateId] = std::make_pair(state, nullHeuristic);
+        statesNotExplored[stateId] = std::make_pair(storedState, nullHeuristic);
         // Reserve one slot for the new state in the remapping
         matrixBuilder.stateRemapping.push_back(0);
-        STORM_LOG_TRACE("New " << (state->isPseudoState() ? "pseudo" : "concrete") << " state: " << dft.getStateString(state));
+        STORM_LOG_TRACE("New " << (storedState->isPseudoState() ? "pseudo" : "concrete") << " state: " << dft.getStateString(storedState));
     }
     return stateId;
 }
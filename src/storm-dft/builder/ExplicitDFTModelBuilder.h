@@ -203,7 +203,7 @@ class ExplicitDFTModelBuilder {
     /*!
      * Add a state to the explored states (if not already there). It also handles pseudo states.
      *
-     * @param state The state to add.
+     * @param state The state to add. It is only copied if it is new, so the caller may reuse it afterwards.
      *
      * @return Id of state.
      */
@@ -98,13 +98,13 @@ storm::generator::StateBehavior<ValueType, StateType> DftNextStateGenerator<Valu
 
     // Let BE fail
     for (; iterFailable != this->state->getFailableElements().end(!exploreDependencies); ++iterFailable) {
-        DFTStatePointer newState;
         if (iterFailable.isFailureDueToDependency()) {
             // Next failure due to dependency
             STORM_LOG_ASSERT(exploreDependencies, "Failure should be due to dependency.");
             std::shared_ptr<storm::dft::storage::elements::DFTDependency<ValueType> const> dependency = iterFailable.asDependency(mDft);
             // Obtain successor state by propagating dependency failure to dependent BE
-            newState = createSuccessorState(this->state, dependency, true);
+            DFTStatePointer const& newState = resetScratchState();
+            letDependencyTrigger(newState, dependency, true, scratchQueues);
 
             auto [newStateId, shouldStop] = getNewStateId(newState, stateToIdCallback);
             if (shouldStop) {
@@ -120,7 +120,8 @@ storm::generator::StateBehavior<ValueType, StateType> DftNextStateGenerator<Valu
 
             if (!storm::utility::isOne(probability)) {
                 // Add transition to state where dependency was unsuccessful
-                DFTStatePointer unsuccessfulState = createSuccessorState(this->state, dependency, false);
+                DFTStatePointer const& unsuccessfulState = resetScratchState();
+                letDependencyTrigger(unsuccessfulState, dependency, false, scratchQueues);
                 // Add state
                 StateType unsuccessfulStateId = stateToIdCallback(unsuccessfulState);
                 ValueType remainingProbability = storm::utility::one<ValueType>() - probability;
@@ -146,7 +147,8 @@ storm::generator::StateBehavior<ValueType, StateType> DftNextStateGenerator<Valu
             // Next failure due to BE failing on its own
             std::shared_ptr<storm::dft::storage::elements::DFTBE<ValueType> const> nextBE = iterFailable.asBE(mDft);
             // Obtain successor state by propagating failure of BE
-            newState = createSuccessorState(this->state, nextBE);
+            DFTStatePointer const& newState = resetScratchState();
+            letBEFail(newState, nextBE, scratchQueues);
 
             auto [newStateId, shouldStop] = getNewStateId(newState, stateToIdCallback);
             if (shouldStop) {
@@ -187,7 +189,7 @@ storm::generator::StateBehavior<ValueType, StateType> DftNextStateGenerator<Valu
 }
 
 template<typename ValueType, typename StateType>
-std::pair<StateType, bool> DftNextStateGenerator<ValueType, StateType>::getNewStateId(DFTStatePointer newState,
+std::pair<StateType, bool> DftNextStateGenerator<ValueType, StateType>::getNewStateId(DFTStatePointer const& newState,
                                                                                       StateToIdCallback const& stateToIdCallback) const {
     if (newState->isInvalid() || newState->isTransient()) {
         STORM_LOG_TRACE("State is ignored because " << (newState->isInvalid() ? "it is invalid" : "the transient fault is ignored"));
@@ -209,72 +211,96 @@ typename DftNextStateGenerator<ValueType, StateType>::DFTStatePointer DftNextSta
     bool dependencySuccessful) const {
     // Construct new state as copy from original one
     DFTStatePointer newState = origState->copy();
+    storm::dft::storage::DFTStateSpaceGenerationQueues<ValueType> queues;
+    letDependencyTrigger(newState, dependency, dependencySuccessful, queues);
+    return newState;
+}
 
+template<typename ValueType, typename StateType>
+typename DftNextStateGenerator<ValueType, StateType>::DFTStatePointer DftNextStateGenerator<ValueType, StateType>::createSuccessorState(
+    DFTStatePointer const origState, std::shared_ptr<storm::dft::storage::elements::DFTBE<ValueType> const> be) const {
+    // Construct new state as copy from original one
+    DFTStatePointer newState = origState->copy();
+    storm::dft::storage::DFTStateSpaceGenerationQueues<ValueType> queues;
+    letBEFail(newState, be, queues);
+    return newState;
+}
+
+template<typename ValueType, typename StateType>
+void DftNextStateGenerator<ValueType, StateType>::letDependencyTrigger(
+    DFTStatePointer const& state, std::shared_ptr<storm::dft::storage::elements::DFTDependency<ValueType> const> const& dependency, bool dependencySuccessful,
+    storm::dft::storage::DFTStateSpaceGenerationQueues<ValueType>& queues) const {
     if (dependencySuccessful) {
         // Dependency was successful -> dependent BE fails
         STORM_LOG_TRACE("With the successful triggering of PDEP " << dependency->name() << " [" << dependency->id() << "]" << " in "
-                                                                  << mDft.getStateString(origState));
-        newState->letDependencyTrigger(dependency, true);
+                                                                  << mDft.getStateString(state));
+        state->letDependencyTrigger(dependency, true);
         STORM_LOG_ASSERT(dependency->dependentEvents().size() == 1, "Dependency " << dependency->name() << " does not have unique dependent event.");
         STORM_LOG_ASSERT(dependency->dependentEvents().front()->isBasicElement(),
                          "Trigger event " << dependency->dependentEvents().front()->name() << " is not a BE.");
         auto trigger = std::static_pointer_cast<storm::dft::storage::elements::DFTBE<ValueType> const>(dependency->dependentEvents().front());
-        return createSuccessorState(newState, trigger);
+        letBEFail(state, trigger, queues);
     } else {
         // Dependency was unsuccessful -> no BE fails
         STORM_LOG_TRACE("With the unsuccessful triggering of PDEP " << dependency->name() << " [" << dependency->id() << "]" << " in "
-                                                                    << mDft.getStateString(origState));
-        newState->letDependencyTrigger(dependency, false);
-        return newState;
+                                                                    << mDft.getStateString(state));
+        state->letDependencyTrigger(dependency, false);
     }
 }
 
 template<typename ValueType, typename StateType>
-typename DftNextStateGenerator<ValueType, StateType>::DFTStatePointer DftNextStateGenerator<ValueType, StateType>::createSuccessorState(
-    DFTStatePointer const origState, std::shared_ptr<storm::dft::storage::elements::DFTBE<ValueType> const> be) const {
-    // Construct new state as copy from original one
-    DFTStatePointer newState = origState->copy();
-
-    STORM_LOG_TRACE("With the failure of " << be->name() << " [" << be->id() << "]" << " in " << mDft.getStateString(origState));
-    newState->letBEFail(be);
+void DftNextStateGenerator<ValueType, StateType>::letBEFail(DFTStatePointer const& state,
+                                                            std::shared_ptr<storm::dft::storage::elements::DFTBE<ValueType> const> const& be,
+                                                            storm::dft::storage::DFTStateSpaceGenerationQueues<ValueType>& queues) const {
+    STORM_LOG_TRACE("With the failure of " << be->name() << " [" << be->id() << "]" << " in " << mDft.getStateString(state));
+    state->letBEFail(be);
 
     // Propagate
-    storm::dft::storage::DFTStateSpaceGenerationQueues<ValueType> queues;
-    propagateFailure(newState, be, queues);
+    propagateFailure(state, be, queues);
 
     // Check whether transient failure lead to TLE failure
     // TODO handle for all types of BEs.
     if (be->beType() == storm::dft::storage::elements::BEType::EXPONENTIAL) {
         auto beExp = std::static_pointer_cast<storm::dft::storage::elements::BEExponential<ValueType> const>(be);
-        if (beExp->isTransient() && !newState->hasFailed(mDft.getTopLevelIndex())) {
-            newState->markAsTransient();
+        if (beExp->isTransient() && !state->hasFailed(mDft.getTopLevelIndex())) {
+            state->markAsTransient();
         }
     }
 
     // Check whether failsafe propagation can be discarded
     bool discardFailSafe = false;
-    discardFailSafe |= newState->isInvalid();
-    discardFailSafe |= newState->isTransient();
-    discardFailSafe |= (newState->hasFailed(mDft.getTopLevelIndex()) && uniqueFailedState);
+    discardFailSafe |= state->isInvalid();
+    discardFailSafe |= state->isTransient();
+    discardFailSafe |= (state->hasFailed(mDft.getTopLevelIndex()) && uniqueFailedState);
 
     // Propagate failsafe (if necessary)
     if (!discardFailSafe) {
-        propagateFailsafe(newState, be, queues);
+        propagateFailsafe(state, be, queues);
 
         // Update failable dependencies
-        newState->updateFailableDependencies(be->id());
-        newState->updateDontCareDependencies(be->id());
-        newState->updateFailableInRestrictions(be->id());
+        state->updateFailableDependencies(be->id());
+        state->updateDontCareDependencies(be->id());
+        state->updateFailableInRestrictions(be->id());
     }
-    return newState;
 }
 
 template<typename ValueType, typename StateType>
-void DftNextStateGenerator<ValueType, StateType>::propagateFailure(DFTStatePointer newState,
-                                                                   std::shared_ptr<storm::dft::storage::elements::DFTBE<ValueType> const>& nextBE,
+typename DftNextStateGenerator<ValueType, StateType>::DFTStatePointer const& DftNextStateGenerator<ValueType, StateType>::resetScratchState() {
+    if (scratchState) {
+        scratchState->assign(*this->state);
+    } else {
+        scratchState = this->state->copy();
+    }
+    scratchQueues.clear();
+    return scratchState;
+}
+
+template<typename ValueType, typename StateType>
+void DftNextStateGenerator<ValueType, StateType>::propagateFailure(DFTStatePointer const& newState,
+                                                                   std::shared_ptr<storm::dft::storage::elements::DFTBE<ValueType> const> const& nextBE,
                                                                    storm::dft::storage::DFTStateSpaceGenerationQueues<ValueType>& queues) const {
     // Propagate failure
-    for (DFTGatePointer parent : nextBE->parents()) {
+    for (DFTGatePointer const& parent : nextBE->parents()) {
         if (newState->isOperational(parent->id())) {
             queues.propagateFailure(parent);
         }
@@ -288,7 +314,7 @@ void DftNextStateGenerator<ValueType, StateType>::propagateFailure(DFTStatePoint
     }
 
     // Check restrictions
-    for (DFTRestrictionPointer restr : nextBE->restrictions()) {
+    for (DFTRestrictionPointer const& restr : nextBE->restrictions()) {
         queues.checkRestrictionLater(restr);
     }
     // Check restrictions
@@ -301,8 +327,8 @@ void DftNextStateGenerator<ValueType, StateType>::propagateFailure(DFTStatePoint
 }
 
 template<typename ValueType, typename StateType>
-void DftNextStateGenerator<ValueType, StateType>::propagateFailsafe(DFTStatePointer newState,
-                                                                    std::shared_ptr<storm::dft::storage::elements::DFTBE<ValueType> const>& nextBE,
+void DftNextStateGenerator<ValueType, StateType>::propagateFailsafe(DFTStatePointer const& newState,
+                                                                    std::shared_ptr<storm::dft::storage::elements::DFTBE<ValueType> const> const& nextBE,
                                                                     storm::dft::storage::DFTStateSpaceGenerationQueues<ValueType>& queues) const {
     // Propagate failsafe
     while (!queues.failsafePropagationDone()) {
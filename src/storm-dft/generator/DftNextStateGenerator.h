@@ -21,6 +21,7 @@ class DftNextStateGenerator {
     using DFTRestrictionPointer = std::shared_ptr<storm::dft::storage::elements::DFTRestriction<ValueType>>;
 
    public:
+    // The callback must not keep the given state, as it may be reused for the next successor. States that need to be stored have to be copied.
     typedef std::function<StateType(DFTStatePointer const&)> StateToIdCallback;
 
     DftNextStateGenerator(storm::dft::storage::DFT<ValueType> const& dft, storm::dft::storage::DFTStateGenerationInfo const& stateGenerationInfo);
@@ -86,7 +87,7 @@ class DftNextStateGenerator {
      * @param newState starting state of the propagation
      * @param nextBE BE whose failure is propagated
      */
-    void propagateFailure(DFTStatePointer newState, std::shared_ptr<storm::dft::storage::elements::DFTBE<ValueType> const>& nextBE,
+    void propagateFailure(DFTStatePointer const& newState, std::shared_ptr<storm::dft::storage::elements::DFTBE<ValueType> const> const& nextBE,
                           storm::dft::storage::DFTStateSpaceGenerationQueues<ValueType>& queues) const;
 
     /**
@@ -95,7 +96,7 @@ class DftNextStateGenerator {
      * @param newState starting state of the propagation
      * @param nextBE BE whose failure is propagated
      */
-    void propagateFailsafe(DFTStatePointer newState, std::shared_ptr<storm::dft::storage::elements::DFTBE<ValueType> const>& nextBE,
+    void propagateFailsafe(DFTStatePointer const& newState, std::shared_ptr<storm::dft::storage::elements::DFTBE<ValueType> const> const& nextBE,
                            storm::dft::storage::DFTStateSpaceGenerationQueues<ValueType>& queues) const;
 
    private:
@@ -118,7 +119,37 @@ class DftNextStateGenerator {
      * @param stateToIdCallback Callback function which adds new state and returns the corresponding id.
      * @return Pair of id for new state, and true iff state should not be further explored.
      */
-    std::pair<StateType, bool> getNewStateId(DFTStatePointer state, StateToIdCallback const& stateToIdCallback) const;
+    std::pair<StateType, bool> getNewStateId(DFTStatePointer const& state, StateToIdCallback const& stateToIdCallback) const;
+
+    /*!
+     * Let the given BE fail in the given state and propagate the failure.
+     * The state is modified in place.
+     *
+     * @param state State.
+     * @param be BE which fails next.
+     * @param queues Queues used for the propagation. They are empty afterwards unless the failsafe propagation was discarded.
+     */
+    void letBEFail(DFTStatePointer const& state, std::shared_ptr<storm::dft::storage::elements::DFTBE<ValueType> const> const& be,
+                   storm::dft::storage::DFTStateSpaceGenerationQueues<ValueType>& queues) const;
+
+    /*!
+     * Trigger the given dependency in the given state. If triggering is successful, the dependent BE fails.
+     * The state is modified in place.
+     *
+     * @param state State.
+     * @param dependency Dependency which triggers.
+     * @param dependencySuccessful Whether triggering the dependency was successful.
+     * @param queues Queues used for the propagation.
+     */
+    void letDependencyTrigger(DFTStatePointer const& state, std::shared_ptr<storm::dft::storage::elements::DFTDependency<ValueType> const> const& dependency,
+                              bool dependencySuccessful, storm::dft::storage::DFTStateSpaceGenerationQueues<ValueType>& queues) const;
+
+    /*!
+     * Overwrite the scratch state with the current state and clear the scratch queues.
+     *
+     * @return Scratch state.
+     */
+    DFTStatePointer const& resetScratchState();
 
     // The dft used for the generation of next states.
     storm::dft::storage::DFT<ValueType> const& mDft;
@@ -129,6 +160,13 @@ class DftNextStateGenerator {
     // Current state
     DFTStatePointer state;
 
+    // State in which all successors of the current state are generated.
+    // The callback only has to copy it if the successor is new, so no state is allocated for already known successors.
+    DFTStatePointer scratchState;
+
+    // Queues for the propagation in the scratch state. They are reused to avoid allocations.
+    storm::dft::storage::DFTStateSpaceGenerationQueues<ValueType> scratchQueues;
+
     // Flag indicating whether all failed states should be merged into one unique failed state.
     bool uniqueFailedState;
 
@@ -1,24 +1,116 @@
 #include "DftModularizationChecker.h"
 
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <map>
+#include <numeric>
 #include <sstream>
 
+#include <boost/functional/hash.hpp>
+
 #include "storm-dft/adapters/SFTBDDPropertyFormulaAdapter.h"
 #include "storm-dft/api/storm-dft.h"
 #include "storm-dft/builder/DFTBuilder.h"
 #include "storm-dft/modelchecker/DFTModelChecker.h"
 #include "storm-dft/modelchecker/SFTBDDChecker.h"
+#include "storm-dft/storage/DFTIsomorphism.h"
 #include "storm-dft/utility/DftModularizer.h"
 
 #include "storm-parsers/api/properties.h"
 #include "storm/api/properties.h"
 #include "storm/exceptions/InvalidModelException.h"
+#include "storm/utility/TaskPool.h"
+#include "storm/utility/threads.h"
 
 namespace storm::dft {
 namespace modelchecker {
 
+namespace {
+// The search for an isomorphism between two modules enumerates all bijections between elements of the same colour.
+// Modules for which there are more bijections are not merged.
+constexpr uint64_t maximalNumberOfBijections = 10000;
+
+/*!
+ * Computes the number of bijections between the elements of the same colours or maximalNumberOfBijections + 1 if there are more.
+ */
+template<typename ValueType>
+uint64_t getNumberOfBijections(storm::dft::storage::BijectionCandidates<ValueType> const& candidates) {
+    uint64_t result = 1;
+    auto multiply = [&result](auto const& colourClasses) {
+        for (auto const& colourClass : colourClasses) {
+            for (uint64_t factor = 2; factor <= colourClass.second.size() && result <= maximalNumberOfBijections; ++factor) {
+                result *= factor;
+            }
+        }
+    };
+    multiply(candidates.gateCandidates);
+    multiply(candidates.beCandidates);
+    multiply(candidates.pdepCandidates);
+    multiply(candidates.restrictionCandidates);
+    return std::min(result, maximalNumberOfBijections + 1);
+}
+
+/*!
+ * Computes a signature of the given module which is invariant under isomorphism, i.e., isomorphic modules have the same signature.
+ * It combines the colours of all elements and a hash of the tree below the top element in which each gate is described by its colour and its children.
+ */
 template<typename ValueType>
-DftModularizationChecker<ValueType>::DftModularizationChecker(std::shared_ptr<storm::dft::storage::DFT<ValueType>> dft)
-    : dft{dft}, modelchecker(true), sylvanBddManager{std::make_shared<storm::dft::storage::SylvanBddManager>()} {
+size_t computeModuleSignature(storm::dft::storage::DFT<ValueType> const& dft, storm::dft::storage::DftIndependentModule const& module,
+                              storm::dft::storage::BijectionCandidates<ValueType> const& candidates) {
+    // Hash of the colour of each element. The colours of the different kinds of elements are distinguished by a salt.
+    std::map<size_t, size_t> colourHashes;
+    size_t signature = 0;
+    auto addColours = [&colourHashes, &signature](auto const& colourClasses, size_t salt) {
+        for (auto const& colourClass : colourClasses) {
+            size_t colourHash = salt;
+            boost::hash_combine(colourHash, std::hash<typename std::decay_t<decltype(colourClass.first)>>()(colourClass.first));
+            for (size_t element : colourClass.second) {
+                colourHashes[element] = colourHash;
+            }
+            // The order of the colour classes is arbitrary, so their hashes are combined commutatively
+            size_t classHash = colourHash;
+            boost::hash_combine(classHash, colourClass.second.size());
+            signature += classHash;
+        }
+    };
+    addColours(candidates.gateCandidates, 1);
+    addColours(candidates.beCandidates, 2);
+    addColours(candidates.pdepCandidates, 3);
+    addColours(candidates.restrictionCandidates, 4);
+
+    std::map<size_t, size_t> subtreeHashes;
+    std::function<size_t(size_t)> getSubtreeHash = [&](size_t id) -> size_t {
+        auto it = subtreeHashes.find(id);
+        if (it != subtreeHashes.end()) {
+            return it->second;
+        }
+        size_t hash = colourHashes.at(id);
+        if (dft.isGate(id)) {
+            // Children are sorted by their hashes, as isomorphisms need not preserve the order of children of all gates
+            std::vector<size_t> childHashes;
+            for (auto const& child : dft.getGate(id)->children()) {
+                childHashes.push_back(getSubtreeHash(child->id()));
+            }
+            std::sort(childHashes.begin(), childHashes.end());
+            boost::hash_combine(hash, boost::hash_range(childHashes.begin(), childHashes.end()));
+        }
+        subtreeHashes.emplace(id, hash);
+        return hash;
+    };
+    boost::hash_combine(signature, getSubtreeHash(module.getRepresentative()));
+    return signature;
+}
+}  // namespace
+
+template<typename ValueType>
+DftModularizationChecker<ValueType>::DftModularizationChecker(std::shared_ptr<storm::dft::storage::DFT<ValueType>> dft, size_t numberOfThreads,
+                                                              bool mergeIsomorphicModules)
+    : dft{dft}, numberOfThreads{numberOfThreads}, sylvanBddManager{std::make_shared<storm::dft::storage::SylvanBddManager>()} {
+    if (this->numberOfThreads == 0) {
+        this->numberOfThreads = std::max(1u, storm::utility::getNumberOfThreads());
+    }
+
     // Initialize modules
     storm::dft::utility::DftModularizer<ValueType> modularizer;
     auto topModule = modularizer.computeModules(*dft);
@@ -26,6 +118,7 @@ DftModularizationChecker<ValueType>::DftModularizationChecker(std::shared_ptr<st
 
     // Gather all dynamic modules
     populateDynamicModules(topModule);
+    groupIsomorphicModules(mergeIsomorphicModules);
 }
 
 template<typename ValueType>
@@ -41,6 +134,63 @@ void DftModularizationChecker<ValueType>::populateDynamicModules(storm::dft::sto
     }
 }
 
+template<typename ValueType>
+void DftModularizationChecker<ValueType>::groupIsomorphicModules(bool mergeIsomorphicModules) {
+    std::vector<size_t> classSizes;
+    if (!mergeIsomorphicModules) {
+        for (size_t moduleIndex = 0; moduleIndex < dynamicModules.size(); ++moduleIndex) {
+            isomorphicModules.push_back({moduleIndex});
+            classSizes.push_back(dynamicModules[moduleIndex].getAllElements().size());
+        }
+    } else {
+        storm::dft::storage::DFTColouring<ValueType> colouring(*dft);
+        // Colouring and signature of the first module of each class
+        std::vector<storm::dft::storage::BijectionCandidates<ValueType>> classCandidates;
+        std::vector<size_t> classSignatures;
+        for (size_t moduleIndex = 0; moduleIndex < dynamicModules.size(); ++moduleIndex) {
+            auto const& mod = dynamicModules[moduleIndex];
+            auto const elements = mod.getAllElements();
+            auto candidates = colouring.colourSubdft(std::vector<size_t>(elements.begin(), elements.end()));
+            size_t signature = computeModuleSignature(*dft, mod, candidates);
+            bool foundClass = false;
+            // Only modules with equal signatures can be isomorphic. The expensive search for an isomorphism is skipped if there are too many bijections.
+            if (getNumberOfBijections(candidates) <= maximalNumberOfBijections) {
+                for (size_t classIndex = 0; classIndex < isomorphicModules.size(); ++classIndex) {
+                    if (classSizes[classIndex] != elements.size() || classSignatures[classIndex] != signature) {
+                        continue;
+                    }
+                    storm::dft::storage::DFTIsomorphismCheck<ValueType> isoCheck(classCandidates[classIndex], candidates, *dft);
+                    // The top elements of both modules must correspond to each other
+                    auto const& classRepresentative = dynamicModules[isomorphicModules[classIndex].front()].getRepresentative();
+                    if (isoCheck.findNextIsomorphism() && isoCheck.getIsomorphism().at(classRepresentative) == mod.getRepresentative()) {
+                        isomorphicModules[classIndex].push_back(moduleIndex);
+                        foundClass = true;
+                        break;
+                    }
+                }
+            }
+            if (!foundClass) {
+                isomorphicModules.push_back({moduleIndex});
+                classCandidates.push_back(std::move(candidates));
+                classSizes.push_back(elements.size());
+                classSignatures.push_back(signature);
+            }
+        }
+    }
+
+    // Order classes by decreasing module size such that the largest modules are analysed first
+    std::vector<size_t> order(isomorphicModules.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&classSizes](size_t left, size_t right) { return classSizes[left] > classSizes[right]; });
+    std::vector<std::vector<size_t>> sortedModules;
+    sortedModules.reserve(order.size());
+    for (size_t classIndex : order) {
+        sortedModules.push_back(std::move(isomorphicModules[classIndex]));
+    }
+    isomorphicModules = std::move(sortedModules);
+    STORM_LOG_DEBUG("Found " << isomorphicModules.size() << " classes of isomorphic modules among " << dynamicModules.size() << " dynamic modules.");
+}
+
 template<typename ValueType>
 std::vector<ValueType> DftModularizationChecker<ValueType>::check(FormulaVector const& formulas, size_t chunksize) {
     // Gather time points
@@ -69,18 +219,47 @@ std::shared_ptr<storm::dft::storage::DFT<ValueType>> DftModularizationChecker<Va
     // Map from module representatives to their sample points
     std::map<size_t, std::map<ValueType, ValueType>> samplePoints;
 
-    // First analyse all dynamic modules
-    for (auto const& mod : dynamicModules) {
-        STORM_LOG_DEBUG("Analyse dynamic module " << mod.toString(*dft));
-        auto result = analyseDynamicModule(mod, timepoints);
+    // Create properties
+    std::stringstream propertyStream{};
+    for (auto const timebound : timepoints) {
+        propertyStream << "Pmin=? [F<=" << timebound << "\"failed\"];";
+    }
+    auto const properties{storm::api::extractFormulasFromProperties(storm::api::parseProperties(propertyStream.str()))};
+
+    // First analyse all dynamic modules.
+    // Only one module per class of isomorphic modules is analysed. The analyses are independent and run concurrently, largest modules first.
+    std::vector<typename storm::dft::modelchecker::DFTModelChecker<ValueType>::dft_results> classResults(isomorphicModules.size());
+    std::atomic<size_t> nextClass{0};
+    auto analyseClasses = [&]() {
+        for (size_t classIndex = nextClass++; classIndex < isomorphicModules.size(); classIndex = nextClass++) {
+            auto const& mod = dynamicModules[isomorphicModules[classIndex].front()];
+            STORM_LOG_DEBUG("Analyse dynamic module " << mod.toString(*dft));
+            classResults[classIndex] = analyseDynamicModule(mod, properties);
+        }
+    };
+    size_t const threads = std::min(numberOfThreads, isomorphicModules.size());
+    if (threads > 1) {
+        storm::utility::TaskPool pool(threads);
+        for (size_t i = 0; i < threads; ++i) {
+            pool.submit(analyseClasses);
+        }
+        pool.wait();
+    } else {
+        analyseClasses();
+    }
+
+    for (size_t classIndex = 0; classIndex < isomorphicModules.size(); ++classIndex) {
         // Remember probabilities for module
         std::map<ValueType, ValueType> activeSamples{};
         for (size_t i{0}; i < timepoints.size(); ++i) {
-            auto const probability{boost::get<ValueType>(result[i])};
+            auto const probability{boost::get<ValueType>(classResults[classIndex][i])};
             auto const timebound{timepoints[i]};
             activeSamples[timebound] = probability;
         }
-        samplePoints.insert({mod.getRepresentative(), activeSamples});
+        // Isomorphic modules share the same probabilities
+        for (size_t moduleIndex : isomorphicModules[classIndex]) {
+            samplePoints.insert({dynamicModules[moduleIndex].getRepresentative(), activeSamples});
+        }
     }
 
     // Gather all elements contained in dynamic modules
@@ -123,20 +302,16 @@ std::shared_ptr<storm::dft::storage::DFT<ValueType>> DftModularizationChecker<Va
 
 template<typename ValueType>
 typename storm::dft::modelchecker::DFTModelChecker<ValueType>::dft_results DftModularizationChecker<ValueType>::analyseDynamicModule(
-    storm::dft::storage::DftIndependentModule const& module, std::vector<ValueType> const& timepoints) {
+    storm::dft::storage::DftIndependentModule const& module, FormulaVector const& properties) const {
     STORM_LOG_ASSERT(!module.isStatic() && !module.isFullyStatic(), "Module should be dynamic.");
     STORM_LOG_ASSERT(!dft->getElement(module.getRepresentative())->isBasicElement(), "Dynamic module should not be a single BE.");
 
     auto subDft = module.getSubtree(*dft);
 
-    // Create properties
-    std::stringstream propertyStream{};
-    for (auto const timebound : timepoints) {
-        propertyStream << "Pmin=? [F<=" << timebound << "\"failed\"];";
-    }
-    auto const props{storm::api::extractFormulasFromProperties(storm::api::parseProperties(propertyStream.str()))};
-
-    return std::move(modelchecker.check(subDft, props, false, false, {}));
+    // Each analysis uses its own model checker such that modules can be analysed concurrently.
+    // Model information is only printed for sequential analysis as the output of concurrent analyses would be interleaved.
+    storm::dft::modelchecker::DFTModelChecker<ValueType> modelchecker(numberOfThreads == 1);
+    return modelchecker.check(subDft, properties, false, false, {});
 }
 
 // Explicitly instantiate the class.
@@ -28,8 +28,10 @@ class DftModularizationChecker {
     /*!
      * Initializes and computes all modules.
      * @param dft DFT.
+     * @param numberOfThreads Number of threads used to analyse the dynamic modules. If zero, the number of hardware threads is used.
+     * @param mergeIsomorphicModules If set, only one module of each class of isomorphic dynamic modules is analysed.
      */
-    DftModularizationChecker(std::shared_ptr<storm::dft::storage::DFT<ValueType>> dft);
+    DftModularizationChecker(std::shared_ptr<storm::dft::storage::DFT<ValueType>> dft, size_t numberOfThreads = 1, bool mergeIsomorphicModules = false);
 
     /*!
      * Calculate the properties specified by the formulas.
@@ -58,6 +60,20 @@ class DftModularizationChecker {
         return getProbabilitiesAtTimepoints({timebound}).at(0);
     }
 
+    /*!
+     * @return The number of dynamic modules.
+     */
+    size_t getNumberOfDynamicModules() const {
+        return dynamicModules.size();
+    }
+
+    /*!
+     * @return The number of classes of isomorphic dynamic modules, i.e., the number of dynamic modules that are actually analysed.
+     */
+    size_t getNumberOfIsomorphismClasses() const {
+        return isomorphicModules.size();
+    }
+
    private:
     /*!
      * Recursively populate the list of dynamic modules.
@@ -65,6 +81,14 @@ class DftModularizationChecker {
      */
     void populateDynamicModules(storm::dft::storage::DftIndependentModule const &module);
 
+    /*!
+     * Partition the dynamic modules into classes of isomorphic modules.
+     * If isomorphic modules are not merged, each module forms its own class.
+     * The classes are sorted by decreasing module size.
+     * @param mergeIsomorphicModules Whether isomorphic modules are put into the same class.
+     */
+    void groupIsomorphicModules(bool mergeIsomorphicModules);
+
     /*!
      * Calculate results for dynamic modules and replace them with BE's in workDFT.
      * @param timepoints Time points for which the failure probability should be computed.
@@ -75,20 +99,22 @@ class DftModularizationChecker {
     /*!
      * Analyse the given dynamic module.
      * @param module Module.
-     * @param timepoints Time points for which the failure probability of element should be computed.
+     * @param properties Properties for the failure probability of the module at the relevant time points.
      */
     typename storm::dft::modelchecker::DFTModelChecker<ValueType>::dft_results analyseDynamicModule(storm::dft::storage::DftIndependentModule const &module,
-                                                                                                    std::vector<ValueType> const &timepoints);
+                                                                                                    FormulaVector const &properties) const;
 
     // DFT.
     std::shared_ptr<storm::dft::storage::DFT<ValueType>> dft;
-    // DFT modelchecker
-    storm::dft::modelchecker::DFTModelChecker<ValueType> modelchecker;
+    // Number of threads used to analyse the dynamic modules
+    size_t numberOfThreads;
     // don't reinitialize Sylvan BDD
     // temporary
     std::shared_ptr<storm::dft::storage::SylvanBddManager> sylvanBddManager;
     // Independent modules with their top element
     std::vector<storm::dft::storage::DftIndependentModule> dynamicModules;
+    // Classes of isomorphic dynamic modules (given by their indices in dynamicModules), largest modules first
+    std::vector<std::vector<size_t>> isomorphicModules;
 };
 
 }  // namespace modelchecker
@@ -18,6 +18,8 @@ const std::string FaultTreeSettings::moduleName = "dft";
 const std::string FaultTreeSettings::noSymmetryReductionOptionName = "nosymmetryreduction";
 const std::string FaultTreeSettings::noSymmetryReductionOptionShortName = "nosymred";
 const std::string FaultTreeSettings::modularisationOptionName = "modularisation";
+const std::string FaultTreeSettings::modularisationThreadsOptionName = "modularisation-threads";
+const std::string FaultTreeSettings::mergeIsomorphicModulesOptionName = "merge-isomorphic";
 const std::string FaultTreeSettings::disableDCOptionName = "disabledc";
 const std::string FaultTreeSettings::allowDCRelevantOptionName = "allowdcrelevant";
 const std::string FaultTreeSettings::relevantEventsOptionName = "relevantevents";
@@ -42,6 +44,17 @@ FaultTreeSettings::FaultTreeSettings() : ModuleSettings(moduleName) {
                         .build());
     this->addOption(
         storm::settings::OptionBuilder(moduleName, modularisationOptionName, false, "Use modularisation (not applicable for expected time).").build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, modularisationThreadsOptionName, false,
+                                                   "Sets the number of threads that analyse dynamic modules concurrently during modularisation.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("number", "The number of threads (0 means 'auto-detect').")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, mergeIsomorphicModulesOptionName, false,
+                                                   "Analyse only one of several isomorphic dynamic modules during modularisation.")
+                        .setIsAdvanced()
+                        .build());
     this->addOption(storm::settings::OptionBuilder(moduleName, disableDCOptionName, false, "Disable Don't Care propagation.").build());
     this->addOption(
         storm::settings::OptionBuilder(moduleName, firstDependencyOptionName, false, "Avoid non-determinism by always taking the first possible dependency.")
@@ -116,6 +129,14 @@ bool FaultTreeSettings::useModularisation() const {
     return this->getOption(modularisationOptionName).getHasOptionBeenSet();
 }
 
+size_t FaultTreeSettings::getModularisationThreads() const {
+    return this->getOption(modularisationThreadsOptionName).getArgumentByName("number").getValueAsUnsignedInteger();
+}
+
+bool FaultTreeSettings::isMergeIsomorphicModules() const {
+    return this->getOption(mergeIsomorphicModulesOptionName).getHasOptionBeenSet();
+}
+
 bool FaultTreeSettings::isDisableDC() const {
     return this->getOption(disableDCOptionName).getHasOptionBeenSet();
 }
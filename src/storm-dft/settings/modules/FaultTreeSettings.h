@@ -32,6 +32,20 @@ class FaultTreeSettings : public storm::settings::modules::ModuleSettings {
      */
     bool useModularisation() const;
 
+    /*!
+     * Retrieves the number of threads that analyse dynamic modules during modularisation.
+     *
+     * @return The number of threads (0 means the number of hardware threads).
+     */
+    size_t getModularisationThreads() const;
+
+    /*!
+     * Retrieves whether the option to analyse only one of several isomorphic dynamic modules is set.
+     *
+     * @return True iff the option was set.
+     */
+    bool isMergeIsomorphicModules() const;
+
     /*!
      * Retrieves whether the option to disable Dont Care propagation is set.
      *
@@ -179,6 +193,8 @@ class FaultTreeSettings : public storm::settings::modules::ModuleSettings {
     static const std::string noSymmetryReductionOptionName;
     static const std::string noSymmetryReductionOptionShortName;
     static const std::string modularisationOptionName;
+    static const std::string modularisationThreadsOptionName;
+    static const std::string mergeIsomorphicModulesOptionName;
     static const std::string disableDCOptionName;
     static const std::string allowDCRelevantOptionName;
     static const std::string relevantEventsOptionName;
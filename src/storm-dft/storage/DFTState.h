@@ -71,6 +71,14 @@ class DFTState {
 
     std::shared_ptr<DFTState<ValueType>> copy() const;
 
+    /**
+     * Overwrite this state with the given state of the same DFT.
+     * In contrast to copy(), no new state is created and the memory of this state is reused.
+     *
+     * @param other State to copy from.
+     */
+    void assign(DFTState const& other);
+
     DFTElementState getElementState(size_t id) const;
 
     static DFTElementState getElementState(storm::storage::BitVector const& state, DFTStateGenerationInfo const& stateGenerationInfo, size_t id);
@@ -38,6 +38,19 @@ class DFTStateSpaceGenerationQueues {
     DFTRestrictionVector restrictionChecks;
 
    public:
+    /*!
+     * Remove all pending elements. The allocated memory is kept, so the queues can be reused for the next state.
+     */
+    void clear() {
+        while (!failurePropagation.empty()) {
+            failurePropagation.pop();
+        }
+        failsafePropagation.clear();
+        dontcarePropagation.clear();
+        activatePropagation.clear();
+        restrictionChecks.clear();
+    }
+
     void propagateFailure(DFTGatePointer const& elem) {
         failurePropagation.push(elem);
     }
@@ -21,9 +21,10 @@ void linspace(std::vector<double> &buffer, double start, double const stepsize)
 namespace storm::dft {
 namespace utility {
 
-double MTTFHelperProceeding(std::shared_ptr<storm::dft::storage::DFT<double>> const dft, double const stepsize, double const precision) {
+double MTTFHelperProceeding(std::shared_ptr<storm::dft::storage::DFT<double>> const dft, double const stepsize, double const precision,
+                            size_t const numberOfThreads, bool const mergeIsomorphicModules) {
     constexpr size_t chunksize{1001};
-    storm::dft::modelchecker::DftModularizationChecker checker{dft};
+    storm::dft::modelchecker::DftModularizationChecker checker{dft, numberOfThreads, mergeIsomorphicModules};
 
     std::vector<double> timepoints{};
     timepoints.resize(chunksize);
@@ -62,9 +63,10 @@ double MTTFHelperProceeding(std::shared_ptr<storm::dft::storage::DFT<double>> co
     return rval;
 }
 
-double MTTFHelperVariableChange(std::shared_ptr<storm::dft::storage::DFT<double>> const dft, double const stepsize) {
+double MTTFHelperVariableChange(std::shared_ptr<storm::dft::storage::DFT<double>> const dft, double const stepsize, size_t const numberOfThreads,
+                                bool const mergeIsomorphicModules) {
     constexpr size_t chunksize{1001};
-    storm::dft::modelchecker::DftModularizationChecker checker{dft};
+    storm::dft::modelchecker::DftModularizationChecker checker{dft, numberOfThreads, mergeIsomorphicModules};
 
     std::vector<double> timepoints{};
     timepoints.resize(static_cast<size_t>(1 / stepsize) - 1);
@@ -7,16 +7,20 @@ namespace utility {
 
 /**
  * Tries to numerically approximate the mttf of the given dft
- * by integrating 1 - cdf(dft) with Simpson's rule
+ * by integrating 1 - cdf(dft) with Simpson's rule.
+ * The cdf is computed via modularisation with the given number of threads, optionally analysing isomorphic dynamic modules only once.
  */
-double MTTFHelperProceeding(std::shared_ptr<storm::dft::storage::DFT<double>> const dft, double const stepsize = 1e-10, double const precision = 1e-12);
+double MTTFHelperProceeding(std::shared_ptr<storm::dft::storage::DFT<double>> const dft, double const stepsize = 1e-10, double const precision = 1e-12,
+                            size_t const numberOfThreads = 1, bool const mergeIsomorphicModules = false);
 
 /**
  * Tries to numerically approximate the mttf of the given dft
  * by integrating 1 - cdf(dft) by changing the variable
- * such that the interval is (0,1) instead of (0,oo)
+ * such that the interval is (0,1) instead of (0,oo).
+ * The cdf is computed via modularisation with the given number of threads, optionally analysing isomorphic dynamic modules only once.
  */
-double MTTFHelperVariableChange(std::shared_ptr<storm::dft::storage::DFT<double>> const dft, double const stepsize = 1e-6);
+double MTTFHelperVariableChange(std::shared_ptr<storm::dft::storage::DFT<double>> const dft, double const stepsize = 1e-6, size_t const numberOfThreads = 1,
+                                bool const mergeIsomorphicModules = false);
 
 }  // namespace utility
 }  // namespace storm::dft
@@ -378,7 +378,7 @@ void parameterSpacePartitioningWithSparseEngine(std::shared_ptr<storm::models::s
     storm::utility::Stopwatch watch(true);
     std::unique_ptr<storm::modelchecker::CheckResult> result = storm::api::checkAndRefineRegionWithSparseEngine<ValueType>(
         model, storm::api::createTask<ValueType>((property.getRawFormula()), true), regions.front(), engine, refinementThreshold, optionalDepthLimit,
-        storm::modelchecker::RegionResultHypothesis::Unknown, false, monotonicitySettings, monThresh);
+        storm::modelchecker::RegionResultHypothesis::Unknown, false, monotonicitySettings, monThresh, partitionSettings.getNumberOfThreads());
     watch.stop();
     printInitialStatesResult<ValueType>(result, &watch);
 
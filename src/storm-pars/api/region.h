@@ -280,6 +280,8 @@ std::unique_ptr<storm::modelchecker::RegionCheckResult<ValueType>> checkRegionsW
  * @param allowModelSimplification
  * @param useMonotonicity
  * @param monThresh if given, determines at which depth to start using monotonicity
+ * @param numberOfThreads the number of threads that analyze regions concurrently. Each thread uses its own region model checker.
+ * Multiple threads are only used if the coefficients of rational functions are GMP numbers.
  */
 template<typename ValueType>
 std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ValueType>> checkAndRefineRegionWithSparseEngine(
@@ -287,9 +289,24 @@ std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ValueType>> che
     storm::storage::ParameterRegion<ValueType> const& region, storm::modelchecker::RegionCheckEngine engine,
     boost::optional<ValueType> const& coverageThreshold, boost::optional<uint64_t> const& refinementDepthThreshold = boost::none,
     storm::modelchecker::RegionResultHypothesis hypothesis = storm::modelchecker::RegionResultHypothesis::Unknown, bool allowModelSimplification = true,
-    MonotonicitySetting monotonicitySetting = MonotonicitySetting(), uint64_t monThresh = 0) {
+    MonotonicitySetting monotonicitySetting = MonotonicitySetting(), uint64_t monThresh = 0, uint64_t numberOfThreads = 1) {
     Environment env;
     bool preconditionsValidated = false;
+    STORM_LOG_WARN_COND(numberOfThreads <= 1 || !monotonicitySetting.useMonotonicity,
+                        "Region refinement with monotonicity is not supported with multiple threads, continuing with a single thread.");
+    STORM_LOG_WARN_COND(numberOfThreads <= 1 || storm::modelchecker::RegionModelChecker<ValueType>::isParallelRegionRefinementSupported(),
+                        "Regions can not be refined concurrently as the coefficients of rational functions are not thread-safe (CLN), continuing with a "
+                        "single thread.");
+    if (numberOfThreads > 1 && !monotonicitySetting.useMonotonicity &&
+        storm::modelchecker::RegionModelChecker<ValueType>::isParallelRegionRefinementSupported()) {
+        // The checkers are specified one after another as manipulating rational functions is not thread-safe.
+        std::vector<std::shared_ptr<storm::modelchecker::RegionModelChecker<ValueType>>> regionCheckers;
+        for (uint64_t thread = 0; thread < numberOfThreads; ++thread) {
+            regionCheckers.push_back(initializeRegionModelChecker(env, model, task, engine, true, allowModelSimplification, preconditionsValidated));
+        }
+        return storm::modelchecker::RegionModelChecker<ValueType>::performParallelRegionRefinement(env, regionCheckers, region, coverageThreshold,
+                                                                                                   refinementDepthThreshold, hypothesis);
+    }
     auto regionChecker = initializeRegionModelChecker(env, model, task, engine, true, allowModelSimplification, preconditionsValidated, monotonicitySetting);
     return regionChecker->performRegionRefinement(env, region, coverageThreshold, refinementDepthThreshold, hypothesis, monThresh);
 }
@@ -1,3 +1,6 @@
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
 #include <queue>
 #include <sstream>
 #include <vector>
@@ -13,6 +16,7 @@
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/CoreSettings.h"
 #include "storm/utility/Stopwatch.h"
+#include "storm/utility/TaskPool.h"
 
 #include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/NotImplementedException.h"
@@ -333,6 +337,165 @@ std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ParametricType>
     return std::make_unique<storm::modelchecker::RegionRefinementCheckResult<ParametricType>>(std::move(result), std::move(regionCopyForResult));
 }
 
+template<typename ParametricType>
+std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ParametricType>> RegionModelChecker<ParametricType>::performParallelRegionRefinement(
+    Environment const& env, std::vector<std::shared_ptr<RegionModelChecker<ParametricType>>> const& checkers,
+    storm::storage::ParameterRegion<ParametricType> const& region, boost::optional<ParametricType> const& coverageThreshold,
+    boost::optional<uint64_t> depthThreshold, RegionResultHypothesis const& hypothesis) {
+    STORM_LOG_THROW(!checkers.empty(), storm::exceptions::InvalidArgumentException, "At least one region model checker is required for region refinement.");
+    if (checkers.size() > 1 && !isParallelRegionRefinementSupported()) {
+        STORM_LOG_WARN("Regions can not be refined concurrently as the coefficients of rational functions are not thread-safe (CLN), using a single thread.");
+        return checkers.front()->performRegionRefinement(env, region, coverageThreshold, depthThreshold, hypothesis);
+    }
+    STORM_LOG_WARN_COND(std::none_of(checkers.begin(), checkers.end(), [](auto const& checker) { return checker->isUseMonotonicitySet(); }),
+                        "Monotonicity is not considered in parallel region refinement.");
+    STORM_LOG_INFO("Applying refinement on region: " << region.toString(true) << " using " << checkers.size() << " threads.");
+
+    auto thresholdAsCoefficient =
+        coverageThreshold ? storm::utility::convertNumber<CoefficientType>(coverageThreshold.get()) : storm::utility::zero<CoefficientType>();
+    auto areaOfParameterSpace = region.area();
+    auto fractionOfUndiscoveredArea = storm::utility::one<CoefficientType>();
+    bool showStatistics = storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet();
+
+    // The resulting (sub-)regions
+    std::vector<std::pair<storm::storage::ParameterRegion<ParametricType>, RegionResult>> result;
+
+    // A region that still needs to be processed. Regions with lower depth are processed first and regions of the same depth in the order of their creation,
+    // so that a single thread analyzes the regions in the same order as performRegionRefinement.
+    struct RefinementTask {
+        std::pair<storm::storage::ParameterRegion<ParametricType>, RegionResult> regionAndResult;
+        uint64_t depth;
+        uint64_t index;
+
+        bool operator<(RefinementTask const& other) const {
+            return depth > other.depth || (depth == other.depth && index > other.index);
+        }
+    };
+    std::priority_queue<RefinementTask> unprocessedRegions;
+    uint64_t numberOfCreatedRegions = 0;
+    unprocessedRegions.push(RefinementTask{{region, RegionResult::Unknown}, 0, numberOfCreatedRegions++});
+
+    // The state shared among the workers is protected by this mutex. Workers wait for new regions if all pending regions are currently being analyzed.
+    std::mutex mutex;
+    std::condition_variable regionsAvailable;
+    uint64_t numberOfRegionsInProgress = 0;
+    bool aborted = false;
+
+    uint_fast64_t numOfAnalyzedRegions = 0;
+    CoefficientType displayedProgress = storm::utility::zero<CoefficientType>();
+    if (showStatistics) {
+        STORM_PRINT_AND_LOG("Progress (solved fraction) :\n" << "0% [");
+        while (displayedProgress < storm::utility::one<CoefficientType>() - thresholdAsCoefficient) {
+            STORM_PRINT_AND_LOG(" ");
+            displayedProgress += storm::utility::convertNumber<CoefficientType>(0.01);
+        }
+        while (displayedProgress < storm::utility::one<CoefficientType>()) {
+            STORM_PRINT_AND_LOG("-");
+            displayedProgress += storm::utility::convertNumber<CoefficientType>(0.01);
+        }
+        STORM_PRINT_AND_LOG("] 100%\n" << "   [");
+        displayedProgress = storm::utility::zero<CoefficientType>();
+    }
+
+    auto refine = [&](RegionModelChecker<ParametricType>& checker) {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            regionsAvailable.wait(lock, [&]() {
+                return aborted || !unprocessedRegions.empty() || numberOfRegionsInProgress == 0 || fractionOfUndiscoveredArea <= thresholdAsCoefficient;
+            });
+            if (aborted || unprocessedRegions.empty() || fractionOfUndiscoveredArea <= thresholdAsCoefficient) {
+                // Either the refinement is complete or no region will become available anymore.
+                return;
+            }
+            RefinementTask task = unprocessedRegions.top();
+            unprocessedRegions.pop();
+            ++numberOfRegionsInProgress;
+            STORM_LOG_INFO("Analyzing region #" << numOfAnalyzedRegions << " (Refinement depth " << task.depth << "; "
+                                                << storm::utility::convertNumber<double>(fractionOfUndiscoveredArea) * 100 << "% still unknown)");
+            ++numOfAnalyzedRegions;
+            lock.unlock();
+
+            auto& currentRegion = task.regionAndResult.first;
+            auto& res = task.regionAndResult.second;
+            try {
+                res = checker.analyzeRegion(env, currentRegion, hypothesis, res, false);
+            } catch (...) {
+                lock.lock();
+                aborted = true;
+                regionsAvailable.notify_all();
+                throw;
+            }
+
+            // Splitting is done without holding the lock.
+            std::vector<storm::storage::ParameterRegion<ParametricType>> newRegions;
+            bool refineFurther = res != RegionResult::AllSat && res != RegionResult::AllViolated && (!depthThreshold || task.depth < depthThreshold.get());
+            if (refineFurther) {
+                currentRegion.split(currentRegion.getCenterPoint(), newRegions);
+            }
+
+            lock.lock();
+            --numberOfRegionsInProgress;
+            if (res == RegionResult::AllSat || res == RegionResult::AllViolated) {
+                fractionOfUndiscoveredArea -= currentRegion.area() / areaOfParameterSpace;
+                result.push_back(std::move(task.regionAndResult));
+            } else if (refineFurther) {
+                RegionResult initResForNewRegions = (res == RegionResult::CenterSat)
+                                                        ? RegionResult::ExistsSat
+                                                        : ((res == RegionResult::CenterViolated) ? RegionResult::ExistsViolated : RegionResult::Unknown);
+                for (auto& newRegion : newRegions) {
+                    unprocessedRegions.push(RefinementTask{{std::move(newRegion), initResForNewRegions}, task.depth + 1, numberOfCreatedRegions++});
+                }
+            } else {
+                // If the region is not further refined, it is still added to the result
+                result.push_back(std::move(task.regionAndResult));
+            }
+            if (showStatistics) {
+                while (displayedProgress < storm::utility::one<CoefficientType>() - fractionOfUndiscoveredArea) {
+                    STORM_PRINT_AND_LOG("#");
+                    displayedProgress += storm::utility::convertNumber<CoefficientType>(0.01);
+                }
+            }
+            regionsAvailable.notify_all();
+        }
+    };
+
+    storm::utility::TaskPool pool(checkers.size());
+    for (auto const& checker : checkers) {
+        pool.submit([&refine, &checker]() { refine(*checker); });
+    }
+    pool.wait();
+
+    // Add the still unprocessed regions to the result
+    while (!unprocessedRegions.empty()) {
+        result.push_back(unprocessedRegions.top().regionAndResult);
+        unprocessedRegions.pop();
+    }
+
+    if (showStatistics) {
+        while (displayedProgress < storm::utility::one<CoefficientType>()) {
+            STORM_PRINT_AND_LOG("-");
+            displayedProgress += storm::utility::convertNumber<CoefficientType>(0.01);
+        }
+        STORM_PRINT_AND_LOG("]\n");
+
+        STORM_PRINT_AND_LOG("Region Refinement Statistics:\n");
+        STORM_PRINT_AND_LOG("    Analyzed a total of " << numOfAnalyzedRegions << " regions using " << checkers.size() << " threads.\n");
+    }
+
+    auto regionCopyForResult = region;
+    return std::make_unique<storm::modelchecker::RegionRefinementCheckResult<ParametricType>>(std::move(result), std::move(regionCopyForResult));
+}
+
+template<typename ParametricType>
+bool RegionModelChecker<ParametricType>::isParallelRegionRefinementSupported() {
+#ifdef STORM_USE_CLN_RF
+    // CLN numbers share their representation with copies and count references non-atomically.
+    return false;
+#else
+    return true;
+#endif
+}
+
 template<typename ParametricType>
 void RegionModelChecker<ParametricType>::extendLocalMonotonicityResult(
     storm::storage::ParameterRegion<ParametricType> const& region, std::shared_ptr<storm::analysis::Order> order,
@@ -74,6 +74,30 @@ class RegionModelChecker {
         boost::optional<uint64_t> depthThreshold = boost::none, RegionResultHypothesis const& hypothesis = RegionResultHypothesis::Unknown,
         uint64_t monThresh = 0);
 
+    /*!
+     * Iteratively refines the region like performRegionRefinement, but analyzes several subregions concurrently.
+     * Every worker thread uses one of the given checkers, so all of them need to be specified for the same model and check task beforehand.
+     * Pending subregions are processed breadth-first, i.e., coarser regions are analyzed first. Monotonicity is not taken into account.
+     * Evaluations of the parametric functions are serialized (carl is not thread-safe), only the analysis of the instantiated models is concurrent.
+     * If the coefficients of rational functions are CLN numbers, whose reference counts are not atomic, the workers would race when copying and splitting
+     * the region bounds they share. In that case (see isParallelRegionRefinementSupported), the refinement is performed sequentially with the first checker.
+     * @param checkers the region model checkers used by the worker threads (one thread per checker)
+     * @param region the considered region
+     * @param coverageThreshold if given, the refinement stops as soon as the fraction of the area of the subregions with inconclusive result is less then this
+     * threshold
+     * @param depthThreshold if given, the refinement stops at the given depth. depth=0 means no refinement.
+     * @param hypothesis if not 'unknown', it is only checked whether the hypothesis holds within the given region.
+     */
+    static std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ParametricType>> performParallelRegionRefinement(
+        Environment const& env, std::vector<std::shared_ptr<RegionModelChecker<ParametricType>>> const& checkers,
+        storm::storage::ParameterRegion<ParametricType> const& region, boost::optional<ParametricType> const& coverageThreshold,
+        boost::optional<uint64_t> depthThreshold = boost::none, RegionResultHypothesis const& hypothesis = RegionResultHypothesis::Unknown);
+
+    /*!
+     * Returns true iff regions can be refined concurrently, i.e., if the coefficients of the region bounds can be copied safely from several threads.
+     */
+    static bool isParallelRegionRefinementSupported();
+
     // TODO return type is not quite nice
     // TODO consider returning v' as well
     /*!
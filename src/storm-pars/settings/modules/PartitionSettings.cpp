@@ -1,11 +1,14 @@
 #include "storm-pars/settings/modules/PartitionSettings.h"
 
+#include <algorithm>
+
 #include "storm/settings/Argument.h"
 #include "storm/settings/ArgumentBuilder.h"
 #include "storm/settings/Option.h"
 #include "storm/settings/OptionBuilder.h"
 
 #include "storm/exceptions/InvalidOperationException.h"
+#include "storm/utility/threads.h"
 
 namespace storm::settings::modules {
 
@@ -13,6 +16,7 @@ const std::string PartitionSettings::moduleName = "partitioning";
 const std::string requestedCoverageOptionName = "terminationCondition";
 const std::string printNoIllustrationOptionName = "noillustration";
 const std::string printFullResultOptionName = "printfullresult";
+const std::string threadsOptionName = "threads";
 
 PartitionSettings::PartitionSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, requestedCoverageOptionName, false, "The requested coverage")
@@ -31,6 +35,13 @@ PartitionSettings::PartitionSettings() : ModuleSettings(moduleName) {
         storm::settings::OptionBuilder(moduleName, printNoIllustrationOptionName, false, "If set, no illustration of the result is printed.").build());
     this->addOption(
         storm::settings::OptionBuilder(moduleName, printFullResultOptionName, false, "If set, the full result for every region is printed.").build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, threadsOptionName, false,
+                                                   "Sets the number of threads that analyze regions concurrently. Monotonicity and CLN coefficients require a "
+                                                   "single thread.")
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("number", "The number of threads (0 means 'auto-detect').")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .build())
+                        .build());
 }
 
 double PartitionSettings::getCoverageThreshold() const {
@@ -50,6 +61,14 @@ bool PartitionSettings::isPrintFullResultSet() const {
     return this->getOption(printFullResultOptionName).getHasOptionBeenSet();
 }
 
+uint64_t PartitionSettings::getNumberOfThreads() const {
+    uint64_t numberOfThreads = this->getOption(threadsOptionName).getArgumentByName("number").getValueAsUnsignedInteger();
+    if (numberOfThreads == 0) {
+        numberOfThreads = std::max(1u, storm::utility::getNumberOfThreads());
+    }
+    return numberOfThreads;
+}
+
 uint64_t PartitionSettings::getDepthLimit() const {
     int64_t depth = this->getOption(requestedCoverageOptionName).getArgumentByName("depth-limit").getValueAsInteger();
     STORM_LOG_THROW(depth >= 0, storm::exceptions::InvalidOperationException, "Tried to retrieve the depth limit but it was not set.");
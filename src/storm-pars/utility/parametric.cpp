@@ -1,3 +1,4 @@
+#include <mutex>
 #include <string>
 
 #include "storm-pars/utility/parametric.h"
@@ -12,9 +13,14 @@ namespace utility {
 namespace parametric {
 
 #ifdef STORM_HAVE_CARL
+// Carl uses global caches and non-atomic reference counts for the polynomials of rational functions. Evaluations may happen concurrently
+// (e.g. in parallel region refinement), so they are serialized. As the result is a number, no carl objects are shared outside of the lock.
+static std::mutex carlMutex;
+
 template<>
 typename CoefficientType<storm::RationalFunction>::type evaluate<storm::RationalFunction>(storm::RationalFunction const& function,
                                                                                           Valuation<storm::RationalFunction> const& valuation) {
+    std::lock_guard<std::mutex> lock(carlMutex);
     return function.evaluate(valuation);
 }
 
@@ -42,6 +42,7 @@ using Valuation = std::map<typename VariableType<FunctionType>::type, typename C
 
 /*!
  * Evaluates the given function wrt. the given valuation
+ * This may be called concurrently, also for different functions that share polynomials.
  */
 template<typename FunctionType>
 typename CoefficientType<FunctionType>::type evaluate(FunctionType const& function, Valuation<FunctionType> const& valuation);
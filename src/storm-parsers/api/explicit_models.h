@@ -6,6 +6,7 @@
 #include <type_traits>
 
 #include "storm-parsers/parser/AutoParser.h"
+#include "storm-parsers/parser/BinaryModelParser.h"
 #include "storm-parsers/parser/DirectEncodingParser.h"
 #include "storm-parsers/parser/ImcaMarkovAutomatonParser.h"
 #include "storm/exceptions/NotSupportedException.h"
@@ -32,6 +33,14 @@ std::shared_ptr<storm::models::sparse::Model<ValueType>> buildExplicitDRNModel(
     return storm::parser::DirectEncodingParser<ValueType>::parseModel(drnFile, options);
 }
 
+template<typename ValueType>
+std::shared_ptr<storm::models::sparse::Model<ValueType>> buildExplicitDRBModel(std::string const& drbFile) {
+    if constexpr (std::is_same_v<ValueType, double>) {
+        return storm::parser::BinaryModelParser::parseModel(drbFile);
+    }
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Exact or parametric models with binary input are not supported.");
+}
+
 template<typename ValueType>
 std::shared_ptr<storm::models::sparse::Model<ValueType>> buildExplicitIMCAModel(std::string const& imcaFile) {
     if constexpr (std::is_same_v<ValueType, double>) {
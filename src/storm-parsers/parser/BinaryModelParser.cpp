@@ -0,0 +1,230 @@
+#include "storm-parsers/parser/BinaryModelParser.h"
+
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <optional>
+
+#include "storm-parsers/parser/MappedFile.h"
+#include "storm/exceptions/WrongFormatException.h"
+#include "storm/io/BinaryModelFormat.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/sparse/ModelComponents.h"
+#include "storm/utility/builder.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace parser {
+
+namespace {
+
+using storm::exporter::BinaryModelFormat;
+
+storm::models::ModelType getModelType(uint32_t binaryModelType) {
+    switch (static_cast<BinaryModelFormat::ModelType>(binaryModelType)) {
+        case BinaryModelFormat::ModelType::Dtmc:
+            return storm::models::ModelType::Dtmc;
+        case BinaryModelFormat::ModelType::Ctmc:
+            return storm::models::ModelType::Ctmc;
+        case BinaryModelFormat::ModelType::Mdp:
+            return storm::models::ModelType::Mdp;
+        case BinaryModelFormat::ModelType::MarkovAutomaton:
+            return storm::models::ModelType::MarkovAutomaton;
+        case BinaryModelFormat::ModelType::Pomdp:
+            return storm::models::ModelType::Pomdp;
+    }
+    STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Unknown model type " << binaryModelType << " in binary model file.");
+}
+
+/*!
+ * Provides access to the sections of a mapped binary model file.
+ */
+class SectionReader {
+   public:
+    SectionReader(char const* fileData, uint64_t fileSize, BinaryModelFormat::Section const& section) : data(fileData), size(section.size) {
+        STORM_LOG_THROW(section.offset % BinaryModelFormat::Alignment == 0 && section.offset <= fileSize && section.size <= fileSize - section.offset,
+                        storm::exceptions::WrongFormatException, "Invalid section in binary model file.");
+        data += section.offset;
+    }
+
+    /*!
+     * Copies the content of this section into a vector with the given number of elements.
+     */
+    template<typename T>
+    std::vector<T> getVector(uint64_t numberOfElements) const {
+        // Compare via division so that large element counts can not overflow
+        STORM_LOG_THROW(size % sizeof(T) == 0 && size / sizeof(T) == numberOfElements, storm::exceptions::WrongFormatException,
+                        "Unexpected section size in binary model file.");
+        T const* begin = reinterpret_cast<T const*>(data);
+        return std::vector<T>(begin, begin + numberOfElements);
+    }
+
+    storm::storage::BitVector getBitVector(uint64_t numberOfBits) const {
+        std::vector<uint64_t> words = getVector<uint64_t>(BinaryModelFormat::getNumberOfWords(numberOfBits));
+        storm::storage::BitVector result(numberOfBits);
+        for (uint64_t word = 0; word < words.size(); ++word) {
+            uint64_t const numberOfBitsInWord = std::min<uint64_t>(64, numberOfBits - word * 64);
+            result.setFromInt(word * 64, numberOfBitsInWord, numberOfBitsInWord == 64 ? words[word] : words[word] >> (64 - numberOfBitsInWord));
+        }
+        return result;
+    }
+
+    template<typename T>
+    T const* getData() const {
+        return reinterpret_cast<T const*>(data);
+    }
+
+    uint64_t getSize() const {
+        return size;
+    }
+
+   private:
+    char const* data;
+    uint64_t size;
+};
+
+}  // namespace
+
+std::shared_ptr<storm::models::sparse::Model<double>> BinaryModelParser::parseModel(std::string const& filename) {
+    STORM_LOG_INFO("Reading from file " << filename);
+    MappedFile file(filename.c_str());
+    char const* data = file.getData();
+    uint64_t const fileSize = file.getDataSize();
+
+    // Parse header and section table.
+    BinaryModelFormat::Header header;
+    STORM_LOG_THROW(fileSize >= sizeof(header), storm::exceptions::WrongFormatException, "The file " << filename << " is not a binary model file.");
+    std::memcpy(&header, data, sizeof(header));
+    STORM_LOG_THROW(std::equal(std::begin(BinaryModelFormat::Magic), std::end(BinaryModelFormat::Magic), header.magic), storm::exceptions::WrongFormatException,
+                    "The file " << filename << " is not a binary model file.");
+    STORM_LOG_THROW(header.byteOrderMark == BinaryModelFormat::ByteOrderMark, storm::exceptions::WrongFormatException,
+                    "The binary model file " << filename << " was written on a machine with a different byte order.");
+    STORM_LOG_THROW(header.version == BinaryModelFormat::Version, storm::exceptions::WrongFormatException,
+                    "The binary model file " << filename << " has version " << header.version << " but only version " << BinaryModelFormat::Version
+                                             << " is supported.");
+    STORM_LOG_THROW(header.numberOfSections <= (fileSize - sizeof(header)) / sizeof(BinaryModelFormat::Section), storm::exceptions::WrongFormatException,
+                    "The binary model file " << filename << " is truncated.");
+    // Every row needs a row indication and every entry needs a column, so all counts are bounded by the file size.
+    // This also ensures that the computations with these counts below can not overflow.
+    STORM_LOG_THROW(header.numberOfRows < fileSize / sizeof(uint64_t) && header.numberOfEntries <= fileSize / sizeof(uint64_t) &&
+                        header.numberOfStates <= header.numberOfRows && header.numberOfColumns == header.numberOfStates,
+                    storm::exceptions::WrongFormatException, "The binary model file " << filename << " has an invalid header.");
+    std::vector<BinaryModelFormat::Section> sections(header.numberOfSections);
+    std::memcpy(sections.data(), data + sizeof(header), sections.size() * sizeof(BinaryModelFormat::Section));
+
+    std::optional<SectionReader> namesSection;
+    for (auto const& section : sections) {
+        if (section.kind == static_cast<uint32_t>(BinaryModelFormat::SectionKind::Names)) {
+            namesSection.emplace(data, fileSize, section);
+        }
+    }
+    auto getName = [&namesSection](BinaryModelFormat::Section const& section) {
+        STORM_LOG_THROW(namesSection && section.nameOffset <= namesSection->getSize() && section.nameLength <= namesSection->getSize() - section.nameOffset,
+                        storm::exceptions::WrongFormatException, "Invalid section name in binary model file.");
+        return std::string(namesSection->getData<char>() + section.nameOffset, section.nameLength);
+    };
+
+    // Build the model components. Each section is copied exactly once into the corresponding component.
+    storm::models::ModelType const type = getModelType(header.modelType);
+    storm::storage::sparse::ModelComponents<double> components;
+    components.stateLabeling = storm::models::sparse::StateLabeling(header.numberOfStates);
+    components.rateTransitions = (header.flags & BinaryModelFormat::RateTransitionsFlag) != 0;
+    std::vector<uint64_t> rowIndications;
+    std::optional<SectionReader> columnsSection, valuesSection;
+    boost::optional<std::vector<uint64_t>> rowGroupIndices;
+    std::map<std::string, std::pair<std::optional<std::vector<double>>, std::optional<std::vector<double>>>> rewardVectors;
+    for (auto const& section : sections) {
+        SectionReader reader(data, fileSize, section);
+        switch (static_cast<BinaryModelFormat::SectionKind>(section.kind)) {
+            case BinaryModelFormat::SectionKind::Names:
+                break;
+            case BinaryModelFormat::SectionKind::RowIndications:
+                rowIndications = reader.getVector<uint64_t>(header.numberOfRows + 1);
+                break;
+            case BinaryModelFormat::SectionKind::Columns:
+                columnsSection = reader;
+                break;
+            case BinaryModelFormat::SectionKind::Values:
+                valuesSection = reader;
+                break;
+            case BinaryModelFormat::SectionKind::RowGroupIndices:
+                rowGroupIndices = reader.getVector<uint64_t>(header.numberOfStates + 1);
+                break;
+            case BinaryModelFormat::SectionKind::StateLabel:
+                components.stateLabeling.addLabel(getName(section), reader.getBitVector(header.numberOfStates));
+                break;
+            case BinaryModelFormat::SectionKind::ChoiceLabel:
+                if (!components.choiceLabeling) {
+                    components.choiceLabeling = storm::models::sparse::ChoiceLabeling(header.numberOfRows);
+                }
+                components.choiceLabeling->addLabel(getName(section), reader.getBitVector(header.numberOfRows));
+                break;
+            case BinaryModelFormat::SectionKind::StateRewards:
+                rewardVectors[getName(section)].first = reader.getVector<double>(header.numberOfStates);
+                break;
+            case BinaryModelFormat::SectionKind::ActionRewards:
+                rewardVectors[getName(section)].second = reader.getVector<double>(header.numberOfRows);
+                break;
+            case BinaryModelFormat::SectionKind::ExitRates:
+                components.exitRates = reader.getVector<double>(header.numberOfStates);
+                break;
+            case BinaryModelFormat::SectionKind::MarkovianStates:
+                components.markovianStates = reader.getBitVector(header.numberOfStates);
+                break;
+            case BinaryModelFormat::SectionKind::Observations:
+                components.observabilityClasses = reader.getVector<uint32_t>(header.numberOfStates);
+                break;
+            default:
+                STORM_LOG_WARN("Ignoring unknown section of kind " << section.kind << " in binary model file.");
+        }
+    }
+
+    // Build the transition matrix.
+    STORM_LOG_THROW(!rowIndications.empty() && columnsSection && valuesSection, storm::exceptions::WrongFormatException,
+                    "The binary model file " << filename << " does not contain a transition matrix.");
+    STORM_LOG_THROW(rowIndications.front() == 0 && rowIndications.back() == header.numberOfEntries && std::is_sorted(rowIndications.begin(), rowIndications.end()),
+                    storm::exceptions::WrongFormatException, "Invalid row indications in binary model file.");
+    STORM_LOG_THROW(columnsSection->getSize() % sizeof(uint64_t) == 0 && columnsSection->getSize() / sizeof(uint64_t) == header.numberOfEntries &&
+                        valuesSection->getSize() % sizeof(double) == 0 && valuesSection->getSize() / sizeof(double) == header.numberOfEntries,
+                    storm::exceptions::WrongFormatException, "Unexpected section size in binary model file.");
+    if (rowGroupIndices) {
+        STORM_LOG_THROW(rowGroupIndices->front() == 0 && rowGroupIndices->back() == header.numberOfRows &&
+                            std::is_sorted(rowGroupIndices->begin(), rowGroupIndices->end()),
+                        storm::exceptions::WrongFormatException, "Invalid row group indices in binary model file.");
+        STORM_LOG_THROW(std::adjacent_find(rowGroupIndices->begin(), rowGroupIndices->end()) == rowGroupIndices->end(),
+                        storm::exceptions::WrongFormatException, "The binary model file " << filename << " contains an empty row group.");
+    } else {
+        STORM_LOG_THROW(header.numberOfRows == header.numberOfStates, storm::exceptions::WrongFormatException,
+                        "The binary model file " << filename << " has more rows than states but no row group indices.");
+    }
+    STORM_LOG_THROW(!(type == storm::models::ModelType::Dtmc || type == storm::models::ModelType::Ctmc) || header.numberOfRows == header.numberOfStates,
+                    storm::exceptions::WrongFormatException,
+                    "The binary model file " << filename << " describes a deterministic model with multiple choices per state.");
+    std::vector<storm::storage::MatrixEntry<uint64_t, double>> columnsAndValues;
+    columnsAndValues.reserve(header.numberOfEntries);
+    uint64_t const* columns = columnsSection->getData<uint64_t>();
+    double const* values = valuesSection->getData<double>();
+    uint64_t maximalColumn = 0;
+    for (uint64_t row = 0; row < header.numberOfRows; ++row) {
+        for (uint64_t entry = rowIndications[row]; entry < rowIndications[row + 1]; ++entry) {
+            // The entries of each row have to be sorted by their column and columns must not occur twice.
+            STORM_LOG_THROW(entry == rowIndications[row] || columns[entry - 1] < columns[entry], storm::exceptions::WrongFormatException,
+                            "Unsorted or duplicate column " << columns[entry] << " in row " << row << " of binary model file.");
+            maximalColumn = std::max(maximalColumn, columns[entry]);
+            columnsAndValues.emplace_back(columns[entry], values[entry]);
+        }
+    }
+    STORM_LOG_THROW(header.numberOfEntries == 0 || maximalColumn < header.numberOfColumns, storm::exceptions::WrongFormatException,
+                    "Invalid column in binary model file.");
+    components.transitionMatrix =
+        storm::storage::SparseMatrix<double>(header.numberOfColumns, std::move(rowIndications), std::move(columnsAndValues), std::move(rowGroupIndices));
+
+    for (auto& [name, rewards] : rewardVectors) {
+        components.rewardModels.emplace(name, storm::models::sparse::StandardRewardModel<double>(std::move(rewards.first), std::move(rewards.second)));
+    }
+
+    return storm::utility::builder::buildModelFromComponents(type, std::move(components));
+}
+
+}  // namespace parser
+}  // namespace storm
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "storm/models/sparse/Model.h"
+
+namespace storm {
+namespace parser {
+
+/*!
+ * Loads models in the binary drb format as written by storm::exporter::explicitExportSparseModelBinary.
+ *
+ * The file is mapped to memory and the sections are directly accessed as arrays. As the model components own their data, every section is copied exactly
+ * once into its final location, i.e., no intermediate representations are created.
+ */
+class BinaryModelParser {
+   public:
+    /*!
+     * Loads the model from the given file.
+     *
+     * @param filename The drb file to be loaded.
+     * @return A sparse model
+     */
+    static std::shared_ptr<storm::models::sparse::Model<double>> parseModel(std::string const& filename);
+};
+
+}  // namespace parser
+}  // namespace storm
@@ -2,12 +2,16 @@
 
 #include <boost/algorithm/string.hpp>
 #include <boost/algorithm/string/predicate.hpp>
+#include <charconv>
 #include <iostream>
+#include <map>
 #include <regex>
 #include <string>
+#include <string_view>
 
 #include "storm/adapters/RationalFunctionAdapter.h"
 
+#include "storm-parsers/parser/MappedFile.h"
 #include "storm-parsers/parser/ValueParser.h"
 
 #include "storm/exceptions/AbortException.h"
@@ -23,13 +27,504 @@
 #include "storm/models/sparse/Ctmc.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
 #include "storm/utility/SignalHandler.h"
+#include "storm/utility/TaskPool.h"
 #include "storm/utility/builder.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/threads.h"
 
 namespace storm {
 namespace parser {
 
+namespace {
+
+bool isBlank(char c) {
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+std::string_view trimLeft(std::string_view str) {
+    while (!str.empty() && isBlank(str.front())) {
+        str.remove_prefix(1);
+    }
+    return str;
+}
+
+std::string_view trim(std::string_view str) {
+    str = trimLeft(str);
+    while (!str.empty() && isBlank(str.back())) {
+        str.remove_suffix(1);
+    }
+    return str;
+}
+
+/*!
+ * Removes the next whitespace-separated token from the given string and returns it.
+ */
+std::string_view nextToken(std::string_view& str) {
+    str = trimLeft(str);
+    std::string_view token = str.substr(0, str.find_first_of(" \t\r"));
+    str.remove_prefix(token.size());
+    return token;
+}
+
+template<typename IntegerType>
+IntegerType parseInteger(std::string_view str) {
+    IntegerType result;
+    auto [end, error] = std::from_chars(str.data(), str.data() + str.size(), result);
+    STORM_LOG_THROW(error == std::errc() && end == str.data() + str.size(), storm::exceptions::WrongFormatException,
+                    "Could not parse '" << str << "' as an integer.");
+    return result;
+}
+
+/*!
+ * Parses double values (or placeholders) without creating intermediate strings whenever possible.
+ */
+class DoubleValueParser {
+   public:
+    DoubleValueParser(std::unordered_map<std::string, double> const& placeholders, ValueParser<double> const& valueParser)
+        : placeholders(placeholders), valueParser(valueParser) {
+        // Intentionally left empty.
+    }
+
+    double parse(std::string_view str) const {
+        if (!str.empty() && str.front() == '$') {
+            auto it = placeholders.find(std::string(str.substr(1)));
+            STORM_LOG_THROW(it != placeholders.end(), storm::exceptions::WrongFormatException, "Placeholder " << str << " unknown.");
+            return it->second;
+        }
+#ifdef __cpp_lib_to_chars
+        double result;
+        auto [end, error] = std::from_chars(str.data(), str.data() + str.size(), result);
+        if (error == std::errc() && end == str.data() + str.size()) {
+            return result;
+        }
+#endif
+        // Fall back to the default parser, which for example also handles fractions.
+        return valueParser.parseValue(std::string(str));
+    }
+
+   private:
+    std::unordered_map<std::string, double> const& placeholders;
+    ValueParser<double> const& valueParser;
+};
+
+/*!
+ * The information of a chunk of the model section, i.e., of a sequence of consecutive states.
+ * Rows are numbered relative to the first row of the chunk.
+ */
+struct DrnChunk {
+    std::string_view content;
+    uint64_t firstState = 0;
+    uint64_t numberOfStates = 0;
+    // The (local) first row of each state.
+    std::vector<uint64_t> rowGroupIndices;
+    // The (local) position of the first entry of each row.
+    std::vector<uint64_t> rowIndications;
+    std::vector<storm::storage::MatrixEntry<uint64_t, double>> entries;
+    std::vector<double> exitRates;
+    std::vector<uint32_t> observations;
+    // The rewards indexed by reward model and local state (or row). The vector of a reward model is empty (or too short) if the rewards are zero.
+    std::vector<std::vector<double>> stateRewards;
+    std::vector<std::vector<double>> actionRewards;
+    // The labeled states (global ids) and the labeled choices (local rows).
+    std::map<std::string, std::vector<uint64_t>> stateLabels;
+    std::map<std::string, std::vector<uint64_t>> choiceLabels;
+};
+
+/*!
+ * Returns the beginning of the first line at or after the given position that declares a state.
+ */
+uint64_t findNextStateDeclaration(std::string_view content, uint64_t position) {
+    if (position > 0 && content[position - 1] != '\n') {
+        position = content.find('\n', position);
+        position = position == std::string_view::npos ? content.size() : position + 1;
+    }
+    while (position < content.size()) {
+        uint64_t const lineEnd = std::min(content.find('\n', position), content.size());
+        if (trimLeft(content.substr(position, lineEnd - position)).starts_with("state ")) {
+            return position;
+        }
+        position = lineEnd + 1;
+    }
+    return content.size();
+}
+
+/*!
+ * Splits the model section into (at most) the given number of chunks of roughly equal size. Each chunk except the first starts with a state declaration.
+ */
+std::vector<DrnChunk> splitIntoChunks(std::string_view content, uint64_t numberOfChunks) {
+    std::vector<DrnChunk> chunks;
+    uint64_t chunkBegin = 0;
+    for (uint64_t chunk = 1; chunk <= numberOfChunks && chunkBegin < content.size(); ++chunk) {
+        uint64_t chunkEnd = content.size();
+        if (chunk < numberOfChunks) {
+            chunkEnd = findNextStateDeclaration(content, std::max<uint64_t>(chunkBegin + 1, content.size() * chunk / numberOfChunks));
+        }
+        chunks.emplace_back();
+        chunks.back().content = content.substr(chunkBegin, chunkEnd - chunkBegin);
+        chunkBegin = chunkEnd;
+    }
+    return chunks;
+}
+
+/*!
+ * Parses a reward declaration of the form [r_1, ..., r_n] at the beginning of the given line and removes it from the line.
+ */
+void parseRewards(std::string_view& line, std::vector<std::vector<double>>& rewards, uint64_t index, DoubleValueParser const& valueParser) {
+    size_t const posEndReward = line.find(']');
+    STORM_LOG_THROW(posEndReward != std::string_view::npos, storm::exceptions::WrongFormatException, "] missing in '" << line << "'.");
+    std::string_view rewardsStr = line.substr(1, posEndReward - 1);
+    line.remove_prefix(posEndReward + 1);
+    for (uint64_t rewardModel = 0; true; ++rewardModel) {
+        size_t const posComma = rewardsStr.find(',');
+        double const rewardValue = valueParser.parse(trim(rewardsStr.substr(0, posComma)));
+        if (rewards.size() <= rewardModel) {
+            rewards.resize(rewardModel + 1);
+        }
+        if (!storm::utility::isZero(rewardValue)) {
+            if (rewards[rewardModel].size() <= index) {
+                rewards[rewardModel].resize(index + 1, storm::utility::zero<double>());
+            }
+            rewards[rewardModel][index] = rewardValue;
+        }
+        if (posComma == std::string_view::npos) {
+            break;
+        }
+        rewardsStr.remove_prefix(posComma + 1);
+    }
+}
+
+/*!
+ * Sorts the entries of the row starting at the given position by column and sums up entries with the same column.
+ */
+void sortAndMergeRow(std::vector<storm::storage::MatrixEntry<uint64_t, double>>& entries, uint64_t rowStart) {
+    auto const rowBegin = entries.begin() + rowStart;
+    std::sort(rowBegin, entries.end(), [](auto const& lhs, auto const& rhs) { return lhs.getColumn() < rhs.getColumn(); });
+    auto insertIt = rowBegin;
+    for (auto it = rowBegin + 1; it != entries.end(); ++it) {
+        if (it->getColumn() == insertIt->getColumn()) {
+            insertIt->setValue(insertIt->getValue() + it->getValue());
+        } else {
+            *(++insertIt) = *it;
+        }
+    }
+    ++insertIt;
+    STORM_LOG_WARN_COND(insertIt == entries.end(), "Duplicate transitions in a row were summed up.");
+    entries.erase(insertIt, entries.end());
+}
+
+void parseChunk(DrnChunk& chunk, storm::models::ModelType type, uint64_t stateSize, bool buildChoiceLabeling, DoubleValueParser const& valueParser) {
+    bool const continuousTime = (type == storm::models::ModelType::Ctmc || type == storm::models::ModelType::MarkovAutomaton);
+    bool firstActionForState = true;
+    bool currentRowIsUnsorted = false;
+    auto startNewRow = [&chunk, &currentRowIsUnsorted]() {
+        if (currentRowIsUnsorted) {
+            sortAndMergeRow(chunk.entries, chunk.rowIndications.back());
+            currentRowIsUnsorted = false;
+        }
+        chunk.rowIndications.push_back(chunk.entries.size());
+    };
+
+    std::string_view content = chunk.content;
+    while (!content.empty()) {
+        size_t const posNewline = content.find('\n');
+        std::string_view line = trim(content.substr(0, posNewline));
+        content.remove_prefix(posNewline == std::string_view::npos ? content.size() : posNewline + 1);
+        if (line.empty() || line.starts_with("//")) {
+            continue;
+        }
+
+        if (line.starts_with("state ")) {
+            // New state
+            line.remove_prefix(6);
+            uint64_t const state = parseInteger<uint64_t>(nextToken(line));
+            if (chunk.numberOfStates == 0) {
+                chunk.firstState = state;
+            } else {
+                STORM_LOG_THROW(state == chunk.firstState + chunk.numberOfStates, storm::exceptions::WrongFormatException,
+                                "State ids are not ordered and without gaps. Expected " << chunk.firstState + chunk.numberOfStates << " but got " << state
+                                                                                        << ".");
+            }
+            STORM_LOG_THROW(state < stateSize, storm::exceptions::WrongFormatException, "More states detected than declared (in @nr_states).");
+            ++chunk.numberOfStates;
+            chunk.rowGroupIndices.push_back(chunk.rowIndications.size());
+            startNewRow();
+            firstActionForState = true;
+
+            if (continuousTime) {
+                // Parse exit rate for CTMC or MA
+                line = trimLeft(line);
+                STORM_LOG_THROW(line.starts_with('!'), storm::exceptions::WrongFormatException, "Exit rate missing for state " << state << ".");
+                line.remove_prefix(1);
+                chunk.exitRates.push_back(valueParser.parse(nextToken(line)));
+            }
+
+            // Parse rewards and observation
+            bool sawObservation = false;
+            while (true) {
+                line = trimLeft(line);
+                if (line.starts_with('[')) {
+                    parseRewards(line, chunk.stateRewards, state - chunk.firstState, valueParser);
+                } else if (type == storm::models::ModelType::Pomdp && line.starts_with('{')) {
+                    size_t const posEndObservation = line.find('}');
+                    STORM_LOG_THROW(posEndObservation != std::string_view::npos, storm::exceptions::WrongFormatException,
+                                    "} missing for state " << state << ".");
+                    chunk.observations.push_back(parseInteger<uint32_t>(trim(line.substr(1, posEndObservation - 1))));
+                    line.remove_prefix(posEndObservation + 1);
+                    sawObservation = true;
+                } else {
+                    break;
+                }
+            }
+            STORM_LOG_THROW(type != storm::models::ModelType::Pomdp || sawObservation, storm::exceptions::WrongFormatException,
+                            "Expected an observation for state " << state << ".");
+
+            // Parse labels. Labels are separated by whitespace and can optionally be enclosed in quotation marks.
+            while (!(line = trimLeft(line)).empty()) {
+                std::string_view label;
+                if (line.front() == '\"') {
+                    size_t const posEndLabel = line.find('\"', 1);
+                    STORM_LOG_THROW(posEndLabel != std::string_view::npos, storm::exceptions::WrongFormatException,
+                                    "Missing quotation mark in labels of state " << state << ".");
+                    label = line.substr(1, posEndLabel - 1);
+                    line.remove_prefix(posEndLabel + 1);
+                } else {
+                    label = nextToken(line);
+                }
+                if (!label.empty()) {
+                    chunk.stateLabels[std::string(label)].push_back(state);
+                }
+            }
+
+            if (storm::utility::resources::isTerminate()) {
+                STORM_LOG_THROW(false, storm::exceptions::AbortException, "Aborted while parsing state " << state << ".");
+            }
+        } else if (line.starts_with("action ")) {
+            // New action
+            STORM_LOG_THROW(chunk.numberOfStates > 0, storm::exceptions::WrongFormatException, "Action declared before the first state.");
+            if (firstActionForState) {
+                firstActionForState = false;
+            } else {
+                startNewRow();
+            }
+            line.remove_prefix(7);
+            std::string_view const actionName = nextToken(line);
+            uint64_t const row = chunk.rowIndications.size() - 1;
+            if (buildChoiceLabeling && actionName != "__NOLABEL__") {
+                chunk.choiceLabels[std::string(actionName)].push_back(row);
+            }
+            line = trimLeft(line);
+            if (line.starts_with('[')) {
+                parseRewards(line, chunk.actionRewards, row, valueParser);
+            }
+        } else {
+            // New transition
+            STORM_LOG_THROW(chunk.numberOfStates > 0, storm::exceptions::WrongFormatException, "Transition declared before the first state.");
+            size_t const posColon = line.find(':');
+            STORM_LOG_THROW(posColon != std::string_view::npos, storm::exceptions::WrongFormatException, "':' not found in '" << line << "'.");
+            uint64_t const target = parseInteger<uint64_t>(trim(line.substr(0, posColon)));
+            STORM_LOG_THROW(target < stateSize, storm::exceptions::WrongFormatException,
+                            "Target state " << target << " is greater than state size " << stateSize << ".");
+            double const value = valueParser.parse(trim(line.substr(posColon + 1)));
+            if (chunk.entries.size() > chunk.rowIndications.back()) {
+                auto& lastEntry = chunk.entries.back();
+                if (lastEntry.getColumn() == target) {
+                    lastEntry.setValue(lastEntry.getValue() + value);
+                    continue;
+                }
+                currentRowIsUnsorted |= target < lastEntry.getColumn();
+            }
+            chunk.entries.emplace_back(target, value);
+        }
+    }
+    if (currentRowIsUnsorted) {
+        sortAndMergeRow(chunk.entries, chunk.rowIndications.back());
+    }
+}
+
+/*!
+ * Calls the given task for each index in {0, ..., numberOfTasks - 1} using the given pool.
+ * Exceptions are rethrown in the calling thread. If several tasks throw, the exception of the task with the smallest index is rethrown so that errors in
+ * the file are reported deterministically.
+ */
+void executeInParallel(storm::utility::TaskPool& pool, uint64_t numberOfTasks, std::function<void(uint64_t)> const& task) {
+    std::vector<std::exception_ptr> exceptions(numberOfTasks);
+    for (uint64_t taskIndex = 0; taskIndex < numberOfTasks; ++taskIndex) {
+        pool.submit([&task, &exceptions, taskIndex]() {
+            try {
+                task(taskIndex);
+            } catch (...) {
+                exceptions[taskIndex] = std::current_exception();
+            }
+        });
+    }
+    pool.wait();
+    for (auto const& exception : exceptions) {
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+    }
+}
+
+/*!
+ * Parses the states of a model with double values. The model section of the memory-mapped file is split into chunks at state declarations.
+ * The chunks are parsed independently (possibly by several threads) and are then stitched together.
+ */
+std::shared_ptr<storm::storage::sparse::ModelComponents<double>> parseStatesFromMappedFile(
+    std::string const& filename, int64_t modelSectionOffset, storm::models::ModelType type, size_t stateSize, size_t nrChoices,
+    std::unordered_map<std::string, double> const& placeholders, ValueParser<double> const& valueParser, std::vector<std::string> const& rewardModelNames,
+    DirectEncodingParserOptions const& options) {
+    MappedFile file(filename.c_str());
+    // A negative offset indicates that the model section is empty.
+    uint64_t const offset = modelSectionOffset < 0 ? file.getDataSize() : std::min<uint64_t>(modelSectionOffset, file.getDataSize());
+    std::string_view const content(file.getData() + offset, file.getDataSize() - offset);
+
+    // Parse chunks
+    uint64_t const numberOfThreads = options.numberOfThreads == 0 ? std::max(1u, storm::utility::getNumberOfThreads()) : options.numberOfThreads;
+    uint64_t const minimalChunkSize = std::max<uint64_t>(1, options.minimalChunkSize);
+    uint64_t const numberOfChunks = numberOfThreads == 1 ? 1 : std::min<uint64_t>(numberOfThreads * 4, content.size() / minimalChunkSize + 1);
+    std::vector<DrnChunk> chunks = splitIntoChunks(content, numberOfChunks);
+    STORM_LOG_DEBUG("Parsing " << chunks.size() << " chunk(s) of the model section using " << numberOfThreads << " thread(s).");
+    DoubleValueParser const doubleValueParser(placeholders, valueParser);
+    storm::utility::TaskPool pool(std::min<uint64_t>(numberOfThreads, chunks.size()));
+    executeInParallel(pool, chunks.size(), [&](uint64_t chunk) { parseChunk(chunks[chunk], type, stateSize, options.buildChoiceLabeling, doubleValueParser); });
+
+    // Compute the position of each chunk
+    bool const nonDeterministic =
+        (type == storm::models::ModelType::Mdp || type == storm::models::ModelType::MarkovAutomaton || type == storm::models::ModelType::Pomdp);
+    std::vector<uint64_t> rowOffsets, entryOffsets;
+    uint64_t numberOfRows = 0, numberOfEntries = 0, numberOfStates = 0;
+    for (auto const& chunk : chunks) {
+        STORM_LOG_THROW(chunk.numberOfStates == 0 || chunk.firstState == numberOfStates, storm::exceptions::WrongFormatException,
+                        "State ids are not ordered and without gaps. Expected " << numberOfStates << " but got " << chunk.firstState << ".");
+        rowOffsets.push_back(numberOfRows);
+        entryOffsets.push_back(numberOfEntries);
+        numberOfStates += chunk.numberOfStates;
+        numberOfRows += chunk.rowIndications.size();
+        numberOfEntries += chunk.entries.size();
+    }
+    if (nonDeterministic) {
+        STORM_LOG_THROW(nrChoices == 0 || numberOfRows == nrChoices, storm::exceptions::WrongFormatException,
+                        "Number of actions detected (" << numberOfRows << ") does not match number of actions declared (" << nrChoices << ", in @nr_choices).");
+    }
+
+    // Stitch the chunks together
+    auto modelComponents = std::make_shared<storm::storage::sparse::ModelComponents<double>>();
+    std::vector<uint64_t> rowIndications(numberOfRows + 1, numberOfEntries);
+    std::vector<storm::storage::MatrixEntry<uint64_t, double>> columnsAndValues(numberOfEntries);
+    boost::optional<std::vector<uint64_t>> rowGroupIndices;
+    if (nonDeterministic) {
+        rowGroupIndices = std::vector<uint64_t>(stateSize + 1, numberOfRows);
+    }
+    executeInParallel(pool, chunks.size(), [&](uint64_t chunkIndex) {
+        DrnChunk& chunk = chunks[chunkIndex];
+        std::copy(chunk.entries.begin(), chunk.entries.end(), columnsAndValues.begin() + entryOffsets[chunkIndex]);
+        for (uint64_t row = 0; row < chunk.rowIndications.size(); ++row) {
+            rowIndications[rowOffsets[chunkIndex] + row] = entryOffsets[chunkIndex] + chunk.rowIndications[row];
+        }
+        if (nonDeterministic) {
+            for (uint64_t state = 0; state < chunk.numberOfStates; ++state) {
+                rowGroupIndices.get()[chunk.firstState + state] = rowOffsets[chunkIndex] + chunk.rowGroupIndices[state];
+            }
+        }
+        // Free the memory of the chunk as early as possible.
+        chunk.entries = {};
+        chunk.rowIndications = {};
+        chunk.rowGroupIndices = {};
+    });
+    modelComponents->transitionMatrix =
+        storm::storage::SparseMatrix<double>(stateSize, std::move(rowIndications), std::move(columnsAndValues), std::move(rowGroupIndices));
+    STORM_LOG_TRACE("Built matrix");
+
+    // Build labelings
+    std::map<std::string, storm::storage::BitVector> stateLabels;
+    for (auto const& chunk : chunks) {
+        for (auto const& [label, states] : chunk.stateLabels) {
+            auto& labeledStates = stateLabels.try_emplace(label, stateSize).first->second;
+            for (auto state : states) {
+                labeledStates.set(state);
+            }
+        }
+    }
+    modelComponents->stateLabeling = storm::models::sparse::StateLabeling(stateSize);
+    for (auto& [label, states] : stateLabels) {
+        modelComponents->stateLabeling.addLabel(label, std::move(states));
+    }
+    if (options.buildChoiceLabeling) {
+        std::map<std::string, storm::storage::BitVector> choiceLabels;
+        for (uint64_t chunkIndex = 0; chunkIndex < chunks.size(); ++chunkIndex) {
+            for (auto const& [label, rows] : chunks[chunkIndex].choiceLabels) {
+                auto& labeledChoices = choiceLabels.try_emplace(label, nrChoices).first->second;
+                for (auto row : rows) {
+                    STORM_LOG_THROW(rowOffsets[chunkIndex] + row < nrChoices, storm::exceptions::WrongFormatException,
+                                    "More actions detected than declared (in @nr_choices).");
+                    labeledChoices.set(rowOffsets[chunkIndex] + row);
+                }
+            }
+        }
+        modelComponents->choiceLabeling = storm::models::sparse::ChoiceLabeling(nrChoices);
+        for (auto& [label, choices] : choiceLabels) {
+            modelComponents->choiceLabeling->addLabel(label, std::move(choices));
+        }
+    }
+
+    // Build exit rates and observations
+    bool const continuousTime = (type == storm::models::ModelType::Ctmc || type == storm::models::ModelType::MarkovAutomaton);
+    if (continuousTime) {
+        modelComponents->exitRates = std::vector<double>(stateSize);
+        for (auto const& chunk : chunks) {
+            std::copy(chunk.exitRates.begin(), chunk.exitRates.end(), modelComponents->exitRates->begin() + chunk.firstState);
+        }
+        if (type == storm::models::ModelType::MarkovAutomaton) {
+            modelComponents->markovianStates = storm::storage::BitVector(stateSize);
+            for (uint64_t state = 0; state < stateSize; ++state) {
+                if (!storm::utility::isZero(modelComponents->exitRates.get()[state])) {
+                    modelComponents->markovianStates->set(state);
+                }
+            }
+        }
+    }
+    // We parse rates for continuous time models.
+    if (type == storm::models::ModelType::Ctmc) {
+        modelComponents->rateTransitions = true;
+    }
+    modelComponents->observabilityClasses = std::vector<uint32_t>(stateSize);
+    for (auto const& chunk : chunks) {
+        std::copy(chunk.observations.begin(), chunk.observations.end(), modelComponents->observabilityClasses->begin() + chunk.firstState);
+    }
+
+    // Build reward models
+    uint64_t numRewardModels = 0;
+    for (auto const& chunk : chunks) {
+        numRewardModels = std::max<uint64_t>({numRewardModels, chunk.stateRewards.size(), chunk.actionRewards.size()});
+    }
+    for (uint64_t i = 0; i < numRewardModels; ++i) {
+        std::optional<std::vector<double>> stateRewardVector, actionRewardVector;
+        for (uint64_t chunkIndex = 0; chunkIndex < chunks.size(); ++chunkIndex) {
+            auto const& chunk = chunks[chunkIndex];
+            if (i < chunk.stateRewards.size() && !chunk.stateRewards[i].empty()) {
+                if (!stateRewardVector) {
+                    stateRewardVector = std::vector<double>(stateSize, storm::utility::zero<double>());
+                }
+                std::copy(chunk.stateRewards[i].begin(), chunk.stateRewards[i].end(), stateRewardVector->begin() + chunk.firstState);
+            }
+            if (i < chunk.actionRewards.size() && !chunk.actionRewards[i].empty()) {
+                if (!actionRewardVector) {
+                    actionRewardVector = std::vector<double>(numberOfRows, storm::utility::zero<double>());
+                }
+                std::copy(chunk.actionRewards[i].begin(), chunk.actionRewards[i].end(), actionRewardVector->begin() + rowOffsets[chunkIndex]);
+            }
+        }
+        std::string const rewardModelName = i < rewardModelNames.size() ? rewardModelNames[i] : "rew" + std::to_string(i);
+        modelComponents->rewardModels.emplace(rewardModelName,
+                                              storm::models::sparse::StandardRewardModel<double>(std::move(stateRewardVector), std::move(actionRewardVector)));
+    }
+    STORM_LOG_TRACE("Built reward models");
+    return modelComponents;
+}
+
+}  // namespace
+
 template<typename ValueType, typename RewardModelType>
 std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> DirectEncodingParser<ValueType, RewardModelType>::parseModel(
     std::string const& filename, DirectEncodingParserOptions const& options) {
@@ -118,6 +613,14 @@ std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> Direct
                             "No. of actions (@nr_choices) has to be declared before model.");
             STORM_LOG_WARN_COND(nrChoices != 0, "No. of actions has to be declared. We may continue now, but future versions might not support this.");
             // Construct model components
+            if constexpr (std::is_same_v<ValueType, double> && std::is_same_v<RewardModelType, storm::models::sparse::StandardRewardModel<double>>) {
+                // Models with double values are parsed from the memory-mapped file, possibly using several threads.
+                if (options.useMemoryMappedFile) {
+                    modelComponents = parseStatesFromMappedFile(filename, static_cast<int64_t>(file.tellg()), type, nrStates, nrChoices, placeholders,
+                                                                valueParser, rewardModelNames, options);
+                    break;
+                }
+            }
             modelComponents = parseStates(file, type, nrStates, nrChoices, placeholders, valueParser, rewardModelNames, options);
             break;
         } else {
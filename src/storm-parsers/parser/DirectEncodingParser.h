@@ -13,6 +13,18 @@ class ValueParser;
 
 struct DirectEncodingParserOptions {
     bool buildChoiceLabeling = false;
+    /*!
+     * The number of threads that parse the states of models with double values (0 means 'auto-detect').
+     */
+    uint64_t numberOfThreads = 1;
+    /*!
+     * The minimal size (in bytes) of the model section a single thread parses when several threads are used.
+     */
+    uint64_t minimalChunkSize = 1ull << 20;
+    /*!
+     * If set, models with double values are parsed from a memory-mapped file. Otherwise, the line-based parser is used for all models.
+     */
+    bool useMemoryMappedFile = true;
 };
 /*!
  *	Parser for models in the DRN format with explicit encoding.
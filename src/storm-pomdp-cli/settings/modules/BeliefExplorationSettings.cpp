@@ -7,6 +7,7 @@
 #include "storm-pomdp/modelchecker/BeliefExplorationPomdpModelCheckerOptions.h"
 #include "storm/adapters/RationalNumberAdapter.h"
 #include "storm/utility/NumberTraits.h"
+#include "storm/utility/threads.h"
 
 namespace storm {
 namespace settings {
@@ -24,6 +25,9 @@ const std::string optimalChoiceValueThresholdOption = "optimal-choice-value-thre
 const std::string observationThresholdOption = "obs-threshold";
 const std::string numericPrecisionOption = "numeric-precision";
 const std::string triangulationModeOption = "triangulationmode";
+const std::string beliefFixedPointOption = "belief-fixed-point";
+const std::string explorationThreadsOption = "exploration-threads";
+const std::string pointBasedOption = "point-based";
 const std::string clippingOption = "use-clipping";
 const std::string cutZeroGapOption = "cut-zero-gap";
 const std::string stateEliminationCutoffOption = "state-elimination-cutoff";
@@ -151,6 +155,31 @@ BeliefExplorationSettings::BeliefExplorationSettings() : ModuleSettings(moduleNa
                                          .addValidatorString(storm::settings::ArgumentValidatorFactory::createMultipleChoiceValidator({"dynamic", "static"}))
                                          .build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, beliefFixedPointOption, false,
+                                                   "If set, belief probabilities are rounded to fixed-point numbers when comparing beliefs.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("bits", "the number of fractional bits")
+                                         .setDefaultValueUnsignedInteger(40)
+                                         .makeOptional()
+                                         .addValidatorUnsignedInteger(storm::settings::ArgumentValidatorFactory::createUnsignedRangeValidatorIncluding(1, 62))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, explorationThreadsOption, false,
+                                                   "Sets the number of threads that expand beliefs. Also refines both approximations concurrently.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("number", "The number of threads (0 means 'auto-detect').")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, pointBasedOption, false,
+                                                   "If set, point-based value iteration improves the initial bounds and the cut-off values.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("beliefs", "the maximal number of sampled beliefs")
+                                         .setDefaultValueUnsignedInteger(1000)
+                                         .makeOptional()
+                                         .addValidatorUnsignedInteger(storm::settings::ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
     this->addOption(
         storm::settings::OptionBuilder(moduleName, clippingOption, false, "If this is set, unfolding will use  (grid) clipping instead of cut-offs only.")
             .build());
@@ -241,6 +270,30 @@ bool BeliefExplorationSettings::isStaticTriangulationModeSet() const {
     return this->getOption(triangulationModeOption).getArgumentByName("value").getValueAsString() == "static";
 }
 
+bool BeliefExplorationSettings::isBeliefFixedPointSet() const {
+    return this->getOption(beliefFixedPointOption).getHasOptionBeenSet();
+}
+
+uint64_t BeliefExplorationSettings::getBeliefFixedPointBits() const {
+    return this->getOption(beliefFixedPointOption).getArgumentByName("bits").getValueAsUnsignedInteger();
+}
+
+uint64_t BeliefExplorationSettings::getNumberOfExplorationThreads() const {
+    uint64_t numberOfThreads = this->getOption(explorationThreadsOption).getArgumentByName("number").getValueAsUnsignedInteger();
+    if (numberOfThreads == 0) {
+        numberOfThreads = std::max(1u, storm::utility::getNumberOfThreads());
+    }
+    return numberOfThreads;
+}
+
+bool BeliefExplorationSettings::isPointBasedSet() const {
+    return this->getOption(pointBasedOption).getHasOptionBeenSet();
+}
+
+uint64_t BeliefExplorationSettings::getPointBasedBeliefLimit() const {
+    return this->getOption(pointBasedOption).getArgumentByName("beliefs").getValueAsUnsignedInteger();
+}
+
 bool BeliefExplorationSettings::isUseClippingSet() const {
     return this->getOption(clippingOption).getHasOptionBeenSet();
 }
@@ -281,6 +334,14 @@ void BeliefExplorationSettings::setValuesInOptionsStruct(storm::pomdp::modelchec
         }
     }
     options.dynamicTriangulation = isDynamicTriangulationModeSet();
+    if (isBeliefFixedPointSet()) {
+        STORM_LOG_WARN_COND(!storm::NumberTraits<ValueType>::IsExact, "Belief probabilities are not rounded because exact arithmethic is used.");
+        options.beliefFixedPointBits = storm::NumberTraits<ValueType>::IsExact ? 0 : getBeliefFixedPointBits();
+    }
+    options.explorationThreads = getNumberOfExplorationThreads();
+    if (isPointBasedSet()) {
+        options.pointBasedBeliefLimit = getPointBasedBeliefLimit();
+    }
     options.cutZeroGap = isCutZeroGapSet();
 }
 
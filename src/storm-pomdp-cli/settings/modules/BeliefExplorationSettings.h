@@ -69,6 +69,17 @@ class BeliefExplorationSettings : public ModuleSettings {
     bool isDynamicTriangulationModeSet() const;
     bool isStaticTriangulationModeSet() const;
 
+    /// Used to determine whether two beliefs are equal after rounding their probabilities to fixed-point numbers
+    bool isBeliefFixedPointSet() const;
+    uint64_t getBeliefFixedPointBits() const;
+
+    /// The number of threads used to expand beliefs
+    uint64_t getNumberOfExplorationThreads() const;
+
+    /// Controls whether point-based value iteration is used to improve the bounds before exploring the belief MDP
+    bool isPointBasedSet() const;
+    uint64_t getPointBasedBeliefLimit() const;
+
     /// Controls if (grid) clipping is to be used
     bool isUseClippingSet() const;
 
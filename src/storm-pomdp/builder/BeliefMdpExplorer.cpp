@@ -19,6 +19,11 @@
 
 namespace storm {
 namespace builder {
+namespace {
+// The number of beliefs per thread whose successors are computed at once when exploring with multiple threads.
+const uint64_t beliefsPerThread = 16;
+}  // namespace
+
 template<typename PomdpType, typename BeliefValueType>
 BeliefMdpExplorer<PomdpType, BeliefValueType>::SuccessorObservationInformation::SuccessorObservationInformation(ValueType const &obsProb,
                                                                                                                 ValueType const &maxProb, uint64_t const &count)
@@ -37,8 +42,12 @@ void BeliefMdpExplorer<PomdpType, BeliefValueType>::SuccessorObservationInformat
 template<typename PomdpType, typename BeliefValueType>
 BeliefMdpExplorer<PomdpType, BeliefValueType>::BeliefMdpExplorer(std::shared_ptr<BeliefManagerType> beliefManager,
                                                                  storm::pomdp::storage::PreprocessingPomdpValueBounds<ValueType> const &pomdpValueBounds,
-                                                                 ExplorationHeuristic explorationHeuristic)
-    : beliefManager(beliefManager), pomdpValueBounds(pomdpValueBounds), explHeuristic(explorationHeuristic), status(Status::Uninitialized) {
+                                                                 ExplorationHeuristic explorationHeuristic, uint64_t numberOfThreads)
+    : beliefManager(beliefManager),
+      numberOfThreads(numberOfThreads),
+      pomdpValueBounds(pomdpValueBounds),
+      explHeuristic(explorationHeuristic),
+      status(Status::Uninitialized) {
     // Intentionally left empty
 }
 
@@ -60,6 +69,7 @@ void BeliefMdpExplorer<PomdpType, BeliefValueType>::startNewExploration(std::opt
     exploredBeliefIds.grow(beliefManager->getNumberOfBeliefIds(), false);
     mdpStatesToExplorePrioState.clear();
     mdpStatesToExploreStatePrio.clear();
+    precomputedSuccessors.clear();
     stateRemapping.clear();
     lowerValueBounds.clear();
     upperValueBounds.clear();
@@ -145,6 +155,7 @@ void BeliefMdpExplorer<PomdpType, BeliefValueType>::restartExploration() {
     delayedExplorationChoices.clear();
     mdpStatesToExplorePrioState.clear();
     mdpStatesToExploreStatePrio.clear();
+    precomputedSuccessors.clear();
 
     // The extra states are not changed
     if (extraBottomState) {
@@ -194,6 +205,7 @@ void BeliefMdpExplorer<PomdpType, BeliefValueType>::restoreExplorationState() {
     mdpStateToChoiceLabelsMap = std::map<BeliefId, std::map<uint64_t, std::string>>(explorationStorage.storedMdpStateToChoiceLabelsMap);
     mdpStatesToExplorePrioState = std::multimap<ValueType, uint64_t>(explorationStorage.storedMdpStatesToExplorePrioState);
     mdpStatesToExploreStatePrio = std::map<uint64_t, ValueType>(explorationStorage.storedMdpStatesToExploreStatePrio);
+    precomputedSuccessors.clear();
     probabilityEstimation = std::vector<ValueType>(explorationStorage.storedProbabilityEstimation);
     exploredMdpTransitions = std::vector<std::map<MdpStateType, ValueType>>(explorationStorage.storedExploredMdpTransitions);
     exploredChoiceIndices = std::vector<MdpStateType>(explorationStorage.storedExploredChoiceIndices);
@@ -242,6 +254,10 @@ typename BeliefMdpExplorer<PomdpType, BeliefValueType>::BeliefId BeliefMdpExplor
     if (currentMdpState != noState() && mdpStatesToExplorePrioState.rbegin()->second == exploredChoiceIndices.size()) {
         internalAddRowGroupIndex();
     }
+    // The successors of the previously explored belief are no longer needed
+    if (currentMdpState != noState() && !precomputedSuccessors.empty()) {
+        precomputedSuccessors.erase(getCurrentBeliefId());
+    }
 
     // Pop from the queue.
     currentMdpState = mdpStatesToExplorePrioState.rbegin()->second;
@@ -326,6 +342,29 @@ bool BeliefMdpExplorer<PomdpType, BeliefValueType>::addTransitionToBelief(uint64
     return true;
 }
 
+template<typename PomdpType, typename BeliefValueType>
+std::vector<std::pair<typename BeliefMdpExplorer<PomdpType, BeliefValueType>::BeliefId, typename BeliefMdpExplorer<PomdpType, BeliefValueType>::ValueType>>
+BeliefMdpExplorer<PomdpType, BeliefValueType>::expandCurrentState(uint64_t const &localActionIndex,
+                                                                  std::optional<std::vector<BeliefValueType>> const &observationResolutions) {
+    STORM_LOG_ASSERT(status == Status::Exploring, "Method call is invalid in current status.");
+    BeliefId currentBeliefId = getCurrentBeliefId();
+    if (numberOfThreads <= 1) {
+        if (observationResolutions) {
+            return beliefManager->expandAndTriangulate(currentBeliefId, localActionIndex, observationResolutions.value());
+        } else {
+            return beliefManager->expand(currentBeliefId, localActionIndex);
+        }
+    }
+    auto findRes = precomputedSuccessors.find(currentBeliefId);
+    if (findRes == precomputedSuccessors.end()) {
+        precomputeSuccessors(observationResolutions);
+        findRes = precomputedSuccessors.find(currentBeliefId);
+        STORM_LOG_ASSERT(findRes != precomputedSuccessors.end(), "Successors of the current belief have not been computed.");
+    }
+    STORM_LOG_ASSERT(localActionIndex < findRes->second.size(), "Invalid local action index " << localActionIndex << ".");
+    return beliefManager->addBeliefs(findRes->second[localActionIndex]);
+}
+
 template<typename PomdpType, typename BeliefValueType>
 void BeliefMdpExplorer<PomdpType, BeliefValueType>::computeRewardAtCurrentState(uint64_t const &localActionIndex, ValueType extraReward) {
     STORM_LOG_ASSERT(status == Status::Exploring, "Method call is invalid in current status.");
@@ -1152,6 +1191,45 @@ void BeliefMdpExplorer<PomdpType, BeliefValueType>::insertValueHints(ValueType c
     STORM_LOG_ASSERT(lowerValueBounds.size() == upperValueBounds.size() && values.size() == upperValueBounds.size(), "Value vectors have inconsistent size.");
 }
 
+template<typename PomdpType, typename BeliefValueType>
+void BeliefMdpExplorer<PomdpType, BeliefValueType>::precomputeSuccessors(std::optional<std::vector<BeliefValueType>> const &observationResolutions) {
+    // Gather the current belief and the beliefs that are explored next (in the order of the exploration queue).
+    // States with old behavior are skipped as their behavior is likely to be restored.
+    uint64_t const maxNumberOfBeliefs = numberOfThreads * beliefsPerThread;
+    std::vector<BeliefId> beliefIds = {getCurrentBeliefId()};
+    for (auto stateIt = mdpStatesToExplorePrioState.rbegin(); stateIt != mdpStatesToExplorePrioState.rend() && beliefIds.size() < maxNumberOfBeliefs;
+         ++stateIt) {
+        if (exploredMdp && stateIt->second < exploredMdp->getNumberOfStates()) {
+            continue;
+        }
+        BeliefId beliefId = getBeliefId(stateIt->second);
+        if (precomputedSuccessors.count(beliefId) == 0) {
+            beliefIds.push_back(beliefId);
+        }
+    }
+
+    // Compute the successors concurrently. The belief manager is not modified while doing so.
+    std::vector<std::vector<std::vector<std::pair<BeliefType, ValueType>>>> successors(beliefIds.size());
+    for (uint64_t i = 0; i < beliefIds.size(); ++i) {
+        successors[i].resize(beliefManager->getBeliefNumberOfChoices(beliefIds[i]));
+    }
+    if (!taskPool) {
+        taskPool = std::make_unique<storm::utility::TaskPool>(numberOfThreads);
+    }
+    for (uint64_t i = 0; i < beliefIds.size(); ++i) {
+        taskPool->submit([this, &beliefIds, &successors, &observationResolutions, i]() {
+            for (uint64_t action = 0; action < successors[i].size(); ++action) {
+                successors[i][action] = beliefManager->computeSuccessors(beliefIds[i], action, observationResolutions);
+            }
+        });
+    }
+    taskPool->wait();
+
+    for (uint64_t i = 0; i < beliefIds.size(); ++i) {
+        precomputedSuccessors.emplace(beliefIds[i], std::move(successors[i]));
+    }
+}
+
 template<typename PomdpType, typename BeliefValueType>
 typename BeliefMdpExplorer<PomdpType, BeliefValueType>::MdpStateType BeliefMdpExplorer<PomdpType, BeliefValueType>::getOrAddMdpState(
     BeliefId const &beliefId, ValueType const &transitionValue) {
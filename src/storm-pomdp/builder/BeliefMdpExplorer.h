@@ -5,12 +5,14 @@
 #include <memory>
 #include <optional>
 #include <queue>
+#include <unordered_map>
 #include <vector>
 
 #include "storm-pomdp/storage/BeliefExplorationBounds.h"
 #include "storm-pomdp/storage/BeliefManager.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/storage/BitVector.h"
+#include "storm/utility/TaskPool.h"
 
 namespace storm {
 class Environment;
@@ -29,6 +31,7 @@ class BeliefMdpExplorer {
     typedef typename PomdpType::ValueType ValueType;
     typedef storm::storage::BeliefManager<PomdpType, BeliefValueType> BeliefManagerType;
     typedef typename BeliefManagerType::BeliefId BeliefId;
+    typedef typename BeliefManagerType::BeliefType BeliefType;
     typedef uint64_t MdpStateType;
 
     struct SuccessorObservationInformation {
@@ -42,8 +45,11 @@ class BeliefMdpExplorer {
 
     enum class Status { Uninitialized, Exploring, ModelFinished, ModelChecked };
 
+    /*!
+     * @param numberOfThreads if greater than one, the successors of beliefs are computed concurrently (see expandCurrentState).
+     */
     BeliefMdpExplorer(std::shared_ptr<BeliefManagerType> beliefManager, storm::pomdp::storage::PreprocessingPomdpValueBounds<ValueType> const &pomdpValueBounds,
-                      ExplorationHeuristic explorationHeuristic = ExplorationHeuristic::BreadthFirst);
+                      ExplorationHeuristic explorationHeuristic = ExplorationHeuristic::BreadthFirst, uint64_t numberOfThreads = 1);
 
     BeliefMdpExplorer(BeliefMdpExplorer &&other) = default;
 
@@ -82,6 +88,16 @@ class BeliefMdpExplorer {
      */
     bool addTransitionToBelief(uint64_t const &localActionIndex, BeliefId const &transitionTarget, ValueType const &value, bool ignoreNewBeliefs);
 
+    /*!
+     * Computes the successors of the belief of the current state under the given action and adds them to the belief manager.
+     * With multiple threads, the successors of the beliefs that are explored next are computed concurrently as well and kept until these beliefs are explored.
+     * The successors are added to the belief manager in the order of exploration, so the resulting belief ids do not depend on the number of threads.
+     * @param observationResolutions if given, the successors are triangulated (see BeliefManager::expandAndTriangulate). Must not change during an exploration.
+     * @return the successor beliefs (or grid points) together with the corresponding probabilities.
+     */
+    std::vector<std::pair<BeliefId, ValueType>> expandCurrentState(uint64_t const &localActionIndex,
+                                                                   std::optional<std::vector<BeliefValueType>> const &observationResolutions = std::nullopt);
+
     void computeRewardAtCurrentState(uint64_t const &localActionIndex, ValueType extraReward = storm::utility::zero<ValueType>());
 
     /*!
@@ -274,6 +290,12 @@ class BeliefMdpExplorer {
 
     MdpStateType getOrAddMdpState(BeliefId const &beliefId, ValueType const &transitionValue = storm::utility::zero<ValueType>());
 
+    /*!
+     * Concurrently computes the successors of the current belief and of the new beliefs that are explored next. The results are stored in
+     * precomputedSuccessors.
+     */
+    void precomputeSuccessors(std::optional<std::vector<BeliefValueType>> const &observationResolutions);
+
     // Belief state related information
     std::shared_ptr<BeliefManagerType> beliefManager;
     std::vector<BeliefId> mdpStateToBeliefIdMap;
@@ -295,6 +317,11 @@ class BeliefMdpExplorer {
     uint64_t nextId;
     ValueType prio;
 
+    // Concurrent computation of successor beliefs
+    uint64_t numberOfThreads;
+    std::unique_ptr<storm::utility::TaskPool> taskPool;
+    std::unordered_map<BeliefId, std::vector<std::vector<std::pair<BeliefType, ValueType>>>> precomputedSuccessors;  // The successors for each local action
+
     // Special states and choices during exploration
     std::optional<MdpStateType> extraTargetState;
     std::optional<MdpStateType> extraBottomState;
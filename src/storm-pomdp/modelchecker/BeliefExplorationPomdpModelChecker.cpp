@@ -11,6 +11,7 @@
 #include "storm/utility/NumberTraits.h"
 
 #include "storm-pomdp/builder/BeliefMdpExplorer.h"
+#include "storm-pomdp/modelchecker/PointBasedPomdpModelChecker.h"
 #include "storm-pomdp/modelchecker/PreprocessingPomdpValueBoundsModelChecker.h"
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/utility/vector.h"
@@ -18,6 +19,7 @@
 #include "storm/environment/Environment.h"
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/utility/SignalHandler.h"
+#include "storm/utility/TaskPool.h"
 #include "storm/utility/graph.h"
 #include "storm/utility/macros.h"
 
@@ -150,9 +152,7 @@ BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType, BeliefMDPTyp
     auto formulaInfo = storm::pomdp::analysis::getFormulaInformation(pomdp(), formula);
 
     precomputeValueBounds(formula, preProcEnv);
-    if (!additionalUnderApproximationBounds.empty()) {
-        pomdpValueBounds.fmSchedulerValueList = additionalUnderApproximationBounds;
-    }
+    pomdpValueBounds.fmSchedulerValueList = additionalUnderApproximationBounds;
     uint64_t initialPomdpState = pomdp().getInitialStates().getNextSetIndex(0);
     Result result(pomdpValueBounds.trivialPomdpValueBounds.getHighestLowerBound(initialPomdpState),
                   pomdpValueBounds.trivialPomdpValueBounds.getSmallestUpperBound(initialPomdpState));
@@ -200,6 +200,28 @@ BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType, BeliefMDPTyp
         STORM_LOG_INFO("Detected that the belief MDP is finite.");
         statistics.beliefMdpDetectedToBeFinite = true;
     }
+    if (options.pointBasedBeliefLimit > 0) {
+        // The alpha vectors are values of observation-based policies, so they can be used like the values of the finite-memory schedulers
+        statistics.pointBasedTime.start();
+        typename PointBasedPomdpModelChecker<PomdpModelType, BeliefValueType>::Options pointBasedOptions;
+        pointBasedOptions.beliefLimit = options.pointBasedBeliefLimit;
+        pointBasedOptions.numericPrecision = options.numericPrecision;
+        PointBasedPomdpModelChecker<PomdpModelType, BeliefValueType> pointBasedChecker(pomdp(), pointBasedOptions);
+        ValueType pointBasedValue = pointBasedChecker.check(preProcEnv, formula, pomdpValueBounds.trivialPomdpValueBounds);
+        if (formulaInfo.minimize() ? result.updateUpperBound(pointBasedValue) : result.updateLowerBound(pointBasedValue)) {
+            STORM_LOG_INFO("Point-based value iteration improved the value bounds to [" << result.lowerBound << ", " << result.upperBound << "]");
+        }
+        auto alphaVectors = pointBasedChecker.getAlphaVectorsAsValueList();
+        pomdpValueBounds.fmSchedulerValueList.resize(std::max<uint64_t>(pomdpValueBounds.fmSchedulerValueList.size(), alphaVectors.size()));
+        statistics.pointBasedAlphaVectors = 0;
+        for (uint64_t observation = 0; observation < alphaVectors.size(); ++observation) {
+            auto& valueList = pomdpValueBounds.fmSchedulerValueList[observation];
+            statistics.pointBasedAlphaVectors.value() += alphaVectors[observation].size();
+            valueList.insert(valueList.end(), std::make_move_iterator(alphaVectors[observation].begin()),
+                             std::make_move_iterator(alphaVectors[observation].end()));
+        }
+        statistics.pointBasedTime.stop();
+    }
     if (options.interactiveUnfolding) {
         unfoldInteractively(env, targetObservations, formulaInfo.minimize(), rewardModelName, pomdpValueBounds, result);
     } else {
@@ -242,6 +264,11 @@ void BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType, BeliefM
         stream << "# Detected a refinement fixpoint.\n";
     }
 
+    if (statistics.pointBasedAlphaVectors) {
+        stream << "# Number of alpha vectors obtained by point-based value iteration: " << statistics.pointBasedAlphaVectors.value() << '\n';
+        stream << "# Time spend for point-based value iteration: " << statistics.pointBasedTime << '\n';
+    }
+
     // The overapproximation MDP:
     if (statistics.overApproximationStates) {
         stream << "# Number of states in the ";
@@ -321,11 +348,13 @@ void BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType, BeliefM
             std::vector<BeliefValueType>(pomdp().getNrObservations(), storm::utility::convertNumber<BeliefValueType>(options.resolutionInit));
         overApproxBeliefManager = std::make_shared<BeliefManagerType>(
             pomdp(), storm::utility::convertNumber<BeliefValueType>(options.numericPrecision),
-            options.dynamicTriangulation ? BeliefManagerType::TriangulationMode::Dynamic : BeliefManagerType::TriangulationMode::Static);
+            options.dynamicTriangulation ? BeliefManagerType::TriangulationMode::Dynamic : BeliefManagerType::TriangulationMode::Static,
+            options.beliefFixedPointBits);
         if (rewardModelName) {
             overApproxBeliefManager->setRewardModel(rewardModelName);
         }
-        overApproximation = std::make_shared<ExplorerType>(overApproxBeliefManager, trivialPOMDPBounds, storm::builder::ExplorationHeuristic::BreadthFirst);
+        overApproximation = std::make_shared<ExplorerType>(overApproxBeliefManager, trivialPOMDPBounds, storm::builder::ExplorationHeuristic::BreadthFirst,
+                                                            options.explorationThreads);
         overApproxHeuristicPar.gapThreshold = options.gapThresholdInit;
         overApproxHeuristicPar.observationThreshold = options.obsThresholdInit;
         overApproxHeuristicPar.sizeThreshold = options.sizeThresholdInit == 0 ? std::numeric_limits<uint64_t>::max() : options.sizeThresholdInit;
@@ -349,11 +378,13 @@ void BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType, BeliefM
     if (options.unfold) {  // Setup and build first UnderApproximation
         underApproxBeliefManager = std::make_shared<BeliefManagerType>(
             pomdp(), storm::utility::convertNumber<BeliefValueType>(options.numericPrecision),
-            options.dynamicTriangulation ? BeliefManagerType::TriangulationMode::Dynamic : BeliefManagerType::TriangulationMode::Static);
+            options.dynamicTriangulation ? BeliefManagerType::TriangulationMode::Dynamic : BeliefManagerType::TriangulationMode::Static,
+            options.beliefFixedPointBits);
         if (rewardModelName) {
             underApproxBeliefManager->setRewardModel(rewardModelName);
         }
-        underApproximation = std::make_shared<ExplorerType>(underApproxBeliefManager, trivialPOMDPBounds, options.explorationHeuristic);
+        underApproximation =
+            std::make_shared<ExplorerType>(underApproxBeliefManager, trivialPOMDPBounds, options.explorationHeuristic, options.explorationThreads);
         underApproxHeuristicPar.gapThreshold = options.gapThresholdInit;
         underApproxHeuristicPar.optimalChoiceValueEpsilon = options.optimalChoiceValueThresholdInit;
         underApproxHeuristicPar.sizeThreshold = options.sizeThresholdInit;
@@ -413,8 +444,7 @@ void BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType, BeliefM
         while ((options.refineStepLimit == 0 || statistics.refinementSteps.value() < options.refineStepLimit) && result.diff() > options.refinePrecision) {
             bool overApproxFixPoint = true;
             bool underApproxFixPoint = true;
-            if (options.discretize) {
-                // Refine over-approximation
+            auto refineOverApproximation = [&]() {
                 if (min) {
                     overApproximation->takeCurrentValuesAsLowerBounds();
                 } else {
@@ -428,6 +458,30 @@ void BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType, BeliefM
                 overApproxHeuristicPar.optimalChoiceValueEpsilon *= options.optimalChoiceValueThresholdFactor;
                 overApproxFixPoint = buildOverApproximation(env, targetObservations, min, rewardModelName.has_value(), true, overApproxHeuristicPar,
                                                             observationResolutionVector, overApproxBeliefManager, overApproximation);
+            };
+            auto refineUnderApproximation = [&]() {
+                underApproxHeuristicPar.gapThreshold *= options.gapThresholdFactor;
+                underApproxHeuristicPar.sizeThreshold = storm::utility::convertNumber<uint64_t, ValueType>(
+                    storm::utility::convertNumber<ValueType, uint64_t>(underApproximation->getExploredMdp()->getNumberOfStates()) *
+                    options.sizeThresholdFactor);
+                underApproxHeuristicPar.optimalChoiceValueEpsilon *= options.optimalChoiceValueThresholdFactor;
+                underApproxFixPoint = buildUnderApproximation(env, targetObservations, min, rewardModelName.has_value(), true, underApproxHeuristicPar,
+                                                              underApproxBeliefManager, underApproximation, true);
+            };
+            // Over- and under-approximation use separate belief managers and explorers, so they can be refined concurrently
+            bool refineConcurrently = options.explorationThreads > 1 && options.discretize && options.unfold;
+            if (refineConcurrently) {
+                storm::utility::TaskPool pool(2);
+                pool.submit(refineOverApproximation);
+                pool.submit(refineUnderApproximation);
+                pool.wait();
+            }
+
+            if (options.discretize) {
+                // Refine over-approximation
+                if (!refineConcurrently) {
+                    refineOverApproximation();
+                }
                 if (overApproximation->hasComputedValues() && !storm::utility::resources::isTerminate()) {
                     ValueType const& newValue = overApproximation->getComputedValueAtInitialState();
                     bool betterBound = min ? result.updateLowerBound(newValue) : result.updateUpperBound(newValue);
@@ -441,15 +495,11 @@ void BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType, BeliefM
                 }
             }
 
-            if (options.unfold && result.diff() > options.refinePrecision) {
+            if (options.unfold && (refineConcurrently || result.diff() > options.refinePrecision)) {
                 // Refine under-approximation
-                underApproxHeuristicPar.gapThreshold *= options.gapThresholdFactor;
-                underApproxHeuristicPar.sizeThreshold = storm::utility::convertNumber<uint64_t, ValueType>(
-                    storm::utility::convertNumber<ValueType, uint64_t>(underApproximation->getExploredMdp()->getNumberOfStates()) *
-                    options.sizeThresholdFactor);
-                underApproxHeuristicPar.optimalChoiceValueEpsilon *= options.optimalChoiceValueThresholdFactor;
-                underApproxFixPoint = buildUnderApproximation(env, targetObservations, min, rewardModelName.has_value(), true, underApproxHeuristicPar,
-                                                              underApproxBeliefManager, underApproximation, true);
+                if (!refineConcurrently) {
+                    refineUnderApproximation();
+                }
                 if (underApproximation->hasComputedValues() && !storm::utility::resources::isTerminate()) {
                     ValueType const& newValue = underApproximation->getComputedValueAtInitialState();
                     bool betterBound = min ? result.updateUpperBound(newValue) : result.updateLowerBound(newValue);
@@ -587,13 +637,15 @@ void BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType, BeliefM
     // Set up belief manager
     underApproxBeliefManager = std::make_shared<BeliefManagerType>(
         pomdp(), storm::utility::convertNumber<BeliefValueType>(options.numericPrecision),
-        options.dynamicTriangulation ? BeliefManagerType::TriangulationMode::Dynamic : BeliefManagerType::TriangulationMode::Static);
+        options.dynamicTriangulation ? BeliefManagerType::TriangulationMode::Dynamic : BeliefManagerType::TriangulationMode::Static,
+        options.beliefFixedPointBits);
     if (rewardModelName) {
         underApproxBeliefManager->setRewardModel(rewardModelName);
     }
 
     // set up belief MDP explorer
-    interactiveUnderApproximationExplorer = std::make_shared<ExplorerType>(underApproxBeliefManager, trivialPOMDPBounds, options.explorationHeuristic);
+    interactiveUnderApproximationExplorer =
+        std::make_shared<ExplorerType>(underApproxBeliefManager, trivialPOMDPBounds, options.explorationHeuristic, options.explorationThreads);
     underApproxHeuristicPar.gapThreshold = options.gapThresholdInit;
     underApproxHeuristicPar.optimalChoiceValueEpsilon = options.optimalChoiceValueThresholdInit;
     underApproxHeuristicPar.sizeThreshold = std::numeric_limits<uint64_t>::max() - 1;  // we don't set a size threshold
@@ -961,7 +1013,7 @@ bool BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType, BeliefM
                     expandedAtLeastOneAction = true;
                     if (!truncateAllActions) {
                         // Cases 1.1, 2.1, or 3.1
-                        auto successorGridPoints = beliefManager->expandAndTriangulate(currId, action, observationResolutionVector);
+                        auto successorGridPoints = overApproximation->expandCurrentState(action, observationResolutionVector);
                         for (auto const& successor : successorGridPoints) {
                             overApproximation->addTransitionToBelief(action, successor.first, successor.second, false);
                         }
@@ -972,7 +1024,7 @@ bool BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType, BeliefM
                         // Cases 1.2 or 2.2
                         auto truncationProbability = storm::utility::zero<ValueType>();
                         auto truncationValueBound = storm::utility::zero<ValueType>();
-                        auto successorGridPoints = beliefManager->expandAndTriangulate(currId, action, observationResolutionVector);
+                        auto successorGridPoints = overApproximation->expandCurrentState(action, observationResolutionVector);
                         for (auto const& successor : successorGridPoints) {
                             bool added = overApproximation->addTransitionToBelief(action, successor.first, successor.second, true);
                             if (!added) {
@@ -1167,7 +1219,7 @@ bool BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType, BeliefM
                     } else {
                         auto truncationProbability = storm::utility::zero<ValueType>();
                         auto truncationValueBound = storm::utility::zero<ValueType>();
-                        auto successors = beliefManager->expand(currId, action);
+                        auto successors = underApproximation->expandCurrentState(action);
                         for (auto const& successor : successors) {
                             bool added = underApproximation->addTransitionToBelief(addedActions + action, successor.first, successor.second, stopExploration);
                             if (!added) {
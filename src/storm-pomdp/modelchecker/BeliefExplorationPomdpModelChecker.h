@@ -213,6 +213,9 @@ class BeliefExplorationPomdpModelChecker {
         bool beliefMdpDetectedToBeFinite;
         bool refinementFixpointDetected;
 
+        std::optional<uint64_t> pointBasedAlphaVectors;
+        storm::utility::Stopwatch pointBasedTime;
+
         std::optional<uint64_t> overApproximationStates;
         bool overApproximationBuildAborted;
         storm::utility::Stopwatch overApproximationBuildTime;
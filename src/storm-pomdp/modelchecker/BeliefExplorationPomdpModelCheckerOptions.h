@@ -55,6 +55,10 @@ struct BeliefExplorationPomdpModelCheckerOptions {
                                      ? storm::utility::zero<ValueType>()
                                      : storm::utility::convertNumber<ValueType>(1e-9);  /// Used to decide whether two beliefs are equal
     bool dynamicTriangulation = true;  // Sets whether the triangulation is done in a dynamic way (yielding more precise triangulations)
+    uint64_t beliefFixedPointBits = 0;  // If not zero, beliefs are compared after rounding their probabilities to multiples of 2^-beliefFixedPointBits
+    uint64_t explorationThreads = 1;    // If greater than one, beliefs are expanded concurrently and over- and under-approximation are refined concurrently
+    // If not zero, point-based value iteration on at most this many beliefs improves the initial bounds and the cut-off values before exploration
+    uint64_t pointBasedBeliefLimit = 0;
 
     storm::builder::ExplorationHeuristic explorationHeuristic = storm::builder::ExplorationHeuristic::BreadthFirst;
 };
@@ -0,0 +1,378 @@
+#include "storm-pomdp/modelchecker/PointBasedPomdpModelChecker.h"
+
+#include <numeric>
+#include <set>
+
+#include "storm-pomdp/analysis/FormulaInformation.h"
+#include "storm-pomdp/modelchecker/PreprocessingPomdpValueBoundsModelChecker.h"
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/environment/Environment.h"
+#include "storm/exceptions/InvalidOperationException.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/logic/Formulas.h"
+#include "storm/models/sparse/Pomdp.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/utility/SignalHandler.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace pomdp {
+namespace modelchecker {
+
+template<typename PomdpModelType, typename BeliefValueType>
+uint64_t PointBasedPomdpModelChecker<PomdpModelType, BeliefValueType>::AlphaVectors::size() const {
+    return values.size() / dimension;
+}
+
+template<typename PomdpModelType, typename BeliefValueType>
+PointBasedPomdpModelChecker<PomdpModelType, BeliefValueType>::PointBasedPomdpModelChecker(PomdpModelType const& pomdp, Options options)
+    : pomdp(pomdp), options(options) {
+    observationStates.resize(pomdp.getNrObservations());
+    localStateIndices.reserve(pomdp.getNumberOfStates());
+    for (uint64_t state = 0; state < pomdp.getNumberOfStates(); ++state) {
+        auto& states = observationStates[pomdp.getObservation(state)];
+        localStateIndices.push_back(states.size());
+        states.push_back(state);
+    }
+}
+
+template<typename PomdpModelType, typename BeliefValueType>
+typename PointBasedPomdpModelChecker<PomdpModelType, BeliefValueType>::ValueType PointBasedPomdpModelChecker<PomdpModelType, BeliefValueType>::check(
+    storm::Environment const& env, storm::logic::Formula const& formula) {
+    PreprocessingPomdpValueBoundsModelChecker<ValueType> preProcessingMC(pomdp);
+    return check(env, formula, preProcessingMC.getValueBounds(env, formula));
+}
+
+template<typename PomdpModelType, typename BeliefValueType>
+typename PointBasedPomdpModelChecker<PomdpModelType, BeliefValueType>::ValueType PointBasedPomdpModelChecker<PomdpModelType, BeliefValueType>::check(
+    storm::Environment const&, storm::logic::Formula const& formula, storm::pomdp::storage::PreprocessingPomdpValueBounds<ValueType> const& valueBounds) {
+    statistics = Statistics();
+    statistics.totalTime.start();
+    initialize(formula, valueBounds);
+    sampleReachableBeliefs();
+
+    bool converged = false;
+    while (!converged && statistics.sweeps < options.sweepLimit && !storm::utility::resources::isTerminate()) {
+        ++statistics.sweeps;
+        converged = true;
+        // Beliefs that were sampled late tend to be far away from the initial belief, so their new alpha vectors can be used in the same sweep
+        for (auto beliefIt = sampledBeliefs.rbegin(); beliefIt != sampledBeliefs.rend(); ++beliefIt) {
+            if (backup(*beliefIt)) {
+                converged = false;
+            }
+        }
+    }
+    STORM_LOG_WARN_COND(converged, "Point-based value iteration did not converge within " << statistics.sweeps << " sweeps.");
+
+    auto const& initialBelief = sampledBeliefs.front();
+    ValueType result = getBestAlphaVector(initialBelief.observation, initialBelief.localStates, initialBelief.probabilities).second;
+    statistics.totalTime.stop();
+    return result;
+}
+
+template<typename PomdpModelType, typename BeliefValueType>
+std::vector<std::vector<std::unordered_map<uint64_t, typename PointBasedPomdpModelChecker<PomdpModelType, BeliefValueType>::ValueType>>>
+PointBasedPomdpModelChecker<PomdpModelType, BeliefValueType>::getAlphaVectorsAsValueList() const {
+    STORM_LOG_THROW(!alphaVectors.empty(), storm::exceptions::InvalidOperationException, "Alpha vectors can only be retrieved after calling check.");
+    // Only keep the vectors that are best at some sampled belief. The default vectors are kept for observations without sampled beliefs.
+    std::vector<std::set<uint64_t>> usefulAlphaVectors(observationStates.size());
+    for (uint64_t observation = 0; observation < observationStates.size(); ++observation) {
+        usefulAlphaVectors[observation].insert(defaultAlphaVectors[observation]);
+    }
+    for (auto const& belief : sampledBeliefs) {
+        usefulAlphaVectors[belief.observation].insert(getBestAlphaVector(belief.observation, belief.localStates, belief.probabilities).first);
+    }
+
+    std::vector<std::vector<std::unordered_map<uint64_t, ValueType>>> result(observationStates.size());
+    for (uint64_t observation = 0; observation < observationStates.size(); ++observation) {
+        auto const& vectors = alphaVectors[observation];
+        for (auto const& vectorIndex : usefulAlphaVectors[observation]) {
+            std::unordered_map<uint64_t, ValueType> stateValues;
+            for (uint64_t localState = 0; localState < vectors.dimension; ++localState) {
+                stateValues.emplace(observationStates[observation][localState], vectors.values[vectorIndex * vectors.dimension + localState]);
+            }
+            result[observation].push_back(std::move(stateValues));
+        }
+    }
+    return result;
+}
+
+template<typename PomdpModelType, typename BeliefValueType>
+void PointBasedPomdpModelChecker<PomdpModelType, BeliefValueType>::printStatisticsToStream(std::ostream& stream) const {
+    stream << "##### Point-Based POMDP Value Iteration Statistics ######\n";
+    stream << "# Number of sampled beliefs: " << sampledBeliefs.size() << '\n';
+    stream << "# Number of sweeps: " << statistics.sweeps << '\n';
+    stream << "# Number of backups: " << statistics.backups << '\n';
+    stream << "# Number of alpha vectors added by backups: " << statistics.addedAlphaVectors << '\n';
+    uint64_t numberOfAlphaVectors = 0;
+    for (auto const& vectors : alphaVectors) {
+        numberOfAlphaVectors += vectors.size();
+    }
+    stream << "# Total number of alpha vectors: " << numberOfAlphaVectors << '\n';
+    stream << "# Total time: " << statistics.totalTime << '\n';
+    stream << "##########################################\n";
+}
+
+template<typename PomdpModelType, typename BeliefValueType>
+void PointBasedPomdpModelChecker<PomdpModelType, BeliefValueType>::initialize(
+    storm::logic::Formula const& formula, storm::pomdp::storage::PreprocessingPomdpValueBounds<ValueType> const& valueBounds) {
+    auto formulaInfo = storm::pomdp::analysis::getFormulaInformation(pomdp, formula);
+    STORM_LOG_THROW(formulaInfo.isNonNestedReachabilityProbability() || formulaInfo.isNonNestedExpectedRewardFormula(),
+                    storm::exceptions::NotSupportedException, "Unsupported formula '" << formula << "'.");
+    minimize = formulaInfo.minimize();
+    targetStates = formulaInfo.getTargetStates().states;
+    choiceRewards.clear();
+    if (formulaInfo.isNonNestedReachabilityProbability()) {
+        targetValue = storm::utility::one<ValueType>();
+    } else {
+        targetValue = storm::utility::zero<ValueType>();
+        choiceRewards = pomdp.getRewardModel(formulaInfo.getRewardModelName()).getTotalRewardVector(pomdp.getTransitionMatrix());
+    }
+
+    // Each scheduler computed during preprocessing yields one alpha vector per observation
+    auto const& schedulerValues = minimize ? valueBounds.upper : valueBounds.lower;
+    STORM_LOG_THROW(!schedulerValues.empty(), storm::exceptions::NotSupportedException,
+                    "Point-based value iteration requires the values of at least one observation-based scheduler.");
+    alphaVectors.assign(observationStates.size(), AlphaVectors());
+    defaultAlphaVectors.assign(observationStates.size(), 0);
+    defaultAlphaVectorSums.assign(observationStates.size(), storm::utility::zero<ValueType>());
+    successorBeliefs.resize(observationStates.size());
+    successorObservations.clear();
+    isSuccessorObservation = storm::storage::BitVector(observationStates.size(), false);
+    for (uint64_t observation = 0; observation < observationStates.size(); ++observation) {
+        alphaVectors[observation].dimension = observationStates[observation].size();
+        alphaVectors[observation].hasInfiniteValues = false;
+        successorBeliefs[observation].assign(observationStates[observation].size(), storm::utility::zero<ValueType>());
+        std::vector<ValueType> alphaVector;
+        alphaVector.reserve(observationStates[observation].size());
+        for (auto const& values : schedulerValues) {
+            alphaVector.clear();
+            for (auto const& state : observationStates[observation]) {
+                alphaVector.push_back(values[state]);
+            }
+            addAlphaVector(observation, alphaVector);
+        }
+    }
+
+    beliefManager = std::make_shared<BeliefManagerType>(pomdp, storm::utility::convertNumber<BeliefValueType>(options.numericPrecision),
+                                                        BeliefManagerType::TriangulationMode::Static);
+    sampledBeliefs.clear();
+    sampledBeliefIndices.clear();
+}
+
+template<typename PomdpModelType, typename BeliefValueType>
+void PointBasedPomdpModelChecker<PomdpModelType, BeliefValueType>::sampleBelief(BeliefId const& beliefId) {
+    if (sampledBeliefIndices.count(beliefId) > 0) {
+        return;
+    }
+    SampledBelief belief;
+    belief.id = beliefId;
+    belief.observation = beliefManager->getBeliefObservation(beliefId);
+    for (auto const& entry : beliefManager->getBeliefCopy(beliefId)) {
+        belief.localStates.push_back(localStateIndices[entry.first]);
+        belief.probabilities.push_back(storm::utility::convertNumber<ValueType>(entry.second));
+    }
+    sampledBeliefIndices.emplace(beliefId, sampledBeliefs.size());
+    sampledBeliefs.push_back(std::move(belief));
+}
+
+template<typename PomdpModelType, typename BeliefValueType>
+void PointBasedPomdpModelChecker<PomdpModelType, BeliefValueType>::sampleReachableBeliefs() {
+    sampleBelief(beliefManager->getInitialBelief());
+    // sampledBeliefs is used as the queue of the breadth-first search
+    for (uint64_t beliefIndex = 0; beliefIndex < sampledBeliefs.size() && sampledBeliefs.size() < options.beliefLimit; ++beliefIndex) {
+        BeliefId beliefId = sampledBeliefs[beliefIndex].id;
+        uint32_t observation = sampledBeliefs[beliefIndex].observation;
+        bool onlyTargetStates = true;
+        for (auto const& localState : sampledBeliefs[beliefIndex].localStates) {
+            if (!targetStates.get(observationStates[observation][localState])) {
+                onlyTargetStates = false;
+                break;
+            }
+        }
+        if (onlyTargetStates) {
+            continue;
+        }
+        uint64_t numberOfChoices = beliefManager->getBeliefNumberOfChoices(beliefId);
+        for (uint64_t action = 0; action < numberOfChoices && sampledBeliefs.size() < options.beliefLimit; ++action) {
+            for (auto const& successor : beliefManager->expand(beliefId, action)) {
+                sampleBelief(successor.first);
+                if (sampledBeliefs.size() >= options.beliefLimit) {
+                    break;
+                }
+            }
+        }
+    }
+}
+
+template<typename PomdpModelType, typename BeliefValueType>
+bool PointBasedPomdpModelChecker<PomdpModelType, BeliefValueType>::backup(SampledBelief const& belief) {
+    ++statistics.backups;
+    auto const& transitionMatrix = pomdp.getTransitionMatrix();
+    auto const& states = observationStates[belief.observation];
+    uint64_t numberOfChoices = pomdp.getNumberOfChoices(states[belief.localStates.front()]);
+
+    // For each action, compute the (unnormalized) successor belief for each observation and pick the alpha vector that is best for it.
+    // The successor beliefs are accumulated in dense buffers, so that the values of the alpha vectors are obtained by contiguous dot products.
+    ValueType bestValue = storm::utility::zero<ValueType>();
+    uint64_t bestAction = 0;
+    std::vector<std::pair<uint32_t, uint64_t>> bestSuccessorAlphaVectors, actionSuccessorAlphaVectors;
+    for (uint64_t action = 0; action < numberOfChoices; ++action) {
+        ValueType actionValue = storm::utility::zero<ValueType>();
+        for (uint64_t i = 0; i < belief.localStates.size(); ++i) {
+            uint64_t state = states[belief.localStates[i]];
+            ValueType const& probability = belief.probabilities[i];
+            if (targetStates.get(state)) {
+                actionValue += probability * targetValue;
+                continue;
+            }
+            uint64_t row = transitionMatrix.getRowGroupIndices()[state] + action;
+            if (!choiceRewards.empty()) {
+                actionValue += probability * choiceRewards[row];
+            }
+            for (auto const& entry : transitionMatrix.getRow(row)) {
+                if (!storm::utility::isZero(entry.getValue())) {
+                    uint32_t successorObservation = pomdp.getObservation(entry.getColumn());
+                    if (!isSuccessorObservation.get(successorObservation)) {
+                        isSuccessorObservation.set(successorObservation, true);
+                        successorObservations.push_back(successorObservation);
+                    }
+                    successorBeliefs[successorObservation][localStateIndices[entry.getColumn()]] += probability * entry.getValue();
+                }
+            }
+        }
+        actionSuccessorAlphaVectors.clear();
+        for (auto const& successorObservation : successorObservations) {
+            auto& successorBelief = successorBeliefs[successorObservation];
+            auto bestAlphaVector = getBestAlphaVector(successorObservation, successorBelief);
+            actionSuccessorAlphaVectors.emplace_back(successorObservation, bestAlphaVector.first);
+            actionValue += bestAlphaVector.second;
+            // Reset the buffer for the next action
+            std::fill(successorBelief.begin(), successorBelief.end(), storm::utility::zero<ValueType>());
+            isSuccessorObservation.set(successorObservation, false);
+        }
+        successorObservations.clear();
+        if (action == 0 || isBetter(actionValue, bestValue)) {
+            bestValue = actionValue;
+            bestAction = action;
+            std::swap(bestSuccessorAlphaVectors, actionSuccessorAlphaVectors);
+        }
+    }
+
+    ValueType currentValue = getBestAlphaVector(belief.observation, belief.localStates, belief.probabilities).second;
+    if (minimize ? !(bestValue < currentValue - options.improvementThreshold) : !(bestValue > currentValue + options.improvementThreshold)) {
+        return false;
+    }
+
+    // The new alpha vector is the value of the policy that picks the best action and then continues with the chosen policies of the successor observations.
+    // Successor observations that are not reached from the belief continue with their default policy.
+    successorAlphaVectors = defaultAlphaVectors;
+    for (auto const& observationAlphaVector : bestSuccessorAlphaVectors) {
+        successorAlphaVectors[observationAlphaVector.first] = observationAlphaVector.second;
+    }
+    std::vector<ValueType> alphaVector;
+    alphaVector.reserve(states.size());
+    for (auto const& state : states) {
+        if (targetStates.get(state)) {
+            alphaVector.push_back(targetValue);
+            continue;
+        }
+        uint64_t row = transitionMatrix.getRowGroupIndices()[state] + bestAction;
+        ValueType value = choiceRewards.empty() ? storm::utility::zero<ValueType>() : choiceRewards[row];
+        for (auto const& entry : transitionMatrix.getRow(row)) {
+            if (!storm::utility::isZero(entry.getValue())) {
+                uint32_t successorObservation = pomdp.getObservation(entry.getColumn());
+                auto const& successorVectors = alphaVectors[successorObservation];
+                value += entry.getValue() * successorVectors.values[successorAlphaVectors[successorObservation] * successorVectors.dimension +
+                                                                    localStateIndices[entry.getColumn()]];
+            }
+        }
+        alphaVector.push_back(std::move(value));
+    }
+    addAlphaVector(belief.observation, alphaVector);
+    ++statistics.addedAlphaVectors;
+    return true;
+}
+
+template<typename PomdpModelType, typename BeliefValueType>
+std::pair<uint64_t, typename PointBasedPomdpModelChecker<PomdpModelType, BeliefValueType>::ValueType>
+PointBasedPomdpModelChecker<PomdpModelType, BeliefValueType>::getBestAlphaVector(uint32_t observation, std::vector<uint64_t> const& localStates,
+                                                                                 std::vector<ValueType> const& probabilities) const {
+    auto const& vectors = alphaVectors[observation];
+    std::pair<uint64_t, ValueType> result(0, storm::utility::zero<ValueType>());
+    for (uint64_t vectorIndex = 0; vectorIndex < vectors.size(); ++vectorIndex) {
+        // Only the support of the belief is considered, which avoids multiplying zero with infinite values
+        auto vectorIt = vectors.values.begin() + vectorIndex * vectors.dimension;
+        ValueType value = storm::utility::zero<ValueType>();
+        for (uint64_t i = 0; i < localStates.size(); ++i) {
+            value += probabilities[i] * vectorIt[localStates[i]];
+        }
+        if (vectorIndex == 0 || isBetter(value, result.second)) {
+            result.first = vectorIndex;
+            result.second = std::move(value);
+        }
+    }
+    return result;
+}
+
+template<typename PomdpModelType, typename BeliefValueType>
+std::pair<uint64_t, typename PointBasedPomdpModelChecker<PomdpModelType, BeliefValueType>::ValueType>
+PointBasedPomdpModelChecker<PomdpModelType, BeliefValueType>::getBestAlphaVector(uint32_t observation, std::vector<ValueType> const& belief) const {
+    auto const& vectors = alphaVectors[observation];
+    STORM_LOG_ASSERT(belief.size() == vectors.dimension, "Belief has unexpected dimension.");
+    std::pair<uint64_t, ValueType> result(0, storm::utility::zero<ValueType>());
+    for (uint64_t vectorIndex = 0; vectorIndex < vectors.size(); ++vectorIndex) {
+        auto vectorIt = vectors.values.begin() + vectorIndex * vectors.dimension;
+        ValueType value = storm::utility::zero<ValueType>();
+        if (vectors.hasInfiniteValues) {
+            // Zero times infinity would yield an undefined value, so only the support of the belief is considered
+            for (uint64_t localState = 0; localState < belief.size(); ++localState) {
+                if (!storm::utility::isZero(belief[localState])) {
+                    value += belief[localState] * vectorIt[localState];
+                }
+            }
+        } else {
+            // transform_reduce may reorder the summation, which allows for vectorization
+            value = std::transform_reduce(belief.begin(), belief.end(), vectorIt, storm::utility::zero<ValueType>());
+        }
+        if (vectorIndex == 0 || isBetter(value, result.second)) {
+            result.first = vectorIndex;
+            result.second = std::move(value);
+        }
+    }
+    return result;
+}
+
+template<typename PomdpModelType, typename BeliefValueType>
+void PointBasedPomdpModelChecker<PomdpModelType, BeliefValueType>::addAlphaVector(uint32_t observation, std::vector<ValueType> const& alphaVector) {
+    STORM_LOG_ASSERT(alphaVector.size() == alphaVectors[observation].dimension, "Alpha vector has unexpected dimension.");
+    auto& vectors = alphaVectors[observation];
+    uint64_t vectorIndex = vectors.size();
+    vectors.values.insert(vectors.values.end(), alphaVector.begin(), alphaVector.end());
+    ValueType sum = storm::utility::zero<ValueType>();
+    for (auto const& value : alphaVector) {
+        sum += value;
+        if (storm::utility::isInfinity(value)) {
+            vectors.hasInfiniteValues = true;
+        }
+    }
+    if (vectorIndex == 0 || isBetter(sum, defaultAlphaVectorSums[observation])) {
+        defaultAlphaVectors[observation] = vectorIndex;
+        defaultAlphaVectorSums[observation] = std::move(sum);
+    }
+}
+
+template<typename PomdpModelType, typename BeliefValueType>
+bool PointBasedPomdpModelChecker<PomdpModelType, BeliefValueType>::isBetter(ValueType const& first, ValueType const& second) const {
+    return minimize ? first < second : first > second;
+}
+
+template class PointBasedPomdpModelChecker<storm::models::sparse::Pomdp<double>>;
+template class PointBasedPomdpModelChecker<storm::models::sparse::Pomdp<double>, storm::RationalNumber>;
+template class PointBasedPomdpModelChecker<storm::models::sparse::Pomdp<storm::RationalNumber>, double>;
+template class PointBasedPomdpModelChecker<storm::models::sparse::Pomdp<storm::RationalNumber>>;
+
+}  // namespace modelchecker
+}  // namespace pomdp
+}  // namespace storm
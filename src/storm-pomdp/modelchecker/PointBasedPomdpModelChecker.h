@@ -0,0 +1,178 @@
+#pragma once
+
+#include <memory>
+#include <ostream>
+#include <unordered_map>
+#include <vector>
+
+#include "storm-pomdp/storage/BeliefExplorationBounds.h"
+#include "storm-pomdp/storage/BeliefManager.h"
+#include "storm/storage/BitVector.h"
+#include "storm/utility/NumberTraits.h"
+#include "storm/utility/Stopwatch.h"
+#include "storm/utility/constants.h"
+
+namespace storm {
+class Environment;
+
+namespace logic {
+class Formula;
+}
+
+namespace pomdp {
+namespace modelchecker {
+
+template<typename ValueType>
+struct PointBasedPomdpModelCheckerOptions {
+    uint64_t beliefLimit = 1000;  // The maximal number of sampled beliefs
+    uint64_t sweepLimit = 100;    // The maximal number of sweeps, i.e., rounds of backups at all sampled beliefs
+    // A backup only adds an alpha vector if it improves the value at its belief by more than this
+    ValueType improvementThreshold = storm::utility::convertNumber<ValueType>(1e-6);
+    ValueType numericPrecision = storm::NumberTraits<ValueType>::IsExact
+                                     ? storm::utility::zero<ValueType>()
+                                     : storm::utility::convertNumber<ValueType>(1e-9);  /// Used to decide whether two beliefs are equal
+};
+
+/*!
+ * Computes bounds on reachability probabilities and expected rewards of POMDPs with point-based value iteration.
+ *
+ * The value function is represented by alpha vectors. An alpha vector of an observation assigns a value to each POMDP state with this observation and
+ * corresponds to an observation-based policy. Initially, these are the values of the schedulers computed by PreprocessingPomdpValueBoundsModelChecker.
+ * A backup at a sampled belief prepends one action to the policies that are best at the successor beliefs, so every alpha vector is the value of some policy.
+ * Hence, the best alpha vector at a belief is a lower bound on the maximal value (or an upper bound on the minimal value) of this belief.
+ *
+ * The alpha vectors of an observation are stored consecutively in one dense array. Beliefs are sampled breadth-first from the initial belief.
+ * Backups are performed in reverse sampling order (so that values propagate towards the initial belief) until a sweep yields no new alpha vector.
+ */
+template<typename PomdpModelType, typename BeliefValueType = typename PomdpModelType::ValueType>
+class PointBasedPomdpModelChecker {
+   public:
+    typedef typename PomdpModelType::ValueType ValueType;
+    typedef storm::storage::BeliefManager<PomdpModelType, BeliefValueType> BeliefManagerType;
+    typedef typename BeliefManagerType::BeliefId BeliefId;
+    typedef PointBasedPomdpModelCheckerOptions<ValueType> Options;
+
+    PointBasedPomdpModelChecker(PomdpModelType const& pomdp, Options options = Options());
+
+    /*!
+     * Computes alpha vectors for the given formula, which has to be a (non-nested) reachability probability or expected reward formula.
+     * The initial alpha vectors are computed with PreprocessingPomdpValueBoundsModelChecker.
+     * @return a lower bound (if maximizing) or an upper bound (if minimizing) on the value of the initial state.
+     */
+    ValueType check(storm::Environment const& env, storm::logic::Formula const& formula);
+
+    /*!
+     * Computes alpha vectors for the given formula, starting with the values of the schedulers in the given bounds.
+     * @param valueBounds bounds as computed by PreprocessingPomdpValueBoundsModelChecker
+     * @return a lower bound (if maximizing) or an upper bound (if minimizing) on the value of the initial state.
+     */
+    ValueType check(storm::Environment const& env, storm::logic::Formula const& formula,
+                    storm::pomdp::storage::PreprocessingPomdpValueBounds<ValueType> const& valueBounds);
+
+    /*!
+     * Retrieves the alpha vectors that are best at at least one of the sampled beliefs.
+     * The format is the one of the additional under-approximation bounds of BeliefExplorationPomdpModelChecker, i.e.,
+     * for each observation a list of maps from the states with that observation to their value.
+     */
+    std::vector<std::vector<std::unordered_map<uint64_t, ValueType>>> getAlphaVectorsAsValueList() const;
+
+    /*!
+     * Prints statistics of the last check to the given output stream
+     */
+    void printStatisticsToStream(std::ostream& stream) const;
+
+   private:
+    /*!
+     * The alpha vectors of a single observation. Alpha vector i occupies values[i * dimension], ..., values[(i+1) * dimension - 1].
+     */
+    struct AlphaVectors {
+        uint64_t dimension;
+        std::vector<ValueType> values;
+        bool hasInfiniteValues;  // If set, zero entries of a belief have to be skipped since zero times infinity is undefined
+        uint64_t size() const;
+    };
+
+    /*!
+     * A sampled belief, given by the local indices of the states in its support and their probabilities.
+     */
+    struct SampledBelief {
+        BeliefId id;
+        uint32_t observation;
+        std::vector<uint64_t> localStates;
+        std::vector<ValueType> probabilities;
+    };
+
+    void initialize(storm::logic::Formula const& formula, storm::pomdp::storage::PreprocessingPomdpValueBounds<ValueType> const& valueBounds);
+
+    /*!
+     * Adds the given belief to the sampled beliefs if it has not been sampled before.
+     */
+    void sampleBelief(BeliefId const& beliefId);
+
+    /*!
+     * Samples the beliefs reachable from the initial belief in breadth-first order until the belief limit is reached.
+     */
+    void sampleReachableBeliefs();
+
+    /*!
+     * Performs a backup at the given belief and adds the resulting alpha vector if it improves the value at the belief.
+     * @return true iff an alpha vector was added.
+     */
+    bool backup(SampledBelief const& belief);
+
+    /*!
+     * Retrieves the index of the alpha vector of the given observation that is best for the given (possibly unnormalized) belief and its value.
+     */
+    std::pair<uint64_t, ValueType> getBestAlphaVector(uint32_t observation, std::vector<uint64_t> const& localStates,
+                                                      std::vector<ValueType> const& probabilities) const;
+
+    /*!
+     * Retrieves the index of the alpha vector of the given observation that is best for the given (possibly unnormalized) belief and its value.
+     * @param belief the probability of each state of the observation (dense)
+     */
+    std::pair<uint64_t, ValueType> getBestAlphaVector(uint32_t observation, std::vector<ValueType> const& belief) const;
+
+    void addAlphaVector(uint32_t observation, std::vector<ValueType> const& alphaVector);
+
+    bool isBetter(ValueType const& first, ValueType const& second) const;
+
+    PomdpModelType const& pomdp;
+    Options options;
+
+    // Information about the checked formula
+    bool minimize;
+    storm::storage::BitVector targetStates;
+    ValueType targetValue;
+    std::vector<ValueType> choiceRewards;  // empty if there are no rewards
+
+    // The states of each observation and the index of each state among the states of its observation
+    std::vector<std::vector<uint64_t>> observationStates;
+    std::vector<uint64_t> localStateIndices;
+
+    std::vector<AlphaVectors> alphaVectors;
+    std::vector<uint64_t> defaultAlphaVectors;  // For each observation, the index of the vector with the best sum of values
+    std::vector<ValueType> defaultAlphaVectorSums;
+
+    // Buffers that are reused by all backups: the dense (unnormalized) successor belief of each observation, the observations reached by the current
+    // action, and the alpha vector that is chosen for each successor observation
+    std::vector<std::vector<ValueType>> successorBeliefs;
+    std::vector<uint32_t> successorObservations;
+    storm::storage::BitVector isSuccessorObservation;
+    std::vector<uint64_t> successorAlphaVectors;
+
+    std::shared_ptr<BeliefManagerType> beliefManager;
+    std::vector<SampledBelief> sampledBeliefs;
+    std::unordered_map<BeliefId, uint64_t> sampledBeliefIndices;
+
+    struct Statistics {
+        uint64_t sweeps = 0;
+        uint64_t backups = 0;
+        uint64_t addedAlphaVectors = 0;
+        storm::utility::Stopwatch totalTime;
+    };
+    Statistics statistics;
+};
+
+}  // namespace modelchecker
+}  // namespace pomdp
+}  // namespace storm
@@ -30,60 +30,11 @@ bool BeliefManager<PomdpType, BeliefValueType, StateType>::FreudenthalDiff::oper
     }
 }
 
-template<typename PomdpType, typename BeliefValueType, typename StateType>
-bool BeliefManager<PomdpType, BeliefValueType, StateType>::Belief_equal_to::operator()(const BeliefType &lhBelief, const BeliefType &rhBelief) const {
-    return lhBelief == rhBelief;
-}
-
-template<>
-bool BeliefManager<storm::models::sparse::Pomdp<double>, double, uint64_t>::Belief_equal_to::operator()(const BeliefType &lhBelief,
-                                                                                                        const BeliefType &rhBelief) const {
-    // If the sizes are different, we don't have to look inside the belief
-    if (lhBelief.size() != rhBelief.size()) {
-        return false;
-    }
-    // Assumes that beliefs are ordered
-    auto lhIt = lhBelief.begin();
-    auto rhIt = rhBelief.begin();
-    while (lhIt != lhBelief.end() || rhIt != rhBelief.end()) {
-        // Iterate over the entries simultaneously, beliefs not equal if they contain either different states or different values for the same state
-        if (lhIt->first != rhIt->first || std::fabs(lhIt->second - rhIt->second) > 1e-15) {
-            return false;
-        }
-        ++lhIt;
-        ++rhIt;
-    }
-    return lhIt == lhBelief.end() && rhIt == rhBelief.end();
-}
-
-template<typename PomdpType, typename BeliefValueType, typename StateType>
-std::size_t BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefHash::operator()(const BeliefType &belief) const {
-    std::size_t seed = 0;
-    // Assumes that beliefs are ordered
-    for (auto const &entry : belief) {
-        boost::hash_combine(seed, entry.first);
-        boost::hash_combine(seed, entry.second);
-    }
-    return seed;
-}
-
-template<>
-std::size_t BeliefManager<storm::models::sparse::Pomdp<double>, double, uint64_t>::BeliefHash::operator()(const BeliefType &belief) const {
-    std::size_t seed = 0;
-    // Assumes that beliefs are ordered
-    for (auto const &entry : belief) {
-        boost::hash_combine(seed, entry.first);
-        boost::hash_combine(seed, round(storm::utility::convertNumber<double>(entry.second) * 1e15));
-    }
-    return seed;
-}
-
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefManager(PomdpType const &pomdp, BeliefValueType const &precision,
-                                                                    TriangulationMode const &triangulationMode)
-    : pomdp(pomdp), triangulationMode(triangulationMode) {
+                                                                    TriangulationMode const &triangulationMode, uint64_t beliefFixedPointBits)
+    : pomdp(pomdp), beliefStore(beliefFixedPointBits), triangulationMode(triangulationMode) {
     cc = storm::utility::ConstantsComparator<BeliefValueType>(precision, false);
-    beliefToIdMap.resize(pomdp.getNrObservations());
     initialBeliefId = computeInitialBelief();
 }
 
@@ -104,7 +55,7 @@ void BeliefManager<PomdpType, BeliefValueType, StateType>::unsetRewardModel() {
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefManager<PomdpType, BeliefValueType, StateType>::noId() const {
-    return std::numeric_limits<BeliefId>::max();
+    return BeliefStoreType::noId();
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
@@ -190,12 +141,13 @@ uint64_t BeliefManager<PomdpType, BeliefValueType, StateType>::getBeliefNumberOf
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 typename BeliefManager<PomdpType, BeliefValueType, StateType>::Triangulation BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBelief(
     BeliefId beliefId, BeliefValueType resolution) {
-    return triangulateBelief(getBelief(beliefId), resolution);
+    return triangulateBelief(getBeliefCopy(beliefId), resolution);
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 template<typename DistributionType>
-void BeliefManager<PomdpType, BeliefValueType, StateType>::addToDistribution(DistributionType &distr, StateType const &state, BeliefValueType const &value) {
+void BeliefManager<PomdpType, BeliefValueType, StateType>::addToDistribution(DistributionType &distr, StateType const &state,
+                                                                             BeliefValueType const &value) const {
     auto insertionRes = distr.emplace(state, value);
     if (!insertionRes.second) {
         insertionRes.first->second += value;
@@ -204,7 +156,7 @@ void BeliefManager<PomdpType, BeliefValueType, StateType>::addToDistribution(Dis
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 template<typename DistributionType>
-void BeliefManager<PomdpType, BeliefValueType, StateType>::adjustDistribution(DistributionType &distr) {
+void BeliefManager<PomdpType, BeliefValueType, StateType>::adjustDistribution(DistributionType &distr) const {
     if (distr.size() == 1 && cc.isEqual(distr.begin()->second, storm::utility::one<BeliefValueType>())) {
         // If the distribution consists of only one entry and its value is sufficiently close to 1, make it exactly 1 to avoid numerical problems
         distr.begin()->second = storm::utility::one<BeliefValueType>();
@@ -221,7 +173,7 @@ void BeliefManager<PomdpType, BeliefValueType, StateType>::joinSupport(BeliefId
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefManager<PomdpType, BeliefValueType, StateType>::getNumberOfBeliefIds() const {
-    return beliefs.size();
+    return beliefStore.size();
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
@@ -248,25 +200,66 @@ BeliefManager<PomdpType, BeliefValueType, StateType>::expand(BeliefId const &bel
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
-typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefType const &BeliefManager<PomdpType, BeliefValueType, StateType>::getBelief(
+std::vector<std::pair<typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefType,
+                      typename BeliefManager<PomdpType, BeliefValueType, StateType>::ValueType>>
+BeliefManager<PomdpType, BeliefValueType, StateType>::computeSuccessors(
+    BeliefId const &beliefId, uint64_t actionIndex, std::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions) const {
+    std::vector<std::pair<BeliefType, ValueType>> destinations;
+    for (auto &successor : computeSuccessorBeliefs(getBelief(beliefId), actionIndex)) {
+        uint32_t successorObservation = getBeliefObservation(successor.first);
+        if (observationTriangulationResolutions) {
+            GridPointTriangulation triangulation = computeTriangulation(successor.first, observationTriangulationResolutions.value()[successorObservation]);
+            for (size_t j = 0; j < triangulation.weights.size(); ++j) {
+                // Here we additionally assume that triangulation.gridPoints does not contain the same point multiple times
+                BeliefValueType a = triangulation.weights[j] * successor.second;
+                destinations.emplace_back(std::move(triangulation.gridPoints[j]), storm::utility::convertNumber<ValueType>(a));
+            }
+        } else {
+            destinations.emplace_back(std::move(successor.first), storm::utility::convertNumber<ValueType>(successor.second));
+        }
+    }
+    return destinations;
+}
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+std::vector<std::pair<typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId,
+                      typename BeliefManager<PomdpType, BeliefValueType, StateType>::ValueType>>
+BeliefManager<PomdpType, BeliefValueType, StateType>::addBeliefs(std::vector<std::pair<BeliefType, ValueType>> const &beliefs) {
+    std::vector<std::pair<BeliefId, ValueType>> result;
+    result.reserve(beliefs.size());
+    for (auto const &belief : beliefs) {
+        result.emplace_back(getOrAddBeliefId(belief.first), belief.second);
+    }
+    return result;
+}
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefView BeliefManager<PomdpType, BeliefValueType, StateType>::getBelief(
     BeliefId const &id) const {
     STORM_LOG_ASSERT(id != noId(), "Tried to get a non-existent belief.");
     STORM_LOG_ASSERT(id < getNumberOfBeliefIds(), "Belief index " << id << " is out of range.");
-    return beliefs[id];
+    return beliefStore.getBelief(id);
+}
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefType BeliefManager<PomdpType, BeliefValueType, StateType>::getBeliefCopy(
+    BeliefId const &id) const {
+    auto belief = getBelief(id);
+    return BeliefType(boost::container::ordered_unique_range, belief.begin(), belief.end());
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefManager<PomdpType, BeliefValueType, StateType>::getId(
     BeliefType const &belief) const {
-    uint32_t obs = getBeliefObservation(belief);
-    STORM_LOG_ASSERT(obs < beliefToIdMap.size(), "Belief has unknown observation.");
-    auto idIt = beliefToIdMap[obs].find(belief);
-    STORM_LOG_ASSERT(idIt != beliefToIdMap[obs].end(), "Unknown Belief.");
-    return idIt->second;
+    STORM_LOG_ASSERT(getBeliefObservation(belief) < pomdp.getNrObservations(), "Belief has unknown observation.");
+    BeliefId id = beliefStore.find(belief);
+    STORM_LOG_ASSERT(id != noId(), "Unknown Belief.");
+    return id;
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
-std::string BeliefManager<PomdpType, BeliefValueType, StateType>::toString(BeliefType const &belief) const {
+template<typename BeliefRangeType>
+std::string BeliefManager<PomdpType, BeliefValueType, StateType>::toString(BeliefRangeType const &belief) const {
     std::stringstream str;
     str << "{ ";
     bool first = true;
@@ -283,7 +276,8 @@ std::string BeliefManager<PomdpType, BeliefValueType, StateType>::toString(Belie
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
-bool BeliefManager<PomdpType, BeliefValueType, StateType>::isEqual(BeliefType const &first, BeliefType const &second) const {
+template<typename FirstBeliefRangeType, typename SecondBeliefRangeType>
+bool BeliefManager<PomdpType, BeliefValueType, StateType>::isEqual(FirstBeliefRangeType const &first, SecondBeliefRangeType const &second) const {
     if (first.size() != second.size()) {
         return false;
     }
@@ -301,7 +295,8 @@ bool BeliefManager<PomdpType, BeliefValueType, StateType>::isEqual(BeliefType co
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
-bool BeliefManager<PomdpType, BeliefValueType, StateType>::assertBelief(BeliefType const &belief) const {
+template<typename BeliefRangeType>
+bool BeliefManager<PomdpType, BeliefValueType, StateType>::assertBelief(BeliefRangeType const &belief) const {
     auto sum = storm::utility::zero<BeliefValueType>();
     std::optional<uint32_t> observation;
     for (auto const &entry : belief) {
@@ -342,12 +337,12 @@ bool BeliefManager<PomdpType, BeliefValueType, StateType>::assertBelief(BeliefTy
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
-bool BeliefManager<PomdpType, BeliefValueType, StateType>::assertTriangulation(BeliefType const &belief, Triangulation const &triangulation) const {
+bool BeliefManager<PomdpType, BeliefValueType, StateType>::assertTriangulation(BeliefType const &belief, GridPointTriangulation const &triangulation) const {
     if (triangulation.weights.size() != triangulation.gridPoints.size()) {
         STORM_LOG_ERROR("Number of weights and points in triangulation does not match.");
         return false;
     }
-    if (triangulation.size() == 0) {
+    if (triangulation.weights.empty()) {
         STORM_LOG_ERROR("Empty triangulation.");
         return false;
     }
@@ -366,8 +361,7 @@ bool BeliefManager<PomdpType, BeliefValueType, StateType>::assertTriangulation(B
             STORM_LOG_ERROR("Weight greater than one in triangulation.");
         }
         weightSum += triangulation.weights[i];
-        BeliefType const &gridPoint = getBelief(triangulation.gridPoints[i]);
-        for (auto const &pointEntry : gridPoint) {
+        for (auto const &pointEntry : triangulation.gridPoints[i]) {
             BeliefValueType &triangulatedValue = triangulatedBelief.emplace(pointEntry.first, storm::utility::zero<BeliefValueType>()).first->second;
             triangulatedValue += triangulation.weights[i] * pointEntry.second;
         }
@@ -387,14 +381,15 @@ bool BeliefManager<PomdpType, BeliefValueType, StateType>::assertTriangulation(B
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
-uint32_t BeliefManager<PomdpType, BeliefValueType, StateType>::getBeliefObservation(BeliefType belief) const {
+template<typename BeliefRangeType>
+uint32_t BeliefManager<PomdpType, BeliefValueType, StateType>::getBeliefObservation(BeliefRangeType const &belief) const {
     STORM_LOG_ASSERT(assertBelief(belief), "Invalid belief.");
     return pomdp.getObservation(belief.begin()->first);
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 void BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefFreudenthal(BeliefType const &belief, BeliefValueType const &resolution,
-                                                                                        Triangulation &result) {
+                                                                                        GridPointTriangulation &result) const {
     STORM_LOG_ASSERT(resolution != 0, "Invalid resolution: 0");
     STORM_LOG_ASSERT(storm::utility::isInteger(resolution), "Expected an integer resolution");
     StateType numEntries = belief.size();
@@ -443,7 +438,7 @@ void BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefFreu
                     gridPoint[toOriginalIndicesMap[j]] = gridPointEntry / resolution;
                 }
             }
-            result.gridPoints.push_back(getOrAddBeliefId(gridPoint));
+            result.gridPoints.push_back(std::move(gridPoint));
         }
         previousSortedDiff = currentSortedDiff++;
     }
@@ -451,7 +446,7 @@ void BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefFreu
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 void BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefDynamic(BeliefType const &belief, BeliefValueType const &resolution,
-                                                                                    Triangulation &result) {
+                                                                                    GridPointTriangulation &result) const {
     // Find the best resolution for this belief, i.e., N such that the largest distance between one of the belief values to a value in {i/N | 0 ≤ i ≤ N} is
     // minimal
     STORM_LOG_ASSERT(storm::utility::isInteger(resolution), "Expected an integer resolution");
@@ -489,14 +484,14 @@ void BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefDyna
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
-typename BeliefManager<PomdpType, BeliefValueType, StateType>::Triangulation BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBelief(
-    BeliefType const &belief, BeliefValueType const &resolution) {
+typename BeliefManager<PomdpType, BeliefValueType, StateType>::GridPointTriangulation
+BeliefManager<PomdpType, BeliefValueType, StateType>::computeTriangulation(BeliefType const &belief, BeliefValueType const &resolution) const {
     STORM_LOG_ASSERT(assertBelief(belief), "Input belief for triangulation is not valid.");
-    Triangulation result;
+    GridPointTriangulation result;
     // Quickly triangulate Dirac beliefs
     if (belief.size() == 1u) {
         result.weights.push_back(storm::utility::one<BeliefValueType>());
-        result.gridPoints.push_back(getOrAddBeliefId(belief));
+        result.gridPoints.push_back(belief);
     } else {
         auto ceiledResolution = storm::utility::ceil<BeliefValueType>(resolution);
         switch (triangulationMode) {
@@ -510,19 +505,27 @@ typename BeliefManager<PomdpType, BeliefValueType, StateType>::Triangulation Bel
                 STORM_LOG_ASSERT(false, "Invalid triangulation mode.");
         }
     }
-    STORM_LOG_ASSERT(assertTriangulation(belief, result), "Incorrect triangulation: " << toString(result));
+    STORM_LOG_ASSERT(assertTriangulation(belief, result), "Incorrect triangulation of belief " << toString(belief) << ".");
     return result;
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
-std::vector<std::pair<typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId,
-                      typename BeliefManager<PomdpType, BeliefValueType, StateType>::ValueType>>
-BeliefManager<PomdpType, BeliefValueType, StateType>::expandInternal(BeliefId const &beliefId, uint64_t actionIndex,
-                                                                     std::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions,
-                                                                     std::optional<std::vector<uint64_t>> const &observationGridClippingResolutions) {
-    std::vector<std::pair<BeliefId, ValueType>> destinations;
+typename BeliefManager<PomdpType, BeliefValueType, StateType>::Triangulation BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBelief(
+    BeliefType const &belief, BeliefValueType const &resolution) {
+    GridPointTriangulation triangulation = computeTriangulation(belief, resolution);
+    Triangulation result;
+    result.weights = std::move(triangulation.weights);
+    result.gridPoints.reserve(triangulation.gridPoints.size());
+    for (auto const &gridPoint : triangulation.gridPoints) {
+        result.gridPoints.push_back(getOrAddBeliefId(gridPoint));
+    }
+    return result;
+}
 
-    BeliefType belief = getBelief(beliefId);
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+std::vector<std::pair<typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefType, BeliefValueType>>
+BeliefManager<PomdpType, BeliefValueType, StateType>::computeSuccessorBeliefs(BeliefView const &belief, uint64_t actionIndex) const {
+    std::vector<std::pair<BeliefType, BeliefValueType>> successors;
 
     // Find the probability we go to each observation
     BeliefType successorObs;  // This is actually not a belief but has the same type
@@ -537,7 +540,8 @@ BeliefManager<PomdpType, BeliefValueType, StateType>::expandInternal(BeliefId co
     }
     adjustDistribution(successorObs);
 
-    // Now for each successor observation we find and potentially triangulate the successor belief
+    // Now for each successor observation we find the successor belief
+    successors.reserve(successorObs.size());
     for (auto const &successor : successorObs) {
         BeliefType successorBelief;
         for (auto const &pointEntry : belief) {
@@ -551,27 +555,35 @@ BeliefManager<PomdpType, BeliefValueType, StateType>::expandInternal(BeliefId co
         }
         adjustDistribution(successorBelief);
         STORM_LOG_ASSERT(assertBelief(successorBelief), "Invalid successor belief.");
+        successors.emplace_back(std::move(successorBelief), successor.second);
+    }
+    return successors;
+}
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+std::vector<std::pair<typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId,
+                      typename BeliefManager<PomdpType, BeliefValueType, StateType>::ValueType>>
+BeliefManager<PomdpType, BeliefValueType, StateType>::expandInternal(BeliefId const &beliefId, uint64_t actionIndex,
+                                                                     std::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions,
+                                                                     std::optional<std::vector<uint64_t>> const &observationGridClippingResolutions) {
+    if (!observationGridClippingResolutions) {
+        // Successor beliefs are only added once all of them are computed, so we do not need a copy of the belief
+        return addBeliefs(computeSuccessors(beliefId, actionIndex, observationTriangulationResolutions));
+    }
 
+    std::vector<std::pair<BeliefId, ValueType>> destinations;
+    // Clipping adds beliefs while the successors are processed, so we compute all of them beforehand
+    auto successors = computeSuccessorBeliefs(getBelief(beliefId), actionIndex);
+    for (auto const &successor : successors) {
         // Insert the destination. We know that destinations have to be disjoint since they have different observations
-        if (observationTriangulationResolutions) {
-            Triangulation triangulation = triangulateBelief(successorBelief, observationTriangulationResolutions.value()[successor.first]);
-            for (size_t j = 0; j < triangulation.size(); ++j) {
-                // Here we additionally assume that triangulation.gridPoints does not contain the same point multiple times
-                BeliefValueType a = triangulation.weights[j] * successor.second;
-                destinations.emplace_back(triangulation.gridPoints[j], storm::utility::convertNumber<ValueType>(a));
-            }
-        } else if (observationGridClippingResolutions) {
-            BeliefClipping clipping = clipBeliefToGrid(successorBelief, observationGridClippingResolutions.value()[successor.first],
-                                                       storm::storage::BitVector(pomdp.getNumberOfStates()));
-            if (clipping.isClippable) {
-                BeliefValueType a = (storm::utility::one<BeliefValueType>() - clipping.delta) * successor.second;
-                destinations.emplace_back(clipping.targetBelief, storm::utility::convertNumber<ValueType>(a));
-            } else {
-                // Belief on Grid
-                destinations.emplace_back(getOrAddBeliefId(successorBelief), storm::utility::convertNumber<ValueType>(successor.second));
-            }
+        BeliefClipping clipping = clipBeliefToGrid(successor.first, observationGridClippingResolutions.value()[getBeliefObservation(successor.first)],
+                                                   storm::storage::BitVector(pomdp.getNumberOfStates()));
+        if (clipping.isClippable) {
+            BeliefValueType a = (storm::utility::one<BeliefValueType>() - clipping.delta) * successor.second;
+            destinations.emplace_back(clipping.targetBelief, storm::utility::convertNumber<ValueType>(a));
         } else {
-            destinations.emplace_back(getOrAddBeliefId(successorBelief), storm::utility::convertNumber<ValueType>(successor.second));
+            // Belief on Grid
+            destinations.emplace_back(getOrAddBeliefId(successor.first), storm::utility::convertNumber<ValueType>(successor.second));
         }
     }
 
@@ -581,7 +593,7 @@ BeliefManager<PomdpType, BeliefValueType, StateType>::expandInternal(BeliefId co
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefClipping BeliefManager<PomdpType, BeliefValueType, StateType>::clipBeliefToGrid(
     BeliefId const &beliefId, uint64_t resolution, storm::storage::BitVector isInfinite) {
-    auto res = clipBeliefToGrid(getBelief(beliefId), resolution, isInfinite);
+    auto res = clipBeliefToGrid(getBeliefCopy(beliefId), resolution, isInfinite);
     res.startingBelief = beliefId;
     return res;
 }
@@ -589,8 +601,7 @@ typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefClipping Be
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefClipping BeliefManager<PomdpType, BeliefValueType, StateType>::clipBeliefToGrid(
     BeliefType const &belief, uint64_t resolution, const storm::storage::BitVector &isInfinite) {
-    uint32_t obs = getBeliefObservation(belief);
-    STORM_LOG_ASSERT(obs < beliefToIdMap.size(), "Belief has unknown observation.");
+    STORM_LOG_ASSERT(getBeliefObservation(belief) < pomdp.getNrObservations(), "Belief has unknown observation.");
     if (!lpSolver) {
         lpSolver = storm::utility::solver::getLpSolver<BeliefValueType>("POMDP LP Solver");
     } else {
@@ -769,16 +780,14 @@ typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefMa
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefManager<PomdpType, BeliefValueType, StateType>::getOrAddBeliefId(
     BeliefType const &belief) {
-    uint32_t obs = getBeliefObservation(belief);
-    STORM_LOG_ASSERT(obs < beliefToIdMap.size(), "Belief has unknown observation.");
-    auto insertioRes = beliefToIdMap[obs].emplace(belief, beliefs.size());
-    if (insertioRes.second) {
-        // There actually was an insertion, so add the new belief
-        STORM_LOG_TRACE("Add Belief " << beliefs.size() << " " << toString(belief));
-        beliefs.push_back(belief);
+    STORM_LOG_ASSERT(getBeliefObservation(belief) < pomdp.getNrObservations(), "Belief has unknown observation.");
+    auto insertionRes = beliefStore.findOrAdd(belief);
+    if (insertionRes.second) {
+        // There actually was an insertion
+        STORM_LOG_TRACE("Add Belief " << insertionRes.first << " " << toString(belief));
     }
     // Return the id
-    return insertioRes.first->second;
+    return insertionRes.first;
 }
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 uint64_t BeliefManager<PomdpType, BeliefValueType, StateType>::getRepresentativeState(BeliefId const &beliefId) {
@@ -801,7 +810,7 @@ std::vector<BeliefValueType> BeliefManager<PomdpType, BeliefValueType, StateType
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
-std::vector<BeliefValueType> BeliefManager<PomdpType, BeliefValueType, StateType>::getBeliefAsVector(const BeliefType &belief) {
+std::vector<BeliefValueType> BeliefManager<PomdpType, BeliefValueType, StateType>::getBeliefAsVector(BeliefView const &belief) {
     std::vector<BeliefValueType> res(pomdp.getNumberOfStates(), storm::utility::zero<BeliefValueType>());
     for (auto const &stateprob : belief) {
         res[stateprob.first] = stateprob.second;
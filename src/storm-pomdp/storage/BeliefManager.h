@@ -6,6 +6,7 @@
 #include <unordered_map>
 #include <vector>
 
+#include "storm-pomdp/storage/BeliefStore.h"
 #include "storm/solver/LpSolver.h"
 #include "storm/storage/BitVector.h"
 #include "storm/utility/ConstantsComparator.h"
@@ -22,13 +23,18 @@ template<typename PomdpType, typename BeliefValueType = typename PomdpType::Valu
 class BeliefManager {
    public:
     typedef typename PomdpType::ValueType ValueType;
-    typedef boost::container::flat_map<StateType, BeliefValueType> BeliefType;  // iterating over this shall be ordered (for correct hash computation)
+    typedef BeliefStore<BeliefValueType, StateType> BeliefStoreType;
+    typedef typename BeliefStoreType::BeliefType BeliefType;
     typedef boost::container::flat_set<StateType> BeliefSupportType;
-    typedef uint64_t BeliefId;
+    typedef typename BeliefStoreType::BeliefId BeliefId;
 
     enum class TriangulationMode { Static, Dynamic };
 
-    BeliefManager(PomdpType const &pomdp, BeliefValueType const &precision, TriangulationMode const &triangulationMode);
+    /*!
+     * @param beliefFixedPointBits if not zero, beliefs are considered equal iff their probabilities coincide after rounding them to multiples of
+     * 2^-beliefFixedPointBits (see BeliefStore).
+     */
+    BeliefManager(PomdpType const &pomdp, BeliefValueType const &precision, TriangulationMode const &triangulationMode, uint64_t beliefFixedPointBits = 0);
 
     void setRewardModel(std::optional<std::string> rewardModelName = std::nullopt);
 
@@ -79,7 +85,7 @@ class BeliefManager {
     Triangulation triangulateBelief(BeliefId beliefId, BeliefValueType resolution);
 
     template<typename DistributionType>
-    void addToDistribution(DistributionType &distr, StateType const &state, BeliefValueType const &value);
+    void addToDistribution(DistributionType &distr, StateType const &state, BeliefValueType const &value) const;
 
     void joinSupport(BeliefId const &beliefId, BeliefSupportType &support);
 
@@ -93,28 +99,51 @@ class BeliefManager {
 
     std::vector<std::pair<BeliefId, ValueType>> expand(BeliefId const &beliefId, uint64_t actionIndex);
 
+    /*!
+     * Computes the successors of the given belief under the given action without adding them to this manager.
+     * Since no belief is added, this can be invoked concurrently for several beliefs as long as no beliefs are added in the meantime.
+     * @param observationTriangulationResolutions if given, each successor belief is replaced by the grid points of its triangulation.
+     * @return the successor beliefs (or grid points) together with their probabilities. Their ids are obtained with addBeliefs.
+     */
+    std::vector<std::pair<BeliefType, ValueType>> computeSuccessors(
+        BeliefId const &beliefId, uint64_t actionIndex,
+        std::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions = std::nullopt) const;
+
+    /*!
+     * Retrieves the ids of the given beliefs and adds the ones that are not yet known.
+     * New beliefs get their ids in the given order, i.e., adding the result of computeSuccessors yields the same ids as expanding the belief directly.
+     */
+    std::vector<std::pair<BeliefId, ValueType>> addBeliefs(std::vector<std::pair<BeliefType, ValueType>> const &beliefs);
+
     BeliefClipping clipBeliefToGrid(BeliefId const &beliefId, uint64_t resolution, storm::storage::BitVector isInfinite = storm::storage::BitVector());
 
     std::string getObservationLabel(BeliefId const &beliefId);
 
     std::vector<BeliefValueType> computeMatrixBeliefProduct(BeliefId const &beliefId, storm::storage::SparseMatrix<BeliefValueType> &matrix);
 
+    /*!
+     * Returns a copy of the stored belief that remains valid while new beliefs are added.
+     */
+    BeliefType getBeliefCopy(BeliefId const &id) const;
+
    private:
+    typedef typename BeliefStoreType::BeliefView BeliefView;
+
     std::vector<BeliefValueType> getBeliefAsVector(BeliefId const &beliefId);
 
-    std::vector<BeliefValueType> getBeliefAsVector(const BeliefType &belief);
+    std::vector<BeliefValueType> getBeliefAsVector(BeliefView const &belief);
 
     BeliefClipping clipBeliefToGrid(BeliefType const &belief, uint64_t resolution, const storm::storage::BitVector &isInfinite);
 
     template<typename DistributionType>
-    void adjustDistribution(DistributionType &distr);
+    void adjustDistribution(DistributionType &distr) const;
 
-    struct BeliefHash {
-        std::size_t operator()(const BeliefType &belief) const;
-    };
-
-    struct Belief_equal_to {
-        bool operator()(const BeliefType &lhBelief, const BeliefType &rhBelief) const;
+    /*!
+     * A triangulation whose grid points have not (yet) been added to this manager.
+     */
+    struct GridPointTriangulation {
+        std::vector<BeliefType> gridPoints;
+        std::vector<BeliefValueType> weights;
     };
 
     struct FreudenthalDiff {
@@ -125,26 +154,41 @@ class BeliefManager {
         bool operator>(FreudenthalDiff const &other) const;
     };
 
-    BeliefType const &getBelief(BeliefId const &id) const;
+    /*!
+     * Returns a view on the stored belief. The view is invalidated as soon as a new belief is added.
+     */
+    BeliefView getBelief(BeliefId const &id) const;
 
     BeliefId getId(BeliefType const &belief) const;
 
-    std::string toString(BeliefType const &belief) const;
+    // The following functions can be applied to both BeliefType and BeliefView
+    template<typename BeliefRangeType>
+    std::string toString(BeliefRangeType const &belief) const;
+
+    template<typename FirstBeliefRangeType, typename SecondBeliefRangeType>
+    bool isEqual(FirstBeliefRangeType const &first, SecondBeliefRangeType const &second) const;
 
-    bool isEqual(BeliefType const &first, BeliefType const &second) const;
+    template<typename BeliefRangeType>
+    bool assertBelief(BeliefRangeType const &belief) const;
 
-    bool assertBelief(BeliefType const &belief) const;
+    template<typename BeliefRangeType>
+    uint32_t getBeliefObservation(BeliefRangeType const &belief) const;
 
-    bool assertTriangulation(BeliefType const &belief, Triangulation const &triangulation) const;
+    bool assertTriangulation(BeliefType const &belief, GridPointTriangulation const &triangulation) const;
 
-    uint32_t getBeliefObservation(BeliefType belief) const;
+    void triangulateBeliefFreudenthal(BeliefType const &belief, BeliefValueType const &resolution, GridPointTriangulation &result) const;
 
-    void triangulateBeliefFreudenthal(BeliefType const &belief, BeliefValueType const &resolution, Triangulation &result);
+    void triangulateBeliefDynamic(BeliefType const &belief, BeliefValueType const &resolution, GridPointTriangulation &result) const;
 
-    void triangulateBeliefDynamic(BeliefType const &belief, BeliefValueType const &resolution, Triangulation &result);
+    GridPointTriangulation computeTriangulation(BeliefType const &belief, BeliefValueType const &resolution) const;
 
     Triangulation triangulateBelief(BeliefType const &belief, BeliefValueType const &resolution);
 
+    /*!
+     * Computes the successor beliefs of the given belief under the given action together with the probability to reach them.
+     */
+    std::vector<std::pair<BeliefType, BeliefValueType>> computeSuccessorBeliefs(BeliefView const &belief, uint64_t actionIndex) const;
+
     std::vector<std::pair<BeliefId, ValueType>> expandInternal(
         BeliefId const &beliefId, uint64_t actionIndex, std::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions = std::nullopt,
         std::optional<std::vector<uint64_t>> const &observationGridClippingResolutions = std::nullopt);
@@ -156,8 +200,7 @@ class BeliefManager {
     PomdpType const &pomdp;
     std::vector<ValueType> pomdpActionRewardVector;
 
-    std::vector<BeliefType> beliefs;
-    std::vector<std::unordered_map<BeliefType, BeliefId, BeliefHash, Belief_equal_to>> beliefToIdMap;
+    BeliefStoreType beliefStore;
     BeliefId initialBeliefId;
 
     storm::utility::ConstantsComparator<BeliefValueType> cc;
@@ -0,0 +1,185 @@
+#include "storm-pomdp/storage/BeliefStore.h"
+
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <type_traits>
+
+#include <boost/functional/hash.hpp>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace storage {
+
+namespace {
+// The number of bits of the initial hash table.
+const uint64_t initialTableBits = 6;
+// The tolerance for comparing floating point probabilities (if they are not quantized) and the inverse of the granularity used for hashing them.
+const double floatingPointTolerance = 1e-15;
+const double floatingPointHashScale = 1e15;
+}  // namespace
+
+template<typename BeliefValueType, typename StateType>
+BeliefStore<BeliefValueType, StateType>::BeliefView::BeliefView(EntryType const *first, EntryType const *last) : first(first), last(last) {
+    // Intentionally left empty
+}
+
+template<typename BeliefValueType, typename StateType>
+typename BeliefStore<BeliefValueType, StateType>::EntryType const *BeliefStore<BeliefValueType, StateType>::BeliefView::begin() const {
+    return first;
+}
+
+template<typename BeliefValueType, typename StateType>
+typename BeliefStore<BeliefValueType, StateType>::EntryType const *BeliefStore<BeliefValueType, StateType>::BeliefView::end() const {
+    return last;
+}
+
+template<typename BeliefValueType, typename StateType>
+uint64_t BeliefStore<BeliefValueType, StateType>::BeliefView::size() const {
+    return last - first;
+}
+
+template<typename BeliefValueType, typename StateType>
+BeliefStore<BeliefValueType, StateType>::BeliefStore(uint64_t fixedPointBits)
+    : offsets(1, 0), table(1ull << initialTableBits, noId()), tableBits(initialTableBits), fixedPointBits(fixedPointBits) {
+    STORM_LOG_WARN_COND(fixedPointBits == 0 || std::is_floating_point<BeliefValueType>::value,
+                        "Quantizing belief probabilities is only supported for floating point numbers. Probabilities are compared exactly.");
+    STORM_LOG_THROW(fixedPointBits < 63, storm::exceptions::InvalidArgumentException, "Belief probabilities can be quantized to at most 62 bits.");
+}
+
+template<typename BeliefValueType, typename StateType>
+std::pair<typename BeliefStore<BeliefValueType, StateType>::BeliefId, bool> BeliefStore<BeliefValueType, StateType>::findOrAdd(BeliefType const &belief) {
+    // Keep the load factor of the table below 3/4
+    if (4 * (size() + 1) > 3 * table.size()) {
+        growTable();
+    }
+    uint64_t hash = computeHash(belief);
+    uint64_t slot = findSlot(belief, hash);
+    if (table[slot] != noId()) {
+        return {table[slot], false};
+    }
+    BeliefId id = size();
+    table[slot] = id;
+    hashes.push_back(hash);
+    entries.insert(entries.end(), belief.begin(), belief.end());
+    offsets.push_back(entries.size());
+    return {id, true};
+}
+
+template<typename BeliefValueType, typename StateType>
+typename BeliefStore<BeliefValueType, StateType>::BeliefId BeliefStore<BeliefValueType, StateType>::find(BeliefType const &belief) const {
+    return table[findSlot(belief, computeHash(belief))];
+}
+
+template<typename BeliefValueType, typename StateType>
+typename BeliefStore<BeliefValueType, StateType>::BeliefView BeliefStore<BeliefValueType, StateType>::getBelief(BeliefId const &id) const {
+    STORM_LOG_ASSERT(id < size(), "Belief index " << id << " is out of range.");
+    return BeliefView(entries.data() + offsets[id], entries.data() + offsets[id + 1]);
+}
+
+template<typename BeliefValueType, typename StateType>
+uint64_t BeliefStore<BeliefValueType, StateType>::size() const {
+    return hashes.size();
+}
+
+template<typename BeliefValueType, typename StateType>
+uint64_t BeliefStore<BeliefValueType, StateType>::getNumberOfEntries() const {
+    return entries.size();
+}
+
+template<typename BeliefValueType, typename StateType>
+typename BeliefStore<BeliefValueType, StateType>::BeliefId BeliefStore<BeliefValueType, StateType>::noId() {
+    return std::numeric_limits<BeliefId>::max();
+}
+
+template<typename BeliefValueType, typename StateType>
+uint64_t BeliefStore<BeliefValueType, StateType>::computeHash(BeliefType const &belief) const {
+    std::size_t seed = 0;
+    // Assumes that beliefs are ordered
+    for (auto const &entry : belief) {
+        boost::hash_combine(seed, entry.first);
+        boost::hash_combine(seed, computeValueHash(entry.second));
+    }
+    return seed;
+}
+
+template<typename BeliefValueType, typename StateType>
+uint64_t BeliefStore<BeliefValueType, StateType>::computeValueHash(BeliefValueType const &value) const {
+    if constexpr (std::is_floating_point<BeliefValueType>::value) {
+        if (fixedPointBits > 0) {
+            return boost::hash_value(std::llround(std::ldexp(value, fixedPointBits)));
+        } else {
+            return boost::hash_value(std::round(value * floatingPointHashScale));
+        }
+    } else {
+        return std::hash<BeliefValueType>()(value);
+    }
+}
+
+template<typename BeliefValueType, typename StateType>
+bool BeliefStore<BeliefValueType, StateType>::isEqual(BeliefView const &storedBelief, BeliefType const &belief) const {
+    // If the sizes are different, we don't have to look inside the belief
+    if (storedBelief.size() != belief.size()) {
+        return false;
+    }
+    // Assumes that beliefs are ordered
+    auto beliefIt = belief.begin();
+    for (auto const &storedEntry : storedBelief) {
+        if (storedEntry.first != beliefIt->first || !isEqualValue(storedEntry.second, beliefIt->second)) {
+            return false;
+        }
+        ++beliefIt;
+    }
+    return true;
+}
+
+template<typename BeliefValueType, typename StateType>
+bool BeliefStore<BeliefValueType, StateType>::isEqualValue(BeliefValueType const &first, BeliefValueType const &second) const {
+    if constexpr (std::is_floating_point<BeliefValueType>::value) {
+        if (fixedPointBits > 0) {
+            return std::llround(std::ldexp(first, fixedPointBits)) == std::llround(std::ldexp(second, fixedPointBits));
+        } else {
+            return std::fabs(first - second) <= floatingPointTolerance;
+        }
+    } else {
+        return first == second;
+    }
+}
+
+template<typename BeliefValueType, typename StateType>
+uint64_t BeliefStore<BeliefValueType, StateType>::findSlot(BeliefType const &belief, uint64_t hash) const {
+    uint64_t const mask = table.size() - 1;
+    // Fibonacci hashing spreads the hash values over the table
+    uint64_t slot = (hash * 11400714819323198485ull) >> (64 - tableBits);
+    while (table[slot] != noId()) {
+        BeliefId const &id = table[slot];
+        if (hashes[id] == hash && isEqual(getBelief(id), belief)) {
+            break;
+        }
+        slot = (slot + 1) & mask;
+    }
+    return slot;
+}
+
+template<typename BeliefValueType, typename StateType>
+void BeliefStore<BeliefValueType, StateType>::growTable() {
+    ++tableBits;
+    table.assign(1ull << tableBits, noId());
+    uint64_t const mask = table.size() - 1;
+    for (BeliefId id = 0; id < size(); ++id) {
+        // All stored beliefs are distinct, so they can be inserted into the first free slot
+        uint64_t slot = (hashes[id] * 11400714819323198485ull) >> (64 - tableBits);
+        while (table[slot] != noId()) {
+            slot = (slot + 1) & mask;
+        }
+        table[slot] = id;
+    }
+}
+
+template class BeliefStore<double>;
+template class BeliefStore<storm::RationalNumber>;
+}  // namespace storage
+}  // namespace storm
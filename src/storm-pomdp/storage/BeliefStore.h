@@ -0,0 +1,103 @@
+#pragma once
+
+#include <boost/container/flat_map.hpp>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace storm {
+namespace storage {
+
+/*!
+ * Stores the beliefs of a POMDP, i.e., distributions over its states, and assigns a unique id to each of them.
+ *
+ * The entries of all beliefs are kept consecutively in one pooled array, so storing a belief requires no allocation of its own.
+ * Duplicates are detected with an open-addressing hash table that only holds belief ids, i.e., no second copy of the beliefs is kept.
+ * Floating point probabilities are compared up to a small tolerance. Alternatively, they can be quantized to fixed-point numbers,
+ * which makes both hashing and comparison exact.
+ */
+template<typename BeliefValueType, typename StateType = uint64_t>
+class BeliefStore {
+   public:
+    typedef boost::container::flat_map<StateType, BeliefValueType> BeliefType;  // iterating over this shall be ordered (for correct hash computation)
+    typedef std::pair<StateType, BeliefValueType> EntryType;
+    typedef uint64_t BeliefId;
+
+    /*!
+     * A read-only view on a stored belief. Entries are ordered by state.
+     * The view is invalidated as soon as another belief is added to the store.
+     */
+    class BeliefView {
+       public:
+        BeliefView(EntryType const *first, EntryType const *last);
+
+        EntryType const *begin() const;
+        EntryType const *end() const;
+        uint64_t size() const;
+
+       private:
+        EntryType const *first;
+        EntryType const *last;
+    };
+
+    /*!
+     * Creates an empty store.
+     * @param fixedPointBits If not zero, two probabilities are considered equal iff they coincide after rounding them to a multiple of 2^-fixedPointBits.
+     * Only has an effect for floating point beliefs.
+     */
+    explicit BeliefStore(uint64_t fixedPointBits = 0);
+
+    /*!
+     * Retrieves the id of the given belief and adds the belief if it is not yet stored.
+     * @return the id of the belief and whether the belief has been added.
+     */
+    std::pair<BeliefId, bool> findOrAdd(BeliefType const &belief);
+
+    /*!
+     * Retrieves the id of the given belief or noId() if the belief is not stored.
+     */
+    BeliefId find(BeliefType const &belief) const;
+
+    BeliefView getBelief(BeliefId const &id) const;
+
+    /*!
+     * Retrieves the number of stored beliefs.
+     */
+    uint64_t size() const;
+
+    /*!
+     * Retrieves the total number of (state, probability) entries of all stored beliefs.
+     */
+    uint64_t getNumberOfEntries() const;
+
+    static BeliefId noId();
+
+   private:
+    uint64_t computeHash(BeliefType const &belief) const;
+    uint64_t computeValueHash(BeliefValueType const &value) const;
+    bool isEqual(BeliefView const &storedBelief, BeliefType const &belief) const;
+    bool isEqualValue(BeliefValueType const &first, BeliefValueType const &second) const;
+
+    /*!
+     * Retrieves the slot of the table that either holds the given belief or is the empty slot where the belief would be inserted.
+     */
+    uint64_t findSlot(BeliefType const &belief, uint64_t hash) const;
+
+    /*!
+     * Doubles the size of the table and reinserts all stored beliefs.
+     */
+    void growTable();
+
+    // The entries of all beliefs. The entries of belief i are at positions offsets[i], ..., offsets[i+1]-1.
+    std::vector<EntryType> entries;
+    std::vector<uint64_t> offsets;
+    // The hash of each belief, so that beliefs need not be rehashed when the table grows.
+    std::vector<uint64_t> hashes;
+    // The hash table (with linear probing). Free slots hold noId(). The size is always 2^tableBits.
+    std::vector<BeliefId> table;
+    uint64_t tableBits;
+
+    uint64_t fixedPointBits;
+};
+}  // namespace storage
+}  // namespace storm
@@ -10,6 +10,10 @@
 #include "storm/storage/dd/BisimulationDecomposition.h"
 #include "storm/storage/dd/DdType.h"
 
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/BisimulationSettings.h"
+#include "storm/settings/modules/CoreSettings.h"
+
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/utility/macros.h"
 
@@ -25,6 +29,8 @@ std::shared_ptr<ModelType> performDeterministicSparseBisimulationMinimization(st
         options = typename storm::storage::DeterministicModelBisimulationDecomposition<ModelType>::Options(*model, formulas);
     }
     options.setType(type);
+    options.signatureRefinement = storm::settings::getModule<storm::settings::modules::BisimulationSettings>().isSparseSignatureRefinementSet();
+    options.numberOfThreads = storm::settings::getModule<storm::settings::modules::CoreSettings>().getNumberOfSolverThreads();
 
     storm::storage::DeterministicModelBisimulationDecomposition<ModelType> bisimulationDecomposition(*model, options);
     bisimulationDecomposition.computeBisimulationDecomposition();
@@ -40,6 +46,8 @@ std::shared_ptr<ModelType> performNondeterministicSparseBisimulationMinimization
         options = typename storm::storage::NondeterministicModelBisimulationDecomposition<ModelType>::Options(*model, formulas);
     }
     options.setType(type);
+    options.signatureRefinement = storm::settings::getModule<storm::settings::modules::BisimulationSettings>().isSparseSignatureRefinementSet();
+    options.numberOfThreads = storm::settings::getModule<storm::settings::modules::CoreSettings>().getNumberOfSolverThreads();
 
     storm::storage::NondeterministicModelBisimulationDecomposition<ModelType> bisimulationDecomposition(*model, options);
     bisimulationDecomposition.computeBisimulationDecomposition();
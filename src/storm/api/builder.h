@@ -90,15 +90,26 @@ storm::builder::ExplicitModelBuilder<ValueType> makeExplicitModelBuilder(storm::
                                                                          storm::builder::BuilderOptions const& options,
                                                                          std::shared_ptr<storm::generator::ActionMask<ValueType>> actionMask = nullptr) {
     std::shared_ptr<storm::generator::NextStateGenerator<ValueType, uint32_t>> generator;
+    // Further generators are only required for the parallel exploration. As action masks need not be thread-safe, we do not
+    // provide further generators if a mask is given.
+    std::function<std::shared_ptr<storm::generator::NextStateGenerator<ValueType, uint32_t>>()> generatorFactory;
     if (model.isPrismProgram()) {
         generator = std::make_shared<storm::generator::PrismNextStateGenerator<ValueType, uint32_t>>(model.asPrismProgram(), options, actionMask);
+        if (actionMask == nullptr) {
+            generatorFactory = [program = model.asPrismProgram(), options]() {
+                return std::make_shared<storm::generator::PrismNextStateGenerator<ValueType, uint32_t>>(program, options);
+            };
+        }
     } else if (model.isJaniModel()) {
         STORM_LOG_THROW(actionMask == nullptr, storm::exceptions::NotSupportedException, "Action masks for JANI are not yet supported");
         generator = std::make_shared<storm::generator::JaniNextStateGenerator<ValueType, uint32_t>>(model.asJaniModel(), options);
+        generatorFactory = [janiModel = model.asJaniModel(), options]() {
+            return std::make_shared<storm::generator::JaniNextStateGenerator<ValueType, uint32_t>>(janiModel, options);
+        };
     } else {
         STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Cannot build sparse model from this symbolic model description.");
     }
-    return storm::builder::ExplicitModelBuilder<ValueType>(generator);
+    return storm::builder::ExplicitModelBuilder<ValueType>(generator, generatorFactory);
 }
 
 template<typename ValueType>
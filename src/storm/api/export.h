@@ -1,7 +1,9 @@
 #pragma once
 
 #include "storm/adapters/JsonForward.h"
+#include "storm/exceptions/FileIoException.h"
 #include "storm/exceptions/NotSupportedException.h"
+#include "storm/io/BinaryModelExporter.h"
 #include "storm/io/DDEncodingExporter.h"
 #include "storm/io/DirectEncodingExporter.h"
 #include "storm/io/file.h"
@@ -32,6 +34,20 @@ void exportSparseModelAsDrn(std::shared_ptr<storm::models::sparse::Model<ValueTy
     storm::utility::closeFile(stream);
 }
 
+template<typename ValueType>
+void exportSparseModelAsDrb(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, std::string const& filename) {
+    if constexpr (std::is_same_v<ValueType, double>) {
+        // Open the file in binary mode.
+        std::ofstream stream(filename, std::ios::out | std::ios::binary);
+        STORM_LOG_THROW(stream, storm::exceptions::FileIoException, "Could not open file " << filename << ".");
+        STORM_PRINT_AND_LOG("Write to file " << filename << ".\n");
+        storm::exporter::explicitExportSparseModelBinary(stream, model);
+        storm::utility::closeFile(stream);
+    } else {
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Only models with double values can be exported in the binary drb format.");
+    }
+}
+
 template<storm::dd::DdType Type, typename ValueType>
 void exportSymbolicModelAsDrdd(std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> const& model, std::string const& filename) {
     storm::exporter::explicitExportSymbolicModel(filename, model);
@@ -17,11 +17,13 @@
 #include "storm/modelchecker/prctl/SymbolicMdpPrctlModelChecker.h"
 #include "storm/modelchecker/reachability/SparseDtmcEliminationModelChecker.h"
 #include "storm/modelchecker/rpatl/SparseSmgRpatlModelChecker.h"
+#include "storm/modelchecker/smc/StatisticalModelChecker.h"
 
 #include "storm/models/symbolic/Dtmc.h"
 #include "storm/models/symbolic/MarkovAutomaton.h"
 #include "storm/models/symbolic/Mdp.h"
 
+#include "storm/models/sparse/Ctmc.h"
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/Smg.h"
@@ -53,23 +55,20 @@ template<typename ValueType>
 typename std::enable_if<std::is_same<ValueType, double>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type verifyWithExplorationEngine(
     storm::Environment const& env, storm::storage::SymbolicModelDescription const& model,
     storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
-    STORM_LOG_THROW(model.isPrismProgram(), storm::exceptions::NotSupportedException, "Exploration engine is currently only applicable to PRISM models.");
-    storm::prism::Program const& program = model.asPrismProgram();
-
     std::unique_ptr<storm::modelchecker::CheckResult> result;
-    if (program.getModelType() == storm::prism::Program::ModelType::DTMC) {
-        storm::modelchecker::SparseExplorationModelChecker<storm::models::sparse::Dtmc<ValueType>> checker(program);
+    if (model.getModelType() == storm::storage::SymbolicModelDescription::ModelType::DTMC) {
+        storm::modelchecker::SparseExplorationModelChecker<storm::models::sparse::Dtmc<ValueType>> checker(model);
         if (checker.canHandle(task)) {
             result = checker.check(env, task);
         }
-    } else if (program.getModelType() == storm::prism::Program::ModelType::MDP) {
-        storm::modelchecker::SparseExplorationModelChecker<storm::models::sparse::Mdp<ValueType>> checker(program);
+    } else if (model.getModelType() == storm::storage::SymbolicModelDescription::ModelType::MDP) {
+        storm::modelchecker::SparseExplorationModelChecker<storm::models::sparse::Mdp<ValueType>> checker(model);
         if (checker.canHandle(task)) {
             result = checker.check(env, task);
         }
     } else {
         STORM_LOG_THROW(false, storm::exceptions::NotSupportedException,
-                        "The model type " << program.getModelType() << " is not supported by the exploration engine.");
+                        "The model type " << model.getModelType() << " is not supported by the exploration engine.");
     }
 
     return result;
@@ -88,6 +87,45 @@ std::unique_ptr<storm::modelchecker::CheckResult> verifyWithExplorationEngine(st
     return verifyWithExplorationEngine(env, model, task);
 }
 
+//
+// Verifying with statistical model checking engine
+//
+template<typename ValueType>
+typename std::enable_if<std::is_same<ValueType, double>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type verifyWithSmcEngine(
+    storm::Environment const& env, storm::storage::SymbolicModelDescription const& model,
+    storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
+    std::unique_ptr<storm::modelchecker::CheckResult> result;
+    if (model.getModelType() == storm::storage::SymbolicModelDescription::ModelType::DTMC) {
+        storm::modelchecker::StatisticalModelChecker<storm::models::sparse::Dtmc<ValueType>> checker(model);
+        if (checker.canHandle(task)) {
+            result = checker.check(env, task);
+        }
+    } else if (model.getModelType() == storm::storage::SymbolicModelDescription::ModelType::CTMC) {
+        storm::modelchecker::StatisticalModelChecker<storm::models::sparse::Ctmc<ValueType>> checker(model);
+        if (checker.canHandle(task)) {
+            result = checker.check(env, task);
+        }
+    } else {
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException,
+                        "The model type " << model.getModelType() << " is not supported by the statistical model checking engine.");
+    }
+
+    return result;
+}
+
+template<typename ValueType>
+typename std::enable_if<!std::is_same<ValueType, double>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type verifyWithSmcEngine(
+    storm::Environment const&, storm::storage::SymbolicModelDescription const&, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const&) {
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Statistical model checking engine does not support data type.");
+}
+
+template<typename ValueType>
+std::unique_ptr<storm::modelchecker::CheckResult> verifyWithSmcEngine(storm::storage::SymbolicModelDescription const& model,
+                                                                      storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
+    Environment env;
+    return verifyWithSmcEngine(env, model, task);
+}
+
 //
 // Verifying with Sparse engine
 //
@@ -317,6 +355,28 @@ std::unique_ptr<storm::modelchecker::CheckResult> computeExpectedVisitingTimesWi
     return result;
 }
 
+/*!
+ * Checks a property of the form P=? [phi U<=t psi] on the given CTMC for each of the given time bounds t in one pass, ignoring the time bound of the property.
+ *
+ * @param timeBounds The time bounds in ascending order.
+ * @return One result for each of the time bounds.
+ */
+template<typename ValueType>
+std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> verifyForTimeBoundsWithSparseEngine(
+    storm::Environment const& env, std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model,
+    storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task, std::vector<double> const& timeBounds) {
+    STORM_LOG_THROW(model->getType() == storm::models::ModelType::Ctmc, storm::exceptions::NotSupportedException,
+                    "Checking properties for multiple time bounds is not supported for the model type " << model->getType() << ".");
+    storm::logic::Formula const& formula = task.getFormula();
+    STORM_LOG_THROW(formula.isProbabilityOperatorFormula() && !formula.asProbabilityOperatorFormula().hasBound() &&
+                        formula.asProbabilityOperatorFormula().getSubformula().isBoundedUntilFormula(),
+                    storm::exceptions::NotSupportedException, "Checking the property " << formula << " for multiple time bounds is not supported.");
+    auto ctmc = model->template as<storm::models::sparse::Ctmc<ValueType>>();
+    storm::modelchecker::SparseCtmcCslModelChecker<storm::models::sparse::Ctmc<ValueType>> modelchecker(*ctmc);
+    return modelchecker.computeBoundedUntilProbabilitiesForTimeBounds(
+        env, task.substituteFormula(formula.asProbabilityOperatorFormula().getSubformula().asBoundedUntilFormula()), timeBounds);
+}
+
 //
 // Verifying with Hybrid engine
 //
@@ -53,7 +53,10 @@ BuilderOptions::BuilderOptions(bool buildAllRewardModels, bool buildAllLabels)
       addOutOfBoundsState(false),
       reservedBitsForUnboundedVariables(32),
       showProgress(false),
-      showProgressDelay(0) {
+      showProgressDelay(0),
+      jitCompilation(false),
+      jitCompiler("c++"),
+      bytecodeEvaluation(false) {
     // Intentionally left empty.
 }
 
@@ -212,6 +215,42 @@ BuilderOptions& BuilderOptions::setExplorationChecks(bool newValue) {
     return *this;
 }
 
+bool BuilderOptions::isJitCompilationSet() const {
+    return jitCompilation;
+}
+
+std::string const& BuilderOptions::getJitCompiler() const {
+    return jitCompiler;
+}
+
+std::string const& BuilderOptions::getJitCacheDirectory() const {
+    return jitCacheDirectory;
+}
+
+bool BuilderOptions::isBytecodeEvaluationSet() const {
+    return bytecodeEvaluation;
+}
+
+BuilderOptions& BuilderOptions::setJitCompilation(bool newValue) {
+    jitCompilation = newValue;
+    return *this;
+}
+
+BuilderOptions& BuilderOptions::setJitCompiler(std::string const& compiler) {
+    jitCompiler = compiler;
+    return *this;
+}
+
+BuilderOptions& BuilderOptions::setJitCacheDirectory(std::string const& directory) {
+    jitCacheDirectory = directory;
+    return *this;
+}
+
+BuilderOptions& BuilderOptions::setBytecodeEvaluation(bool newValue) {
+    bytecodeEvaluation = newValue;
+    return *this;
+}
+
 BuilderOptions& BuilderOptions::addRewardModel(std::string const& rewardModelName) {
     STORM_LOG_THROW(!buildAllRewardModels, storm::exceptions::InvalidSettingsException, "Cannot add reward model, because all reward models are built anyway.");
     rewardModelNames.emplace(rewardModelName);
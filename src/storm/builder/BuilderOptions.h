@@ -121,6 +121,10 @@ class BuilderOptions {
     uint64_t getReservedBitsForUnboundedVariables() const;
     bool isAddOverlappingGuardLabelSet() const;
     uint64_t getShowProgressDelay() const;
+    bool isJitCompilationSet() const;
+    bool isBytecodeEvaluationSet() const;
+    std::string const& getJitCompiler() const;
+    std::string const& getJitCacheDirectory() const;
 
     /**
      * Should all reward models be built? If not set, only required reward models are build.
@@ -211,6 +215,33 @@ class BuilderOptions {
      */
     BuilderOptions& setReservedBitsForUnboundedVariables(uint64_t value);
 
+    /**
+     * Should the expressions of the model be compiled to native code before the exploration?
+     * If the compilation fails, the expressions are interpreted as usual.
+     * @param newValue The new value (default true)
+     * @return this
+     */
+    BuilderOptions& setJitCompilation(bool newValue = true);
+
+    /**
+     * Sets the compiler that is invoked to compile the expressions of the model.
+     */
+    BuilderOptions& setJitCompiler(std::string const& compiler);
+
+    /**
+     * Sets the directory in which compiled expressions are cached. It has to be owned by the current user and must not be writable by others.
+     * If empty, a directory in the cache directory of the current user is used.
+     */
+    BuilderOptions& setJitCacheDirectory(std::string const& directory);
+
+    /**
+     * Should the expressions of the model be translated to bytecode before the exploration?
+     * This does not require a compiler at runtime. If JIT compilation is also enabled, the bytecode is only used if the compilation fails.
+     * @param newValue The new value (default true)
+     * @return this
+     */
+    BuilderOptions& setBytecodeEvaluation(bool newValue = true);
+
     /**
      * Substitutes all expressions occurring in these options.
      */
@@ -276,6 +307,18 @@ class BuilderOptions {
 
     /// The delay for printing progress information.
     uint64_t showProgressDelay;
+
+    /// A flag indicating whether the expressions of the model are to be compiled to native code.
+    bool jitCompilation;
+
+    /// The compiler used for compiling the expressions of the model.
+    std::string jitCompiler;
+
+    /// The directory in which compiled expressions are cached.
+    std::string jitCacheDirectory;
+
+    /// A flag indicating whether the expressions of the model are to be evaluated with bytecode.
+    bool bytecodeEvaluation;
 };
 
 }  // namespace builder
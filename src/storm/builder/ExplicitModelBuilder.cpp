@@ -1,6 +1,11 @@
 #include "storm/builder/ExplicitModelBuilder.h"
 
+#include <atomic>
+#include <exception>
+#include <limits>
 #include <map>
+#include <thread>
+#include <unordered_map>
 
 #include "storm/adapters/RationalFunctionAdapter.h"
 
@@ -62,6 +67,8 @@ ExplicitModelBuilder<ValueType, RewardModelType, StateType>::Options::Options()
     if (buildSettings.isExplorationStateLimitSet()) {
         explorationStateLimit = buildSettings.getExplorationStateLimit();
     }
+    numberOfThreads = buildSettings.getNumberOfExplorationThreads();
+    useConcurrentStateStorage = buildSettings.isConcurrentStateStorageSet();
 }
 
 template<typename ValueType, typename RewardModelType, typename StateType>
@@ -71,11 +78,22 @@ ExplicitModelBuilder<ValueType, RewardModelType, StateType>::ExplicitModelBuilde
     // Intentionally left empty.
 }
 
+template<typename ValueType, typename RewardModelType, typename StateType>
+ExplicitModelBuilder<ValueType, RewardModelType, StateType>::ExplicitModelBuilder(
+    std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>> const& generator,
+    std::function<std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>>()> const& generatorFactory, Options const& options)
+    : generator(generator), generatorFactory(generatorFactory), options(options), stateStorage(generator->getStateSize()) {
+    // Intentionally left empty.
+}
+
 template<typename ValueType, typename RewardModelType, typename StateType>
 ExplicitModelBuilder<ValueType, RewardModelType, StateType>::ExplicitModelBuilder(storm::prism::Program const& program,
                                                                                   storm::generator::NextStateGeneratorOptions const& generatorOptions,
                                                                                   Options const& builderOptions)
-    : ExplicitModelBuilder(std::make_shared<storm::generator::PrismNextStateGenerator<ValueType, StateType>>(program, generatorOptions), builderOptions) {
+    : ExplicitModelBuilder(
+          std::make_shared<storm::generator::PrismNextStateGenerator<ValueType, StateType>>(program, generatorOptions),
+          [program, generatorOptions]() { return std::make_shared<storm::generator::PrismNextStateGenerator<ValueType, StateType>>(program, generatorOptions); },
+          builderOptions) {
     // Intentionally left empty.
 }
 
@@ -83,7 +101,10 @@ template<typename ValueType, typename RewardModelType, typename StateType>
 ExplicitModelBuilder<ValueType, RewardModelType, StateType>::ExplicitModelBuilder(storm::jani::Model const& model,
                                                                                   storm::generator::NextStateGeneratorOptions const& generatorOptions,
                                                                                   Options const& builderOptions)
-    : ExplicitModelBuilder(std::make_shared<storm::generator::JaniNextStateGenerator<ValueType, StateType>>(model, generatorOptions), builderOptions) {
+    : ExplicitModelBuilder(
+          std::make_shared<storm::generator::JaniNextStateGenerator<ValueType, StateType>>(model, generatorOptions),
+          [model, generatorOptions]() { return std::make_shared<storm::generator::JaniNextStateGenerator<ValueType, StateType>>(model, generatorOptions); },
+          builderOptions) {
     // Intentionally left empty.
 }
 
@@ -136,6 +157,181 @@ StateType ExplicitModelBuilder<ValueType, RewardModelType, StateType>::getOrAddS
     return actualIndex;
 }
 
+template<typename ValueType, typename RewardModelType, typename StateType>
+bool ExplicitModelBuilder<ValueType, RewardModelType, StateType>::isParallelExplorationApplicable() const {
+    if (options.numberOfThreads <= 1) {
+        return false;
+    }
+
+    std::string reason;
+    if (!generatorFactory) {
+        reason = "no further generators can be created for the model";
+    } else if (options.explorationOrder != ExplorationOrder::Bfs) {
+        reason = "it requires breadth-first exploration";
+    } else if (options.explorationStateLimit.has_value()) {
+        reason = "it does not support exploration state limits";
+    } else if (generator->getOptions().isAddOverlappingGuardLabelSet()) {
+        reason = "it does not support labeling states with overlapping guards";
+    } else if (std::is_same<ValueType, storm::RationalFunction>::value) {
+        reason = "it does not support parametric models";
+    }
+    STORM_LOG_WARN_COND(reason.empty(), "Exploring the state space sequentially although " << options.numberOfThreads
+                                                                                           << " threads were requested, because the parallel exploration "
+                                                                                           << reason << ".");
+    return reason.empty();
+}
+
+template<typename ValueType, typename RewardModelType, typename StateType>
+void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::expandStatesInParallel(
+    std::vector<std::pair<CompressedState, StateType>> const& states,
+    std::vector<std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>>> const& workerGenerators,
+    std::vector<storm::generator::StateBehavior<ValueType, StateType>>& behaviors) {
+    behaviors.clear();
+    behaviors.resize(states.size());
+
+    // While the threads are running, the state storage is only read. States that are not yet stored get a preliminary id
+    // (counting downwards from the largest representable value) that is local to the expanded state. For each expanded
+    // state, we remember the newly discovered states in the order in which the generator requested their ids.
+    std::vector<std::vector<CompressedState>> discoveredStates(states.size());
+    StateType const firstPreliminaryId = std::numeric_limits<StateType>::max();
+
+    // If the concurrent state storage is used, the preliminary ids are instead shared among all expanded states: the
+    // threads insert newly discovered states into a common concurrent map, which assigns consecutive indices. Each
+    // expanded state then only remembers these indices rather than copies of the states.
+    std::unique_ptr<storm::storage::ConcurrentBitVectorHashMap<StateType>> sharedDiscoveredStates;
+    std::vector<std::vector<StateType>> sharedDiscoveredIndices;
+    if (options.useConcurrentStateStorage) {
+        sharedDiscoveredStates = std::make_unique<storm::storage::ConcurrentBitVectorHashMap<StateType>>(stateStorage.bitsPerState, 2 * states.size());
+        sharedDiscoveredIndices.resize(states.size());
+    }
+
+    uint64_t const numberOfWorkers = std::min<uint64_t>(workerGenerators.size(), states.size());
+    uint64_t const chunkSize = std::max<uint64_t>(1, std::min<uint64_t>(256, states.size() / (4 * numberOfWorkers)));
+    std::atomic<uint64_t> nextChunkStart(0);
+    std::vector<std::exception_ptr> exceptions(numberOfWorkers);
+
+    auto expandChunks = [&](uint64_t worker) {
+        try {
+            storm::generator::NextStateGenerator<ValueType, StateType>& workerGenerator = *workerGenerators[worker];
+            std::unordered_map<CompressedState, StateType> preliminaryIds;
+            std::vector<CompressedState>* currentDiscoveredStates = nullptr;
+            std::vector<StateType>* currentDiscoveredIndices = nullptr;
+            std::function<StateType(CompressedState const&)> stateToIdCallback = [&](CompressedState const& state) {
+                if (auto knownId = stateStorage.stateToId.find(state)) {
+                    return knownId.value();
+                }
+                if (sharedDiscoveredStates) {
+                    StateType index = sharedDiscoveredStates->findOrAddConsecutive(state).first;
+                    currentDiscoveredIndices->push_back(index);
+                    return firstPreliminaryId - index;
+                }
+                auto insertionResult = preliminaryIds.emplace(state, firstPreliminaryId - static_cast<StateType>(currentDiscoveredStates->size()));
+                if (insertionResult.second) {
+                    currentDiscoveredStates->push_back(state);
+                }
+                return insertionResult.first->second;
+            };
+
+            for (uint64_t chunkStart = nextChunkStart.fetch_add(chunkSize); chunkStart < states.size(); chunkStart = nextChunkStart.fetch_add(chunkSize)) {
+                uint64_t const chunkEnd = std::min<uint64_t>(chunkStart + chunkSize, states.size());
+                for (uint64_t stateIndex = chunkStart; stateIndex < chunkEnd; ++stateIndex) {
+                    preliminaryIds.clear();
+                    currentDiscoveredStates = &discoveredStates[stateIndex];
+                    if (sharedDiscoveredStates) {
+                        currentDiscoveredIndices = &sharedDiscoveredIndices[stateIndex];
+                    }
+                    workerGenerator.load(states[stateIndex].first);
+                    behaviors[stateIndex] = workerGenerator.expand(stateToIdCallback);
+                }
+            }
+        } catch (...) {
+            exceptions[worker] = std::current_exception();
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(numberOfWorkers - 1);
+    for (uint64_t worker = 1; worker < numberOfWorkers; ++worker) {
+        threads.emplace_back(expandChunks, worker);
+    }
+    expandChunks(0);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (auto const& exception : exceptions) {
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+    }
+
+    if (sharedDiscoveredStates) {
+        registerSharedDiscoveredStates(*sharedDiscoveredStates, sharedDiscoveredIndices, behaviors);
+        return;
+    }
+
+    // Now register the discovered states in the order in which the sequential exploration would have discovered them
+    // and replace the preliminary ids accordingly.
+    std::vector<StateType> actualIds;
+    for (uint64_t stateIndex = 0; stateIndex < states.size(); ++stateIndex) {
+        if (discoveredStates[stateIndex].empty()) {
+            continue;
+        }
+        actualIds.clear();
+        for (auto const& discoveredState : discoveredStates[stateIndex]) {
+            actualIds.push_back(getOrAddStateIndex(discoveredState));
+        }
+        STORM_LOG_THROW(stateStorage.getNumberOfStates() <= firstPreliminaryId - actualIds.size(), storm::exceptions::WrongFormatException,
+                        "The number of states exceeds the range of the state index type.");
+        auto remapping = [&actualIds, &firstPreliminaryId](StateType const& state) {
+            return state > firstPreliminaryId - actualIds.size() ? actualIds[firstPreliminaryId - state] : state;
+        };
+        for (auto& choice : behaviors[stateIndex].getChoices()) {
+            choice.remapStates(remapping);
+        }
+    }
+}
+
+template<typename ValueType, typename RewardModelType, typename StateType>
+void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::registerSharedDiscoveredStates(
+    storm::storage::ConcurrentBitVectorHashMap<StateType> const& discoveredStates, std::vector<std::vector<StateType>> const& discoveredIndices,
+    std::vector<storm::generator::StateBehavior<ValueType, StateType>>& behaviors) {
+    StateType const firstPreliminaryId = std::numeric_limits<StateType>::max();
+    uint64_t const numberOfDiscoveredStates = discoveredStates.size();
+    if (numberOfDiscoveredStates == 0) {
+        return;
+    }
+
+    std::vector<CompressedState> indexToState(numberOfDiscoveredStates);
+    for (auto const& stateIndexPair : discoveredStates) {
+        indexToState[stateIndexPair.second] = stateIndexPair.first;
+    }
+
+    // Register the states in the order in which the sequential exploration would have discovered them, i.e., in the order of
+    // the expanded states and, for each expanded state, in the order in which the generator requested their ids.
+    StateType const unassigned = firstPreliminaryId;
+    std::vector<StateType> actualIds(numberOfDiscoveredStates, unassigned);
+    for (auto const& indices : discoveredIndices) {
+        for (StateType index : indices) {
+            if (actualIds[index] == unassigned) {
+                actualIds[index] = getOrAddStateIndex(indexToState[index]);
+            }
+        }
+    }
+    STORM_LOG_THROW(stateStorage.getNumberOfStates() <= firstPreliminaryId - numberOfDiscoveredStates, storm::exceptions::WrongFormatException,
+                    "The number of states exceeds the range of the state index type.");
+
+    auto remapping = [&actualIds, &firstPreliminaryId, &numberOfDiscoveredStates](StateType const& state) {
+        return state > firstPreliminaryId - numberOfDiscoveredStates ? actualIds[firstPreliminaryId - state] : state;
+    };
+    for (uint64_t stateIndex = 0; stateIndex < behaviors.size(); ++stateIndex) {
+        if (!discoveredIndices[stateIndex].empty()) {
+            for (auto& choice : behaviors[stateIndex].getChoices()) {
+                choice.remapStates(remapping);
+            }
+        }
+    }
+}
+
 template<typename ValueType, typename RewardModelType, typename StateType>
 ExplicitStateLookup<StateType> ExplicitModelBuilder<ValueType, RewardModelType, StateType>::exportExplicitStateLookup() const {
     return ExplicitStateLookup<StateType>(this->generator->getVariableInformation(), this->stateStorage.stateToId);
@@ -167,6 +363,21 @@ void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(
     STORM_LOG_THROW(!this->stateStorage.initialStateIndices.empty(), storm::exceptions::WrongFormatException,
                     "The model does not have a single initial state.");
 
+    // If requested, several threads expand batches of states taken from the front of the queue. The resulting
+    // behaviors are then added to the matrices in the same way as in the sequential exploration.
+    bool const parallelExploration = isParallelExplorationApplicable();
+    std::vector<std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>>> workerGenerators;
+    if (parallelExploration) {
+        for (uint64_t worker = 0; worker < options.numberOfThreads; ++worker) {
+            workerGenerators.push_back(generatorFactory());
+        }
+        STORM_LOG_INFO("Exploring the state space with " << options.numberOfThreads << " threads.");
+    }
+    uint64_t const batchSize = 4096 * options.numberOfThreads;
+    std::vector<std::pair<CompressedState, StateType>> currentBatch;
+    std::vector<storm::generator::StateBehavior<ValueType, StateType>> currentBatchBehaviors;
+    uint64_t currentBatchPosition = 0;
+
     // Now explore the current state until there is no more reachable state.
     uint_fast64_t currentRowGroup = 0;
     uint_fast64_t currentRow = 0;
@@ -177,11 +388,33 @@ void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(
     uint64_t numberOfExploredStatesSinceLastMessage = 0;
 
     // Perform a search through the model.
-    while (!statesToExplore.empty()) {
-        // Get the first state in the queue.
-        CompressedState currentState = statesToExplore.front().first;
-        StateType currentIndex = statesToExplore.front().second;
-        statesToExplore.pop_front();
+    while (!statesToExplore.empty() || currentBatchPosition < currentBatch.size()) {
+        CompressedState currentState;
+        StateType currentIndex;
+        storm::generator::StateBehavior<ValueType, StateType> behavior;
+        bool stateLimitExceeded = false;
+
+        if (parallelExploration) {
+            // If the current batch is exhausted, expand the next batch of states.
+            if (currentBatchPosition == currentBatch.size()) {
+                currentBatch.clear();
+                while (!statesToExplore.empty() && currentBatch.size() < batchSize) {
+                    currentBatch.push_back(std::move(statesToExplore.front()));
+                    statesToExplore.pop_front();
+                }
+                expandStatesInParallel(currentBatch, workerGenerators, currentBatchBehaviors);
+                currentBatchPosition = 0;
+            }
+            currentState = std::move(currentBatch[currentBatchPosition].first);
+            currentIndex = currentBatch[currentBatchPosition].second;
+            behavior = std::move(currentBatchBehaviors[currentBatchPosition]);
+            ++currentBatchPosition;
+        } else {
+            // Get the first state in the queue.
+            currentState = statesToExplore.front().first;
+            currentIndex = statesToExplore.front().second;
+            statesToExplore.pop_front();
+        }
 
         // If the exploration order differs from breadth-first, we remember that this row group was actually
         // filled with the transitions of a different state.
@@ -193,16 +426,20 @@ void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(
             STORM_LOG_TRACE("Exploring state with id " << currentIndex << ".");
         }
 
-        generator->load(currentState);
+        // In the parallel exploration, the state was already expanded by one of the worker generators.
+        if (!parallelExploration || stateAndChoiceInformationBuilder.isBuildStateValuations()) {
+            generator->load(currentState);
+        }
         if (stateAndChoiceInformationBuilder.isBuildStateValuations()) {
             generator->addStateValuation(currentIndex, stateAndChoiceInformationBuilder.stateValuationsBuilder());
         }
 
-        storm::generator::StateBehavior<ValueType, StateType> behavior;
-        // If the exploration state limit is set and the limit is reached, we stop the exploration.
-        bool const stateLimitExceeded = options.explorationStateLimit.has_value() && stateStorage.getNumberOfStates() >= options.explorationStateLimit.value();
-        if (!stateLimitExceeded) {
-            behavior = generator->expand(stateToIdCallback);
+        if (!parallelExploration) {
+            // If the exploration state limit is set and the limit is reached, we stop the exploration.
+            stateLimitExceeded = options.explorationStateLimit.has_value() && stateStorage.getNumberOfStates() >= options.explorationStateLimit.value();
+            if (!stateLimitExceeded) {
+                behavior = generator->expand(stateToIdCallback);
+            }
         }
 
         if (behavior.empty()) {
@@ -6,6 +6,7 @@
 #include <boost/variant.hpp>
 #include <cstdint>
 #include <deque>
+#include <functional>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -16,6 +17,7 @@
 #include "storm/models/sparse/Model.h"
 #include "storm/models/sparse/StateLabeling.h"
 #include "storm/storage/BitVectorHashMap.h"
+#include "storm/storage/ConcurrentBitVectorHashMap.h"
 #include "storm/storage/SparseMatrix.h"
 #include "storm/storage/prism/Program.h"
 #include "storm/storage/sparse/ModelComponents.h"
@@ -82,6 +84,12 @@ class ExplicitModelBuilder {
 
         // If set, no further states will be explored once the given number is exceeded.
         std::optional<StateType> explorationStateLimit;
+
+        // The number of threads that expand states concurrently. A value of one yields the sequential exploration.
+        uint64_t numberOfThreads;
+
+        // If set, the threads of the parallel exploration share a concurrent map for the states they newly discover.
+        bool useConcurrentStateStorage;
     };
 
     /*!
@@ -91,6 +99,17 @@ class ExplicitModelBuilder {
      */
     ExplicitModelBuilder(std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>> const& generator, Options const& options = Options());
 
+    /*!
+     * Creates an explicit model builder that uses the provided generator. If the state space is to be explored by
+     * multiple threads, the given factory is used to create one further generator per thread.
+     *
+     * @param generator The generator to use.
+     * @param generatorFactory A function creating generators that behave exactly like the given generator.
+     */
+    ExplicitModelBuilder(std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>> const& generator,
+                         std::function<std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>>()> const& generatorFactory,
+                         Options const& options = Options());
+
     /*!
      * Creates an explicit model builder for the given PRISM program.
      *
@@ -137,6 +156,37 @@ class ExplicitModelBuilder {
      */
     StateType getOrAddStateIndex(CompressedState const& state);
 
+    /*!
+     * Checks whether the states can be expanded by several threads, i.e., whether more than one thread was requested and
+     * the current configuration supports the parallel exploration.
+     */
+    bool isParallelExplorationApplicable() const;
+
+    /*!
+     * Expands the given states concurrently using the given (thread-local) generators. Newly discovered states are added
+     * to the state storage (and the exploration queue) in the same order in which a sequential exploration would have
+     * added them. Hence, the state ids and the resulting behaviors do not depend on the number of threads.
+     *
+     * @param states The states to expand together with their ids.
+     * @param workerGenerators The generators used by the individual threads.
+     * @param behaviors The behaviors of the given states (in the same order as the states) are written to this vector.
+     */
+    void expandStatesInParallel(std::vector<std::pair<CompressedState, StateType>> const& states,
+                                std::vector<std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>>> const& workerGenerators,
+                                std::vector<storm::generator::StateBehavior<ValueType, StateType>>& behaviors);
+
+    /*!
+     * Adds the states that were discovered while expanding states with a shared concurrent map to the state storage and
+     * replaces their preliminary ids in the given behaviors.
+     *
+     * @param discoveredStates The map from the discovered states to their (consecutive) indices.
+     * @param discoveredIndices For each expanded state, the indices of the discovered states in the order in which they were requested.
+     * @param behaviors The behaviors of the expanded states.
+     */
+    void registerSharedDiscoveredStates(storm::storage::ConcurrentBitVectorHashMap<StateType> const& discoveredStates,
+                                        std::vector<std::vector<StateType>> const& discoveredIndices,
+                                        std::vector<storm::generator::StateBehavior<ValueType, StateType>>& behaviors);
+
     /*!
      * Builds the transition matrix and the transition reward matrix based for the given program.
      *
@@ -165,6 +215,10 @@ class ExplicitModelBuilder {
     /// The generator to use for the building process.
     std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>> generator;
 
+    /// If available, a function that creates further (independent) generators for the model. These are required for the
+    /// parallel exploration as the generators themselves are not thread-safe.
+    std::function<std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>>()> generatorFactory;
+
     /// The options to be used for the building process.
     Options options;
 
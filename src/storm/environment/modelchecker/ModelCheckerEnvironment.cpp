@@ -1,6 +1,7 @@
 #include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 
 #include "storm/environment/modelchecker/MultiObjectiveModelCheckerEnvironment.h"
+#include "storm/environment/modelchecker/StatisticalModelCheckerEnvironment.h"
 
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/IOSettings.h"
@@ -41,6 +42,14 @@ MultiObjectiveModelCheckerEnvironment const& ModelCheckerEnvironment::multi() co
     return multiObjectiveModelCheckerEnvironment.get();
 }
 
+StatisticalModelCheckerEnvironment& ModelCheckerEnvironment::smc() {
+    return statisticalModelCheckerEnvironment.get();
+}
+
+StatisticalModelCheckerEnvironment const& ModelCheckerEnvironment::smc() const {
+    return statisticalModelCheckerEnvironment.get();
+}
+
 bool ModelCheckerEnvironment::isLtl2daToolSet() const {
     return ltl2daTool.is_initialized();
 }
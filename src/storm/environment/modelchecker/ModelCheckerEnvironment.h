@@ -12,6 +12,7 @@ namespace storm {
 
 // Forward declare subenvironments
 class MultiObjectiveModelCheckerEnvironment;
+class StatisticalModelCheckerEnvironment;
 
 class ModelCheckerEnvironment {
    public:
@@ -21,6 +22,9 @@ class ModelCheckerEnvironment {
     MultiObjectiveModelCheckerEnvironment& multi();
     MultiObjectiveModelCheckerEnvironment const& multi() const;
 
+    StatisticalModelCheckerEnvironment& smc();
+    StatisticalModelCheckerEnvironment const& smc() const;
+
     SteadyStateDistributionAlgorithm getSteadyStateDistributionAlgorithm() const;
     void setSteadyStateDistributionAlgorithm(SteadyStateDistributionAlgorithm value);
 
@@ -31,6 +35,7 @@ class ModelCheckerEnvironment {
 
    private:
     SubEnvironment<MultiObjectiveModelCheckerEnvironment> multiObjectiveModelCheckerEnvironment;
+    SubEnvironment<StatisticalModelCheckerEnvironment> statisticalModelCheckerEnvironment;
     boost::optional<std::string> ltl2daTool;
     SteadyStateDistributionAlgorithm steadyStateDistributionAlgorithm;
 };
@@ -0,0 +1,85 @@
+#include "storm/environment/modelchecker/StatisticalModelCheckerEnvironment.h"
+
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/StatisticalModelCheckingSettings.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+
+StatisticalModelCheckerEnvironment::StatisticalModelCheckerEnvironment() {
+    auto const& smcSettings = storm::settings::getModule<storm::settings::modules::StatisticalModelCheckingSettings>();
+    stoppingCriterion = smcSettings.getStoppingCriterion();
+    epsilon = smcSettings.getEpsilon();
+    confidence = smcSettings.getConfidence();
+    numberOfThreads = smcSettings.getNumberOfThreads();
+    if (smcSettings.isSeedSet()) {
+        seed = smcSettings.getSeed();
+    }
+    maximalPathLength = smcSettings.getMaximalPathLength();
+}
+
+StatisticalModelCheckerEnvironment::~StatisticalModelCheckerEnvironment() {
+    // Intentionally left empty
+}
+
+storm::modelchecker::smc::StoppingCriterion const& StatisticalModelCheckerEnvironment::getStoppingCriterion() const {
+    return stoppingCriterion;
+}
+
+void StatisticalModelCheckerEnvironment::setStoppingCriterion(storm::modelchecker::smc::StoppingCriterion value) {
+    stoppingCriterion = value;
+}
+
+double StatisticalModelCheckerEnvironment::getEpsilon() const {
+    return epsilon;
+}
+
+void StatisticalModelCheckerEnvironment::setEpsilon(double value) {
+    STORM_LOG_THROW(value > 0.0 && value < 1.0, storm::exceptions::InvalidArgumentException, "The error bound must lie in (0,1).");
+    epsilon = value;
+}
+
+double StatisticalModelCheckerEnvironment::getConfidence() const {
+    return confidence;
+}
+
+void StatisticalModelCheckerEnvironment::setConfidence(double value) {
+    STORM_LOG_THROW(value > 0.0 && value < 1.0, storm::exceptions::InvalidArgumentException, "The confidence must lie in (0,1).");
+    confidence = value;
+}
+
+uint64_t StatisticalModelCheckerEnvironment::getNumberOfThreads() const {
+    return numberOfThreads;
+}
+
+void StatisticalModelCheckerEnvironment::setNumberOfThreads(uint64_t value) {
+    numberOfThreads = value;
+}
+
+bool StatisticalModelCheckerEnvironment::isSeedSet() const {
+    return seed.is_initialized();
+}
+
+uint64_t StatisticalModelCheckerEnvironment::getSeed() const {
+    STORM_LOG_ASSERT(isSeedSet(), "Tried to retrieve the seed although it is not set.");
+    return seed.get();
+}
+
+void StatisticalModelCheckerEnvironment::setSeed(uint64_t value) {
+    seed = value;
+}
+
+void StatisticalModelCheckerEnvironment::unsetSeed() {
+    seed = boost::none;
+}
+
+uint64_t StatisticalModelCheckerEnvironment::getMaximalPathLength() const {
+    return maximalPathLength;
+}
+
+void StatisticalModelCheckerEnvironment::setMaximalPathLength(uint64_t value) {
+    maximalPathLength = value;
+}
+}  // namespace storm
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <boost/optional.hpp>
+#include <cstdint>
+
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
+#include "storm/modelchecker/smc/StoppingCriterion.h"
+
+namespace storm {
+
+class StatisticalModelCheckerEnvironment {
+   public:
+    StatisticalModelCheckerEnvironment();
+    ~StatisticalModelCheckerEnvironment();
+
+    storm::modelchecker::smc::StoppingCriterion const& getStoppingCriterion() const;
+    void setStoppingCriterion(storm::modelchecker::smc::StoppingCriterion value);
+
+    double getEpsilon() const;
+    void setEpsilon(double value);
+
+    double getConfidence() const;
+    void setConfidence(double value);
+
+    uint64_t getNumberOfThreads() const;
+    void setNumberOfThreads(uint64_t value);
+
+    bool isSeedSet() const;
+    uint64_t getSeed() const;
+    void setSeed(uint64_t value);
+    void unsetSeed();
+
+    uint64_t getMaximalPathLength() const;
+    void setMaximalPathLength(uint64_t value);
+
+   private:
+    storm::modelchecker::smc::StoppingCriterion stoppingCriterion;
+    double epsilon;
+    double confidence;
+    uint64_t numberOfThreads;
+    boost::optional<uint64_t> seed;
+    uint64_t maximalPathLength;
+};
+}  // namespace storm
@@ -19,6 +19,7 @@ LongRunAverageSolverEnvironment::LongRunAverageSolverEnvironment() {
         maxIters = lraSettings.getMaximalIterationCount();
     }
     aperiodicFactor = storm::utility::convertNumber<storm::RationalNumber>(lraSettings.getAperiodicFactor());
+    mecBatchSize = lraSettings.getMecBatchSize();
 }
 
 LongRunAverageSolverEnvironment::~LongRunAverageSolverEnvironment() {
@@ -91,4 +92,12 @@ void LongRunAverageSolverEnvironment::setAperiodicFactor(storm::RationalNumber v
     aperiodicFactor = value;
 }
 
+uint64_t LongRunAverageSolverEnvironment::getMecBatchSize() const {
+    return mecBatchSize;
+}
+
+void LongRunAverageSolverEnvironment::setMecBatchSize(uint64_t value) {
+    mecBatchSize = value;
+}
+
 }  // namespace storm
@@ -32,6 +32,9 @@ class LongRunAverageSolverEnvironment {
     storm::RationalNumber const& getAperiodicFactor() const;
     void setAperiodicFactor(storm::RationalNumber value);
 
+    uint64_t getMecBatchSize() const;
+    void setMecBatchSize(uint64_t value);
+
    private:
     storm::solver::LraMethod detMethod;
     bool detMethodSetFromDefault;
@@ -44,5 +47,7 @@ class LongRunAverageSolverEnvironment {
     boost::optional<uint64_t> maxIters;
 
     storm::RationalNumber aperiodicFactor;
+
+    uint64_t mecBatchSize;
 };
 }  // namespace storm
@@ -26,6 +26,7 @@ NativeSolverEnvironment::NativeSolverEnvironment() {
     powerMethodMultiplicationStyle = nativeSettings.getPowerMethodMultiplicationStyle();
     sorOmega = storm::utility::convertNumber<storm::RationalNumber>(nativeSettings.getOmega());
     symmetricUpdates = nativeSettings.isForceIntervalIterationSymmetricUpdatesSet();
+    useSlicedMatrix = nativeSettings.isUseSlicedMatrixSet();
 }
 
 NativeSolverEnvironment::~NativeSolverEnvironment() {
@@ -93,4 +94,12 @@ void NativeSolverEnvironment::setSymmetricUpdates(bool value) {
     symmetricUpdates = value;
 }
 
+bool NativeSolverEnvironment::isUseSlicedMatrixSet() const {
+    return useSlicedMatrix;
+}
+
+void NativeSolverEnvironment::setUseSlicedMatrix(bool value) {
+    useSlicedMatrix = value;
+}
+
 }  // namespace storm
@@ -18,6 +18,7 @@ SolverEnvironment::SolverEnvironment() {
     forceExact = generalSettings.isExactSet() || generalSettings.isExactFinitePrecisionSet();
     linearEquationSolverType = storm::settings::getModule<storm::settings::modules::CoreSettings>().getEquationSolver();
     linearEquationSolverTypeSetFromDefault = storm::settings::getModule<storm::settings::modules::CoreSettings>().isEquationSolverSetFromDefaultValue();
+    numberOfThreads = storm::settings::getModule<storm::settings::modules::CoreSettings>().getNumberOfSolverThreads();
 }
 
 SolverEnvironment::~SolverEnvironment() {
@@ -120,6 +121,15 @@ void SolverEnvironment::setForceExact(bool value) {
     SolverEnvironment::forceExact = value;
 }
 
+uint64_t SolverEnvironment::getNumberOfThreads() const {
+    return numberOfThreads;
+}
+
+void SolverEnvironment::setNumberOfThreads(uint64_t value) {
+    STORM_LOG_THROW(value > 0, storm::exceptions::InvalidEnvironmentException, "The number of threads must be positive.");
+    numberOfThreads = value;
+}
+
 storm::solver::EquationSolverType const& SolverEnvironment::getLinearEquationSolverType() const {
     return linearEquationSolverType;
 }
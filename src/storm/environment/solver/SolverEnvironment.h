@@ -52,6 +52,8 @@ class SolverEnvironment {
     void setForceSoundness(bool value);
     bool isForceExact() const;
     void setForceExact(bool value);
+    uint64_t getNumberOfThreads() const;
+    void setNumberOfThreads(uint64_t value);
 
     storm::solver::EquationSolverType const& getLinearEquationSolverType() const;
     void setLinearEquationSolverType(storm::solver::EquationSolverType const& value, bool isSetFromDefault = false);
@@ -78,5 +80,6 @@ class SolverEnvironment {
     bool linearEquationSolverTypeSetFromDefault;
     bool forceSoundness;
     bool forceExact;
+    uint64_t numberOfThreads;
 };
 }  // namespace storm
@@ -0,0 +1,115 @@
+#include "storm/generator/BytecodePrismProgram.h"
+
+#include <algorithm>
+
+#include "storm/exceptions/BaseException.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/generator/VariableInformation.h"
+#include "storm/storage/prism/Program.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace generator {
+
+std::unique_ptr<BytecodePrismProgram> BytecodePrismProgram::create(storm::prism::Program const& program, VariableInformation const& variableInformation) {
+    std::unique_ptr<BytecodePrismProgram> result(new BytecodePrismProgram());
+    try {
+        for (auto const& module : program.getModules()) {
+            result->guardBytecodes.emplace_back();
+            uint64_t const guardBytecodeIndex = result->guardBytecodes.size() - 1;
+            for (auto const& command : module.getCommands()) {
+                ExpressionBytecode& guardBytecode = result->guardBytecodes.back().bytecode;
+                if (result->guards.size() <= command.getGlobalIndex()) {
+                    result->guards.resize(command.getGlobalIndex() + 1);
+                }
+                result->guards[command.getGlobalIndex()] = {guardBytecodeIndex, guardBytecode.addExpression(command.getGuardExpression(), variableInformation)};
+
+                result->updateBytecodes.emplace_back();
+                uint64_t const updateBytecodeIndex = result->updateBytecodes.size() - 1;
+                ExpressionBytecode& updateBytecode = result->updateBytecodes.back().bytecode;
+                for (auto const& update : command.getUpdates()) {
+                    if (result->probabilities.size() <= update.getGlobalIndex()) {
+                        result->probabilities.resize(update.getGlobalIndex() + 1);
+                        result->assignmentRanges.resize(update.getGlobalIndex() + 1);
+                    }
+                    result->probabilities[update.getGlobalIndex()] = {updateBytecodeIndex,
+                                                                      updateBytecode.addExpression(update.getLikelihoodExpression(), variableInformation)};
+                    uint64_t const firstAssignment = result->assignments.size();
+                    for (auto const& assignment : update.getAssignments()) {
+                        uint64_t const output = updateBytecode.addExpression(assignment.getExpression(), variableInformation);
+                        auto booleanIt = std::find_if(
+                            variableInformation.booleanVariables.begin(), variableInformation.booleanVariables.end(),
+                            [&assignment](BooleanVariableInformation const& information) { return information.variable == assignment.getVariable(); });
+                        if (booleanIt != variableInformation.booleanVariables.end()) {
+                            result->assignments.push_back({output, true, booleanIt->bitOffset, 1, 0, 1});
+                            continue;
+                        }
+                        auto integerIt = std::find_if(
+                            variableInformation.integerVariables.begin(), variableInformation.integerVariables.end(),
+                            [&assignment](IntegerVariableInformation const& information) { return information.variable == assignment.getVariable(); });
+                        STORM_LOG_THROW(integerIt != variableInformation.integerVariables.end(), storm::exceptions::NotSupportedException,
+                                        "Assignment to unknown variable '" << assignment.getVariableName() << "'.");
+                        result->assignments.push_back(
+                            {output, false, integerIt->bitOffset, integerIt->bitWidth, integerIt->lowerBound, integerIt->upperBound});
+                    }
+                    result->assignmentRanges[update.getGlobalIndex()] = {firstAssignment, result->assignments.size()};
+                }
+            }
+        }
+    } catch (storm::exceptions::BaseException const& e) {
+        STORM_LOG_WARN("Expressions of the program are not translated to bytecode and will be interpreted: " << e.what());
+        return nullptr;
+    }
+    return result;
+}
+
+void BytecodePrismProgram::loadState(CompressedState const& state) {
+    this->state = &state;
+    ++currentState;
+}
+
+ExpressionBytecode& BytecodePrismProgram::getExecuted(LazyBytecode& lazyBytecode) {
+    if (lazyBytecode.executedState != currentState) {
+        lazyBytecode.bytecode.execute(*state);
+        lazyBytecode.executedState = currentState;
+    }
+    return lazyBytecode.bytecode;
+}
+
+bool BytecodePrismProgram::isCommandEnabled(uint64_t globalCommandIndex) {
+    Output const& guard = guards[globalCommandIndex];
+    return getExecuted(guardBytecodes[guard.bytecodeIndex]).getBoolean(guard.output);
+}
+
+double BytecodePrismProgram::getProbability(uint64_t globalUpdateIndex) {
+    Output const& probability = probabilities[globalUpdateIndex];
+    return getExecuted(updateBytecodes[probability.bytecodeIndex]).getDouble(probability.output);
+}
+
+bool BytecodePrismProgram::applyUpdate(uint64_t globalUpdateIndex, CompressedState& state) {
+    ExpressionBytecode const& bytecode = getExecuted(updateBytecodes[probabilities[globalUpdateIndex].bytecodeIndex]);
+    auto const& range = assignmentRanges[globalUpdateIndex];
+
+    // Check all bounds before modifying the state.
+    for (uint64_t position = range.first; position < range.second; ++position) {
+        Assignment const& assignment = assignments[position];
+        if (!assignment.boolean) {
+            int64_t const value = bytecode.getInteger(assignment.output);
+            if (value < assignment.lowerBound || value > assignment.upperBound) {
+                return false;
+            }
+        }
+    }
+    for (uint64_t position = range.first; position < range.second; ++position) {
+        Assignment const& assignment = assignments[position];
+        if (assignment.boolean) {
+            state.set(assignment.bitOffset, bytecode.getBoolean(assignment.output));
+        } else {
+            state.setFromInt(assignment.bitOffset, assignment.bitWidth, bytecode.getInteger(assignment.output) - assignment.lowerBound);
+        }
+    }
+    return true;
+}
+
+}  // namespace generator
+}  // namespace storm
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "storm/generator/CompiledPrismProgram.h"
+#include "storm/generator/ExpressionBytecode.h"
+
+namespace storm {
+namespace prism {
+class Program;
+}
+
+namespace generator {
+struct VariableInformation;
+
+/*!
+ * Evaluates the guards, update probabilities and assignments of a PRISM program with bytecode programs.
+ *
+ * The guards of all commands of a module are evaluated together in one pass and the probabilities and assignments of all updates of a command are evaluated
+ * together. Both are evaluated lazily, i.e., only for modules and commands whose guards or updates are requested in the loaded state.
+ */
+class BytecodePrismProgram : public CompiledPrismProgram {
+   public:
+    /*!
+     * Translates the expressions of the given program to bytecode.
+     *
+     * @param program The program whose commands are to be translated. Constants and formulas need to be substituted.
+     * @param variableInformation The layout of the compressed states.
+     * @return The translated program or nullptr if the program can not be translated, in which case a warning is issued.
+     */
+    static std::unique_ptr<BytecodePrismProgram> create(storm::prism::Program const& program, VariableInformation const& variableInformation);
+
+    virtual void loadState(CompressedState const& state) override;
+    virtual bool isCommandEnabled(uint64_t globalCommandIndex) override;
+    virtual double getProbability(uint64_t globalUpdateIndex) override;
+    virtual bool applyUpdate(uint64_t globalUpdateIndex, CompressedState& state) override;
+
+   private:
+    // A bytecode program together with the index of the last loaded state for which it has been executed.
+    struct LazyBytecode {
+        ExpressionBytecode bytecode;
+        uint64_t executedState = 0;
+    };
+
+    // The target of an assignment together with the output of the assigned value.
+    struct Assignment {
+        uint64_t output;
+        bool boolean;
+        uint64_t bitOffset;
+        uint64_t bitWidth;
+        int64_t lowerBound;
+        int64_t upperBound;
+    };
+
+    // The position of a command's guard or an update's probability together with its (lazily executed) bytecode.
+    struct Output {
+        uint64_t bytecodeIndex;
+        uint64_t output;
+    };
+
+    BytecodePrismProgram() = default;
+
+    // Executes the given bytecode if it has not yet been executed in the loaded state.
+    ExpressionBytecode& getExecuted(LazyBytecode& lazyBytecode);
+
+    // One bytecode for the guards of each module and one bytecode for the updates of each command.
+    std::vector<LazyBytecode> guardBytecodes;
+    std::vector<LazyBytecode> updateBytecodes;
+
+    // Maps global command and update indices to their outputs.
+    std::vector<Output> guards;
+    std::vector<Output> probabilities;
+
+    // For each update (by global index), the range of its assignments in assignments.
+    std::vector<std::pair<uint64_t, uint64_t>> assignmentRanges;
+    std::vector<Assignment> assignments;
+
+    // The loaded state and a counter that identifies it.
+    CompressedState const* state = nullptr;
+    uint64_t currentState = 0;
+};
+
+}  // namespace generator
+}  // namespace storm
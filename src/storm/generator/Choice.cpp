@@ -190,6 +190,11 @@ void Choice<ValueType, StateType>::reserve(std::size_t const& size) {
     distribution.reserve(size);
 }
 
+template<typename ValueType, typename StateType>
+void Choice<ValueType, StateType>::remapStates(std::function<StateType(StateType const&)> const& remapping) {
+    distribution.remapStates(remapping);
+}
+
 template<typename ValueType, typename StateType>
 std::ostream& operator<<(std::ostream& out, Choice<ValueType, StateType> const& choice) {
     out << "<";
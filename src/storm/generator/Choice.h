@@ -186,6 +186,13 @@ struct Choice {
      */
     void reserve(std::size_t const& size);
 
+    /*!
+     * Replaces the target states of this choice by the states they are mapped to.
+     *
+     * @param remapping The function mapping the old states to the new ones.
+     */
+    void remapStates(std::function<StateType(StateType const&)> const& remapping);
+
    private:
     // A flag indicating whether this choice is Markovian or not.
     bool markovian;
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstdint>
+
+#include "storm/generator/CompressedState.h"
+
+namespace storm {
+namespace generator {
+
+/*!
+ * Evaluates the guards, update probabilities and assignments of a PRISM program without going through an expression evaluator.
+ */
+class CompiledPrismProgram {
+   public:
+    virtual ~CompiledPrismProgram() = default;
+
+    /*!
+     * Loads the given state. The state has to stay alive until another state is loaded.
+     */
+    virtual void loadState(CompressedState const& state) = 0;
+
+    /*!
+     * Retrieves whether the guard of the command with the given global index holds in the loaded state.
+     */
+    virtual bool isCommandEnabled(uint64_t globalCommandIndex) = 0;
+
+    /*!
+     * Evaluates the probability of the update with the given global index in the loaded state.
+     */
+    virtual double getProbability(uint64_t globalUpdateIndex) = 0;
+
+    /*!
+     * Evaluates the assignments of the update with the given global index in the loaded state and writes the results to the given state.
+     *
+     * @return False if one of the assigned values is out of the bounds of its variable, in which case the given state is not modified.
+     */
+    virtual bool applyUpdate(uint64_t globalUpdateIndex, CompressedState& state) = 0;
+};
+
+}  // namespace generator
+}  // namespace storm
@@ -0,0 +1,443 @@
+#include "storm/generator/ExpressionBytecode.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/generator/VariableInformation.h"
+#include "storm/storage/expressions/ExpressionVisitor.h"
+#include "storm/storage/expressions/Expressions.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace generator {
+
+/*!
+ * Translates expressions into the instructions of a bytecode program. The result of visiting an expression is the register that holds its value.
+ */
+class ExpressionBytecodeCompiler : public storm::expressions::ExpressionVisitor {
+   public:
+    typedef ExpressionBytecode::Opcode Opcode;
+    typedef ExpressionBytecode::RegisterType RegisterType;
+
+    ExpressionBytecodeCompiler(ExpressionBytecode& bytecode, VariableInformation const& variableInformation)
+        : bytecode(bytecode), variableInformation(variableInformation) {
+        // Intentionally left empty.
+    }
+
+    uint32_t compile(storm::expressions::BaseExpression const& expression) {
+        auto registerIt = bytecode.expressionRegisters.find(&expression);
+        if (registerIt != bytecode.expressionRegisters.end()) {
+            return registerIt->second;
+        }
+        uint32_t result = boost::any_cast<uint32_t>(expression.accept(*this, boost::none));
+        bytecode.expressionRegisters[&expression] = result;
+        return result;
+    }
+
+    virtual boost::any visit(storm::expressions::IfThenElseExpression const& expression, boost::any const&) override {
+        uint32_t condition = compile(*expression.getCondition());
+        uint32_t thenRegister = compile(*expression.getThenExpression());
+        uint32_t elseRegister = compile(*expression.getElseExpression());
+        if (!isDouble(thenRegister) && !isDouble(elseRegister)) {
+            return emit(Opcode::IteInteger, bytecode.registerTypes[thenRegister], condition, thenRegister, elseRegister);
+        }
+        return emit(Opcode::IteDouble, RegisterType::Double, condition, toDouble(thenRegister), toDouble(elseRegister));
+    }
+
+    virtual boost::any visit(storm::expressions::BinaryBooleanFunctionExpression const& expression, boost::any const&) override {
+        uint32_t first = compile(*expression.getFirstOperand());
+        uint32_t second = compile(*expression.getSecondOperand());
+        switch (expression.getOperatorType()) {
+            case storm::expressions::BinaryBooleanFunctionExpression::OperatorType::And:
+                return emit(Opcode::And, RegisterType::Boolean, first, second);
+            case storm::expressions::BinaryBooleanFunctionExpression::OperatorType::Or:
+                return emit(Opcode::Or, RegisterType::Boolean, first, second);
+            case storm::expressions::BinaryBooleanFunctionExpression::OperatorType::Xor:
+                return emit(Opcode::Xor, RegisterType::Boolean, first, second);
+            case storm::expressions::BinaryBooleanFunctionExpression::OperatorType::Implies:
+                return emit(Opcode::Or, RegisterType::Boolean, emit(Opcode::Not, RegisterType::Boolean, first), second);
+            case storm::expressions::BinaryBooleanFunctionExpression::OperatorType::Iff:
+                return emit(Opcode::Iff, RegisterType::Boolean, first, second);
+        }
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Unknown boolean operator in expression '" << expression << "'.");
+    }
+
+    virtual boost::any visit(storm::expressions::BinaryNumericalFunctionExpression const& expression, boost::any const&) override {
+        typedef storm::expressions::BinaryNumericalFunctionExpression::OperatorType OperatorType;
+        uint32_t first = compile(*expression.getFirstOperand());
+        uint32_t second = compile(*expression.getSecondOperand());
+        bool integer = expression.getType().isIntegerType() && !isDouble(first) && !isDouble(second);
+        switch (expression.getOperatorType()) {
+            case OperatorType::Plus:
+                return emitNumerical(integer, Opcode::PlusInteger, Opcode::PlusDouble, first, second);
+            case OperatorType::Minus:
+                return emitNumerical(integer, Opcode::MinusInteger, Opcode::MinusDouble, first, second);
+            case OperatorType::Times:
+                return emitNumerical(integer, Opcode::TimesInteger, Opcode::TimesDouble, first, second);
+            case OperatorType::Divide:
+                return emitNumerical(false, Opcode::Divide, Opcode::Divide, first, second);
+            case OperatorType::Min:
+                return emitNumerical(integer, Opcode::MinInteger, Opcode::MinDouble, first, second);
+            case OperatorType::Max:
+                return emitNumerical(integer, Opcode::MaxInteger, Opcode::MaxDouble, first, second);
+            case OperatorType::Power:
+                // Integer powers are computed with doubles as well, only the result is an integer.
+                if (integer) {
+                    return emit(Opcode::PowerInteger, RegisterType::Integer, toDouble(first), toDouble(second));
+                }
+                return emitNumerical(false, Opcode::PowerDouble, Opcode::PowerDouble, first, second);
+            case OperatorType::Modulo:
+                return emitNumerical(integer, Opcode::ModuloInteger, Opcode::ModuloDouble, first, second);
+            case OperatorType::Logarithm:
+                // Like the exprtk evaluator, we use dedicated functions for the common bases if they are given as literals.
+                if (expression.getSecondOperand()->isLiteral()) {
+                    double base = expression.getSecondOperand()->evaluateAsDouble();
+                    if (base == 2.0) {
+                        return emit(Opcode::Log2, RegisterType::Double, toDouble(first));
+                    } else if (base == 10.0) {
+                        return emit(Opcode::Log10, RegisterType::Double, toDouble(first));
+                    }
+                }
+                return emitNumerical(false, Opcode::Logarithm, Opcode::Logarithm, first, second);
+        }
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Unknown numerical operator in expression '" << expression << "'.");
+    }
+
+    virtual boost::any visit(storm::expressions::BinaryRelationExpression const& expression, boost::any const&) override {
+        typedef storm::expressions::RelationType RelationType;
+        uint32_t first = compile(*expression.getFirstOperand());
+        uint32_t second = compile(*expression.getSecondOperand());
+        bool integer = !isDouble(first) && !isDouble(second);
+        switch (expression.getRelationType()) {
+            case RelationType::Equal:
+                return emitRelation(integer, Opcode::EqualInteger, Opcode::EqualDouble, first, second);
+            case RelationType::NotEqual:
+                return emitRelation(integer, Opcode::NotEqualInteger, Opcode::NotEqualDouble, first, second);
+            case RelationType::Less:
+                return emitRelation(integer, Opcode::LessInteger, Opcode::LessDouble, first, second);
+            case RelationType::LessOrEqual:
+                return emitRelation(integer, Opcode::LessOrEqualInteger, Opcode::LessOrEqualDouble, first, second);
+            case RelationType::Greater:
+                return emitRelation(integer, Opcode::GreaterInteger, Opcode::GreaterDouble, first, second);
+            case RelationType::GreaterOrEqual:
+                return emitRelation(integer, Opcode::GreaterOrEqualInteger, Opcode::GreaterOrEqualDouble, first, second);
+        }
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Unknown relation in expression '" << expression << "'.");
+    }
+
+    virtual boost::any visit(storm::expressions::VariableExpression const& expression, boost::any const&) override {
+        storm::expressions::Variable const& variable = expression.getVariable();
+        auto registerIt = bytecode.variableRegisters.find(variable);
+        if (registerIt != bytecode.variableRegisters.end()) {
+            return registerIt->second;
+        }
+
+        uint32_t result;
+        auto booleanIt = std::find_if(variableInformation.booleanVariables.begin(), variableInformation.booleanVariables.end(),
+                                      [&variable](BooleanVariableInformation const& information) { return information.variable == variable; });
+        if (booleanIt != variableInformation.booleanVariables.end()) {
+            result = emit(Opcode::LoadBoolean, RegisterType::Boolean, 0, 0, bytecode.variableLoads.size());
+            bytecode.variableLoads.push_back({booleanIt->bitOffset, 1, 0});
+        } else {
+            auto integerIt = std::find_if(variableInformation.integerVariables.begin(), variableInformation.integerVariables.end(),
+                                          [&variable](IntegerVariableInformation const& information) { return information.variable == variable; });
+            STORM_LOG_THROW(integerIt != variableInformation.integerVariables.end(), storm::exceptions::NotSupportedException,
+                            "Cannot evaluate '" << variable.getName() << "', which is not a variable of the model.");
+            result = emit(Opcode::LoadInteger, RegisterType::Integer, 0, 0, bytecode.variableLoads.size());
+            bytecode.variableLoads.push_back({integerIt->bitOffset, integerIt->bitWidth, integerIt->lowerBound});
+        }
+        bytecode.variableRegisters[variable] = result;
+        return result;
+    }
+
+    virtual boost::any visit(storm::expressions::UnaryBooleanFunctionExpression const& expression, boost::any const&) override {
+        STORM_LOG_ASSERT(expression.getOperatorType() == storm::expressions::UnaryBooleanFunctionExpression::OperatorType::Not, "Unknown operator.");
+        return emit(Opcode::Not, RegisterType::Boolean, compile(*expression.getOperand()));
+    }
+
+    virtual boost::any visit(storm::expressions::UnaryNumericalFunctionExpression const& expression, boost::any const&) override {
+        typedef storm::expressions::UnaryNumericalFunctionExpression::OperatorType OperatorType;
+        uint32_t operand = compile(*expression.getOperand());
+        switch (expression.getOperatorType()) {
+            case OperatorType::Minus:
+                if (isDouble(operand)) {
+                    return emit(Opcode::NegateDouble, RegisterType::Double, operand);
+                }
+                return emit(Opcode::NegateInteger, RegisterType::Integer, operand);
+            case OperatorType::Floor:
+                return emit(Opcode::Floor, RegisterType::Integer, toDouble(operand));
+            case OperatorType::Ceil:
+                return emit(Opcode::Ceil, RegisterType::Integer, toDouble(operand));
+            case OperatorType::Cos:
+                return emit(Opcode::Cos, RegisterType::Double, toDouble(operand));
+            case OperatorType::Sin:
+                return emit(Opcode::Sin, RegisterType::Double, toDouble(operand));
+        }
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Unknown numerical operator in expression '" << expression << "'.");
+    }
+
+    virtual boost::any visit(storm::expressions::BooleanLiteralExpression const& expression, boost::any const&) override {
+        ExpressionBytecode::Register value;
+        value.integer = expression.getValue() ? 1 : 0;
+        return addRegister(RegisterType::Boolean, value);
+    }
+
+    virtual boost::any visit(storm::expressions::IntegerLiteralExpression const& expression, boost::any const&) override {
+        ExpressionBytecode::Register value;
+        value.integer = expression.getValue();
+        return addRegister(RegisterType::Integer, value);
+    }
+
+    virtual boost::any visit(storm::expressions::RationalLiteralExpression const& expression, boost::any const&) override {
+        ExpressionBytecode::Register value;
+        value.number = expression.getValueAsDouble();
+        return addRegister(RegisterType::Double, value);
+    }
+
+   private:
+    uint32_t addRegister(RegisterType type, ExpressionBytecode::Register value = ExpressionBytecode::Register{0}) {
+        STORM_LOG_THROW(bytecode.registers.size() < std::numeric_limits<uint32_t>::max(), storm::exceptions::NotSupportedException,
+                        "Too many registers in bytecode program.");
+        bytecode.registers.push_back(value);
+        bytecode.registerTypes.push_back(type);
+        return bytecode.registers.size() - 1;
+    }
+
+    uint32_t emit(Opcode opcode, RegisterType type, uint64_t first, uint64_t second = 0, uint64_t third = 0) {
+        uint32_t target = addRegister(type);
+        bytecode.instructions.push_back({opcode, target, static_cast<uint32_t>(first), static_cast<uint32_t>(second), static_cast<uint32_t>(third)});
+        return target;
+    }
+
+    uint32_t emitNumerical(bool integer, Opcode integerOpcode, Opcode doubleOpcode, uint32_t first, uint32_t second) {
+        if (integer) {
+            return emit(integerOpcode, RegisterType::Integer, first, second);
+        }
+        return emit(doubleOpcode, RegisterType::Double, toDouble(first), toDouble(second));
+    }
+
+    uint32_t emitRelation(bool integer, Opcode integerOpcode, Opcode doubleOpcode, uint32_t first, uint32_t second) {
+        if (integer) {
+            return emit(integerOpcode, RegisterType::Boolean, first, second);
+        }
+        return emit(doubleOpcode, RegisterType::Boolean, toDouble(first), toDouble(second));
+    }
+
+    bool isDouble(uint32_t reg) const {
+        return bytecode.registerTypes[reg] == RegisterType::Double;
+    }
+
+    uint32_t toDouble(uint32_t reg) {
+        if (isDouble(reg)) {
+            return reg;
+        }
+        return emit(Opcode::IntegerToDouble, RegisterType::Double, reg);
+    }
+
+    ExpressionBytecode& bytecode;
+    VariableInformation const& variableInformation;
+};
+
+uint64_t ExpressionBytecode::addExpression(storm::expressions::Expression const& expression, VariableInformation const& variableInformation) {
+    ExpressionBytecodeCompiler compiler(*this, variableInformation);
+    outputs.push_back(compiler.compile(expression.getBaseExpression()));
+    expressions.push_back(expression);
+    return outputs.size() - 1;
+}
+
+/*!
+ * Rounds the given value to an integer. Since all operands are evaluated, the value may stem from a branch of an if-then-else that is not taken and
+ * can therefore be non-finite or exceed the range of integers. Casting such a value would be undefined, so we return zero in that case.
+ */
+static int64_t toInteger(double value) {
+    if (std::isfinite(value) && value >= static_cast<double>(std::numeric_limits<int64_t>::min()) &&
+        value < -static_cast<double>(std::numeric_limits<int64_t>::min())) {
+        return static_cast<int64_t>(value);
+    }
+    return 0;
+}
+
+void ExpressionBytecode::execute(CompressedState const& state) {
+    Register* r = registers.data();
+    for (auto const& instruction : instructions) {
+        Register& target = r[instruction.target];
+        Register const& first = r[instruction.first];
+        Register const& second = r[instruction.second];
+        switch (instruction.opcode) {
+            case Opcode::LoadBoolean:
+                target.integer = state.get(variableLoads[instruction.third].bitOffset) ? 1 : 0;
+                break;
+            case Opcode::LoadInteger: {
+                VariableLoad const& load = variableLoads[instruction.third];
+                target.integer = static_cast<int64_t>(state.getAsInt(load.bitOffset, load.bitWidth)) + load.lowerBound;
+                break;
+            }
+            case Opcode::IntegerToDouble:
+                target.number = static_cast<double>(first.integer);
+                break;
+            case Opcode::Not:
+                target.integer = first.integer == 0 ? 1 : 0;
+                break;
+            case Opcode::And:
+                target.integer = first.integer & second.integer;
+                break;
+            case Opcode::Or:
+                target.integer = first.integer | second.integer;
+                break;
+            case Opcode::Xor:
+                target.integer = first.integer ^ second.integer;
+                break;
+            case Opcode::Iff:
+                target.integer = first.integer == second.integer ? 1 : 0;
+                break;
+            case Opcode::IteInteger:
+                target.integer = first.integer != 0 ? second.integer : r[instruction.third].integer;
+                break;
+            case Opcode::IteDouble:
+                target.number = first.integer != 0 ? second.number : r[instruction.third].number;
+                break;
+            case Opcode::NegateInteger:
+                target.integer = -first.integer;
+                break;
+            case Opcode::NegateDouble:
+                target.number = -first.number;
+                break;
+            case Opcode::PlusInteger:
+                target.integer = first.integer + second.integer;
+                break;
+            case Opcode::PlusDouble:
+                target.number = first.number + second.number;
+                break;
+            case Opcode::MinusInteger:
+                target.integer = first.integer - second.integer;
+                break;
+            case Opcode::MinusDouble:
+                target.number = first.number - second.number;
+                break;
+            case Opcode::TimesInteger:
+                target.integer = first.integer * second.integer;
+                break;
+            case Opcode::TimesDouble:
+                target.number = first.number * second.number;
+                break;
+            case Opcode::Divide:
+                target.number = first.number / second.number;
+                break;
+            case Opcode::MinInteger:
+                target.integer = std::min(first.integer, second.integer);
+                break;
+            case Opcode::MinDouble:
+                target.number = std::min(first.number, second.number);
+                break;
+            case Opcode::MaxInteger:
+                target.integer = std::max(first.integer, second.integer);
+                break;
+            case Opcode::MaxDouble:
+                target.number = std::max(first.number, second.number);
+                break;
+            case Opcode::PowerInteger:
+                target.integer = toInteger(std::pow(first.number, second.number));
+                break;
+            case Opcode::PowerDouble:
+                target.number = std::pow(first.number, second.number);
+                break;
+            case Opcode::ModuloInteger:
+                // All operands are evaluated, so the divisor may be zero in a branch of an if-then-else that is not taken.
+                target.integer = second.integer != 0 ? first.integer % second.integer : 0;
+                break;
+            case Opcode::ModuloDouble:
+                target.number = std::fmod(first.number, second.number);
+                break;
+            case Opcode::Logarithm:
+                target.number = std::log(first.number) / std::log(second.number);
+                break;
+            case Opcode::Log2:
+                target.number = std::log2(first.number);
+                break;
+            case Opcode::Log10:
+                target.number = std::log10(first.number);
+                break;
+            case Opcode::Floor:
+                target.integer = toInteger(std::floor(first.number));
+                break;
+            case Opcode::Ceil:
+                target.integer = toInteger(std::ceil(first.number));
+                break;
+            case Opcode::Cos:
+                target.number = std::cos(first.number);
+                break;
+            case Opcode::Sin:
+                target.number = std::sin(first.number);
+                break;
+            case Opcode::EqualInteger:
+                target.integer = first.integer == second.integer ? 1 : 0;
+                break;
+            case Opcode::EqualDouble:
+                target.integer = first.number == second.number ? 1 : 0;
+                break;
+            case Opcode::NotEqualInteger:
+                target.integer = first.integer != second.integer ? 1 : 0;
+                break;
+            case Opcode::NotEqualDouble:
+                target.integer = first.number != second.number ? 1 : 0;
+                break;
+            case Opcode::LessInteger:
+                target.integer = first.integer < second.integer ? 1 : 0;
+                break;
+            case Opcode::LessDouble:
+                target.integer = first.number < second.number ? 1 : 0;
+                break;
+            case Opcode::LessOrEqualInteger:
+                target.integer = first.integer <= second.integer ? 1 : 0;
+                break;
+            case Opcode::LessOrEqualDouble:
+                target.integer = first.number <= second.number ? 1 : 0;
+                break;
+            case Opcode::GreaterInteger:
+                target.integer = first.integer > second.integer ? 1 : 0;
+                break;
+            case Opcode::GreaterDouble:
+                target.integer = first.number > second.number ? 1 : 0;
+                break;
+            case Opcode::GreaterOrEqualInteger:
+                target.integer = first.integer >= second.integer ? 1 : 0;
+                break;
+            case Opcode::GreaterOrEqualDouble:
+                target.integer = first.number >= second.number ? 1 : 0;
+                break;
+        }
+    }
+}
+
+bool ExpressionBytecode::getBoolean(uint64_t output) const {
+    uint32_t reg = outputs[output];
+    if (registerTypes[reg] == RegisterType::Double) {
+        return registers[reg].number == 1.0;
+    }
+    return registers[reg].integer != 0;
+}
+
+int64_t ExpressionBytecode::getInteger(uint64_t output) const {
+    uint32_t reg = outputs[output];
+    if (registerTypes[reg] == RegisterType::Double) {
+        return static_cast<int64_t>(registers[reg].number);
+    }
+    return registers[reg].integer;
+}
+
+double ExpressionBytecode::getDouble(uint64_t output) const {
+    uint32_t reg = outputs[output];
+    if (registerTypes[reg] == RegisterType::Double) {
+        return registers[reg].number;
+    }
+    return static_cast<double>(registers[reg].integer);
+}
+
+uint64_t ExpressionBytecode::getNumberOfInstructions() const {
+    return instructions.size();
+}
+
+}  // namespace generator
+}  // namespace storm
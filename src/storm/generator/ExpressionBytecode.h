@@ -0,0 +1,146 @@
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "storm/generator/CompressedState.h"
+#include "storm/storage/expressions/Expression.h"
+#include "storm/storage/expressions/Variable.h"
+
+namespace storm {
+namespace generator {
+struct VariableInformation;
+
+/*!
+ * A register-based bytecode for expressions over the variables of a model.
+ *
+ * Any number of expressions can be added to a bytecode program, which then evaluates all of them in one pass over its instructions. Variables are read
+ * directly from the bits of a compressed state, and subexpressions that occur in several of the expressions are evaluated only once. Integers are
+ * represented by 64-bit integers and all other numbers by doubles, which matches the values computed by the exprtk-based evaluator.
+ */
+class ExpressionBytecode {
+   public:
+    /*!
+     * Adds the given expression to the program.
+     *
+     * @param expression The expression to add.
+     * @param variableInformation The layout of the states in which the program is executed.
+     * @return The index of the output under which the value of the expression can be retrieved after execution.
+     * @throws NotSupportedException if the expression contains variables that are not part of the variable information.
+     */
+    uint64_t addExpression(storm::expressions::Expression const& expression, VariableInformation const& variableInformation);
+
+    /*!
+     * Evaluates all expressions of the program in the given state.
+     */
+    void execute(CompressedState const& state);
+
+    /*!
+     * Retrieve the value of the given output, converted to the requested type, after the last execution.
+     */
+    bool getBoolean(uint64_t output) const;
+    int64_t getInteger(uint64_t output) const;
+    double getDouble(uint64_t output) const;
+
+    /*!
+     * Retrieves the number of instructions of the program.
+     */
+    uint64_t getNumberOfInstructions() const;
+
+   private:
+    friend class ExpressionBytecodeCompiler;
+
+    enum class Opcode : uint8_t {
+        LoadBoolean,
+        LoadInteger,
+        IntegerToDouble,
+        Not,
+        And,
+        Or,
+        Xor,
+        Iff,
+        IteInteger,
+        IteDouble,
+        NegateInteger,
+        NegateDouble,
+        PlusInteger,
+        PlusDouble,
+        MinusInteger,
+        MinusDouble,
+        TimesInteger,
+        TimesDouble,
+        Divide,
+        MinInteger,
+        MinDouble,
+        MaxInteger,
+        MaxDouble,
+        PowerInteger,
+        PowerDouble,
+        ModuloInteger,
+        ModuloDouble,
+        Logarithm,
+        Log2,
+        Log10,
+        Floor,
+        Ceil,
+        Cos,
+        Sin,
+        EqualInteger,
+        EqualDouble,
+        NotEqualInteger,
+        NotEqualDouble,
+        LessInteger,
+        LessDouble,
+        LessOrEqualInteger,
+        LessOrEqualDouble,
+        GreaterInteger,
+        GreaterDouble,
+        GreaterOrEqualInteger,
+        GreaterOrEqualDouble
+    };
+
+    enum class RegisterType : uint8_t { Boolean, Integer, Double };
+
+    // Booleans and integers are stored as integers.
+    union Register {
+        int64_t integer;
+        double number;
+    };
+
+    // Load instructions store the index of the loaded variable in the third operand.
+    struct Instruction {
+        Opcode opcode;
+        uint32_t target;
+        uint32_t first;
+        uint32_t second;
+        uint32_t third;
+    };
+
+    // The layout of the variables that are loaded by LoadBoolean and LoadInteger instructions.
+    struct VariableLoad {
+        uint64_t bitOffset;
+        uint64_t bitWidth;
+        int64_t lowerBound;
+    };
+
+    std::vector<Instruction> instructions;
+    std::vector<VariableLoad> variableLoads;
+
+    // The registers hold the constants of the program and the intermediate results.
+    std::vector<Register> registers;
+    std::vector<RegisterType> registerTypes;
+
+    // For each output, the register that holds its value.
+    std::vector<uint32_t> outputs;
+
+    // The added expressions. Keeping them alive guarantees that the addresses of their subexpressions are not reused.
+    std::vector<storm::expressions::Expression> expressions;
+
+    // Registers of the subexpressions and variables that have already been compiled.
+    std::unordered_map<storm::expressions::BaseExpression const*, uint32_t> expressionRegisters;
+    std::unordered_map<storm::expressions::Variable, uint32_t> variableRegisters;
+};
+
+}  // namespace generator
+}  // namespace storm
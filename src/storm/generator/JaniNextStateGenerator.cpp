@@ -56,6 +56,8 @@ JaniNextStateGenerator<ValueType, StateType>::JaniNextStateGenerator(storm::jani
       evaluateRewardExpressionsAtDestinations(false) {
     STORM_LOG_THROW(!this->options.isBuildChoiceLabelsSet(), storm::exceptions::NotSupportedException,
                     "JANI next-state generator cannot generate choice labels.");
+    STORM_LOG_WARN_COND(!this->options.isJitCompilationSet() && !this->options.isBytecodeEvaluationSet(),
+                        "Compilation of expressions is only supported for PRISM programs. Expressions of the JANI model will be interpreted.");
 
     auto features = this->model.getModelFeatures();
     features.remove(storm::jani::ModelFeature::DerivedOperators);
@@ -0,0 +1,375 @@
+#include "storm/generator/JitCompiledPrismProgram.h"
+
+#include <dlfcn.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+
+#include "storm/exceptions/BaseException.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/exceptions/UnexpectedException.h"
+#include "storm/generator/VariableInformation.h"
+#include "storm/storage/expressions/Expression.h"
+#include "storm/storage/expressions/ToCppVisitor.h"
+#include "storm/storage/prism/Program.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/sha256.h"
+
+namespace storm {
+namespace generator {
+
+typedef void (*GuardsFunction)(int64_t const*, unsigned char*);
+typedef double (*ProbabilityFunction)(int64_t const*);
+typedef bool (*UpdateFunction)(int64_t const*, int64_t*);
+
+struct JitCompiledPrismProgram::Library {
+    ~Library() {
+        if (handle != nullptr) {
+            dlclose(handle);
+        }
+    }
+
+    void* handle = nullptr;
+    GuardsFunction evaluateGuards = nullptr;
+    ProbabilityFunction const* probabilities = nullptr;
+    UpdateFunction const* updates = nullptr;
+};
+
+namespace {
+std::string const compilerFlags = "-std=c++17 -O2 -fPIC -shared";
+
+// By default, libraries are cached in a directory of the current user (and not in the shared temporary directory).
+std::filesystem::path getDefaultCacheDirectory() {
+    if (char const* cacheHome = std::getenv("XDG_CACHE_HOME"); cacheHome != nullptr && cacheHome[0] == '/') {
+        return std::filesystem::path(cacheHome) / "storm-jit";
+    }
+    if (char const* home = std::getenv("HOME"); home != nullptr && home[0] == '/') {
+        return std::filesystem::path(home) / ".cache" / "storm-jit";
+    }
+    return std::filesystem::temp_directory_path() / ("storm-jit-" + std::to_string(geteuid()));
+}
+
+// Checks that the given path is a directory (or regular file) that is owned by the current user and not writable by others.
+// Symbolic links are not followed, so a file that passes this check can not be replaced by other users if its directory passes the check as well.
+bool isPrivate(std::filesystem::path const& path, bool directory) {
+    struct stat status;
+    if (lstat(path.c_str(), &status) != 0) {
+        return false;
+    }
+    bool const hasExpectedType = directory ? S_ISDIR(status.st_mode) : S_ISREG(status.st_mode);
+    return hasExpectedType && status.st_uid == geteuid() && (status.st_mode & (S_IWGRP | S_IWOTH)) == 0;
+}
+
+// Creates the given directory (accessible only by the current user) unless it exists and makes sure that it is private.
+void preparePrivateDirectory(std::filesystem::path const& directory) {
+    std::error_code errorCode;
+    if (directory.has_parent_path()) {
+        std::filesystem::create_directories(directory.parent_path(), errorCode);
+        STORM_LOG_THROW(!errorCode, storm::exceptions::UnexpectedException,
+                        "Could not create directory " << directory.parent_path() << ": " << errorCode.message() << ".");
+    }
+    STORM_LOG_THROW(mkdir(directory.c_str(), S_IRWXU) == 0 || errno == EEXIST, storm::exceptions::UnexpectedException,
+                    "Could not create directory " << directory << ": " << std::strerror(errno) << ".");
+    STORM_LOG_THROW(isPrivate(directory, true), storm::exceptions::UnexpectedException,
+                    "The cache directory " << directory << " has to be a directory that is owned by the current user and not writable by others.");
+}
+
+// Checks whether the cache contains a library that was compiled from the given source.
+bool isCached(std::filesystem::path const& libraryPath, std::filesystem::path const& sourcePath, std::string const& source) {
+    if (!isPrivate(libraryPath, false) || !isPrivate(sourcePath, false)) {
+        return false;
+    }
+    std::ifstream sourceFile(sourcePath, std::ios::binary);
+    std::string const cachedSource((std::istreambuf_iterator<char>(sourceFile)), std::istreambuf_iterator<char>());
+    return cachedSource == source;
+}
+
+// Writes the given content to a new file that is only accessible by the current user.
+void writePrivateFile(std::filesystem::path const& path, std::string const& content) {
+    int const fileDescriptor = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_NOFOLLOW, S_IRUSR | S_IWUSR);
+    STORM_LOG_THROW(fileDescriptor >= 0, storm::exceptions::UnexpectedException, "Could not write " << path << ": " << std::strerror(errno) << ".");
+    uint64_t written = 0;
+    while (written < content.size()) {
+        ssize_t const result = write(fileDescriptor, content.data() + written, content.size() - written);
+        if (result < 0 && errno == EINTR) {
+            continue;
+        }
+        if (result <= 0) {
+            close(fileDescriptor);
+            STORM_LOG_THROW(false, storm::exceptions::UnexpectedException, "Could not write " << path << ".");
+        }
+        written += result;
+    }
+    close(fileDescriptor);
+}
+
+// Runs the given command (without a shell) and redirects its output to the given log file.
+// @return true iff the command terminated successfully.
+bool runCommand(std::vector<std::string> const& arguments, std::filesystem::path const& logPath) {
+    // Everything the child needs is prepared before forking.
+    std::vector<char*> argv;
+    for (auto const& argument : arguments) {
+        argv.push_back(const_cast<char*>(argument.c_str()));
+    }
+    argv.push_back(nullptr);
+    int const logFile = open(logPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_NOFOLLOW, S_IRUSR | S_IWUSR);
+    STORM_LOG_THROW(logFile >= 0, storm::exceptions::UnexpectedException, "Could not write " << logPath << ": " << std::strerror(errno) << ".");
+
+    pid_t const pid = fork();
+    if (pid == 0) {
+        // Child process
+        dup2(logFile, STDOUT_FILENO);
+        dup2(logFile, STDERR_FILENO);
+        close(logFile);
+        execvp(argv[0], argv.data());
+        _exit(127);
+    }
+    close(logFile);
+    STORM_LOG_THROW(pid > 0, storm::exceptions::UnexpectedException, "Could not start the compiler: " << std::strerror(errno) << ".");
+    int status;
+    while (waitpid(pid, &status, 0) < 0) {
+        STORM_LOG_THROW(errno == EINTR, storm::exceptions::UnexpectedException, "Could not wait for the compiler: " << std::strerror(errno) << ".");
+    }
+    return WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+
+// Makes sure that the expression only refers to variables of the program, e.g., it does not contain undefined constants.
+void checkVariables(storm::expressions::Expression const& expression, std::unordered_map<storm::expressions::Variable, std::string> const& names) {
+    for (auto const& variable : expression.getVariables()) {
+        STORM_LOG_THROW(names.count(variable) > 0, storm::exceptions::NotSupportedException,
+                        "Expression '" << expression << "' refers to '" << variable.getName() << "', which is not a variable of the program.");
+    }
+}
+}  // namespace
+
+std::unique_ptr<JitCompiledPrismProgram> JitCompiledPrismProgram::create(storm::prism::Program const& program, VariableInformation const& variableInformation,
+                                                                         std::string const& compiler, std::string const& cacheDirectory) {
+    std::unique_ptr<JitCompiledPrismProgram> result(new JitCompiledPrismProgram());
+    try {
+        std::string const source = result->generateSource(program, variableInformation);
+        result->library = loadLibrary(source, compiler, cacheDirectory);
+    } catch (storm::exceptions::BaseException const& e) {
+        STORM_LOG_WARN("Expressions of the program are not compiled and will be interpreted: " << e.what());
+        return nullptr;
+    }
+    return result;
+}
+
+std::string JitCompiledPrismProgram::generateSource(storm::prism::Program const& program, VariableInformation const& variableInformation) {
+    STORM_LOG_THROW(variableInformation.locationVariables.empty(), storm::exceptions::NotSupportedException, "Location variables are not supported.");
+
+    // Booleans are stored in the value array before the integers.
+    std::unordered_map<storm::expressions::Variable, std::string> names;
+    std::unordered_map<storm::expressions::Variable, uint64_t> variableToAssignedVariable;
+    std::vector<AssignedVariable> variables;
+    for (auto const& booleanVariable : variableInformation.booleanVariables) {
+        names[booleanVariable.variable] = "(v[" + std::to_string(booleanOffsets.size()) + "] != 0)";
+        variableToAssignedVariable[booleanVariable.variable] = variables.size();
+        variables.push_back({booleanOffsets.size(), booleanVariable.bitOffset, 1, 0});
+        booleanOffsets.push_back(booleanVariable.bitOffset);
+    }
+    for (auto const& integerVariable : variableInformation.integerVariables) {
+        AssignedVariable variable{booleanOffsets.size() + integerVariables.size(), integerVariable.bitOffset, integerVariable.bitWidth,
+                                  integerVariable.lowerBound};
+        names[integerVariable.variable] = "v[" + std::to_string(variable.valueIndex) + "]";
+        variableToAssignedVariable[integerVariable.variable] = variables.size();
+        variables.push_back(variable);
+        integerVariables.push_back(variable);
+    }
+    values.resize(booleanOffsets.size() + integerVariables.size());
+    assignedValues.resize(values.size());
+
+    std::unordered_map<storm::expressions::Variable, std::string> prefixes;
+    storm::expressions::ToCppTranslationOptions options(prefixes, names, storm::expressions::ToCppTranslationMode::CastDouble);
+    storm::expressions::ToCppVisitor visitor;
+
+    std::stringstream functions;
+    std::stringstream guards;
+    uint64_t numberOfCommands = 0;
+    uint64_t numberOfUpdates = 0;
+    assignedVariableIndications.push_back(0);
+    for (auto const& module : program.getModules()) {
+        for (auto const& command : module.getCommands()) {
+            checkVariables(command.getGuardExpression(), names);
+            if (commandIndices.size() <= command.getGlobalIndex()) {
+                commandIndices.resize(command.getGlobalIndex() + 1);
+            }
+            commandIndices[command.getGlobalIndex()] = numberOfCommands;
+            guards << "    enabled[" << numberOfCommands << "] = " << visitor.translate(command.getGuardExpression(), options) << ";\n";
+            ++numberOfCommands;
+
+            for (auto const& update : command.getUpdates()) {
+                checkVariables(update.getLikelihoodExpression(), names);
+                if (updateIndices.size() <= update.getGlobalIndex()) {
+                    updateIndices.resize(update.getGlobalIndex() + 1);
+                }
+                updateIndices[update.getGlobalIndex()] = numberOfUpdates;
+                functions << "double probability" << numberOfUpdates << "(int64_t const* v) {\n"
+                          << "    return " << visitor.translate(update.getLikelihoodExpression(), options) << ";\n"
+                          << "}\n\n";
+
+                // The assigned values are checked against the bounds before any of them is written.
+                functions << "bool update" << numberOfUpdates << "(int64_t const* v, int64_t* t) {\n";
+                std::stringstream writes;
+                for (auto const& assignment : update.getAssignments()) {
+                    checkVariables(assignment.getExpression(), names);
+                    auto variableIt = variableToAssignedVariable.find(assignment.getVariable());
+                    STORM_LOG_THROW(variableIt != variableToAssignedVariable.end(), storm::exceptions::NotSupportedException,
+                                    "Assignment to unknown variable '" << assignment.getVariableName() << "'.");
+                    AssignedVariable const& variable = variables[variableIt->second];
+                    std::string const value = "x" + std::to_string(variable.valueIndex);
+                    if (variable.valueIndex < booleanOffsets.size()) {
+                        functions << "    bool const " << value << " = " << visitor.translate(assignment.getExpression(), options) << ";\n";
+                    } else {
+                        STORM_LOG_ASSERT(assignment.getExpression().hasIntegerType(), "Unexpected type of assignment.");
+                        int64_t const upperBound = variableInformation.integerVariables[variable.valueIndex - booleanOffsets.size()].upperBound;
+                        functions << "    int64_t const " << value << " = static_cast<int64_t>(" << visitor.translate(assignment.getExpression(), options)
+                                  << ");\n"
+                                  << "    if (" << value << " < " << variable.lowerBound << "ll || " << value << " > " << upperBound << "ll) {\n"
+                                  << "        return false;\n"
+                                  << "    }\n";
+                    }
+                    writes << "    t[" << variable.valueIndex << "] = " << value << ";\n";
+                    assignedVariables.push_back(variable);
+                }
+                functions << writes.str() << "    return true;\n"
+                          << "}\n\n";
+                assignedVariableIndications.push_back(assignedVariables.size());
+                ++numberOfUpdates;
+            }
+        }
+    }
+    enabledCommands.resize(numberOfCommands);
+
+    std::stringstream source;
+    source << "#include <algorithm>\n#include <cmath>\n#include <cstdint>\n\n"
+           << "namespace {\n"
+           << functions.str() << "}  // namespace\n\n"
+           << "extern \"C\" {\n"
+           << "void storm_jit_evaluate_guards(int64_t const* v, unsigned char* enabled) {\n"
+           << guards.str() << "}\n\n"
+           << "double (*storm_jit_probabilities[])(int64_t const*) = {";
+    for (uint64_t update = 0; update < numberOfUpdates; ++update) {
+        source << "probability" << update << ", ";
+    }
+    source << "nullptr};\n"
+           << "bool (*storm_jit_updates[])(int64_t const*, int64_t*) = {";
+    for (uint64_t update = 0; update < numberOfUpdates; ++update) {
+        source << "update" << update << ", ";
+    }
+    source << "nullptr};\n"
+           << "}\n";
+    return source.str();
+}
+
+void JitCompiledPrismProgram::loadState(CompressedState const& state) {
+    uint64_t index = 0;
+    for (auto const bitOffset : booleanOffsets) {
+        values[index++] = state.get(bitOffset) ? 1 : 0;
+    }
+    for (auto const& integerVariable : integerVariables) {
+        values[index++] = static_cast<int64_t>(state.getAsInt(integerVariable.bitOffset, integerVariable.bitWidth)) + integerVariable.lowerBound;
+    }
+    library->evaluateGuards(values.data(), enabledCommands.data());
+}
+
+bool JitCompiledPrismProgram::isCommandEnabled(uint64_t globalCommandIndex) {
+    return enabledCommands[commandIndices[globalCommandIndex]] != 0;
+}
+
+double JitCompiledPrismProgram::getProbability(uint64_t globalUpdateIndex) {
+    return library->probabilities[updateIndices[globalUpdateIndex]](values.data());
+}
+
+bool JitCompiledPrismProgram::applyUpdate(uint64_t globalUpdateIndex, CompressedState& state) {
+    uint64_t const update = updateIndices[globalUpdateIndex];
+    if (!library->updates[update](values.data(), assignedValues.data())) {
+        return false;
+    }
+    for (uint64_t position = assignedVariableIndications[update]; position < assignedVariableIndications[update + 1]; ++position) {
+        AssignedVariable const& variable = assignedVariables[position];
+        if (variable.valueIndex < booleanOffsets.size()) {
+            state.set(variable.bitOffset, assignedValues[variable.valueIndex] != 0);
+        } else {
+            state.setFromInt(variable.bitOffset, variable.bitWidth, assignedValues[variable.valueIndex] - variable.lowerBound);
+        }
+    }
+    return true;
+}
+
+std::shared_ptr<JitCompiledPrismProgram::Library const> JitCompiledPrismProgram::loadLibrary(std::string const& source, std::string const& compiler,
+                                                                                              std::string const& cacheDirectory) {
+    // Libraries that are currently loaded by some generator. This avoids compiling and loading a library once per exploration thread.
+    static std::mutex mutex;
+    static std::unordered_map<std::string, std::weak_ptr<Library const>> loadedLibraries;
+
+    // The command is split into its arguments, which are passed to the compiler without a shell.
+    std::vector<std::string> arguments;
+    std::istringstream commandStream(compiler + " " + compilerFlags);
+    for (std::string argument; commandStream >> argument;) {
+        arguments.push_back(argument);
+    }
+    STORM_LOG_THROW(!arguments.empty(), storm::exceptions::UnexpectedException, "No compiler given.");
+
+    std::filesystem::path const directory = cacheDirectory.empty() ? getDefaultCacheDirectory() : std::filesystem::path(cacheDirectory);
+    std::string const name = "storm_jit_" + storm::utility::sha256(compiler + " " + compilerFlags + "\n" + source);
+    std::filesystem::path const libraryPath = directory / (name + ".so");
+    std::filesystem::path const sourcePath = directory / (name + ".cpp");
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (auto library = loadedLibraries[libraryPath.string()].lock()) {
+        return library;
+    }
+
+    preparePrivateDirectory(directory);
+    if (isCached(libraryPath, sourcePath, source)) {
+        STORM_LOG_INFO("Using cached compiled expressions from " << libraryPath << ".");
+    } else {
+        // Other processes might compile the same library concurrently, so we compile to unique files and rename them afterwards.
+        // The source is kept next to the library to detect (unlikely) collisions of the digest before a cached library is reused.
+        std::string const uniqueName = name + "_" + std::to_string(getpid());
+        std::filesystem::path const temporarySourcePath = directory / (uniqueName + ".cpp");
+        std::filesystem::path const temporaryLibraryPath = directory / (uniqueName + ".so");
+        std::filesystem::path const logPath = directory / (uniqueName + ".log");
+        writePrivateFile(temporarySourcePath, source);
+        arguments.insert(arguments.end(), {"-o", temporaryLibraryPath.string(), temporarySourcePath.string()});
+        STORM_LOG_INFO("Compiling expressions with " << compiler << " to " << libraryPath << ".");
+        STORM_LOG_THROW(runCommand(arguments, logPath), storm::exceptions::UnexpectedException, "Compilation failed, see " << logPath << ".");
+
+        std::error_code errorCode;
+        std::filesystem::permissions(temporaryLibraryPath, std::filesystem::perms::owner_all, errorCode);
+        STORM_LOG_THROW(!errorCode, storm::exceptions::UnexpectedException, "Could not restrict the permissions of " << temporaryLibraryPath << ".");
+        std::filesystem::rename(temporaryLibraryPath, libraryPath, errorCode);
+        STORM_LOG_THROW(!errorCode, storm::exceptions::UnexpectedException, "Could not move compiled library to " << libraryPath << ".");
+        std::filesystem::rename(temporarySourcePath, sourcePath, errorCode);
+        STORM_LOG_THROW(!errorCode, storm::exceptions::UnexpectedException, "Could not move source to " << sourcePath << ".");
+        std::filesystem::remove(logPath, errorCode);
+    }
+    STORM_LOG_THROW(isPrivate(libraryPath, false), storm::exceptions::UnexpectedException,
+                    "The library " << libraryPath << " has to be owned by the current user and not writable by others.");
+
+    auto library = std::make_shared<Library>();
+    library->handle = dlopen(libraryPath.c_str(), RTLD_NOW | RTLD_LOCAL);
+    STORM_LOG_THROW(library->handle != nullptr, storm::exceptions::UnexpectedException, "Could not load " << libraryPath << ": " << dlerror());
+    library->evaluateGuards = reinterpret_cast<GuardsFunction>(dlsym(library->handle, "storm_jit_evaluate_guards"));
+    library->probabilities = reinterpret_cast<ProbabilityFunction const*>(dlsym(library->handle, "storm_jit_probabilities"));
+    library->updates = reinterpret_cast<UpdateFunction const*>(dlsym(library->handle, "storm_jit_updates"));
+    STORM_LOG_THROW(library->evaluateGuards != nullptr && library->probabilities != nullptr && library->updates != nullptr,
+                    storm::exceptions::UnexpectedException, "Library " << libraryPath << " does not provide the expected functions.");
+    loadedLibraries[libraryPath.string()] = library;
+    return library;
+}
+
+}  // namespace generator
+}  // namespace storm
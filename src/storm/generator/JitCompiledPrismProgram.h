@@ -0,0 +1,91 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "storm/generator/CompiledPrismProgram.h"
+
+namespace storm {
+namespace prism {
+class Program;
+}
+
+namespace generator {
+struct VariableInformation;
+
+/*!
+ * Holds natively compiled versions of the guards, update probabilities and assignments of a PRISM program.
+ *
+ * The expressions are translated to C++, compiled to a shared library with an external compiler and loaded at runtime. Compiled libraries are cached on disk
+ * (keyed by the SHA-256 digest of the generated code and the compiler) and within the process, so that repeated builds of the same model and multiple
+ * generators of a parallel exploration share the same library. A cached library is only loaded if it and the cache directory are owned by the current user
+ * and not writable by others, and if the source stored next to it equals the generated code.
+ * The expressions are evaluated with the same double arithmetic that the interpreted evaluator uses.
+ */
+class JitCompiledPrismProgram : public CompiledPrismProgram {
+   public:
+    /*!
+     * Compiles the expressions of the given program.
+     *
+     * @param program The program whose commands are to be compiled. Constants and formulas need to be substituted.
+     * @param variableInformation The layout of the compressed states.
+     * @param compiler The command that invokes the compiler. It is split at whitespace into the program and its arguments (no shell is involved).
+     * @param cacheDirectory The directory in which compiled programs are cached. If empty, storm-jit within the cache directory of the current user
+     * ($XDG_CACHE_HOME or ~/.cache) is used. A missing directory is created such that only the current user can access it.
+     * @return The compiled program or nullptr if the program can not be compiled, in which case a warning is issued.
+     */
+    static std::unique_ptr<JitCompiledPrismProgram> create(storm::prism::Program const& program, VariableInformation const& variableInformation,
+                                                           std::string const& compiler, std::string const& cacheDirectory);
+
+    /*!
+     * Loads the given state and evaluates the guards of all commands in it.
+     */
+    virtual void loadState(CompressedState const& state) override;
+    virtual bool isCommandEnabled(uint64_t globalCommandIndex) override;
+    virtual double getProbability(uint64_t globalUpdateIndex) override;
+    virtual bool applyUpdate(uint64_t globalUpdateIndex, CompressedState& state) override;
+
+   private:
+    struct Library;
+
+    // The position of a variable in the compressed state.
+    struct AssignedVariable {
+        uint64_t valueIndex;
+        uint64_t bitOffset;
+        uint64_t bitWidth;
+        int64_t lowerBound;
+    };
+
+    JitCompiledPrismProgram() = default;
+
+    // Generates the source code of the library for the given program.
+    std::string generateSource(storm::prism::Program const& program, VariableInformation const& variableInformation);
+
+    // Compiles the given source (unless it is cached) and loads the resulting library.
+    static std::shared_ptr<Library const> loadLibrary(std::string const& source, std::string const& compiler, std::string const& cacheDirectory);
+
+    // The loaded library which might be shared with other instances.
+    std::shared_ptr<Library const> library;
+
+    // The positions of the boolean and integer variables in the compressed state.
+    std::vector<uint64_t> booleanOffsets;
+    std::vector<AssignedVariable> integerVariables;
+
+    // Maps global command and update indices to the indices used within the library.
+    std::vector<uint64_t> commandIndices;
+    std::vector<uint64_t> updateIndices;
+
+    // For each update (library index), the range of its assigned variables in assignedVariables.
+    std::vector<uint64_t> assignedVariableIndications;
+    std::vector<AssignedVariable> assignedVariables;
+
+    // The values of the variables in the loaded state (booleans first), the results of assignments and the evaluated guards.
+    std::vector<int64_t> values;
+    std::vector<int64_t> assignedValues;
+    std::vector<unsigned char> enabledCommands;
+};
+
+}  // namespace generator
+}  // namespace storm
@@ -10,7 +10,9 @@
 #include "storm/storage/expressions/SimpleValuation.h"
 #include "storm/storage/sparse/PrismChoiceOrigins.h"
 
+#include "storm/generator/BytecodePrismProgram.h"
 #include "storm/generator/Distribution.h"
+#include "storm/generator/JitCompiledPrismProgram.h"
 
 #include "storm/solver/SmtSolver.h"
 
@@ -50,6 +52,21 @@ PrismNextStateGenerator<ValueType, StateType>::PrismNextStateGenerator(storm::pr
     // Create a proper evaluator.
     this->evaluator = std::make_unique<storm::expressions::ExpressionEvaluator<ValueType>>(program.getManager());
 
+    if (this->options.isJitCompilationSet() || this->options.isBytecodeEvaluationSet()) {
+        if constexpr (std::is_same<ValueType, double>::value) {
+            if (this->options.isJitCompilationSet()) {
+                compiledProgram = JitCompiledPrismProgram::create(this->program, this->variableInformation, this->options.getJitCompiler(),
+                                                                  this->options.getJitCacheDirectory());
+            }
+            // The bytecode also serves as fallback if the expressions could not be compiled.
+            if (!compiledProgram && this->options.isBytecodeEvaluationSet()) {
+                compiledProgram = BytecodePrismProgram::create(this->program, this->variableInformation);
+            }
+        } else {
+            STORM_LOG_WARN("Compilation of expressions is only supported for models with double values. Expressions will be interpreted.");
+        }
+    }
+
     if (this->options.isBuildAllRewardModelsSet()) {
         for (auto const& rewardModel : this->program.getRewardModels()) {
             rewardModels.push_back(rewardModel);
@@ -308,6 +325,9 @@ StateBehavior<ValueType, StateType> PrismNextStateGenerator<ValueType, StateType
 
     // Get all choices for the state.
     result.setExpanded();
+    if (compiledProgram) {
+        compiledProgram->loadState(*this->state);
+    }
 
     std::vector<Choice<ValueType>> allChoices;
     if (this->getOptions().isApplyMaximalProgressAssumptionSet()) {
@@ -433,6 +453,11 @@ template<typename ValueType, typename StateType>
 CompressedState PrismNextStateGenerator<ValueType, StateType>::applyUpdate(CompressedState const& state, storm::prism::Update const& update) {
     CompressedState newState(state);
 
+    // Out-of-bounds values are left to the interpreted evaluation below, which treats them according to the options.
+    if (compiledProgram && compiledProgram->applyUpdate(update.getGlobalIndex(), newState)) {
+        return newState;
+    }
+
     // NOTE: the following process assumes that the assignments of the update are ordered in such a way that the
     // assignments to boolean variables precede the assignments to all integer variables and that within the
     // types, the assignments to variables are ordered (in ascending order) by the expression variables.
@@ -481,6 +506,24 @@ CompressedState PrismNextStateGenerator<ValueType, StateType>::applyUpdate(Compr
     return newState;
 }
 
+template<typename ValueType, typename StateType>
+bool PrismNextStateGenerator<ValueType, StateType>::isCommandEnabled(storm::prism::Command const& command) const {
+    if (compiledProgram) {
+        return compiledProgram->isCommandEnabled(command.getGlobalIndex());
+    }
+    return this->evaluator->asBool(command.getGuardExpression());
+}
+
+template<typename ValueType, typename StateType>
+ValueType PrismNextStateGenerator<ValueType, StateType>::getUpdateProbability(storm::prism::Update const& update) const {
+    if constexpr (std::is_same<ValueType, double>::value) {
+        if (compiledProgram) {
+            return compiledProgram->getProbability(update.getGlobalIndex());
+        }
+    }
+    return this->evaluator->asRational(update.getLikelihoodExpression());
+}
+
 struct ActiveCommandData {
     ActiveCommandData(storm::prism::Module const* modulePtr, std::set<uint_fast64_t> const* commandIndicesPtr,
                       typename std::set<uint_fast64_t>::const_iterator currentCommandIndexIt)
@@ -531,7 +574,7 @@ PrismNextStateGenerator<ValueType, StateType>::getActiveCommandsByActionIndex(ui
                     continue;
                 }
             }
-            if (this->evaluator->asBool(command.getGuardExpression())) {
+            if (isCommandEnabled(command)) {
                 // Found the first enabled command for this module.
                 hasOneEnabledCommand = true;
                 activeCommands.emplace_back(&module, &commandIndices, commandIndexIt);
@@ -565,7 +608,7 @@ PrismNextStateGenerator<ValueType, StateType>::getActiveCommandsByActionIndex(ui
                     continue;
                 }
             }
-            if (this->evaluator->asBool(command.getGuardExpression())) {
+            if (isCommandEnabled(command)) {
                 commands.push_back(command);
             }
         }
@@ -608,7 +651,7 @@ std::vector<Choice<ValueType>> PrismNextStateGenerator<ValueType, StateType>::ge
             }
 
             // Skip the command, if it is not enabled.
-            if (!this->evaluator->asBool(command.getGuardExpression())) {
+            if (!isCommandEnabled(command)) {
                 continue;
             }
 
@@ -626,7 +669,7 @@ std::vector<Choice<ValueType>> PrismNextStateGenerator<ValueType, StateType>::ge
             for (uint_fast64_t k = 0; k < command.getNumberOfUpdates(); ++k) {
                 storm::prism::Update const& update = command.getUpdate(k);
 
-                ValueType probability = this->evaluator->asRational(update.getLikelihoodExpression());
+                ValueType probability = getUpdateProbability(update);
                 if (probability != storm::utility::zero<ValueType>()) {
                     // Obtain target state index and add it to the list of known states. If it has not yet been
                     // seen, we also add it to the set of states that have yet to be explored.
@@ -701,7 +744,7 @@ void PrismNextStateGenerator<ValueType, StateType>::generateSynchronizedDistribu
         storm::prism::Command const& command = *iteratorList[position];
         for (uint_fast64_t j = 0; j < command.getNumberOfUpdates(); ++j) {
             storm::prism::Update const& update = command.getUpdate(j);
-            generateSynchronizedDistribution(applyUpdate(state, update), probability * this->evaluator->asRational(update.getLikelihoodExpression()),
+            generateSynchronizedDistribution(applyUpdate(state, update), probability * getUpdateProbability(update),
                                              position + 1, iteratorList, distribution, stateToIdCallback);
         }
     }
@@ -1,6 +1,7 @@
 #ifndef STORM_GENERATOR_PRISMNEXTSTATEGENERATOR_H_
 #define STORM_GENERATOR_PRISMNEXTSTATEGENERATOR_H_
 
+#include "storm/generator/CompiledPrismProgram.h"
 #include "storm/generator/NextStateGenerator.h"
 
 #include "storm/storage/BoostTypes.h"
@@ -68,6 +69,16 @@ class PrismNextStateGenerator : public NextStateGenerator<ValueType, StateType>
      */
     CompressedState applyUpdate(CompressedState const& state, storm::prism::Update const& update);
 
+    /*!
+     * Retrieves whether the guard of the given command holds in the state currently loaded into the evaluator.
+     */
+    bool isCommandEnabled(storm::prism::Command const& command) const;
+
+    /*!
+     * Evaluates the probability of the given update in the state currently loaded into the evaluator.
+     */
+    ValueType getUpdateProbability(storm::prism::Update const& update) const;
+
     /*!
      * Retrieves all commands that are labeled with the given label and enabled in the given state, grouped by
      * modules.
@@ -138,6 +149,9 @@ class PrismNextStateGenerator : public NextStateGenerator<ValueType, StateType>
     // Mappings from module/action indices to the programs players
     std::vector<storm::storage::PlayerIndex> moduleIndexToPlayerIndexMap;
     std::map<uint_fast64_t, storm::storage::PlayerIndex> actionIndexToPlayerIndexMap;
+
+    // If set, guards, probabilities and assignments are evaluated by natively compiled code or bytecode instead of the evaluator.
+    std::unique_ptr<CompiledPrismProgram> compiledProgram;
 };
 
 }  // namespace generator
@@ -0,0 +1,183 @@
+#include "storm/io/BinaryModelExporter.h"
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+
+#include "storm/exceptions/FileIoException.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/io/BinaryModelFormat.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/models/sparse/Pomdp.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace exporter {
+
+namespace {
+
+struct SectionData {
+    BinaryModelFormat::SectionKind kind;
+    std::string name;
+    uint64_t size;
+    std::function<void(std::ostream&)> write;
+};
+
+BinaryModelFormat::ModelType getBinaryModelType(storm::models::ModelType const& type) {
+    switch (type) {
+        case storm::models::ModelType::Dtmc:
+            return BinaryModelFormat::ModelType::Dtmc;
+        case storm::models::ModelType::Ctmc:
+            return BinaryModelFormat::ModelType::Ctmc;
+        case storm::models::ModelType::Mdp:
+            return BinaryModelFormat::ModelType::Mdp;
+        case storm::models::ModelType::MarkovAutomaton:
+            return BinaryModelFormat::ModelType::MarkovAutomaton;
+        case storm::models::ModelType::Pomdp:
+            return BinaryModelFormat::ModelType::Pomdp;
+        default:
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Models of type " << type << " can not be exported in the binary format.");
+    }
+}
+
+void writeBytes(std::ostream& os, void const* data, uint64_t size) {
+    os.write(static_cast<char const*>(data), size);
+}
+
+template<typename T>
+SectionData vectorSection(BinaryModelFormat::SectionKind kind, std::vector<T> const& values, std::string const& name = "") {
+    return {kind, name, values.size() * sizeof(T), [&values](std::ostream& os) { writeBytes(os, values.data(), values.size() * sizeof(T)); }};
+}
+
+SectionData bitVectorSection(BinaryModelFormat::SectionKind kind, storm::storage::BitVector const& bitVector, std::string const& name = "") {
+    uint64_t const numberOfWords = BinaryModelFormat::getNumberOfWords(bitVector.size());
+    return {kind, name, numberOfWords * sizeof(uint64_t), [&bitVector, numberOfWords](std::ostream& os) {
+                std::vector<uint64_t> words(numberOfWords);
+                for (uint64_t word = 0; word < numberOfWords; ++word) {
+                    uint64_t const numberOfBits = std::min<uint64_t>(64, bitVector.size() - word * 64);
+                    words[word] = bitVector.getAsInt(word * 64, numberOfBits) << (64 - numberOfBits);
+                }
+                writeBytes(os, words.data(), words.size() * sizeof(uint64_t));
+            }};
+}
+
+/*!
+ * Writes the column (if Columns is true) or the value of each matrix entry. Uses a small buffer to avoid writing the entries one by one.
+ */
+template<bool Columns>
+void writeMatrixEntries(std::ostream& os, storm::storage::SparseMatrix<double> const& matrix) {
+    using T = std::conditional_t<Columns, uint64_t, double>;
+    uint64_t const bufferSize = 4096;
+    std::vector<T> buffer;
+    buffer.reserve(bufferSize);
+    for (auto const& entry : matrix) {
+        if constexpr (Columns) {
+            buffer.push_back(entry.getColumn());
+        } else {
+            buffer.push_back(entry.getValue());
+        }
+        if (buffer.size() == bufferSize) {
+            writeBytes(os, buffer.data(), buffer.size() * sizeof(T));
+            buffer.clear();
+        }
+    }
+    writeBytes(os, buffer.data(), buffer.size() * sizeof(T));
+}
+
+}  // namespace
+
+void explicitExportSparseModelBinary(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<double>> sparseModel) {
+    storm::storage::SparseMatrix<double> const& matrix = sparseModel->getTransitionMatrix();
+    STORM_LOG_WARN_COND(!sparseModel->hasStateValuations(), "State valuations are not exported in the binary format.");
+
+    BinaryModelFormat::Header header{};
+    std::copy(std::begin(BinaryModelFormat::Magic), std::end(BinaryModelFormat::Magic), header.magic);
+    header.version = BinaryModelFormat::Version;
+    header.byteOrderMark = BinaryModelFormat::ByteOrderMark;
+    header.modelType = static_cast<uint32_t>(getBinaryModelType(sparseModel->getType()));
+    // Notice that for CTMCs the transition matrix contains the rates.
+    header.flags = sparseModel->getType() == storm::models::ModelType::Ctmc ? BinaryModelFormat::RateTransitionsFlag : 0;
+    header.numberOfStates = sparseModel->getNumberOfStates();
+    header.numberOfRows = matrix.getRowCount();
+    header.numberOfColumns = matrix.getColumnCount();
+    header.numberOfEntries = matrix.getEntryCount();
+
+    // Collect the sections.
+    std::vector<SectionData> sections;
+    std::vector<uint64_t> rowIndications;
+    rowIndications.reserve(matrix.getRowCount() + 1);
+    rowIndications.push_back(0);
+    for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+        rowIndications.push_back(rowIndications.back() + matrix.getRow(row).getNumberOfEntries());
+    }
+    sections.push_back(vectorSection(BinaryModelFormat::SectionKind::RowIndications, rowIndications));
+    sections.push_back({BinaryModelFormat::SectionKind::Columns, "", matrix.getEntryCount() * sizeof(uint64_t),
+                        [&matrix](std::ostream& os) { writeMatrixEntries<true>(os, matrix); }});
+    sections.push_back({BinaryModelFormat::SectionKind::Values, "", matrix.getEntryCount() * sizeof(double),
+                        [&matrix](std::ostream& os) { writeMatrixEntries<false>(os, matrix); }});
+    if (!matrix.hasTrivialRowGrouping()) {
+        sections.push_back(vectorSection(BinaryModelFormat::SectionKind::RowGroupIndices, matrix.getRowGroupIndices()));
+    }
+    for (auto const& label : sparseModel->getStateLabeling().getLabels()) {
+        sections.push_back(bitVectorSection(BinaryModelFormat::SectionKind::StateLabel, sparseModel->getStateLabeling().getStates(label), label));
+    }
+    if (sparseModel->hasChoiceLabeling()) {
+        for (auto const& label : sparseModel->getChoiceLabeling().getLabels()) {
+            sections.push_back(bitVectorSection(BinaryModelFormat::SectionKind::ChoiceLabel, sparseModel->getChoiceLabeling().getChoices(label), label));
+        }
+    }
+    for (auto const& [name, rewardModel] : sparseModel->getRewardModels()) {
+        STORM_LOG_THROW(!rewardModel.hasTransitionRewards(), storm::exceptions::NotSupportedException,
+                        "Transition rewards (reward model '" << name << "') can not be exported in the binary format.");
+        if (rewardModel.hasStateRewards()) {
+            sections.push_back(vectorSection(BinaryModelFormat::SectionKind::StateRewards, rewardModel.getStateRewardVector(), name));
+        }
+        if (rewardModel.hasStateActionRewards()) {
+            sections.push_back(vectorSection(BinaryModelFormat::SectionKind::ActionRewards, rewardModel.getStateActionRewardVector(), name));
+        }
+    }
+    if (sparseModel->getType() == storm::models::ModelType::MarkovAutomaton) {
+        auto const& ma = *sparseModel->as<storm::models::sparse::MarkovAutomaton<double>>();
+        sections.push_back(vectorSection(BinaryModelFormat::SectionKind::ExitRates, ma.getExitRates()));
+        sections.push_back(bitVectorSection(BinaryModelFormat::SectionKind::MarkovianStates, ma.getMarkovianStates()));
+    } else if (sparseModel->getType() == storm::models::ModelType::Pomdp) {
+        sections.push_back(vectorSection(BinaryModelFormat::SectionKind::Observations,
+                                         sparseModel->as<storm::models::sparse::Pomdp<double>>()->getObservations()));
+    }
+
+    // The names of the named sections are stored in a separate section.
+    std::string names;
+    for (auto const& section : sections) {
+        names += section.name;
+    }
+    sections.push_back({BinaryModelFormat::SectionKind::Names, "", names.size(), [&names](std::ostream& os) { writeBytes(os, names.data(), names.size()); }});
+    header.numberOfSections = sections.size();
+
+    // Compute the section table.
+    std::vector<BinaryModelFormat::Section> sectionTable;
+    uint64_t offset = BinaryModelFormat::getAlignedOffset(sizeof(BinaryModelFormat::Header) + sections.size() * sizeof(BinaryModelFormat::Section));
+    uint64_t nameOffset = 0;
+    for (auto const& section : sections) {
+        STORM_LOG_THROW(section.name.size() <= std::numeric_limits<uint32_t>::max(), storm::exceptions::NotSupportedException,
+                        "The name '" << section.name.substr(0, 20) << "...' is too long for the binary format.");
+        sectionTable.push_back({static_cast<uint32_t>(section.kind), static_cast<uint32_t>(section.name.size()), nameOffset, offset, section.size});
+        nameOffset += section.name.size();
+        offset = BinaryModelFormat::getAlignedOffset(offset + section.size);
+    }
+
+    // Write the file.
+    char const padding[BinaryModelFormat::Alignment] = {};
+    writeBytes(os, &header, sizeof(header));
+    writeBytes(os, sectionTable.data(), sectionTable.size() * sizeof(BinaryModelFormat::Section));
+    uint64_t position = sizeof(header) + sectionTable.size() * sizeof(BinaryModelFormat::Section);
+    for (uint64_t i = 0; i < sections.size(); ++i) {
+        writeBytes(os, padding, sectionTable[i].offset - position);
+        sections[i].write(os);
+        position = sectionTable[i].offset + sectionTable[i].size;
+    }
+    STORM_LOG_THROW(os.good(), storm::exceptions::FileIoException, "Error while writing the model in the binary format.");
+}
+
+}  // namespace exporter
+}  // namespace storm
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <iostream>
+#include <memory>
+
+#include "storm/models/sparse/Model.h"
+
+namespace storm {
+namespace exporter {
+
+/*!
+ * Exports a sparse model into the binary drb format (see BinaryModelFormat), which can be loaded without parsing.
+ * Supported are DTMCs, CTMCs, MDPs, MAs and POMDPs. Transition rewards and state valuations are not exported.
+ *
+ * @param os           Stream to export to. Should be opened in binary mode.
+ * @param sparseModel  Model to export
+ */
+void explicitExportSparseModelBinary(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<double>> sparseModel);
+
+}  // namespace exporter
+}  // namespace storm
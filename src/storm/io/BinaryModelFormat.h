@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstdint>
+
+namespace storm {
+namespace exporter {
+
+/*!
+ * Describes the layout of the binary (drb) format for explicit models with double values.
+ *
+ * A file consists of a Header, followed by the section table (Header::numberOfSections many Section entries) and the data of the sections.
+ * The data of each section starts at a multiple of Alignment so that a memory-mapped file can directly be accessed as arrays of the respective type.
+ * All numbers are stored in the byte order of the machine that wrote the file, which is detected via the byte order mark.
+ */
+struct BinaryModelFormat {
+    static constexpr char Magic[8] = {'S', 'T', 'O', 'R', 'M', 'D', 'R', 'B'};
+    static constexpr uint32_t Version = 1;
+    static constexpr uint32_t ByteOrderMark = 0x01020304;
+    static constexpr uint64_t Alignment = 64;
+
+    /*!
+     * Flag that is set if the transition matrix contains rates (for CTMCs).
+     */
+    static constexpr uint32_t RateTransitionsFlag = 1;
+
+    enum class ModelType : uint32_t { Dtmc = 0, Ctmc = 1, Mdp = 2, MarkovAutomaton = 3, Pomdp = 4 };
+
+    enum class SectionKind : uint32_t {
+        Names = 0,             // char[]: the concatenated names of the named sections
+        RowIndications = 1,    // uint64_t[numberOfRows + 1]
+        Columns = 2,           // uint64_t[numberOfEntries]
+        Values = 3,            // double[numberOfEntries]
+        RowGroupIndices = 4,   // uint64_t[numberOfStates + 1], only present for non-trivial row groupings
+        StateLabel = 5,        // uint64_t[ceil(numberOfStates / 64)], named
+        ChoiceLabel = 6,       // uint64_t[ceil(numberOfRows / 64)], named
+        StateRewards = 7,      // double[numberOfStates], named after the reward model
+        ActionRewards = 8,     // double[numberOfRows], named after the reward model
+        ExitRates = 9,         // double[numberOfStates]
+        MarkovianStates = 10,  // uint64_t[ceil(numberOfStates / 64)]
+        Observations = 11      // uint32_t[numberOfStates]
+    };
+
+    struct Header {
+        char magic[8];
+        uint32_t version;
+        uint32_t byteOrderMark;
+        uint32_t modelType;
+        uint32_t flags;
+        uint64_t numberOfStates;
+        uint64_t numberOfRows;
+        uint64_t numberOfColumns;
+        uint64_t numberOfEntries;
+        uint64_t numberOfSections;
+    };
+
+    struct Section {
+        uint32_t kind;
+        // Position of the name of the section within the Names section. Only relevant for named sections.
+        uint32_t nameLength;
+        uint64_t nameOffset;
+        // Position of the data of the section within the file (in bytes).
+        uint64_t offset;
+        uint64_t size;
+    };
+
+    /*!
+     * Bit vectors are stored as 64 bit words where the i'th bit of the vector is the (63 - i % 64)'th bit of the (i / 64)'th word.
+     */
+    static constexpr uint64_t getNumberOfWords(uint64_t numberOfBits) {
+        return (numberOfBits + 63) / 64;
+    }
+
+    static constexpr uint64_t getAlignedOffset(uint64_t offset) {
+        return (offset + Alignment - 1) / Alignment * Alignment;
+    }
+};
+
+}  // namespace exporter
+}  // namespace storm
@@ -4,6 +4,7 @@
 #include "storm/exceptions/InvalidPropertyException.h"
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/NotImplementedException.h"
+#include "storm/exceptions/NotSupportedException.h"
 #include "storm/logic/FragmentSpecification.h"
 #include "storm/modelchecker/csl/helper/SparseCtmcCslHelper.h"
 #include "storm/modelchecker/helper/indefinitehorizon/visitingtimes/SparseDeterministicVisitingTimesHelper.h"
@@ -76,6 +77,30 @@ std::unique_ptr<CheckResult> SparseCtmcCslModelChecker<SparseCtmcModelType>::com
     return std::unique_ptr<CheckResult>(new ExplicitQuantitativeCheckResult<ValueType>(std::move(numericResult)));
 }
 
+template<typename SparseCtmcModelType>
+std::vector<std::unique_ptr<CheckResult>> SparseCtmcCslModelChecker<SparseCtmcModelType>::computeBoundedUntilProbabilitiesForTimeBounds(
+    Environment const& env, CheckTask<storm::logic::BoundedUntilFormula, ValueType> const& checkTask, std::vector<double> const& timeBounds) {
+    storm::logic::BoundedUntilFormula const& pathFormula = checkTask.getFormula();
+    STORM_LOG_THROW(pathFormula.getTimeBoundReference().isTimeBound(), storm::exceptions::NotImplementedException,
+                    "Currently step-bounded or reward-bounded properties on CTMCs are not supported.");
+    STORM_LOG_THROW(!pathFormula.hasLowerBound(), storm::exceptions::NotSupportedException,
+                    "Computing probabilities for multiple time bounds is only supported for formulas without lower time bound.");
+    std::unique_ptr<CheckResult> leftResultPointer = this->check(env, pathFormula.getLeftSubformula());
+    std::unique_ptr<CheckResult> rightResultPointer = this->check(env, pathFormula.getRightSubformula());
+    ExplicitQualitativeCheckResult const& leftResult = leftResultPointer->asExplicitQualitativeCheckResult();
+    ExplicitQualitativeCheckResult const& rightResult = rightResultPointer->asExplicitQualitativeCheckResult();
+
+    std::vector<std::vector<ValueType>> numericResults = storm::modelchecker::helper::SparseCtmcCslHelper::computeBoundedUntilProbabilitiesForTimeBounds(
+        env, storm::solver::SolveGoal<ValueType>(this->getModel(), checkTask), this->getModel().getTransitionMatrix(),
+        this->getModel().getBackwardTransitions(), leftResult.getTruthValuesVector(), rightResult.getTruthValuesVector(), this->getModel().getExitRateVector(),
+        timeBounds);
+    std::vector<std::unique_ptr<CheckResult>> results;
+    for (auto& numericResult : numericResults) {
+        results.push_back(std::make_unique<ExplicitQuantitativeCheckResult<ValueType>>(std::move(numericResult)));
+    }
+    return results;
+}
+
 template<typename SparseCtmcModelType>
 std::unique_ptr<CheckResult> SparseCtmcCslModelChecker<SparseCtmcModelType>::computeNextProbabilities(
     Environment const& env, CheckTask<storm::logic::NextFormula, ValueType> const& checkTask) {
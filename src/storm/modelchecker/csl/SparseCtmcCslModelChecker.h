@@ -50,6 +50,16 @@ class SparseCtmcCslModelChecker : public SparsePropositionalModelChecker<SparseC
     virtual std::unique_ptr<CheckResult> computeTotalRewards(Environment const& env,
                                                              CheckTask<storm::logic::TotalRewardFormula, ValueType> const& checkTask) override;
 
+    /*!
+     * Computes the probabilities of the given time-bounded until formula for each of the given upper time bounds, which replace the upper bound of the
+     * formula. The formula must not have a lower time bound.
+     *
+     * @param timeBounds The upper time bounds in ascending order.
+     * @return One result for each of the time bounds.
+     */
+    std::vector<std::unique_ptr<CheckResult>> computeBoundedUntilProbabilitiesForTimeBounds(
+        Environment const& env, CheckTask<storm::logic::BoundedUntilFormula, ValueType> const& checkTask, std::vector<double> const& timeBounds);
+
     /*!
      * Compute transient probabilities for all states.
      */
@@ -22,6 +22,7 @@
 #include "storm/utility/vector.h"
 
 #include "storm/exceptions/FormatUnsupportedBySolverException.h"
+#include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/InvalidOperationException.h"
 #include "storm/exceptions/InvalidPropertyException.h"
 #include "storm/exceptions/InvalidStateException.h"
@@ -274,6 +275,99 @@ std::vector<ValueType> SparseCtmcCslHelper::computeBoundedUntilProbabilities(Env
     STORM_LOG_THROW(false, storm::exceptions::InvalidOperationException, "Computing bounded until probabilities is unsupported for this value type.");
 }
 
+template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+std::vector<std::vector<ValueType>> SparseCtmcCslHelper::computeBoundedUntilProbabilitiesForTimeBounds(
+    Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& rateMatrix,
+    storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+    std::vector<ValueType> const& exitRates, std::vector<double> const& upperBounds) {
+    STORM_LOG_THROW(!env.solver().isForceExact(), storm::exceptions::InvalidOperationException,
+                    "Exact computations not possible for bounded until probabilities.");
+    for (uint64_t boundIndex = 0; boundIndex < upperBounds.size(); ++boundIndex) {
+        STORM_LOG_THROW(upperBounds[boundIndex] >= 0.0 && upperBounds[boundIndex] != storm::utility::infinity<double>(),
+                        storm::exceptions::InvalidArgumentException, "The time bound " << upperBounds[boundIndex] << " is not a finite, non-negative number.");
+        STORM_LOG_THROW(boundIndex == 0 || upperBounds[boundIndex - 1] <= upperBounds[boundIndex], storm::exceptions::InvalidArgumentException,
+                        "The time bounds need to be given in ascending order.");
+    }
+
+    uint_fast64_t numberOfStates = rateMatrix.getRowCount();
+
+    // Set the possible (absolute) error allowed for truncation (epsilon for fox-glynn)
+    ValueType epsilon = storm::utility::convertNumber<ValueType>(env.solver().timeBounded().getPrecision()) / 8.0;
+
+    // If we identify the states that have probability 0 of reaching the target states, we can exclude them from the
+    // further computations.
+    storm::storage::BitVector statesWithProbabilityGreater0 = storm::utility::graph::performProbGreater0(backwardTransitions, phiStates, psiStates);
+    STORM_LOG_INFO("Found " << statesWithProbabilityGreater0.getNumberOfSetBits() << " states with probability greater 0.");
+    storm::storage::BitVector statesWithProbabilityGreater0NonPsi = statesWithProbabilityGreater0 & ~psiStates;
+    STORM_LOG_INFO("Found " << statesWithProbabilityGreater0NonPsi.getNumberOfSetBits() << " 'maybe' states.");
+
+    // the positions within the results for which the precision needs to be checked
+    storm::storage::BitVector relevantValues;
+    if (goal.hasRelevantValues()) {
+        relevantValues = std::move(goal.relevantValues());
+        relevantValues &= statesWithProbabilityGreater0;
+    } else {
+        relevantValues = statesWithProbabilityGreater0;
+    }
+
+    // The uniformized matrix does not depend on the time bounds, so it is computed once for all of them.
+    ValueType uniformizationRate = storm::utility::zero<ValueType>();
+    storm::storage::SparseMatrix<ValueType> uniformizedMatrix;
+    std::vector<ValueType> b;
+    std::vector<ValueType> timeBounds;
+    if (!statesWithProbabilityGreater0NonPsi.empty()) {
+        // Find the maximal rate of all 'maybe' states to take it as the uniformization rate.
+        for (auto state : statesWithProbabilityGreater0NonPsi) {
+            uniformizationRate = std::max(uniformizationRate, exitRates[state]);
+        }
+        uniformizationRate *= 1.02;
+        STORM_LOG_THROW(uniformizationRate > 0, storm::exceptions::InvalidStateException, "The uniformization rate must be positive.");
+
+        uniformizedMatrix = computeUniformizedMatrix(rateMatrix, statesWithProbabilityGreater0NonPsi, uniformizationRate, exitRates);
+
+        // Compute the vector that is to be added as a compensation for removing the absorbing states.
+        b = rateMatrix.getConstrainedRowSumVector(statesWithProbabilityGreater0NonPsi, psiStates);
+        for (auto& element : b) {
+            element /= uniformizationRate;
+        }
+
+        for (auto const& upperBound : upperBounds) {
+            timeBounds.push_back(storm::utility::convertNumber<ValueType>(upperBound));
+        }
+    }
+
+    std::vector<std::vector<ValueType>> results;
+    bool recompute;
+    do {  // Iterate until the desired precision is reached (only relevant for relative precision criterion)
+        results.assign(upperBounds.size(), std::vector<ValueType>(numberOfStates, storm::utility::zero<ValueType>()));
+        for (auto& result : results) {
+            storm::utility::vector::setVectorValues<ValueType>(result, psiStates, storm::utility::one<ValueType>());
+        }
+        if (!statesWithProbabilityGreater0NonPsi.empty()) {
+            std::vector<ValueType> values(statesWithProbabilityGreater0NonPsi.getNumberOfSetBits(), storm::utility::zero<ValueType>());
+            std::vector<std::vector<ValueType>> subresults =
+                computeTransientProbabilitiesForTimeBounds(env, uniformizedMatrix, &b, timeBounds, uniformizationRate, values, epsilon);
+            for (uint64_t boundIndex = 0; boundIndex < results.size(); ++boundIndex) {
+                storm::utility::vector::setVectorValues(results[boundIndex], statesWithProbabilityGreater0NonPsi, subresults[boundIndex]);
+            }
+        }
+
+        // The truncation error has to be small enough for all of the time bounds.
+        recompute = false;
+        for (auto const& result : results) {
+            recompute |= checkAndUpdateTransientProbabilityEpsilon(env, epsilon, result, relevantValues);
+        }
+    } while (recompute);
+    return results;
+}
+
+template<typename ValueType, typename std::enable_if<!storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+std::vector<std::vector<ValueType>> SparseCtmcCslHelper::computeBoundedUntilProbabilitiesForTimeBounds(
+    Environment const&, storm::solver::SolveGoal<ValueType>&&, storm::storage::SparseMatrix<ValueType> const&, storm::storage::SparseMatrix<ValueType> const&,
+    storm::storage::BitVector const&, storm::storage::BitVector const&, std::vector<ValueType> const&, std::vector<double> const&) {
+    STORM_LOG_THROW(false, storm::exceptions::InvalidOperationException, "Computing bounded until probabilities is unsupported for this value type.");
+}
+
 template<typename ValueType>
 std::vector<ValueType> SparseCtmcCslHelper::computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
                                                                       storm::storage::SparseMatrix<ValueType> const& rateMatrix,
@@ -754,6 +848,80 @@ std::vector<ValueType> SparseCtmcCslHelper::computeTransientProbabilities(Enviro
     return result;
 }
 
+template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+std::vector<std::vector<ValueType>> SparseCtmcCslHelper::computeTransientProbabilitiesForTimeBounds(
+    Environment const& env, storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix, std::vector<ValueType> const* addVector,
+    std::vector<ValueType> const& timeBounds, ValueType uniformizationRate, std::vector<ValueType> values, ValueType epsilon) {
+    STORM_LOG_WARN_COND(epsilon > storm::utility::convertNumber<ValueType>(1e-20),
+                        "Very low truncation error " << epsilon << " requested. Numerical inaccuracies are possible.");
+
+    // Use Fox-Glynn to get the truncation points and the weights of each time bound. Time bounds in which no time can pass keep the initial values.
+    std::vector<std::vector<ValueType>> results(timeBounds.size());
+    std::vector<storm::utility::numerical::FoxGlynnResult<ValueType>> foxGlynnResults(timeBounds.size());
+    uint64_t firstPendingBound = timeBounds.size();
+    uint64_t left = 0;
+    uint64_t right = 0;
+    for (uint64_t boundIndex = 0; boundIndex < timeBounds.size(); ++boundIndex) {
+        STORM_LOG_ASSERT(boundIndex == 0 || timeBounds[boundIndex - 1] <= timeBounds[boundIndex], "Time bounds are not sorted.");
+        ValueType lambda = timeBounds[boundIndex] * uniformizationRate;
+        if (storm::utility::isZero(lambda)) {
+            results[boundIndex] = values;
+            continue;
+        }
+        foxGlynnResults[boundIndex] = storm::utility::numerical::foxGlynn(lambda, epsilon);
+        STORM_LOG_DEBUG("Fox-Glynn cutoff points for time bound " << timeBounds[boundIndex] << ": left=" << foxGlynnResults[boundIndex].left
+                                                                  << ", right=" << foxGlynnResults[boundIndex].right);
+        if (firstPendingBound == timeBounds.size()) {
+            firstPendingBound = boundIndex;
+            left = foxGlynnResults[boundIndex].left;
+        }
+        left = std::min<uint64_t>(left, foxGlynnResults[boundIndex].left);
+        right = std::max<uint64_t>(right, foxGlynnResults[boundIndex].right);
+        results[boundIndex] = std::vector<ValueType>(values.size(), storm::utility::zero<ValueType>());
+    }
+    if (firstPendingBound == timeBounds.size()) {
+        return results;
+    }
+
+    STORM_LOG_DEBUG("Starting iterations with " << uniformizedMatrix.getRowCount() << " x " << uniformizedMatrix.getColumnCount() << " matrix for "
+                                                << timeBounds.size() << " time bounds.");
+
+    // Perform the matrix-vector multiplications (without adding) that lie before all left truncation points.
+    auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, uniformizedMatrix);
+    if (left > 0) {
+        multiplier->repeatedMultiply(env, values, addVector, left);
+    }
+
+    // Every iterate is added (scaled with the respective weight) to the results of all time bounds whose truncation points enclose it. As the time bounds
+    // are sorted, the time bounds whose right truncation point has already been passed form a prefix, which we skip.
+    ValueType weight = 0;
+    std::function<ValueType(ValueType const&, ValueType const&)> addAndScale = [&weight](ValueType const& a, ValueType const& b) { return a + weight * b; };
+    for (uint64_t index = left; index <= right; ++index) {
+        if (index > left) {
+            multiplier->multiply(env, values, addVector, values);
+        }
+        while (firstPendingBound < timeBounds.size() && foxGlynnResults[firstPendingBound].right < index) {
+            ++firstPendingBound;
+        }
+        for (uint64_t boundIndex = firstPendingBound; boundIndex < timeBounds.size(); ++boundIndex) {
+            auto const& foxGlynnResult = foxGlynnResults[boundIndex];
+            if (!foxGlynnResult.weights.empty() && foxGlynnResult.left <= index && index <= foxGlynnResult.right) {
+                weight = foxGlynnResult.weights[index - foxGlynnResult.left];
+                storm::utility::vector::applyPointwise(results[boundIndex], values, results[boundIndex], addAndScale);
+            }
+        }
+    }
+
+    // Finally, divide the results by the total weights
+    for (uint64_t boundIndex = 0; boundIndex < timeBounds.size(); ++boundIndex) {
+        if (!foxGlynnResults[boundIndex].weights.empty()) {
+            storm::utility::vector::scaleVectorInPlace<ValueType, ValueType>(results[boundIndex],
+                                                                             storm::utility::one<ValueType>() / foxGlynnResults[boundIndex].totalWeight);
+        }
+    }
+    return results;
+}
+
 template<typename ValueType>
 storm::storage::SparseMatrix<ValueType> SparseCtmcCslHelper::computeProbabilityMatrix(storm::storage::SparseMatrix<ValueType> const& rateMatrix,
                                                                                       std::vector<ValueType> const& exitRates) {
@@ -789,6 +957,11 @@ template std::vector<double> SparseCtmcCslHelper::computeBoundedUntilProbabiliti
     storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
     std::vector<double> const& exitRates, bool qualitative, double lowerBound, double upperBound);
 
+template std::vector<std::vector<double>> SparseCtmcCslHelper::computeBoundedUntilProbabilitiesForTimeBounds(
+    Environment const& env, storm::solver::SolveGoal<double>&& goal, storm::storage::SparseMatrix<double> const& rateMatrix,
+    storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+    std::vector<double> const& exitRates, std::vector<double> const& upperBounds);
+
 template std::vector<double> SparseCtmcCslHelper::computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<double>&& goal,
                                                                             storm::storage::SparseMatrix<double> const& rateMatrix,
                                                                             storm::storage::SparseMatrix<double> const& backwardTransitions,
@@ -851,6 +1024,10 @@ template std::vector<double> SparseCtmcCslHelper::computeTransientProbabilities(
                                                                                 std::vector<double> const* addVector, double timeBound,
                                                                                 double uniformizationRate, std::vector<double> values, double epsilon);
 
+template std::vector<std::vector<double>> SparseCtmcCslHelper::computeTransientProbabilitiesForTimeBounds(
+    Environment const& env, storm::storage::SparseMatrix<double> const& uniformizedMatrix, std::vector<double> const* addVector,
+    std::vector<double> const& timeBounds, double uniformizationRate, std::vector<double> values, double epsilon);
+
 #ifdef STORM_HAVE_CARL
 template std::vector<storm::RationalNumber> SparseCtmcCslHelper::computeBoundedUntilProbabilities(
     Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& rateMatrix,
@@ -861,6 +1038,15 @@ template std::vector<storm::RationalFunction> SparseCtmcCslHelper::computeBounde
     storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, storm::storage::BitVector const& phiStates,
     storm::storage::BitVector const& psiStates, std::vector<storm::RationalFunction> const& exitRates, bool qualitative, double lowerBound, double upperBound);
 
+template std::vector<std::vector<storm::RationalNumber>> SparseCtmcCslHelper::computeBoundedUntilProbabilitiesForTimeBounds(
+    Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& rateMatrix,
+    storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+    storm::storage::BitVector const& psiStates, std::vector<storm::RationalNumber> const& exitRates, std::vector<double> const& upperBounds);
+template std::vector<std::vector<storm::RationalFunction>> SparseCtmcCslHelper::computeBoundedUntilProbabilitiesForTimeBounds(
+    Environment const& env, storm::solver::SolveGoal<storm::RationalFunction>&& goal, storm::storage::SparseMatrix<storm::RationalFunction> const& rateMatrix,
+    storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+    storm::storage::BitVector const& psiStates, std::vector<storm::RationalFunction> const& exitRates, std::vector<double> const& upperBounds);
+
 template std::vector<storm::RationalNumber> SparseCtmcCslHelper::computeUntilProbabilities(
     Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& rateMatrix,
     storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, std::vector<storm::RationalNumber> const& exitRateVector,
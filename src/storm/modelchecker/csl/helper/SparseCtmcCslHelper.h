@@ -39,6 +39,27 @@ class SparseCtmcCslHelper {
                                                                    std::vector<ValueType> const& exitRates, bool qualitative, double lowerBound,
                                                                    double upperBound);
 
+    /*!
+     * Computes the probabilities of satisfying phi U[0, t] psi for each of the given upper time bounds t.
+     *
+     * The CTMC is uniformized only once and all time bounds are handled in a single sequence of matrix-vector multiplications, which is considerably
+     * cheaper than computing the probabilities for each time bound separately.
+     *
+     * @param upperBounds The (finite) upper time bounds in ascending order.
+     * @return For each of the upper time bounds, the vector of probabilities.
+     */
+    template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
+    static std::vector<std::vector<ValueType>> computeBoundedUntilProbabilitiesForTimeBounds(
+        Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& rateMatrix,
+        storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+        storm::storage::BitVector const& psiStates, std::vector<ValueType> const& exitRates, std::vector<double> const& upperBounds);
+
+    template<typename ValueType, typename std::enable_if<!storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
+    static std::vector<std::vector<ValueType>> computeBoundedUntilProbabilitiesForTimeBounds(
+        Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& rateMatrix,
+        storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+        storm::storage::BitVector const& psiStates, std::vector<ValueType> const& exitRates, std::vector<double> const& upperBounds);
+
     template<typename ValueType>
     static std::vector<ValueType> computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
                                                             storm::storage::SparseMatrix<ValueType> const& rateMatrix,
@@ -143,6 +164,26 @@ class SparseCtmcCslHelper {
                                                                 std::vector<ValueType> const* addVector, ValueType timeBound, ValueType uniformizationRate,
                                                                 std::vector<ValueType> values, ValueType epsilon);
 
+    /*!
+     * Computes the transient probabilities for each of the given time bounds in one pass. The iterates of the uniformized matrix are computed once and
+     * accumulated with the (Fox-Glynn) weights of every time bound whose truncation points enclose them.
+     *
+     * @param uniformizedMatrix The uniformized transition matrix.
+     * @param addVector A vector that is added in each step as a possible compensation for removing absorbing states
+     * with a non-zero initial value. If this is not supposed to be used, it can be set to nullptr.
+     * @param timeBounds The time bounds to use in ascending order.
+     * @param uniformizationRate The used uniformization rate.
+     * @param values A vector mapping each state to an initial probability.
+     * @param epsilon The precision used for computing the truncation points of each time bound.
+     * @return For each of the time bounds, the vector of transient probabilities.
+     */
+    template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
+    static std::vector<std::vector<ValueType>> computeTransientProbabilitiesForTimeBounds(Environment const& env,
+                                                                                         storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix,
+                                                                                         std::vector<ValueType> const* addVector,
+                                                                                         std::vector<ValueType> const& timeBounds, ValueType uniformizationRate,
+                                                                                         std::vector<ValueType> values, ValueType epsilon);
+
     /*!
      * Converts the given rate-matrix into a time-abstract probability matrix.
      *
@@ -4,6 +4,7 @@
 #include "storm/modelchecker/exploration/ExplorationInformation.h"
 #include "storm/modelchecker/exploration/StateGeneration.h"
 #include "storm/modelchecker/exploration/Statistics.h"
+#include "storm/modelchecker/exploration/Synchronization.h"
 
 #include "storm/storage/expressions/ExpressionEvaluator.h"
 
@@ -12,6 +13,7 @@
 #include "storm/storage/MaximalEndComponentDecomposition.h"
 #include "storm/storage/SparseMatrix.h"
 
+#include "storm/storage/jani/Model.h"
 #include "storm/storage/prism/Program.h"
 
 #include "storm/logic/FragmentSpecification.h"
@@ -29,6 +31,7 @@
 #include "storm/utility/constants.h"
 #include "storm/utility/graph.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/TaskPool.h"
 #include "storm/utility/prism.h"
 
 #include "storm/exceptions/InvalidOperationException.h"
@@ -39,11 +42,30 @@ namespace storm {
 namespace modelchecker {
 
 template<typename ModelType, typename StateType>
-SparseExplorationModelChecker<ModelType, StateType>::SparseExplorationModelChecker(storm::prism::Program const& program)
-    : program(program.substituteConstantsFormulas()),
+SparseExplorationModelChecker<ModelType, StateType>::SparseExplorationModelChecker(storm::storage::SymbolicModelDescription const& model)
+    : SparseExplorationModelChecker(model, storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getNumberOfThreads()) {
+    // Intentionally left empty.
+}
+
+template<typename ModelType, typename StateType>
+SparseExplorationModelChecker<ModelType, StateType>::SparseExplorationModelChecker(storm::storage::SymbolicModelDescription const& model,
+                                                                                   uint_fast64_t numberOfThreads)
+    : numberOfThreads(std::max<uint_fast64_t>(numberOfThreads, 1)),
       randomGenerator(std::chrono::system_clock::now().time_since_epoch().count()),
       comparator(storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getPrecision()) {
-    // Intentionally left empty.
+    if (model.isPrismProgram()) {
+        storm::prism::Program program = model.asPrismProgram().substituteConstantsFormulas();
+        labelToExpressionMapping = program.getLabelToExpressionMapping();
+        this->model = program;
+    } else {
+        storm::jani::Model janiModel = model.asJaniModel().substituteConstantsFunctionsTranscendentals();
+        for (auto const& variable : janiModel.getGlobalVariables().getTransientVariables()) {
+            if (variable.getType().isBasicType() && variable.getType().asBasicType().isBooleanType()) {
+                labelToExpressionMapping[variable.getName()] = janiModel.getLabelExpression(variable);
+            }
+        }
+        this->model = janiModel;
+    }
 }
 
 template<typename ModelType, typename StateType>
@@ -64,7 +86,8 @@ std::unique_ptr<CheckResult> SparseExplorationModelChecker<ModelType, StateType>
     storm::logic::UntilFormula const& untilFormula = checkTask.getFormula();
     storm::logic::Formula const& conditionFormula = untilFormula.getLeftSubformula();
     storm::logic::Formula const& targetFormula = untilFormula.getRightSubformula();
-    STORM_LOG_THROW(program.isDeterministicModel() || checkTask.isOptimizationDirectionSet(), storm::exceptions::InvalidPropertyException,
+    STORM_LOG_THROW(model.getModelType() == storm::storage::SymbolicModelDescription::ModelType::DTMC || checkTask.isOptimizationDirectionSet(),
+                    storm::exceptions::InvalidPropertyException,
                     "For nondeterministic systems, an optimization direction (min/max) must be given in the property.");
 
     ExplorationInformation<StateType, ValueType> explorationInformation(checkTask.isOptimizationDirectionSet() ? checkTask.getOptimizationDirection()
@@ -73,19 +96,20 @@ std::unique_ptr<CheckResult> SparseExplorationModelChecker<ModelType, StateType>
     // The first row group starts at action 0.
     explorationInformation.newRowGroup(0);
 
-    std::map<std::string, storm::expressions::Expression> labelToExpressionMapping = program.getLabelToExpressionMapping();
-    StateGeneration<StateType, ValueType> stateGeneration(program, explorationInformation,
-                                                          conditionFormula.toExpression(program.getManager(), labelToExpressionMapping),
-                                                          targetFormula.toExpression(program.getManager(), labelToExpressionMapping));
+    Synchronization synchronization(numberOfThreads > 1);
+    StateGeneration<StateType, ValueType> stateGeneration(model, explorationInformation, synchronization,
+                                                          conditionFormula.toExpression(model.getManager(), labelToExpressionMapping),
+                                                          targetFormula.toExpression(model.getManager(), labelToExpressionMapping));
 
     // Compute and return result.
-    std::tuple<StateType, ValueType, ValueType> boundsForInitialState = performExploration(stateGeneration, explorationInformation);
+    std::tuple<StateType, ValueType, ValueType> boundsForInitialState = performExploration(stateGeneration, explorationInformation, synchronization);
     return std::make_unique<ExplicitQuantitativeCheckResult<ValueType>>(std::get<0>(boundsForInitialState), std::get<1>(boundsForInitialState));
 }
 
 template<typename ModelType, typename StateType>
 std::tuple<StateType, typename ModelType::ValueType, typename ModelType::ValueType> SparseExplorationModelChecker<ModelType, StateType>::performExploration(
-    StateGeneration<StateType, ValueType>& stateGeneration, ExplorationInformation<StateType, typename ModelType::ValueType>& explorationInformation) const {
+    StateGeneration<StateType, ValueType>& stateGeneration, ExplorationInformation<StateType, typename ModelType::ValueType>& explorationInformation,
+    Synchronization& synchronization) const {
     // Generate the initial state so we know where to start the simulation.
     stateGeneration.computeInitialStates();
     STORM_LOG_THROW(stateGeneration.getNumberOfInitialStates() == 1, storm::exceptions::NotSupportedException,
@@ -95,41 +119,40 @@ std::tuple<StateType, typename ModelType::ValueType, typename ModelType::ValueTy
     // Create a structure that holds the bounds for the states and actions.
     Bounds<StateType, ValueType> bounds;
 
-    // Create a stack that is used to track the path we sampled.
-    StateActionStack stack;
-
     // Now perform the actual sampling.
     Statistics<StateType, ValueType> stats;
-    bool convergenceCriterionMet = false;
-    while (!convergenceCriterionMet) {
-        bool result = samplePathFromInitialState(stateGeneration, explorationInformation, stack, bounds, stats);
-
-        stats.sampledPath();
-        stats.updateMaxPathLength(stack.size());
+    if (synchronization.isConcurrent()) {
+        STORM_LOG_DEBUG("Sampling paths with " << numberOfThreads << " threads.");
+
+        // Every thread needs its own generator, random numbers and statistics.
+        std::vector<std::unique_ptr<StateGeneration<StateType, ValueType>>> stateGenerations;
+        std::vector<std::default_random_engine> randomGenerators;
+        std::vector<Statistics<StateType, ValueType>> threadStats(numberOfThreads);
+        for (uint_fast64_t thread = 0; thread < numberOfThreads; ++thread) {
+            stateGenerations.push_back(thread == 0 ? nullptr : stateGeneration.createSharingStates());
+            randomGenerators.emplace_back(randomGenerator());
+        }
 
-        // If a terminal state was found, we update the probabilities along the path contained in the stack.
-        if (result) {
-            // Update the bounds along the path to the terminal state.
-            STORM_LOG_TRACE("Found terminal state, updating probabilities along path.");
-            updateProbabilityBoundsAlongSampledPath(stack, explorationInformation, bounds);
-        } else {
-            // If not terminal state was found, the search aborted, possibly because of an EC-detection. In this
-            // case, we cannot update the probabilities.
-            STORM_LOG_TRACE("Did not find terminal state.");
+        storm::utility::TaskPool pool(numberOfThreads);
+        for (uint_fast64_t thread = 0; thread < numberOfThreads; ++thread) {
+            pool.submit([&, thread]() {
+                try {
+                    samplePaths(thread == 0 ? stateGeneration : *stateGenerations[thread], explorationInformation, bounds, synchronization,
+                                randomGenerators[thread], threadStats[thread]);
+                } catch (...) {
+                    // Make the other threads stop sampling, so the error can be reported.
+                    synchronization.finish();
+                    throw;
+                }
+            });
         }
+        pool.wait();
 
-        STORM_LOG_DEBUG("Discovered states: " << explorationInformation.getNumberOfDiscoveredStates() << " (" << stats.numberOfExploredStates << " explored, "
-                                              << explorationInformation.getNumberOfUnexploredStates() << " unexplored).");
-        STORM_LOG_DEBUG("Value of initial state is in [" << bounds.getLowerBoundForState(initialStateIndex, explorationInformation) << ", "
-                                                         << bounds.getUpperBoundForState(initialStateIndex, explorationInformation) << "].");
-        ValueType difference = bounds.getDifferenceOfStateBounds(initialStateIndex, explorationInformation);
-        STORM_LOG_DEBUG("Difference after iteration " << stats.pathsSampled << " is " << difference << ".");
-        convergenceCriterionMet = comparator.isZero(difference);
-
-        // If the number of sampled paths exceeds a certain threshold, do a precomputation.
-        if (!convergenceCriterionMet && explorationInformation.performPrecomputationExcessiveSampledPaths(stats.pathsSampledSinceLastPrecomputation)) {
-            performPrecomputation(stack, explorationInformation, bounds, stats);
+        for (auto const& threadStat : threadStats) {
+            stats.add(threadStat);
         }
+    } else {
+        samplePaths(stateGeneration, explorationInformation, bounds, synchronization, randomGenerator, stats);
     }
 
     // Show statistics if required.
@@ -141,10 +164,65 @@ std::tuple<StateType, typename ModelType::ValueType, typename ModelType::ValueTy
                            bounds.getUpperBoundForState(initialStateIndex, explorationInformation));
 }
 
+template<typename ModelType, typename StateType>
+void SparseExplorationModelChecker<ModelType, StateType>::samplePaths(StateGeneration<StateType, ValueType>& stateGeneration,
+                                                                      ExplorationInformation<StateType, ValueType>& explorationInformation,
+                                                                      Bounds<StateType, ValueType>& bounds, Synchronization& synchronization,
+                                                                      std::default_random_engine& randomGenerator,
+                                                                      Statistics<StateType, ValueType>& stats) const {
+    StateType initialStateIndex = stateGeneration.getFirstInitialState();
+
+    // Create a stack that is used to track the path we sampled.
+    StateActionStack stack;
+
+    while (!synchronization.isFinished()) {
+        // If another thread collapses a MEC while the path is sampled, the actions on the stack are no longer valid.
+        uint64_t numberOfCollapsesBeforeSampling = synchronization.getNumberOfCollapses();
+        bool result = samplePathFromInitialState(stateGeneration, explorationInformation, stack, bounds, synchronization, randomGenerator, stats);
+
+        stats.sampledPath();
+        stats.updateMaxPathLength(stack.size());
+
+        bool convergenceCriterionMet = false;
+        {
+            auto lock = synchronization.lockForWriting();
+
+            // If a terminal state was found, we update the probabilities along the path contained in the stack.
+            if (result && synchronization.getNumberOfCollapses() == numberOfCollapsesBeforeSampling) {
+                // Update the bounds along the path to the terminal state.
+                STORM_LOG_TRACE("Found terminal state, updating probabilities along path.");
+                updateProbabilityBoundsAlongSampledPath(stack, explorationInformation, bounds);
+            } else {
+                // If not terminal state was found, the search aborted, possibly because of an EC-detection. In this
+                // case, we cannot update the probabilities.
+                STORM_LOG_TRACE("Did not find terminal state or the path became invalid.");
+                stack.clear();
+            }
+
+            STORM_LOG_DEBUG("Discovered states: " << explorationInformation.getNumberOfDiscoveredStates() << " (" << stats.numberOfExploredStates
+                                                  << " explored, " << explorationInformation.getNumberOfUnexploredStates() << " unexplored).");
+            STORM_LOG_DEBUG("Value of initial state is in [" << bounds.getLowerBoundForState(initialStateIndex, explorationInformation) << ", "
+                                                             << bounds.getUpperBoundForState(initialStateIndex, explorationInformation) << "].");
+            ValueType difference = bounds.getDifferenceOfStateBounds(initialStateIndex, explorationInformation);
+            STORM_LOG_DEBUG("Difference after iteration " << stats.pathsSampled << " is " << difference << ".");
+            convergenceCriterionMet = comparator.isZero(difference);
+        }
+
+        if (convergenceCriterionMet) {
+            synchronization.finish();
+        } else if (explorationInformation.performPrecomputationExcessiveSampledPaths(stats.pathsSampledSinceLastPrecomputation)) {
+            // If the number of sampled paths exceeds a certain threshold, do a precomputation.
+            performPrecomputation(stack, explorationInformation, bounds, synchronization, stats);
+        }
+    }
+}
+
 template<typename ModelType, typename StateType>
 bool SparseExplorationModelChecker<ModelType, StateType>::samplePathFromInitialState(StateGeneration<StateType, ValueType>& stateGeneration,
                                                                                      ExplorationInformation<StateType, ValueType>& explorationInformation,
                                                                                      StateActionStack& stack, Bounds<StateType, ValueType>& bounds,
+                                                                                     Synchronization& synchronization,
+                                                                                     std::default_random_engine& randomGenerator,
                                                                                      Statistics<StateType, ValueType>& stats) const {
     // Start the search from the initial state.
     stack.push_back(std::make_pair(stateGeneration.getFirstInitialState(), 0));
@@ -152,23 +230,38 @@ bool SparseExplorationModelChecker<ModelType, StateType>::samplePathFromInitialS
     // As long as we didn't find a terminal (accepting or rejecting) state in the search, sample a new successor.
     bool foundTerminalState = false;
     while (!foundTerminalState) {
-        StateType const& currentStateId = stack.back().first;
+        StateType currentStateId = stack.back().first;
         STORM_LOG_TRACE("State on top of stack is: " << currentStateId << ".");
 
         // If the state is not yet explored, we need to retrieve its behaviors.
-        auto unexploredIt = explorationInformation.findUnexploredState(currentStateId);
-        if (unexploredIt != explorationInformation.unexploredStatesEnd()) {
+        bool unexplored;
+        {
+            auto lock = synchronization.lockForReading();
+            unexplored = explorationInformation.isUnexplored(currentStateId);
+        }
+        if (unexplored) {
+            // Take the state from the unexplored states, so no other thread explores it at the same time.
+            storm::generator::CompressedState compressedState;
+            {
+                auto lock = synchronization.lockForWriting();
+                auto unexploredIt = explorationInformation.findUnexploredState(currentStateId);
+                if (unexploredIt == explorationInformation.unexploredStatesEnd()) {
+                    STORM_LOG_TRACE("Aborting sampling of path, because another thread is exploring state " << currentStateId << ".");
+                    return false;
+                }
+                compressedState = unexploredIt->second;
+                explorationInformation.removeUnexploredState(unexploredIt);
+            }
             STORM_LOG_TRACE("State was not yet explored.");
 
             // Explore the previously unexplored state.
-            storm::generator::CompressedState const& compressedState = unexploredIt->second;
-            foundTerminalState = exploreState(stateGeneration, currentStateId, compressedState, explorationInformation, bounds, stats);
+            foundTerminalState = exploreState(stateGeneration, currentStateId, compressedState, explorationInformation, bounds, synchronization, stats);
             if (foundTerminalState) {
                 STORM_LOG_TRACE("Aborting sampling of path, because a terminal state was reached.");
             }
-            explorationInformation.removeUnexploredState(unexploredIt);
         } else {
             // If the state was already explored, we check whether it is a terminal state or not.
+            auto lock = synchronization.lockForReading();
             if (explorationInformation.isTerminal(currentStateId)) {
                 STORM_LOG_TRACE("Found already explored terminal state: " << currentStateId << ".");
                 foundTerminalState = true;
@@ -182,19 +275,23 @@ bool SparseExplorationModelChecker<ModelType, StateType>::samplePathFromInitialS
         if (!foundTerminalState) {
             // At this point, we can be sure that the state was expanded and that we can sample according to the
             // probabilities in the matrix.
-            uint32_t chosenAction = sampleActionOfState(currentStateId, explorationInformation, bounds);
-            stack.back().second = chosenAction;
-            STORM_LOG_TRACE("Sampled action " << chosenAction << " in state " << currentStateId << ".");
-
-            StateType successor = sampleSuccessorFromAction(chosenAction, explorationInformation, bounds);
-            STORM_LOG_TRACE("Sampled successor " << successor << " according to action " << chosenAction << " of state " << currentStateId << ".");
+            StateType successor;
+            {
+                auto lock = synchronization.lockForReading();
+                uint32_t chosenAction = sampleActionOfState(currentStateId, explorationInformation, bounds, randomGenerator);
+                stack.back().second = chosenAction;
+                STORM_LOG_TRACE("Sampled action " << chosenAction << " in state " << currentStateId << ".");
+
+                successor = sampleSuccessorFromAction(chosenAction, explorationInformation, bounds, randomGenerator);
+                STORM_LOG_TRACE("Sampled successor " << successor << " according to action " << chosenAction << " of state " << currentStateId << ".");
+            }
 
             // Put the successor state and a dummy action on top of the stack.
             stack.emplace_back(successor, 0);
 
             // If the number of exploration steps exceeds a certain threshold, do a precomputation.
             if (explorationInformation.performPrecomputationExcessiveExplorationSteps(stats.explorationStepsSinceLastPrecomputation)) {
-                performPrecomputation(stack, explorationInformation, bounds, stats);
+                performPrecomputation(stack, explorationInformation, bounds, synchronization, stats);
 
                 STORM_LOG_TRACE("Aborting the search after precomputation.");
                 stack.clear();
@@ -210,34 +307,47 @@ template<typename ModelType, typename StateType>
 bool SparseExplorationModelChecker<ModelType, StateType>::exploreState(StateGeneration<StateType, ValueType>& stateGeneration, StateType const& currentStateId,
                                                                        storm::generator::CompressedState const& currentState,
                                                                        ExplorationInformation<StateType, ValueType>& explorationInformation,
-                                                                       Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats) const {
+                                                                       Bounds<StateType, ValueType>& bounds, Synchronization& synchronization,
+                                                                       Statistics<StateType, ValueType>& stats) const {
     bool isTerminalState = false;
     bool isTargetState = false;
 
     ++stats.numberOfExploredStates;
 
-    // Finally, map the unexplored state to the row group.
-    explorationInformation.assignStateToNextRowGroup(currentStateId);
-    STORM_LOG_TRACE("Assigning row group " << explorationInformation.getRowGroup(currentStateId) << " to state " << currentStateId << ".");
-
-    // Initialize the bounds, because some of the following computations depend on the values to be available for
-    // all states that have been assigned to a row-group.
-    bounds.initializeBoundsForNextState();
-
     // Before generating the behavior of the state, we need to determine whether it's a target state that
-    // does not need to be expanded.
+    // does not need to be expanded. The generation does not access the shared information (other than for registering
+    // new states), so other threads may continue meanwhile.
     stateGeneration.load(currentState);
+    bool isConditionState = false;
+    storm::generator::StateBehavior<ValueType, StateType> behavior;
     if (stateGeneration.isTargetState()) {
         ++stats.numberOfTargetStates;
         isTargetState = true;
         isTerminalState = true;
     } else if (stateGeneration.isConditionState()) {
         STORM_LOG_TRACE("Exploring state.");
+        isConditionState = true;
 
         // If it needs to be expanded, we use the generator to retrieve the behavior of the new state.
-        storm::generator::StateBehavior<ValueType, StateType> behavior = stateGeneration.expand();
+        behavior = stateGeneration.expand();
         STORM_LOG_TRACE("State has " << behavior.getNumberOfChoices() << " choices.");
+    } else {
+        // In this case, the state is neither a target state nor a condition state and therefore a rejecting
+        // terminal state.
+        isTerminalState = true;
+    }
+
+    auto lock = synchronization.lockForWriting();
+
+    // Finally, map the unexplored state to the row group.
+    explorationInformation.assignStateToNextRowGroup(currentStateId);
+    STORM_LOG_TRACE("Assigning row group " << explorationInformation.getRowGroup(currentStateId) << " to state " << currentStateId << ".");
 
+    // Initialize the bounds, because some of the following computations depend on the values to be available for
+    // all states that have been assigned to a row-group.
+    bounds.initializeBoundsForNextState();
+
+    if (isConditionState) {
         // Clumsily check whether we have found a state that forms a trivial BMEC.
         bool otherSuccessor = false;
         for (auto const& choice : behavior) {
@@ -287,10 +397,6 @@ bool SparseExplorationModelChecker<ModelType, StateType>::exploreState(StateGene
             STORM_LOG_TRACE("Initializing bounds of state " << currentStateId << " to " << bounds.getLowerBoundForState(currentStateId, explorationInformation)
                                                             << " and " << bounds.getUpperBoundForState(currentStateId, explorationInformation) << ".");
         }
-    } else {
-        // In this case, the state is neither a target state nor a condition state and therefore a rejecting
-        // terminal state.
-        isTerminalState = true;
     }
 
     if (isTerminalState) {
@@ -319,7 +425,8 @@ bool SparseExplorationModelChecker<ModelType, StateType>::exploreState(StateGene
 
 template<typename ModelType, typename StateType>
 typename SparseExplorationModelChecker<ModelType, StateType>::ActionType SparseExplorationModelChecker<ModelType, StateType>::sampleActionOfState(
-    StateType const& currentStateId, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType>& bounds) const {
+    StateType const& currentStateId, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType>& bounds,
+    std::default_random_engine& randomGenerator) const {
     // Determine the values of all available actions.
     std::vector<std::pair<ActionType, ValueType>> actionValues;
     StateType rowGroup = explorationInformation.getRowGroup(currentStateId);
@@ -361,7 +468,7 @@ typename SparseExplorationModelChecker<ModelType, StateType>::ActionType SparseE
 template<typename ModelType, typename StateType>
 StateType SparseExplorationModelChecker<ModelType, StateType>::sampleSuccessorFromAction(
     ActionType const& chosenAction, ExplorationInformation<StateType, ValueType> const& explorationInformation,
-    Bounds<StateType, ValueType> const& bounds) const {
+    Bounds<StateType, ValueType> const& bounds, std::default_random_engine& randomGenerator) const {
     std::vector<storm::storage::MatrixEntry<StateType, ValueType>> const& row = explorationInformation.getRowOfMatrix(chosenAction);
     if (row.size() == 1) {
         return row.front().getColumn();
@@ -393,8 +500,13 @@ StateType SparseExplorationModelChecker<ModelType, StateType>::sampleSuccessorFr
 template<typename ModelType, typename StateType>
 bool SparseExplorationModelChecker<ModelType, StateType>::performPrecomputation(StateActionStack const& stack,
                                                                                 ExplorationInformation<StateType, ValueType>& explorationInformation,
-                                                                                Bounds<StateType, ValueType>& bounds,
+                                                                                Bounds<StateType, ValueType>& bounds, Synchronization& synchronization,
                                                                                 Statistics<StateType, ValueType>& stats) const {
+    // Only one thread performs a precomputation at a time, while the other threads continue sampling.
+    if (!synchronization.tryStartPrecomputation()) {
+        STORM_LOG_TRACE("Skipping precomputation, because another thread is performing one.");
+        return false;
+    }
     ++stats.numberOfPrecomputations;
 
     // Outline:
@@ -404,66 +516,79 @@ bool SparseExplorationModelChecker<ModelType, StateType>::performPrecomputation(
     STORM_LOG_TRACE("Starting " << (explorationInformation.useLocalPrecomputation() ? "local" : "global") << " precomputation.");
 
     // Construct the matrix that represents the fragment of the system contained in the currently sampled path.
+    // Other threads may modify the shared information while the matrix is analyzed, so the number of collapsed MECs
+    // is recorded to check whether the actions of the matrix are still valid afterwards.
     storm::storage::SparseMatrixBuilder<ValueType> builder(0, 0, 0, false, true, 0);
-
-    // Determine the set of states that was expanded.
     std::vector<StateType> relevantStates;
-    if (explorationInformation.useLocalPrecomputation()) {
-        for (auto const& stateActionPair : stack) {
-            if (explorationInformation.maximize() || !storm::utility::isOne(bounds.getLowerBoundForState(stateActionPair.first, explorationInformation))) {
-                relevantStates.push_back(stateActionPair.first);
+    StateType sink;
+    storm::storage::BitVector targetStates;
+    uint64_t numberOfCollapsesBeforePrecomputation;
+    {
+        auto lock = synchronization.lockForReading();
+        numberOfCollapsesBeforePrecomputation = synchronization.getNumberOfCollapses();
+
+        // Determine the set of states that was expanded.
+        if (explorationInformation.useLocalPrecomputation()) {
+            for (auto const& stateActionPair : stack) {
+                // The last state on the stack may not have been explored yet.
+                if (explorationInformation.isUnexplored(stateActionPair.first)) {
+                    continue;
+                }
+                if (explorationInformation.maximize() || !storm::utility::isOne(bounds.getLowerBoundForState(stateActionPair.first, explorationInformation))) {
+                    relevantStates.push_back(stateActionPair.first);
+                }
             }
-        }
-        std::sort(relevantStates.begin(), relevantStates.end());
-        auto newEnd = std::unique(relevantStates.begin(), relevantStates.end());
-        relevantStates.resize(std::distance(relevantStates.begin(), newEnd));
-    } else {
-        for (StateType state = 0; state < explorationInformation.getNumberOfDiscoveredStates(); ++state) {
-            // Add the state to the relevant states if they are not unexplored.
-            if (!explorationInformation.isUnexplored(state)) {
-                relevantStates.push_back(state);
+            std::sort(relevantStates.begin(), relevantStates.end());
+            auto newEnd = std::unique(relevantStates.begin(), relevantStates.end());
+            relevantStates.resize(std::distance(relevantStates.begin(), newEnd));
+        } else {
+            for (StateType state = 0; state < explorationInformation.getNumberOfDiscoveredStates(); ++state) {
+                // Add the state to the relevant states if they are not unexplored.
+                if (!explorationInformation.isUnexplored(state)) {
+                    relevantStates.push_back(state);
+                }
             }
         }
-    }
-    StateType sink = relevantStates.size();
-
-    // Create a mapping for faster look-up during the translation of flexible matrix to the real sparse matrix.
-    // While doing so, record all target states.
-    std::unordered_map<StateType, StateType> relevantStateToNewRowGroupMapping;
-    storm::storage::BitVector targetStates(sink + 1);
-    for (StateType index = 0; index < relevantStates.size(); ++index) {
-        relevantStateToNewRowGroupMapping.emplace(relevantStates[index], index);
-        if (storm::utility::isOne(bounds.getLowerBoundForState(relevantStates[index], explorationInformation))) {
-            targetStates.set(index);
+        sink = relevantStates.size();
+
+        // Create a mapping for faster look-up during the translation of flexible matrix to the real sparse matrix.
+        // While doing so, record all target states.
+        std::unordered_map<StateType, StateType> relevantStateToNewRowGroupMapping;
+        targetStates = storm::storage::BitVector(sink + 1);
+        for (StateType index = 0; index < relevantStates.size(); ++index) {
+            relevantStateToNewRowGroupMapping.emplace(relevantStates[index], index);
+            if (storm::utility::isOne(bounds.getLowerBoundForState(relevantStates[index], explorationInformation))) {
+                targetStates.set(index);
+            }
         }
-    }
 
-    // Do the actual translation.
-    StateType currentRow = 0;
-    for (auto const& state : relevantStates) {
-        builder.newRowGroup(currentRow);
-        StateType rowGroup = explorationInformation.getRowGroup(state);
-        for (auto row = explorationInformation.getStartRowOfGroup(rowGroup); row < explorationInformation.getStartRowOfGroup(rowGroup + 1); ++row) {
-            ValueType unexpandedProbability = storm::utility::zero<ValueType>();
-            for (auto const& entry : explorationInformation.getRowOfMatrix(row)) {
-                auto it = relevantStateToNewRowGroupMapping.find(entry.getColumn());
-                if (it != relevantStateToNewRowGroupMapping.end()) {
-                    // If the entry is a relevant state, we copy it over (and compensate for the offset change).
-                    builder.addNextValue(currentRow, it->second, entry.getValue());
-                } else {
-                    // If the entry is an unexpanded state, we gather the probability to later redirect it to an unexpanded sink.
-                    unexpandedProbability += entry.getValue();
+        // Do the actual translation.
+        StateType currentRow = 0;
+        for (auto const& state : relevantStates) {
+            builder.newRowGroup(currentRow);
+            StateType rowGroup = explorationInformation.getRowGroup(state);
+            for (auto row = explorationInformation.getStartRowOfGroup(rowGroup); row < explorationInformation.getStartRowOfGroup(rowGroup + 1); ++row) {
+                ValueType unexpandedProbability = storm::utility::zero<ValueType>();
+                for (auto const& entry : explorationInformation.getRowOfMatrix(row)) {
+                    auto it = relevantStateToNewRowGroupMapping.find(entry.getColumn());
+                    if (it != relevantStateToNewRowGroupMapping.end()) {
+                        // If the entry is a relevant state, we copy it over (and compensate for the offset change).
+                        builder.addNextValue(currentRow, it->second, entry.getValue());
+                    } else {
+                        // If the entry is an unexpanded state, we gather the probability to later redirect it to an unexpanded sink.
+                        unexpandedProbability += entry.getValue();
+                    }
                 }
+                if (unexpandedProbability != storm::utility::zero<ValueType>()) {
+                    builder.addNextValue(currentRow, sink, unexpandedProbability);
+                }
+                ++currentRow;
             }
-            if (unexpandedProbability != storm::utility::zero<ValueType>()) {
-                builder.addNextValue(currentRow, sink, unexpandedProbability);
-            }
-            ++currentRow;
         }
+        // Then, make the unexpanded state absorbing.
+        builder.newRowGroup(currentRow);
+        builder.addNextValue(currentRow, sink, storm::utility::one<ValueType>());
     }
-    // Then, make the unexpanded state absorbing.
-    builder.newRowGroup(currentRow);
-    builder.addNextValue(currentRow, sink, storm::utility::one<ValueType>());
     storm::storage::SparseMatrix<ValueType> relevantStatesMatrix = builder.build();
     storm::storage::SparseMatrix<ValueType> transposedMatrix = relevantStatesMatrix.transpose(true);
     STORM_LOG_TRACE("Successfully built matrix for precomputation.");
@@ -471,6 +596,7 @@ bool SparseExplorationModelChecker<ModelType, StateType>::performPrecomputation(
     storm::storage::BitVector allStates(sink + 1, true);
     storm::storage::BitVector statesWithProbability0;
     storm::storage::BitVector statesWithProbability1;
+    storm::storage::MaximalEndComponentDecomposition<ValueType> mecDecomposition;
     if (explorationInformation.maximize()) {
         // If we are computing maximal probabilities, we first perform a detection of states that have
         // probability 01 and then additionally perform an MEC decomposition. The reason for this somewhat
@@ -483,7 +609,7 @@ bool SparseExplorationModelChecker<ModelType, StateType>::performPrecomputation(
         statesWithProbability1 =
             storm::utility::graph::performProb1E(relevantStatesMatrix, relevantStatesMatrix.getRowGroupIndices(), transposedMatrix, allStates, targetStates);
 
-        storm::storage::MaximalEndComponentDecomposition<ValueType> mecDecomposition(relevantStatesMatrix, relevantStatesMatrix.transpose(true));
+        mecDecomposition = storm::storage::MaximalEndComponentDecomposition<ValueType>(relevantStatesMatrix, transposedMatrix);
         ++stats.ecDetections;
         STORM_LOG_TRACE("Successfully computed MEC decomposition. Found " << (mecDecomposition.size() > 1 ? (mecDecomposition.size() - 1) : 0) << " MEC(s).");
 
@@ -493,16 +619,6 @@ bool SparseExplorationModelChecker<ModelType, StateType>::performPrecomputation(
             ++stats.failedEcDetections;
         } else {
             stats.totalNumberOfEcDetected += mecDecomposition.size() - 1;
-
-            // 3. Analyze the MEC decomposition.
-            for (auto const& mec : mecDecomposition) {
-                // Ignore the (expected) MEC of the sink state.
-                if (mec.containsState(sink)) {
-                    continue;
-                }
-
-                collapseMec(mec, relevantStates, relevantStatesMatrix, explorationInformation, bounds);
-            }
         }
     } else {
         // If we are computing minimal probabilities, we do not need to perform an EC-detection. We rather
@@ -517,7 +633,22 @@ bool SparseExplorationModelChecker<ModelType, StateType>::performPrecomputation(
             storm::utility::graph::performProb1A(relevantStatesMatrix, relevantStatesMatrix.getRowGroupIndices(), transposedMatrix, allStates, targetStates);
     }
 
-    // Set the bounds of the identified states.
+    auto lock = synchronization.lockForWriting();
+
+    // 3. Analyze the MEC decomposition. If another thread collapsed a MEC in the meantime, the actions of the MECs may
+    // have been moved, so they are not collapsed.
+    if (mecDecomposition.size() > 1 && synchronization.getNumberOfCollapses() == numberOfCollapsesBeforePrecomputation) {
+        for (auto const& mec : mecDecomposition) {
+            // Ignore the (expected) MEC of the sink state.
+            if (mec.containsState(sink)) {
+                continue;
+            }
+
+            collapseMec(mec, relevantStates, relevantStatesMatrix, explorationInformation, bounds, synchronization);
+        }
+    }
+
+    // Set the bounds of the identified states. These remain valid even if the explored fragment changed meanwhile.
     STORM_LOG_ASSERT((statesWithProbability0 & statesWithProbability1).empty(), "States with probability 0 and 1 overlap.");
     for (auto state : statesWithProbability0) {
         // Skip the sink state as it is not contained in the original system.
@@ -539,6 +670,7 @@ bool SparseExplorationModelChecker<ModelType, StateType>::performPrecomputation(
         bounds.setLowerBoundForState(originalState, explorationInformation, storm::utility::one<ValueType>());
         explorationInformation.addTerminalState(originalState);
     }
+    synchronization.finishPrecomputation();
     return true;
 }
 
@@ -547,7 +679,7 @@ void SparseExplorationModelChecker<ModelType, StateType>::collapseMec(storm::sto
                                                                       std::vector<StateType> const& relevantStates,
                                                                       storm::storage::SparseMatrix<ValueType> const& relevantStatesMatrix,
                                                                       ExplorationInformation<StateType, ValueType>& explorationInformation,
-                                                                      Bounds<StateType, ValueType>& bounds) const {
+                                                                      Bounds<StateType, ValueType>& bounds, Synchronization& synchronization) const {
     bool containsTargetState = false;
 
     // Now we record all actions leaving the EC.
@@ -616,6 +748,7 @@ void SparseExplorationModelChecker<ModelType, StateType>::collapseMec(storm::sto
 
         // Terminate the row group of the newly introduced state.
         explorationInformation.terminateCurrentRowGroup();
+        synchronization.collapsedMec();
     }
 }
 
@@ -1,11 +1,12 @@
 #ifndef STORM_MODELCHECKER_EXPLORATION_SPARSEEXPLORATIONMODELCHECKER_H_
 #define STORM_MODELCHECKER_EXPLORATION_SPARSEEXPLORATIONMODELCHECKER_H_
 
+#include <map>
 #include <random>
 
 #include "storm/modelchecker/AbstractModelChecker.h"
 
-#include "storm/storage/prism/Program.h"
+#include "storm/storage/SymbolicModelDescription.h"
 
 #include "storm/generator/CompressedState.h"
 #include "storm/generator/VariableInformation.h"
@@ -21,10 +22,6 @@ class MaximalEndComponent;
 template<typename V>
 class SparseMatrix;
 }  // namespace storage
-namespace prism {
-class Program;
-}
-
 namespace modelchecker {
 namespace exploration_detail {
 template<typename StateType, typename ValueType>
@@ -35,10 +32,16 @@ template<typename StateType, typename ValueType>
 class Bounds;
 template<typename StateType, typename ValueType>
 struct Statistics;
+class Synchronization;
 }  // namespace exploration_detail
 
 using namespace exploration_detail;
 
+/*!
+ * A model checker that computes reachability probabilities by sampling paths and only exploring the states that are visited (BRTDP).
+ *
+ * If several threads are selected in the exploration settings, they sample paths concurrently and share the explored states and their bounds.
+ */
 template<typename ModelType, typename StateType = uint32_t>
 class SparseExplorationModelChecker : public AbstractModelChecker<ModelType> {
    public:
@@ -46,7 +49,12 @@ class SparseExplorationModelChecker : public AbstractModelChecker<ModelType> {
     typedef StateType ActionType;
     typedef std::vector<std::pair<StateType, ActionType>> StateActionStack;
 
-    SparseExplorationModelChecker(storm::prism::Program const& program);
+    SparseExplorationModelChecker(storm::storage::SymbolicModelDescription const& model);
+
+    /*!
+     * Creates a model checker whose given number of threads sample paths (instead of the number of threads selected in the settings).
+     */
+    SparseExplorationModelChecker(storm::storage::SymbolicModelDescription const& model, uint_fast64_t numberOfThreads);
 
     static bool canHandleStatic(CheckTask<storm::logic::Formula, ValueType> const& checkTask);
 
@@ -57,28 +65,38 @@ class SparseExplorationModelChecker : public AbstractModelChecker<ModelType> {
 
    private:
     std::tuple<StateType, ValueType, ValueType> performExploration(StateGeneration<StateType, ValueType>& stateGeneration,
-                                                                   ExplorationInformation<StateType, ValueType>& explorationInformation) const;
+                                                                   ExplorationInformation<StateType, ValueType>& explorationInformation,
+                                                                   Synchronization& synchronization) const;
+
+    /*!
+     * Samples paths until the bounds of the initial state have converged or another thread signals to stop. This is executed by every sampling
+     * thread with its own state generation, random generator and statistics.
+     */
+    void samplePaths(StateGeneration<StateType, ValueType>& stateGeneration, ExplorationInformation<StateType, ValueType>& explorationInformation,
+                     Bounds<StateType, ValueType>& bounds, Synchronization& synchronization, std::default_random_engine& randomGenerator,
+                     Statistics<StateType, ValueType>& stats) const;
 
     bool samplePathFromInitialState(StateGeneration<StateType, ValueType>& stateGeneration,
                                     ExplorationInformation<StateType, ValueType>& explorationInformation, StateActionStack& stack,
-                                    Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats) const;
+                                    Bounds<StateType, ValueType>& bounds, Synchronization& synchronization, std::default_random_engine& randomGenerator,
+                                    Statistics<StateType, ValueType>& stats) const;
 
     bool exploreState(StateGeneration<StateType, ValueType>& stateGeneration, StateType const& currentStateId,
                       storm::generator::CompressedState const& currentState, ExplorationInformation<StateType, ValueType>& explorationInformation,
-                      Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats) const;
+                      Bounds<StateType, ValueType>& bounds, Synchronization& synchronization, Statistics<StateType, ValueType>& stats) const;
 
     ActionType sampleActionOfState(StateType const& currentStateId, ExplorationInformation<StateType, ValueType> const& explorationInformation,
-                                   Bounds<StateType, ValueType>& bounds) const;
+                                   Bounds<StateType, ValueType>& bounds, std::default_random_engine& randomGenerator) const;
 
     StateType sampleSuccessorFromAction(ActionType const& chosenAction, ExplorationInformation<StateType, ValueType> const& explorationInformation,
-                                        Bounds<StateType, ValueType> const& bounds) const;
+                                        Bounds<StateType, ValueType> const& bounds, std::default_random_engine& randomGenerator) const;
 
     bool performPrecomputation(StateActionStack const& stack, ExplorationInformation<StateType, ValueType>& explorationInformation,
-                               Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats) const;
+                               Bounds<StateType, ValueType>& bounds, Synchronization& synchronization, Statistics<StateType, ValueType>& stats) const;
 
     void collapseMec(storm::storage::MaximalEndComponent const& mec, std::vector<StateType> const& relevantStates,
                      storm::storage::SparseMatrix<ValueType> const& relevantStatesMatrix, ExplorationInformation<StateType, ValueType>& explorationInformation,
-                     Bounds<StateType, ValueType>& bounds) const;
+                     Bounds<StateType, ValueType>& bounds, Synchronization& synchronization) const;
 
     void updateProbabilityBoundsAlongSampledPath(StateActionStack& stack, ExplorationInformation<StateType, ValueType> const& explorationInformation,
                                                  Bounds<StateType, ValueType>& bounds) const;
@@ -104,10 +122,16 @@ class SparseExplorationModelChecker : public AbstractModelChecker<ModelType> {
     std::pair<ValueType, ValueType> combineBounds(storm::OptimizationDirection const& direction, std::pair<ValueType, ValueType> const& bounds1,
                                                   std::pair<ValueType, ValueType> const& bounds2) const;
 
-    // The program that defines the model to check.
-    storm::prism::Program program;
+    // The PRISM program or JANI model that defines the model to check.
+    storm::storage::SymbolicModelDescription model;
+
+    // The expressions that define the labels of the model.
+    std::map<std::string, storm::expressions::Expression> labelToExpressionMapping;
+
+    // The number of threads that sample paths.
+    uint_fast64_t numberOfThreads;
 
-    // The random number generator.
+    // The random number generator. If several threads sample paths, it is only used to seed the generators of the threads.
     mutable std::default_random_engine randomGenerator;
 
     // A comparator used to determine whether values are equal.
@@ -1,73 +1,107 @@
 #include "storm/modelchecker/exploration/StateGeneration.h"
 #include "storm/storage/expressions/ExpressionEvaluator.h"
 
+#include "storm/generator/JaniNextStateGenerator.h"
+#include "storm/generator/PrismNextStateGenerator.h"
+
 #include "storm/modelchecker/exploration/ExplorationInformation.h"
+#include "storm/modelchecker/exploration/Synchronization.h"
 
 namespace storm {
 namespace modelchecker {
 namespace exploration_detail {
 
 template<typename StateType, typename ValueType>
-StateGeneration<StateType, ValueType>::StateGeneration(storm::prism::Program const& program,
+StateGeneration<StateType, ValueType>::StateGeneration(storm::storage::SymbolicModelDescription const& model,
                                                        ExplorationInformation<StateType, ValueType>& explorationInformation,
-                                                       storm::expressions::Expression const& conditionStateExpression,
+                                                       Synchronization& synchronization, storm::expressions::Expression const& conditionStateExpression,
                                                        storm::expressions::Expression const& targetStateExpression)
-    : generator(program),
-      stateStorage(generator.getStateSize()),
+    : StateGeneration(model, explorationInformation, synchronization, conditionStateExpression, targetStateExpression, nullptr) {
+    // Intentionally left empty.
+}
+
+template<typename StateType, typename ValueType>
+StateGeneration<StateType, ValueType>::StateGeneration(storm::storage::SymbolicModelDescription const& model,
+                                                       ExplorationInformation<StateType, ValueType>& explorationInformation,
+                                                       Synchronization& synchronization, storm::expressions::Expression const& conditionStateExpression,
+                                                       storm::expressions::Expression const& targetStateExpression,
+                                                       std::shared_ptr<storm::storage::sparse::StateStorage<StateType>> stateStorage)
+    : model(model),
+      explorationInformation(explorationInformation),
+      synchronization(synchronization),
+      stateStorage(stateStorage),
       conditionStateExpression(conditionStateExpression),
       targetStateExpression(targetStateExpression) {
-    stateToIdCallback = [&explorationInformation, this](storm::generator::CompressedState const& state) -> StateType {
-        StateType newIndex = stateStorage.getNumberOfStates();
+    if (model.isPrismProgram()) {
+        generator = std::make_unique<storm::generator::PrismNextStateGenerator<ValueType, StateType>>(model.asPrismProgram());
+    } else {
+        generator = std::make_unique<storm::generator::JaniNextStateGenerator<ValueType, StateType>>(model.asJaniModel());
+    }
+    if (!this->stateStorage) {
+        this->stateStorage = std::make_shared<storm::storage::sparse::StateStorage<StateType>>(generator->getStateSize());
+    }
+
+    stateToIdCallback = [this](storm::generator::CompressedState const& state) -> StateType {
+        auto stateStorageLock = this->synchronization.lockStateStorage();
+        StateType newIndex = this->stateStorage->getNumberOfStates();
 
         // Check, if the state was already registered.
-        std::pair<StateType, std::size_t> actualIndexBucketPair = stateStorage.stateToId.findOrAddAndGetBucket(state, newIndex);
+        std::pair<StateType, std::size_t> actualIndexBucketPair = this->stateStorage->stateToId.findOrAddAndGetBucket(state, newIndex);
 
         if (actualIndexBucketPair.first == newIndex) {
-            explorationInformation.addUnexploredState(newIndex, state);
+            // New states must be registered in the order of their indices, so this happens while the storage is still locked.
+            auto explorationLock = this->synchronization.lockForWriting();
+            this->explorationInformation.addUnexploredState(newIndex, state);
         }
 
         return actualIndexBucketPair.first;
     };
 }
 
+template<typename StateType, typename ValueType>
+std::unique_ptr<StateGeneration<StateType, ValueType>> StateGeneration<StateType, ValueType>::createSharingStates() const {
+    return std::unique_ptr<StateGeneration<StateType, ValueType>>(new StateGeneration<StateType, ValueType>(
+        model, explorationInformation, synchronization, conditionStateExpression, targetStateExpression, stateStorage));
+}
+
 template<typename StateType, typename ValueType>
 void StateGeneration<StateType, ValueType>::load(storm::generator::CompressedState const& state) {
-    generator.load(state);
+    generator->load(state);
 }
 
 template<typename StateType, typename ValueType>
 std::vector<StateType> StateGeneration<StateType, ValueType>::getInitialStates() {
-    return stateStorage.initialStateIndices;
+    return stateStorage->initialStateIndices;
 }
 
 template<typename StateType, typename ValueType>
 storm::generator::StateBehavior<ValueType, StateType> StateGeneration<StateType, ValueType>::expand() {
-    return generator.expand(stateToIdCallback);
+    return generator->expand(stateToIdCallback);
 }
 
 template<typename StateType, typename ValueType>
 bool StateGeneration<StateType, ValueType>::isConditionState() const {
-    return generator.satisfies(conditionStateExpression);
+    return generator->satisfies(conditionStateExpression);
 }
 
 template<typename StateType, typename ValueType>
 bool StateGeneration<StateType, ValueType>::isTargetState() const {
-    return generator.satisfies(targetStateExpression);
+    return generator->satisfies(targetStateExpression);
 }
 
 template<typename StateType, typename ValueType>
 void StateGeneration<StateType, ValueType>::computeInitialStates() {
-    stateStorage.initialStateIndices = generator.getInitialStates(stateToIdCallback);
+    stateStorage->initialStateIndices = generator->getInitialStates(stateToIdCallback);
 }
 
 template<typename StateType, typename ValueType>
 StateType StateGeneration<StateType, ValueType>::getFirstInitialState() const {
-    return stateStorage.initialStateIndices.front();
+    return stateStorage->initialStateIndices.front();
 }
 
 template<typename StateType, typename ValueType>
 std::size_t StateGeneration<StateType, ValueType>::getNumberOfInitialStates() const {
-    return stateStorage.initialStateIndices.size();
+    return stateStorage->initialStateIndices.size();
 }
 
 template class StateGeneration<uint32_t, double>;
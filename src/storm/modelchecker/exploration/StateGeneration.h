@@ -1,28 +1,34 @@
 #ifndef STORM_MODELCHECKER_EXPLORATION_EXPLORATION_DETAIL_STATEGENERATION_H_
 #define STORM_MODELCHECKER_EXPLORATION_EXPLORATION_DETAIL_STATEGENERATION_H_
 
+#include <memory>
+
 #include "storm/generator/CompressedState.h"
-#include "storm/generator/PrismNextStateGenerator.h"
+#include "storm/generator/NextStateGenerator.h"
 
+#include "storm/storage/SymbolicModelDescription.h"
 #include "storm/storage/sparse/StateStorage.h"
 
 namespace storm {
-namespace generator {
-template<typename ValueType, typename StateType>
-class PrismNextStateGenerator;
-}
-
 namespace modelchecker {
 namespace exploration_detail {
 
 template<typename StateType, typename ValueType>
 class ExplorationInformation;
+class Synchronization;
 
 template<typename StateType, typename ValueType>
 class StateGeneration {
    public:
-    StateGeneration(storm::prism::Program const& program, ExplorationInformation<StateType, ValueType>& explorationInformation,
-                    storm::expressions::Expression const& conditionStateExpression, storm::expressions::Expression const& targetStateExpression);
+    StateGeneration(storm::storage::SymbolicModelDescription const& model, ExplorationInformation<StateType, ValueType>& explorationInformation,
+                    Synchronization& synchronization, storm::expressions::Expression const& conditionStateExpression,
+                    storm::expressions::Expression const& targetStateExpression);
+
+    /*!
+     * Creates a state generation with its own generator that shares the discovered states with this one. This way, several threads can expand
+     * states at the same time.
+     */
+    std::unique_ptr<StateGeneration<StateType, ValueType>> createSharingStates() const;
 
     void load(storm::generator::CompressedState const& state);
 
@@ -41,10 +47,18 @@ class StateGeneration {
     bool isTargetState() const;
 
    private:
-    storm::generator::PrismNextStateGenerator<ValueType, StateType> generator;
+    StateGeneration(storm::storage::SymbolicModelDescription const& model, ExplorationInformation<StateType, ValueType>& explorationInformation,
+                    Synchronization& synchronization, storm::expressions::Expression const& conditionStateExpression,
+                    storm::expressions::Expression const& targetStateExpression, std::shared_ptr<storm::storage::sparse::StateStorage<StateType>> stateStorage);
+
+    storm::storage::SymbolicModelDescription model;
+    ExplorationInformation<StateType, ValueType>& explorationInformation;
+    Synchronization& synchronization;
+
+    std::unique_ptr<storm::generator::NextStateGenerator<ValueType, StateType>> generator;
     std::function<StateType(storm::generator::CompressedState const&)> stateToIdCallback;
 
-    storm::storage::sparse::StateStorage<StateType> stateStorage;
+    std::shared_ptr<storm::storage::sparse::StateStorage<StateType>> stateStorage;
 
     storm::expressions::Expression conditionStateExpression;
     storm::expressions::Expression targetStateExpression;
@@ -22,6 +22,9 @@ struct Statistics {
 
     void updateMaxPathLength(std::size_t const& currentPathLength);
 
+    // Adds the statistics gathered by another thread.
+    void add(Statistics<StateType, ValueType> const& other);
+
     void printToStream(std::ostream& out, ExplorationInformation<StateType, ValueType> const& explorationInformation) const;
 
     std::size_t pathsSampled;
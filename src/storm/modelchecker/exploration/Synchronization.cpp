@@ -0,0 +1,63 @@
+#include "storm/modelchecker/exploration/Synchronization.h"
+
+namespace storm {
+namespace modelchecker {
+namespace exploration_detail {
+
+Synchronization::Synchronization(bool concurrent) : concurrent(concurrent), numberOfCollapses(0), precomputationRunning(false), finished(false) {
+    // Intentionally left empty.
+}
+
+bool Synchronization::isConcurrent() const {
+    return concurrent;
+}
+
+std::shared_lock<std::shared_mutex> Synchronization::lockForReading() {
+    if (concurrent) {
+        return std::shared_lock<std::shared_mutex>(explorationMutex);
+    }
+    return std::shared_lock<std::shared_mutex>(explorationMutex, std::defer_lock);
+}
+
+std::unique_lock<std::shared_mutex> Synchronization::lockForWriting() {
+    if (concurrent) {
+        return std::unique_lock<std::shared_mutex>(explorationMutex);
+    }
+    return std::unique_lock<std::shared_mutex>(explorationMutex, std::defer_lock);
+}
+
+std::unique_lock<std::mutex> Synchronization::lockStateStorage() {
+    if (concurrent) {
+        return std::unique_lock<std::mutex>(stateStorageMutex);
+    }
+    return std::unique_lock<std::mutex>(stateStorageMutex, std::defer_lock);
+}
+
+uint64_t Synchronization::getNumberOfCollapses() const {
+    return numberOfCollapses.load();
+}
+
+void Synchronization::collapsedMec() {
+    ++numberOfCollapses;
+}
+
+bool Synchronization::tryStartPrecomputation() {
+    bool expected = false;
+    return precomputationRunning.compare_exchange_strong(expected, true);
+}
+
+void Synchronization::finishPrecomputation() {
+    precomputationRunning.store(false);
+}
+
+bool Synchronization::isFinished() const {
+    return finished.load();
+}
+
+void Synchronization::finish() {
+    finished.store(true);
+}
+
+}  // namespace exploration_detail
+}  // namespace modelchecker
+}  // namespace storm
@@ -0,0 +1,63 @@
+#ifndef STORM_MODELCHECKER_EXPLORATION_EXPLORATION_DETAIL_SYNCHRONIZATION_H_
+#define STORM_MODELCHECKER_EXPLORATION_EXPLORATION_DETAIL_SYNCHRONIZATION_H_
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <shared_mutex>
+
+namespace storm {
+namespace modelchecker {
+namespace exploration_detail {
+
+/*!
+ * Coordinates several threads that sample paths and share the exploration information and the bounds. If the exploration is not concurrent, the
+ * returned locks do not lock anything.
+ *
+ * Successors are generated and precomputations are analyzed without holding a lock. The shared structures are read (sampling actions and successors)
+ * under a shared lock and modified (inserting explored states, updating bounds, collapsing MECs) under an exclusive lock.
+ */
+class Synchronization {
+   public:
+    explicit Synchronization(bool concurrent);
+
+    bool isConcurrent() const;
+
+    // Locks the exploration information and the bounds for reading.
+    std::shared_lock<std::shared_mutex> lockForReading();
+
+    // Locks the exploration information and the bounds for modification.
+    std::unique_lock<std::shared_mutex> lockForWriting();
+
+    // Locks the storage of discovered states.
+    std::unique_lock<std::mutex> lockStateStorage();
+
+    // Retrieves the number of collapsed MECs. Collapsing a MEC moves actions, so actions recorded before the last collapse are no longer valid.
+    uint64_t getNumberOfCollapses() const;
+
+    void collapsedMec();
+
+    // Tries to start a precomputation. This fails if another thread is performing a precomputation at the moment.
+    bool tryStartPrecomputation();
+
+    void finishPrecomputation();
+
+    // Retrieves whether all threads are to stop sampling, because the bounds have converged or an error occurred.
+    bool isFinished() const;
+
+    void finish();
+
+   private:
+    bool concurrent;
+    std::shared_mutex explorationMutex;
+    std::mutex stateStorageMutex;
+    std::atomic<uint64_t> numberOfCollapses;
+    std::atomic<bool> precomputationRunning;
+    std::atomic<bool> finished;
+};
+
+}  // namespace exploration_detail
+}  // namespace modelchecker
+}  // namespace storm
+
+#endif /* STORM_MODELCHECKER_EXPLORATION_EXPLORATION_DETAIL_SYNCHRONIZATION_H_ */
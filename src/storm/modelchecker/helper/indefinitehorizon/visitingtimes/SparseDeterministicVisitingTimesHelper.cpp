@@ -211,8 +211,10 @@ void SparseDeterministicVisitingTimesHelper<ValueType>::createDecomposition(Envi
 
     if (!this->sccDecomposition) {
         // The decomposition has not been provided or computed, yet.
-        auto options =
-            storm::storage::StronglyConnectedComponentDecompositionOptions().forceTopologicalSort().computeSccDepths(env.solver().isForceSoundness());
+        auto options = storm::storage::StronglyConnectedComponentDecompositionOptions()
+                           .forceTopologicalSort()
+                           .computeSccDepths(env.solver().isForceSoundness())
+                           .useThreads(env.solver().getNumberOfThreads());
         this->computedSccDecomposition = std::make_unique<storm::storage::StronglyConnectedComponentDecomposition<ValueType>>(this->transitionMatrix, options);
         this->sccDecomposition.reset(*this->computedSccDecomposition);
     }
@@ -44,11 +44,12 @@ SparseDeterministicInfiniteHorizonHelper<ValueType>::SparseDeterministicInfinite
 }
 
 template<typename ValueType>
-void SparseDeterministicInfiniteHorizonHelper<ValueType>::createDecomposition() {
+void SparseDeterministicInfiniteHorizonHelper<ValueType>::createDecomposition(Environment const& env) {
     if (this->_longRunComponentDecomposition == nullptr) {
         // The decomposition has not been provided or computed, yet.
         this->_computedLongRunComponentDecomposition = std::make_unique<storm::storage::StronglyConnectedComponentDecomposition<ValueType>>(
-            this->_transitionMatrix, storm::storage::StronglyConnectedComponentDecompositionOptions().onlyBottomSccs());
+            this->_transitionMatrix,
+            storm::storage::StronglyConnectedComponentDecompositionOptions().onlyBottomSccs().useThreads(env.solver().getNumberOfThreads()));
         this->_longRunComponentDecomposition = this->_computedLongRunComponentDecomposition.get();
     }
 }
@@ -576,7 +577,7 @@ std::vector<ValueType> SparseDeterministicInfiniteHorizonHelper<ValueType>::buil
 
 template<typename ValueType>
 std::vector<ValueType> SparseDeterministicInfiniteHorizonHelper<ValueType>::computeLongRunAverageStateDistribution(Environment const& env) {
-    createDecomposition();
+    createDecomposition(env);
     STORM_LOG_THROW(this->_longRunComponentDecomposition->size() <= 1, storm::exceptions::InvalidOperationException, "");
     return computeLongRunAverageStateDistribution(env, [](uint64_t) { return storm::utility::zero<ValueType>(); });
 }
@@ -594,7 +595,7 @@ std::vector<ValueType> SparseDeterministicInfiniteHorizonHelper<ValueType>::comp
 template<typename ValueType>
 std::vector<ValueType> SparseDeterministicInfiniteHorizonHelper<ValueType>::computeLongRunAverageStateDistribution(
     Environment const& env, ValueGetter const& initialDistributionGetter) {
-    createDecomposition();
+    createDecomposition(env);
 
     Environment subEnv = env;
     if (subEnv.solver().isForceSoundness()) {
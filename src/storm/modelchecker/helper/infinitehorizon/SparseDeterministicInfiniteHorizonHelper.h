@@ -53,7 +53,7 @@ class SparseDeterministicInfiniteHorizonHelper : public SparseInfiniteHorizonHel
     std::vector<ValueType> computeLongRunAverageStateDistribution(Environment const& env, ValueGetter const& initialDistributionGetter);
 
    protected:
-    virtual void createDecomposition() override;
+    virtual void createDecomposition(Environment const& env) override;
 
     /*!
      * Computes for each BSCC the probability to reach that SCC assuming the given distribution over initial states.
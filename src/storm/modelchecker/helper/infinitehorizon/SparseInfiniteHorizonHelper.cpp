@@ -159,9 +159,20 @@ std::vector<ValueType> SparseInfiniteHorizonHelper<ValueType, Nondeterministic>:
     STORM_LOG_ASSERT(Nondeterministic || !this->isProduceSchedulerSet(), "Scheduler production enabled for deterministic model.");
 
     // Decompose the model to their bottom components (MECS or BSCCS)
-    createDecomposition();
+    createDecomposition(env);
 
     // Compute the long-run average for all components in isolation.
+    std::vector<ValueType> componentLraValues = computeLraForComponents(underlyingSolverEnvironment, stateRewardsGetter, actionRewardsGetter);
+
+    // Solve the resulting SSP where end components are collapsed into single auxiliary states
+    STORM_LOG_INFO("Solving stochastic shortest path problem.");
+    return buildAndSolveSsp(underlyingSolverEnvironment, componentLraValues);
+}
+
+template<typename ValueType, bool Nondeterministic>
+std::vector<ValueType> SparseInfiniteHorizonHelper<ValueType, Nondeterministic>::computeLraForComponents(Environment const& env,
+                                                                                                         ValueGetter const& stateRewardsGetter,
+                                                                                                         ValueGetter const& actionRewardsGetter) {
     // Set up some logging
     std::string const componentString = (Nondeterministic ? std::string("Maximal end") : std::string("Bottom strongly connected")) +
                                         (_longRunComponentDecomposition->size() == 1 ? std::string(" component") : std::string(" components"));
@@ -172,13 +183,10 @@ std::vector<ValueType> SparseInfiniteHorizonHelper<ValueType, Nondeterministic>:
     std::vector<ValueType> componentLraValues;
     componentLraValues.reserve(_longRunComponentDecomposition->size());
     for (auto const& c : *_longRunComponentDecomposition) {
-        componentLraValues.push_back(computeLraForComponent(underlyingSolverEnvironment, stateRewardsGetter, actionRewardsGetter, c));
+        componentLraValues.push_back(computeLraForComponent(env, stateRewardsGetter, actionRewardsGetter, c));
         progress.updateProgress(componentLraValues.size());
     }
-
-    // Solve the resulting SSP where end components are collapsed into single auxiliary states
-    STORM_LOG_INFO("Solving stochastic shortest path problem.");
-    return buildAndSolveSsp(underlyingSolverEnvironment, componentLraValues);
+    return componentLraValues;
 }
 
 template<typename ValueType, bool Nondeterministic>
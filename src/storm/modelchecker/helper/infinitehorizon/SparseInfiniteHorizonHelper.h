@@ -121,7 +121,16 @@ class SparseInfiniteHorizonHelper : public SingleValueModelCheckerHelper<ValueTy
     /*!
      * @post _longRunComponentDecomposition points to a decomposition of the long run components (MECs, BSCCs)
      */
-    virtual void createDecomposition() = 0;
+    virtual void createDecomposition(Environment const& env) = 0;
+
+    /*!
+     * Computes the long run average value of each component of the decomposition in isolation.
+     * @pre _longRunComponentDecomposition points to a decomposition of the long run components (MECs, BSCCs)
+     * @return the (unique) optimal LRA value for each component, in the order of the decomposition.
+     * @post if scheduler production is enabled and Nondeterministic is true, getProducedOptimalChoices() contains choices for the states of all components
+     * which yield the returned LRA values.
+     */
+    virtual std::vector<ValueType> computeLraForComponents(Environment const& env, ValueGetter const& stateValuesGetter, ValueGetter const& actionValuesGetter);
 
     /*!
      * @pre if scheduler production is enabled and Nondeterministic is true, a choice for each state within a component must be set such that the choices yield
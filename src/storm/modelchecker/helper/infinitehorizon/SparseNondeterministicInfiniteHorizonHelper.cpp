@@ -12,6 +12,7 @@
 #include "storm/solver/MinMaxLinearEquationSolver.h"
 #include "storm/solver/multiplier/Multiplier.h"
 
+#include "storm/utility/TaskPool.h"
 #include "storm/utility/solver.h"
 #include "storm/utility/vector.h"
 
@@ -65,12 +66,12 @@ storm::storage::Scheduler<ValueType> SparseNondeterministicInfiniteHorizonHelper
 }
 
 template<typename ValueType>
-void SparseNondeterministicInfiniteHorizonHelper<ValueType>::createDecomposition() {
+void SparseNondeterministicInfiniteHorizonHelper<ValueType>::createDecomposition(Environment const& env) {
     if (this->_longRunComponentDecomposition == nullptr) {
         // The decomposition has not been provided or computed, yet.
         this->createBackwardTransitions();
-        this->_computedLongRunComponentDecomposition =
-            std::make_unique<storm::storage::MaximalEndComponentDecomposition<ValueType>>(this->_transitionMatrix, *this->_backwardTransitions);
+        this->_computedLongRunComponentDecomposition = std::make_unique<storm::storage::MaximalEndComponentDecomposition<ValueType>>(
+            this->_transitionMatrix, *this->_backwardTransitions, env.solver().getNumberOfThreads());
         this->_longRunComponentDecomposition = this->_computedLongRunComponentDecomposition.get();
     }
 }
@@ -95,6 +96,94 @@ ValueType SparseNondeterministicInfiniteHorizonHelper<ValueType>::computeLraForC
     }
 
     // Solve nontrivial MEC with the method specified in the settings
+    storm::solver::LraMethod method = getLraMethodForMecs(env);
+    STORM_LOG_ERROR_COND(!this->isProduceSchedulerSet() || method == storm::solver::LraMethod::ValueIteration,
+                         "Scheduler generation not supported for the chosen LRA method. Try value-iteration.");
+    if (method == storm::solver::LraMethod::LinearProgramming) {
+        return computeLraForMecLp(env, stateRewardsGetter, actionRewardsGetter, component);
+    } else if (method == storm::solver::LraMethod::ValueIteration) {
+        return computeLraForMecVi(env, stateRewardsGetter, actionRewardsGetter, component);
+    } else {
+        STORM_LOG_THROW(false, storm::exceptions::InvalidSettingsException, "Unsupported technique.");
+    }
+}
+
+template<typename ValueType>
+std::vector<ValueType> SparseNondeterministicInfiniteHorizonHelper<ValueType>::computeLraForComponents(Environment const& env,
+                                                                                                       ValueGetter const& stateRewardsGetter,
+                                                                                                       ValueGetter const& actionRewardsGetter) {
+    uint64_t const numberOfThreads = env.solver().getNumberOfThreads();
+    uint64_t const mecBatchSize = env.solver().lra().getMecBatchSize();
+    if (numberOfThreads <= 1 && mecBatchSize == 0) {
+        return SparseInfiniteHorizonHelper<ValueType, true>::computeLraForComponents(env, stateRewardsGetter, actionRewardsGetter);
+    }
+    if (getLraMethodForMecs(env) != storm::solver::LraMethod::ValueIteration) {
+        STORM_LOG_INFO("Analyzing maximal end components sequentially as concurrent analysis and batching are only supported for value iteration.");
+        return SparseInfiniteHorizonHelper<ValueType, true>::computeLraForComponents(env, stateRewardsGetter, actionRewardsGetter);
+    }
+
+    // Allocate memory for the nondeterministic choices before any MEC is analyzed. The tasks only write the choices of the states of their MECs.
+    if (this->isProduceSchedulerSet()) {
+        if (!this->_producedOptimalChoices.is_initialized()) {
+            this->_producedOptimalChoices.emplace();
+        }
+        this->_producedOptimalChoices->resize(this->_transitionMatrix.getRowGroupCount());
+    }
+
+    auto const& mecs = *this->_longRunComponentDecomposition;
+    std::vector<ValueType> componentLraValues(mecs.size(), storm::utility::zero<ValueType>());
+
+    // Trivial MECs are handled directly. The remaining MECs are distributed to tasks such that each large MEC is analyzed on its own and small MECs are
+    // batched together (if requested).
+    std::vector<std::vector<uint64_t>> tasks;
+    std::vector<uint64_t> currentBatch;
+    uint64_t currentBatchSize = 0;
+    for (uint64_t mecIndex = 0; mecIndex < mecs.size(); ++mecIndex) {
+        auto const& mec = mecs[mecIndex];
+        auto trivialResult = this->computeLraForTrivialMec(env, stateRewardsGetter, actionRewardsGetter, mec);
+        if (trivialResult.first) {
+            componentLraValues[mecIndex] = std::move(trivialResult.second);
+        } else if (mec.size() > mecBatchSize) {
+            tasks.push_back({mecIndex});
+        } else {
+            if (currentBatchSize + mec.size() > mecBatchSize) {
+                tasks.push_back(std::move(currentBatch));
+                currentBatch.clear();
+                currentBatchSize = 0;
+            }
+            currentBatch.push_back(mecIndex);
+            currentBatchSize += mec.size();
+        }
+    }
+    if (!currentBatch.empty()) {
+        tasks.push_back(std::move(currentBatch));
+    }
+    STORM_LOG_INFO("Computing long run average values for " << mecs.size() << " maximal end components in " << tasks.size() << " tasks using "
+                                                            << numberOfThreads << " threads...");
+
+    // The MECs are analyzed concurrently, so each analysis uses a single thread. Each task creates its own solvers.
+    storm::Environment taskEnv = env;
+    taskEnv.solver().setNumberOfThreads(1);
+    storm::utility::TaskPool pool(numberOfThreads);
+    for (auto const& task : tasks) {
+        pool.submit([this, &taskEnv, &stateRewardsGetter, &actionRewardsGetter, &mecs, &task, &componentLraValues]() {
+            std::vector<storm::storage::MaximalEndComponent const*> taskMecs;
+            taskMecs.reserve(task.size());
+            for (auto const& mecIndex : task) {
+                taskMecs.push_back(&mecs[mecIndex]);
+            }
+            std::vector<ValueType> taskValues = computeLraForMecsVi(taskEnv, stateRewardsGetter, actionRewardsGetter, taskMecs);
+            for (uint64_t i = 0; i < task.size(); ++i) {
+                componentLraValues[task[i]] = std::move(taskValues[i]);
+            }
+        });
+    }
+    pool.wait();
+    return componentLraValues;
+}
+
+template<typename ValueType>
+storm::solver::LraMethod SparseNondeterministicInfiniteHorizonHelper<ValueType>::getLraMethodForMecs(Environment const& env) const {
     storm::solver::LraMethod method = env.solver().lra().getNondetLraMethod();
     if ((storm::NumberTraits<ValueType>::IsExact || env.solver().isForceExact()) && env.solver().lra().isNondetLraMethodSetFromDefault() &&
         method != storm::solver::LraMethod::LinearProgramming) {
@@ -108,15 +197,7 @@ ValueType SparseNondeterministicInfiniteHorizonHelper<ValueType>::computeLraForC
             "specify a different LRA method.");
         method = storm::solver::LraMethod::ValueIteration;
     }
-    STORM_LOG_ERROR_COND(!this->isProduceSchedulerSet() || method == storm::solver::LraMethod::ValueIteration,
-                         "Scheduler generation not supported for the chosen LRA method. Try value-iteration.");
-    if (method == storm::solver::LraMethod::LinearProgramming) {
-        return computeLraForMecLp(env, stateRewardsGetter, actionRewardsGetter, component);
-    } else if (method == storm::solver::LraMethod::ValueIteration) {
-        return computeLraForMecVi(env, stateRewardsGetter, actionRewardsGetter, component);
-    } else {
-        STORM_LOG_THROW(false, storm::exceptions::InvalidSettingsException, "Unsupported technique.");
-    }
+    return method;
 }
 
 template<typename ValueType>
@@ -168,6 +249,13 @@ template<typename ValueType>
 ValueType SparseNondeterministicInfiniteHorizonHelper<ValueType>::computeLraForMecVi(Environment const& env, ValueGetter const& stateRewardsGetter,
                                                                                      ValueGetter const& actionRewardsGetter,
                                                                                      storm::storage::MaximalEndComponent const& mec) {
+    return computeLraForMecsVi(env, stateRewardsGetter, actionRewardsGetter, {&mec}).front();
+}
+
+template<typename ValueType>
+std::vector<ValueType> SparseNondeterministicInfiniteHorizonHelper<ValueType>::computeLraForMecsVi(
+    Environment const& env, ValueGetter const& stateRewardsGetter, ValueGetter const& actionRewardsGetter,
+    std::vector<storm::storage::MaximalEndComponent const*> const& mecs) {
     // Collect some parameters of the computation
     ValueType aperiodicFactor = storm::utility::convertNumber<ValueType>(env.solver().lra().getAperiodicFactor());
     std::vector<uint64_t>* optimalChoices = nullptr;
@@ -180,15 +268,16 @@ ValueType SparseNondeterministicInfiniteHorizonHelper<ValueType>::computeLraForM
         // We assume a Markov Automaton (with deterministic timed states and nondeterministic instant states)
         storm::modelchecker::helper::internal::LraViHelper<ValueType, storm::storage::MaximalEndComponent,
                                                            storm::modelchecker::helper::internal::LraViTransitionsType::DetTsNondetIs>
-            viHelper(mec, this->_transitionMatrix, aperiodicFactor, this->_markovianStates, this->_exitRates);
-        return viHelper.performValueIteration(env, stateRewardsGetter, actionRewardsGetter, this->_exitRates, &this->getOptimizationDirection(),
-                                              optimalChoices);
+            viHelper(mecs, this->_transitionMatrix, aperiodicFactor, this->_markovianStates, this->_exitRates);
+        return viHelper.performValueIterationForComponents(env, stateRewardsGetter, actionRewardsGetter, this->_exitRates, &this->getOptimizationDirection(),
+                                                           optimalChoices);
     } else {
         // We assume an MDP (with nondeterministic timed states and no instant states)
         storm::modelchecker::helper::internal::LraViHelper<ValueType, storm::storage::MaximalEndComponent,
                                                            storm::modelchecker::helper::internal::LraViTransitionsType::NondetTsNoIs>
-            viHelper(mec, this->_transitionMatrix, aperiodicFactor);
-        return viHelper.performValueIteration(env, stateRewardsGetter, actionRewardsGetter, nullptr, &this->getOptimizationDirection(), optimalChoices);
+            viHelper(mecs, this->_transitionMatrix, aperiodicFactor);
+        return viHelper.performValueIterationForComponents(env, stateRewardsGetter, actionRewardsGetter, nullptr, &this->getOptimizationDirection(),
+                                                           optimalChoices);
     }
 }
 
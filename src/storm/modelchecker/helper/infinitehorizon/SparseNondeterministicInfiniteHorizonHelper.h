@@ -1,5 +1,6 @@
 #pragma once
 #include "storm/modelchecker/helper/infinitehorizon/SparseInfiniteHorizonHelper.h"
+#include "storm/solver/SolverSelectionOptions.h"
 
 namespace storm {
 
@@ -63,7 +64,19 @@ class SparseNondeterministicInfiniteHorizonHelper : public SparseInfiniteHorizon
                                              storm::storage::MaximalEndComponent const& component) override;
 
    protected:
-    virtual void createDecomposition() override;
+    virtual void createDecomposition(Environment const& env) override;
+
+    /*!
+     * Computes the LRA values of the MECs in isolation. If multiple threads are set in the environment and value iteration is used, the MECs are analyzed
+     * concurrently. If a MEC batch size is set, small MECs are analyzed together in a single value iteration run.
+     */
+    virtual std::vector<ValueType> computeLraForComponents(Environment const& env, ValueGetter const& stateValuesGetter,
+                                                           ValueGetter const& actionValuesGetter) override;
+
+    /*!
+     * @return the method that is used for computing the LRA values of nontrivial MECs
+     */
+    storm::solver::LraMethod getLraMethodForMecs(Environment const& env) const;
 
     std::pair<bool, ValueType> computeLraForTrivialMec(Environment const& env, ValueGetter const& stateValuesGetter, ValueGetter const& actionValuesGetter,
                                                        storm::storage::MaximalEndComponent const& mec);
@@ -74,6 +87,13 @@ class SparseNondeterministicInfiniteHorizonHelper : public SparseInfiniteHorizon
     ValueType computeLraForMecVi(Environment const& env, ValueGetter const& stateValuesGetter, ValueGetter const& actionValuesGetter,
                                  storm::storage::MaximalEndComponent const& mec);
 
+    /*!
+     * As computeLraForMecVi but analyzes the given MECs together in a single run
+     * @return the LRA value for each of the given MECs
+     */
+    std::vector<ValueType> computeLraForMecsVi(Environment const& env, ValueGetter const& stateValuesGetter, ValueGetter const& actionValuesGetter,
+                                               std::vector<storm::storage::MaximalEndComponent const*> const& mecs);
+
     /*!
      * As computeLraForMec but uses linear programming as a solution method (independent of what is set in env)
      * @see Guck et al.: Modelling and Analysis of Markov Reward Automata (ATVA'14), https://doi.org/10.1007/978-3-319-11936-6_13
@@ -1,5 +1,8 @@
 #include "LraViHelper.h"
 
+#include <algorithm>
+#include <limits>
+
 #include "storm/modelchecker/helper/infinitehorizon/internal/ComponentUtility.h"
 
 #include "storm/storage/MaximalEndComponent.h"
@@ -26,11 +29,22 @@ LraViHelper<ValueType, ComponentType, TransitionsType>::LraViHelper(ComponentTyp
                                                                     storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                                     ValueType const& aperiodicFactor, storm::storage::BitVector const* timedStates,
                                                                     std::vector<ValueType> const* exitRates)
-    : _transitionMatrix(transitionMatrix),
+    : LraViHelper(std::vector<ComponentType const*>({&component}), transitionMatrix, aperiodicFactor, timedStates, exitRates) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType, typename ComponentType, LraViTransitionsType TransitionsType>
+LraViHelper<ValueType, ComponentType, TransitionsType>::LraViHelper(std::vector<ComponentType const*> const& components,
+                                                                    storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                                    ValueType const& aperiodicFactor, storm::storage::BitVector const* timedStates,
+                                                                    std::vector<ValueType> const* exitRates)
+    : _numberOfComponents(components.size()),
+      _transitionMatrix(transitionMatrix),
       _timedStates(timedStates),
       _hasInstantStates(TransitionsType == LraViTransitionsType::DetTsNondetIs || TransitionsType == LraViTransitionsType::DetTsDetIs),
       _Tsx1IsCurrent(false) {
-    setComponent(component);
+    std::vector<uint64_t> const elementComponentIndices = setComponents(components);
+    _componentReferenceTsStates.assign(_numberOfComponents, std::numeric_limits<uint64_t>::max());
 
     // Run through the component and collect some data:
     // We create two submodels, one consisting of the timed states of the component and one consisting of the instant states of the component.
@@ -44,9 +58,15 @@ LraViHelper<ValueType, ComponentType, TransitionsType>::LraViHelper(ComponentTyp
     // component.
     _uniformizationRate = exitRates == nullptr ? storm::utility::one<ValueType>() : storm::utility::zero<ValueType>();
     // Now run over the MEC and collect the required data.
+    auto elementComponentIndexIt = elementComponentIndices.begin();
     for (auto const& element : _component) {
         uint64_t componentState = element.first;
+        uint64_t componentIndex = *(elementComponentIndexIt++);
         if (isTimedState(componentState)) {
+            if (_componentReferenceTsStates[componentIndex] == std::numeric_limits<uint64_t>::max()) {
+                _componentReferenceTsStates[componentIndex] = numTsSubModelStates;
+            }
+            _TsComponentIndices.push_back(componentIndex);
             toSubModelStateMapping.emplace(componentState, numTsSubModelStates);
             ++numTsSubModelStates;
             numTsSubModelChoices += element.second.size();
@@ -67,7 +87,9 @@ LraViHelper<ValueType, ComponentType, TransitionsType>::LraViHelper(ComponentTyp
     STORM_LOG_ASSERT(nondetIs() || numIsSubModelStates == numIsSubModelChoices, "Unexpected choice count of deterministic instant submodel.");
     _hasInstantStates = _hasInstantStates && numIsSubModelStates > 0;
     STORM_LOG_THROW(
-        numTsSubModelStates > 0, storm::exceptions::InvalidOperationException,
+        std::find(_componentReferenceTsStates.begin(), _componentReferenceTsStates.end(), std::numeric_limits<uint64_t>::max()) ==
+            _componentReferenceTsStates.end(),
+        storm::exceptions::InvalidOperationException,
         "Bottom Component has no timed states. Computation of Long Run Average values not supported. Is this a Markov Automaton with Zeno behavior?");
 
     // We make sure that every timed state gets a selfloop to make the model aperiodic
@@ -154,17 +176,29 @@ LraViHelper<ValueType, ComponentType, TransitionsType>::LraViHelper(ComponentTyp
 }
 
 template<typename ValueType, typename ComponentType, LraViTransitionsType TransitionsType>
-void LraViHelper<ValueType, ComponentType, TransitionsType>::setComponent(ComponentType component) {
+std::vector<uint64_t> LraViHelper<ValueType, ComponentType, TransitionsType>::setComponents(std::vector<ComponentType const*> const& components) {
     _component.clear();
-    for (auto const& element : component) {
-        uint64_t componentState = getComponentElementState(element);
-        std::set<uint64_t> componentChoices;
-        for (auto componentChoiceIt = getComponentElementChoicesBegin(element); componentChoiceIt != getComponentElementChoicesEnd(element);
-             ++componentChoiceIt) {
-            componentChoices.insert(*componentChoiceIt);
+    std::map<uint64_t, uint64_t> stateToComponentIndexMap;
+    for (uint64_t componentIndex = 0; componentIndex < components.size(); ++componentIndex) {
+        for (auto const& element : *components[componentIndex]) {
+            uint64_t componentState = getComponentElementState(element);
+            std::set<uint64_t> componentChoices;
+            for (auto componentChoiceIt = getComponentElementChoicesBegin(element); componentChoiceIt != getComponentElementChoicesEnd(element);
+                 ++componentChoiceIt) {
+                componentChoices.insert(*componentChoiceIt);
+            }
+            STORM_LOG_ASSERT(_component.count(componentState) == 0, "State " << componentState << " occurs in multiple components.");
+            _component.emplace(componentState, std::move(componentChoices));
+            stateToComponentIndexMap.emplace(componentState, componentIndex);
         }
-        _component.emplace(std::move(componentState), std::move(componentChoices));
     }
+    // The internal component is sorted by the states, so we can just collect the component indices of the sorted states.
+    std::vector<uint64_t> elementComponentIndices;
+    elementComponentIndices.reserve(stateToComponentIndexMap.size());
+    for (auto const& stateComponentIndexPair : stateToComponentIndexMap) {
+        elementComponentIndices.push_back(stateComponentIndexPair.second);
+    }
+    return elementComponentIndices;
 }
 
 template<typename ValueType, typename ComponentType, LraViTransitionsType TransitionsType>
@@ -173,6 +207,14 @@ ValueType LraViHelper<ValueType, ComponentType, TransitionsType>::performValueIt
                                                                                         std::vector<ValueType> const* exitRates,
                                                                                         storm::solver::OptimizationDirection const* dir,
                                                                                         std::vector<uint64_t>* choices) {
+    STORM_LOG_ASSERT(_numberOfComponents == 1, "Expected a single component but got " << _numberOfComponents << ".");
+    return performValueIterationForComponents(env, stateValueGetter, actionValueGetter, exitRates, dir, choices).front();
+}
+
+template<typename ValueType, typename ComponentType, LraViTransitionsType TransitionsType>
+std::vector<ValueType> LraViHelper<ValueType, ComponentType, TransitionsType>::performValueIterationForComponents(
+    Environment const& env, ValueGetter const& stateValueGetter, ValueGetter const& actionValueGetter, std::vector<ValueType> const* exitRates,
+    storm::solver::OptimizationDirection const* dir, std::vector<uint64_t>* choices) {
     initializeNewValues(stateValueGetter, actionValueGetter, exitRates);
     ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().lra().getPrecision());
     bool relative = env.solver().lra().getRelativeTerminationCriterion();
@@ -182,7 +224,7 @@ ValueType LraViHelper<ValueType, ComponentType, TransitionsType>::performValueIt
     }
 
     // start the iterations
-    ValueType result = storm::utility::zero<ValueType>();
+    std::vector<ValueType> result(_numberOfComponents, storm::utility::zero<ValueType>());
     uint64_t iter = 0;
     while (!maxIter.is_initialized() || iter < maxIter.get()) {
         ++iter;
@@ -190,7 +232,7 @@ ValueType LraViHelper<ValueType, ComponentType, TransitionsType>::performValueIt
 
         // Check if we are done
         auto convergenceCheckResult = checkConvergence(relative, precision);
-        result = convergenceCheckResult.currentValue;
+        result = std::move(convergenceCheckResult.currentValues);
         if (convergenceCheckResult.isPrecisionAchieved) {
             break;
         }
@@ -431,47 +473,84 @@ LraViHelper<ValueType, ComponentType, TransitionsType>::checkConvergence(bool re
     // However, for relative precision, the scaling cancels out.
     ValueType threshold = relative ? precision : ValueType(precision / _uniformizationRate);
 
-    ConvergenceCheckResult res = {true, storm::utility::one<ValueType>()};
+    ConvergenceCheckResult res = {true, {}};
     // Now check whether the currently produced results are precise enough
     STORM_LOG_ASSERT(threshold > storm::utility::zero<ValueType>(), "Did not expect a non-positive threshold.");
-    auto x1It = xOld().begin();
-    auto x1Ite = xOld().end();
-    auto x2It = xNew().begin();
-    ValueType maxDiff = (*x2It - *x1It);
-    ValueType minDiff = maxDiff;
-    // The difference between maxDiff and minDiff is zero at this point. Thus, it doesn't make sense to check the threshold now.
-    for (++x1It, ++x2It; x1It != x1Ite; ++x1It, ++x2It) {
-        ValueType diff = (*x2It - *x1It);
-        // Potentially update maxDiff or minDiff
-        bool skipCheck = false;
-        if (maxDiff < diff) {
-            maxDiff = diff;
-        } else if (minDiff > diff) {
-            minDiff = diff;
-        } else {
-            skipCheck = true;
+    if (_numberOfComponents == 1) {
+        auto x1It = xOld().begin();
+        auto x1Ite = xOld().end();
+        auto x2It = xNew().begin();
+        ValueType maxDiff = (*x2It - *x1It);
+        ValueType minDiff = maxDiff;
+        // The difference between maxDiff and minDiff is zero at this point. Thus, it doesn't make sense to check the threshold now.
+        for (++x1It, ++x2It; x1It != x1Ite; ++x1It, ++x2It) {
+            ValueType diff = (*x2It - *x1It);
+            // Potentially update maxDiff or minDiff
+            bool skipCheck = false;
+            if (maxDiff < diff) {
+                maxDiff = diff;
+            } else if (minDiff > diff) {
+                minDiff = diff;
+            } else {
+                skipCheck = true;
+            }
+            // Check convergence
+            if (!skipCheck && (maxDiff - minDiff) > (relative ? (threshold * minDiff) : threshold)) {
+                res.isPrecisionAchieved = false;
+                break;
+            }
         }
-        // Check convergence
-        if (!skipCheck && (maxDiff - minDiff) > (relative ? (threshold * minDiff) : threshold)) {
-            res.isPrecisionAchieved = false;
-            break;
+        // Compute the average of the maximal and the minimal difference and "undo" the scaling of the values
+        res.currentValues.push_back((maxDiff + minDiff) / (storm::utility::convertNumber<ValueType>(2.0)) * _uniformizationRate);
+    } else {
+        // Compute the maximal and the minimal difference for each component.
+        std::vector<ValueType> maxDiffs, minDiffs;
+        maxDiffs.reserve(_numberOfComponents);
+        for (auto const& referenceState : _componentReferenceTsStates) {
+            maxDiffs.push_back(xNew()[referenceState] - xOld()[referenceState]);
+        }
+        minDiffs = maxDiffs;
+        auto componentIndexIt = _TsComponentIndices.begin();
+        for (auto x1It = xOld().begin(), x1Ite = xOld().end(), x2It = xNew().begin(); x1It != x1Ite; ++x1It, ++x2It, ++componentIndexIt) {
+            ValueType diff = (*x2It - *x1It);
+            if (maxDiffs[*componentIndexIt] < diff) {
+                maxDiffs[*componentIndexIt] = diff;
+            } else if (minDiffs[*componentIndexIt] > diff) {
+                minDiffs[*componentIndexIt] = diff;
+            }
+        }
+        res.currentValues.reserve(_numberOfComponents);
+        for (uint64_t componentIndex = 0; componentIndex < _numberOfComponents; ++componentIndex) {
+            ValueType const& maxDiff = maxDiffs[componentIndex];
+            ValueType const& minDiff = minDiffs[componentIndex];
+            if ((maxDiff - minDiff) > (relative ? (threshold * minDiff) : threshold)) {
+                res.isPrecisionAchieved = false;
+            }
+            res.currentValues.push_back((maxDiff + minDiff) / (storm::utility::convertNumber<ValueType>(2.0)) * _uniformizationRate);
         }
     }
-
-    // Compute the average of the maximal and the minimal difference.
-    ValueType avgDiff = (maxDiff + minDiff) / (storm::utility::convertNumber<ValueType>(2.0));
-
-    // "Undo" the scaling of the values
-    res.currentValue = avgDiff * _uniformizationRate;
     return res;
 }
 
 template<typename ValueType, typename ComponentType, LraViTransitionsType TransitionsType>
 void LraViHelper<ValueType, ComponentType, TransitionsType>::prepareNextIteration(Environment const& env) {
     // To avoid large (and numerically unstable) x-values, we substract a reference value.
-    ValueType referenceValue = xNew().front();
-    storm::utility::vector::applyPointwise<ValueType, ValueType>(xNew(), xNew(),
-                                                                 [&referenceValue](ValueType const& x_i) -> ValueType { return x_i - referenceValue; });
+    if (_numberOfComponents == 1) {
+        ValueType referenceValue = xNew().front();
+        storm::utility::vector::applyPointwise<ValueType, ValueType>(xNew(), xNew(),
+                                                                     [&referenceValue](ValueType const& x_i) -> ValueType { return x_i - referenceValue; });
+    } else {
+        // As the components are independent, each of them gets its own reference value.
+        std::vector<ValueType> referenceValues;
+        referenceValues.reserve(_numberOfComponents);
+        for (auto const& referenceState : _componentReferenceTsStates) {
+            referenceValues.push_back(xNew()[referenceState]);
+        }
+        auto componentIndexIt = _TsComponentIndices.begin();
+        for (auto& x_i : xNew()) {
+            x_i -= referenceValues[*(componentIndexIt++)];
+        }
+    }
     if (_hasInstantStates) {
         // Update the RHS of the equation system for the instant states by taking the new values of timed states into account.
         STORM_LOG_ASSERT(!nondetTs(), "Nondeterministic timed states not expected when there are also instant states.");
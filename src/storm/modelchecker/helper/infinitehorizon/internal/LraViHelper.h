@@ -57,6 +57,16 @@ class LraViHelper {
     LraViHelper(ComponentType const& component, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, ValueType const& aperiodicFactor,
                 storm::storage::BitVector const* timedStates = nullptr, std::vector<ValueType> const* exitRates = nullptr);
 
+    /*!
+     * Initializes a new VI helper for multiple MECs or BSCCs which are then analyzed in a single run.
+     * As the components are independent of each other, this yields the same values as analyzing each of them individually.
+     * @param components the MECs or BSCCs. Each of them must contain at least one timed state and no two of them may share a state.
+     * @note The remaining parameters are as for the constructor for a single component. For continuous time models, the uniformization rate is chosen w.r.t.
+     * the maximal exit rate of all components.
+     */
+    LraViHelper(std::vector<ComponentType const*> const& components, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                ValueType const& aperiodicFactor, storm::storage::BitVector const* timedStates = nullptr, std::vector<ValueType> const* exitRates = nullptr);
+
     /*!
      * Performs value iteration with the given state- and action values.
      * @param env The environment, containing information on the precision of this computation.
@@ -75,6 +85,15 @@ class LraViHelper {
                                     std::vector<ValueType> const* exitRates = nullptr, storm::solver::OptimizationDirection const* dir = nullptr,
                                     std::vector<uint64_t>* choices = nullptr);
 
+    /*!
+     * As performValueIteration but returns the (optimal) long run average value for each of the components given in the constructor (in the same order).
+     * The iterations are performed until the desired precision is achieved for all components.
+     */
+    std::vector<ValueType> performValueIterationForComponents(Environment const& env, ValueGetter const& stateValueGetter, ValueGetter const& actionValueGetter,
+                                                              std::vector<ValueType> const* exitRates = nullptr,
+                                                              storm::solver::OptimizationDirection const* dir = nullptr,
+                                                              std::vector<uint64_t>* choices = nullptr);
+
    private:
     /*!
      * Initializes the value iterations with the provided values.
@@ -99,11 +118,11 @@ class LraViHelper {
 
     struct ConvergenceCheckResult {
         bool isPrecisionAchieved;
-        ValueType currentValue;
+        std::vector<ValueType> currentValues;  // one value for each component
     };
 
     /*!
-     * Checks whether the curently computed value achieves the desired precision
+     * Checks whether the curently computed values achieve the desired precision
      */
     ConvergenceCheckResult checkConvergence(bool relative, ValueType precision) const;
 
@@ -135,12 +154,19 @@ class LraViHelper {
     /// @return true iff there potentially is a nondeterministic choice at instant states. Returns false if there are no instant states.
     bool nondetIs() const;
 
-    void setComponent(ComponentType component);
+    /*!
+     * Sets the internal representation of the given components.
+     * @return for each element of the internal component, the index of the component it belongs to.
+     */
+    std::vector<uint64_t> setComponents(std::vector<ComponentType const*> const& components);
 
     // We need to make sure that states/choices will be processed in ascending order
     typedef std::map<uint64_t, std::set<uint64_t>> InternalComponentType;
 
     InternalComponentType _component;
+    uint64_t _numberOfComponents;
+    std::vector<uint64_t> _TsComponentIndices;          // for each timed state of the submodel, the index of its component
+    std::vector<uint64_t> _componentReferenceTsStates;  // for each component, a timed state of the submodel that lies in the component
     storm::storage::SparseMatrix<ValueType> const& _transitionMatrix;
     storm::storage::BitVector const* _timedStates;  // e.g. Markovian states of a Markov automaton.
     bool _hasInstantStates;
@@ -4,6 +4,7 @@
 #include "storm/automata/LTL2DeterministicAutomaton.h"
 
 #include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
 
 #include "storm/logic/ExtractMaximalStateFormulasVisitor.h"
 
@@ -66,7 +67,8 @@ std::map<std::string, storm::storage::BitVector> SparseLTLHelper<ValueType, Nond
 }
 
 template<typename ValueType, bool Nondeterministic>
-storm::storage::BitVector SparseLTLHelper<ValueType, Nondeterministic>::computeAcceptingECs(automata::AcceptanceCondition const& acceptance,
+storm::storage::BitVector SparseLTLHelper<ValueType, Nondeterministic>::computeAcceptingECs(Environment const& env,
+                                                                                            automata::AcceptanceCondition const& acceptance,
                                                                                             storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                                                             storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
                                                                                             typename transformer::DAProduct<productModelType>::ptr product) {
@@ -118,7 +120,7 @@ storm::storage::BitVector SparseLTLHelper<ValueType, Nondeterministic>::computeA
         }
 
         // Compute MECs in the allowed fragment
-        storm::storage::MaximalEndComponentDecomposition<ValueType> mecs(transitionMatrix, backwardTransitions, allowed);
+        storm::storage::MaximalEndComponentDecomposition<ValueType> mecs(transitionMatrix, backwardTransitions, allowed, env.solver().getNumberOfThreads());
         allMECs += mecs.size();
         for (const auto& mec : mecs) {
             bool accepting = true;
@@ -174,10 +176,12 @@ storm::storage::BitVector SparseLTLHelper<ValueType, Nondeterministic>::computeA
 }
 
 template<typename ValueType, bool Nondeterministic>
-storm::storage::BitVector SparseLTLHelper<ValueType, Nondeterministic>::computeAcceptingBCCs(automata::AcceptanceCondition const& acceptance,
+storm::storage::BitVector SparseLTLHelper<ValueType, Nondeterministic>::computeAcceptingBCCs(Environment const& env,
+                                                                                             automata::AcceptanceCondition const& acceptance,
                                                                                              storm::storage::SparseMatrix<ValueType> const& transitionMatrix) {
     storm::storage::StronglyConnectedComponentDecomposition<ValueType> bottomSccs(
-        transitionMatrix, storage::StronglyConnectedComponentDecompositionOptions().onlyBottomSccs().dropNaiveSccs());
+        transitionMatrix,
+        storage::StronglyConnectedComponentDecompositionOptions().onlyBottomSccs().dropNaiveSccs().useThreads(env.solver().getNumberOfThreads()));
     storm::storage::BitVector acceptingStates(transitionMatrix.getRowGroupCount(), false);
 
     std::size_t checkedBSCCs = 0, acceptingBSCCs = 0, acceptingBSCCStates = 0;
@@ -239,12 +243,12 @@ std::vector<ValueType> SparseLTLHelper<ValueType, Nondeterministic>::computeDAPr
     storm::storage::BitVector acceptingStates;
     if (Nondeterministic) {
         STORM_LOG_INFO("Computing MECs and checking for acceptance...");
-        acceptingStates = computeAcceptingECs(*product->getAcceptance(), product->getProductModel().getTransitionMatrix(),
+        acceptingStates = computeAcceptingECs(env, *product->getAcceptance(), product->getProductModel().getTransitionMatrix(),
                                               product->getProductModel().getBackwardTransitions(), product);
 
     } else {
         STORM_LOG_INFO("Computing BSCCs and checking for acceptance...");
-        acceptingStates = computeAcceptingBCCs(*product->getAcceptance(), product->getProductModel().getTransitionMatrix());
+        acceptingStates = computeAcceptingBCCs(env, *product->getAcceptance(), product->getProductModel().getTransitionMatrix());
     }
 
     if (acceptingStates.empty()) {
@@ -95,21 +95,23 @@ class SparseLTLHelper : public SingleValueModelCheckerHelper<ValueType, storm::m
      *   P1acc be the set of states that satisfy Pmax=1[ F accEC ].
      * This function then computes a set that contains accEC and is contained by P1acc.
      * However, if the acceptance condition consists of 'true', the whole state space can be returned.
+     * @param env the environment, which determines the number of threads for the MEC decomposition
      * @param acceptance the acceptance condition (in DNF)
      * @param transitionMatrix the transition matrix of the model
      * @param backwardTransitions the reversed transition relation
      */
-    storm::storage::BitVector computeAcceptingECs(automata::AcceptanceCondition const& acceptance,
+    storm::storage::BitVector computeAcceptingECs(Environment const& env, automata::AcceptanceCondition const& acceptance,
                                                   storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                   storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
                                                   typename transformer::DAProduct<productModelType>::ptr product);
 
     /*!
      * Computes a set S of states that are contained in BSCCs that satisfy the given acceptance conditon.
+     * @param env the environment, which determines the number of threads for the BSCC decomposition
      * @param acceptance the acceptance condition
      * @param transitionMatrix the transition matrix of the model
      */
-    storm::storage::BitVector computeAcceptingBCCs(automata::AcceptanceCondition const& acceptance,
+    storm::storage::BitVector computeAcceptingBCCs(Environment const& env, automata::AcceptanceCondition const& acceptance,
                                                    storm::storage::SparseMatrix<ValueType> const& transitionMatrix);
 
     storm::storage::SparseMatrix<ValueType> const& _transitionMatrix;
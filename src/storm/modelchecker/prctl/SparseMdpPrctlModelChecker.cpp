@@ -1,5 +1,6 @@
 #include "storm/modelchecker/prctl/SparseMdpPrctlModelChecker.h"
 
+#include "storm/environment/solver/SolverEnvironment.h"
 #include "storm/exceptions/InvalidPropertyException.h"
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/logic/FragmentSpecification.h"
@@ -17,6 +18,7 @@
 #include "storm/modelchecker/results/LexicographicCheckResult.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/solver/SolveGoal.h"
+#include "storm/storage/MaximalEndComponentDecomposition.h"
 #include "storm/storage/expressions/Expressions.h"
 #include "storm/utility/FilteredRewardModel.h"
 #include "storm/utility/constants.h"
@@ -397,6 +399,13 @@ std::unique_ptr<CheckResult> SparseMdpPrctlModelChecker<SparseMdpModelType>::com
 
         storm::modelchecker::helper::SparseNondeterministicInfiniteHorizonHelper<ValueType> helper(this->getModel().getTransitionMatrix());
         storm::modelchecker::helper::setInformationFromCheckTaskNondeterministic(helper, checkTask, this->getModel());
+        // The end components do not depend on the property, so they are shared with other long-run properties of the model.
+        auto analysisCache = this->getModel().getAnalysisCache();
+        auto backwardTransitions = analysisCache->getBackwardTransitions();
+        auto mecDecomposition = analysisCache->getMaximalEndComponentDecomposition(
+            storm::storage::BitVector(this->getModel().getNumberOfStates(), true), env.solver().getNumberOfThreads());
+        helper.provideBackwardTransitions(*backwardTransitions);
+        helper.provideLongRunComponentDecomposition(*mecDecomposition);
         auto values = helper.computeLongRunAverageProbabilities(env, subResult.getTruthValuesVector());
 
         std::unique_ptr<CheckResult> result(new ExplicitQuantitativeCheckResult<SolutionType>(std::move(values)));
@@ -419,6 +428,13 @@ std::unique_ptr<CheckResult> SparseMdpPrctlModelChecker<SparseMdpModelType>::com
         auto rewardModel = storm::utility::createFilteredRewardModel(this->getModel(), checkTask);
         storm::modelchecker::helper::SparseNondeterministicInfiniteHorizonHelper<ValueType> helper(this->getModel().getTransitionMatrix());
         storm::modelchecker::helper::setInformationFromCheckTaskNondeterministic(helper, checkTask, this->getModel());
+        // The end components do not depend on the property, so they are shared with other long-run properties of the model.
+        auto analysisCache = this->getModel().getAnalysisCache();
+        auto backwardTransitions = analysisCache->getBackwardTransitions();
+        auto mecDecomposition = analysisCache->getMaximalEndComponentDecomposition(
+            storm::storage::BitVector(this->getModel().getNumberOfStates(), true), env.solver().getNumberOfThreads());
+        helper.provideBackwardTransitions(*backwardTransitions);
+        helper.provideLongRunComponentDecomposition(*mecDecomposition);
         auto values = helper.computeLongRunAverageRewards(env, rewardModel.get());
         std::unique_ptr<CheckResult> result(new ExplicitQuantitativeCheckResult<SolutionType>(std::move(values)));
         if (checkTask.isProduceSchedulersSet()) {
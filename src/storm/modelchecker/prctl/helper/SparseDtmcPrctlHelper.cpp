@@ -176,8 +176,13 @@ std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::comput
                                          << " states remaining).");
     } else {
         // Get all states that have probability 0 and 1 of satisfying the until-formula.
-        std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01 =
-            storm::utility::graph::performProb01(backwardTransitions, phiStates, psiStates);
+        std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01;
+        if (auto analysisCache = goal.getAnalysisCache(transitionMatrix)) {
+            // The sets are shared with other properties of the same model, so we need to copy them.
+            statesWithProbability01 = *analysisCache->getProb01(phiStates, psiStates);
+        } else {
+            statesWithProbability01 = storm::utility::graph::performProb01(backwardTransitions, phiStates, psiStates);
+        }
         storm::storage::BitVector statesWithProbability0 = std::move(statesWithProbability01.first);
         statesWithProbability1 = std::move(statesWithProbability01.second);
         maybeStates = ~(statesWithProbability0 | statesWithProbability1);
@@ -546,7 +546,11 @@ QualitativeStateSetsUntilProbabilities computeQualitativeStateSetsUntilProbabili
 
     // Get all states that have probability 0 and 1 of satisfying the until-formula.
     std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01;
-    if (goal.minimize()) {
+    if (auto analysisCache = goal.getAnalysisCache(transitionMatrix)) {
+        // The sets are shared with other properties of the same model, so we need to copy them.
+        statesWithProbability01 = *analysisCache->getProb01(
+            goal.minimize() ? storm::OptimizationDirection::Minimize : storm::OptimizationDirection::Maximize, phiStates, psiStates);
+    } else if (goal.minimize()) {
         statesWithProbability01 =
             storm::utility::graph::performProb01Min(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates);
     } else {
@@ -8,6 +8,7 @@
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/modelchecker/results/HybridQuantitativeCheckResult.h"
 #include "storm/modelchecker/results/LexicographicCheckResult.h"
+#include "storm/modelchecker/results/StatisticalCheckResult.h"
 #include "storm/modelchecker/results/SymbolicParetoCurveCheckResult.h"
 #include "storm/modelchecker/results/SymbolicQualitativeCheckResult.h"
 #include "storm/modelchecker/results/SymbolicQuantitativeCheckResult.h"
@@ -82,6 +83,10 @@ bool CheckResult::isHybridQuantitativeCheckResult() const {
     return false;
 }
 
+bool CheckResult::isStatisticalCheckResult() const {
+    return false;
+}
+
 ExplicitQualitativeCheckResult& CheckResult::asExplicitQualitativeCheckResult() {
     return dynamic_cast<ExplicitQualitativeCheckResult&>(*this);
 }
@@ -120,6 +125,16 @@ LexicographicCheckResult<ValueType> const& CheckResult::asLexicographicCheckResu
     return dynamic_cast<LexicographicCheckResult<ValueType> const&>(*this);
 }
 
+template<typename ValueType>
+StatisticalCheckResult<ValueType>& CheckResult::asStatisticalCheckResult() {
+    return dynamic_cast<StatisticalCheckResult<ValueType>&>(*this);
+}
+
+template<typename ValueType>
+StatisticalCheckResult<ValueType> const& CheckResult::asStatisticalCheckResult() const {
+    return dynamic_cast<StatisticalCheckResult<ValueType> const&>(*this);
+}
+
 QualitativeCheckResult& CheckResult::asQualitativeCheckResult() {
     return dynamic_cast<QualitativeCheckResult&>(*this);
 }
@@ -193,6 +208,9 @@ template ExplicitParetoCurveCheckResult<double> const& CheckResult::asExplicitPa
 template LexicographicCheckResult<double>& CheckResult::asLexicographicCheckResult();
 template LexicographicCheckResult<double> const& CheckResult::asLexicographicCheckResult() const;
 
+template StatisticalCheckResult<double>& CheckResult::asStatisticalCheckResult();
+template StatisticalCheckResult<double> const& CheckResult::asStatisticalCheckResult() const;
+
 template SymbolicQualitativeCheckResult<storm::dd::DdType::CUDD>& CheckResult::asSymbolicQualitativeCheckResult();
 template SymbolicQualitativeCheckResult<storm::dd::DdType::CUDD> const& CheckResult::asSymbolicQualitativeCheckResult() const;
 template SymbolicQuantitativeCheckResult<storm::dd::DdType::CUDD, double>& CheckResult::asSymbolicQuantitativeCheckResult();
@@ -24,6 +24,9 @@ class ExplicitParetoCurveCheckResult;
 template<typename ValueType>
 class LexicographicCheckResult;
 
+template<typename ValueType>
+class StatisticalCheckResult;
+
 template<storm::dd::DdType Type>
 class SymbolicQualitativeCheckResult;
 
@@ -66,6 +69,7 @@ class CheckResult {
     virtual bool isSymbolicQuantitativeCheckResult() const;
     virtual bool isSymbolicParetoCurveCheckResult() const;
     virtual bool isHybridQuantitativeCheckResult() const;
+    virtual bool isStatisticalCheckResult() const;
     virtual bool isResultForAllStates() const;
 
     QualitativeCheckResult& asQualitativeCheckResult();
@@ -98,6 +102,12 @@ class CheckResult {
     template<typename ValueType>
     LexicographicCheckResult<ValueType> const& asLexicographicCheckResult() const;
 
+    template<typename ValueType>
+    StatisticalCheckResult<ValueType>& asStatisticalCheckResult();
+
+    template<typename ValueType>
+    StatisticalCheckResult<ValueType> const& asStatisticalCheckResult() const;
+
     template<storm::dd::DdType Type>
     SymbolicQualitativeCheckResult<Type>& asSymbolicQualitativeCheckResult();
 
@@ -0,0 +1,76 @@
+#include "storm/modelchecker/results/StatisticalCheckResult.h"
+
+#include <ostream>
+
+#include "storm/utility/constants.h"
+
+namespace storm {
+namespace modelchecker {
+
+template<typename ValueType>
+StatisticalCheckResult<ValueType>::StatisticalCheckResult(storm::storage::sparse::state_type const& state, ValueType const& estimate,
+                                                          ValueType const& lowerBound, ValueType const& upperBound, double confidence,
+                                                          uint64_t numberOfSamples)
+    : ExplicitQuantitativeCheckResult<ValueType>(state, estimate),
+      state(state),
+      lowerBound(lowerBound),
+      upperBound(upperBound),
+      confidence(confidence),
+      numberOfSamples(numberOfSamples) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+std::unique_ptr<CheckResult> StatisticalCheckResult<ValueType>::clone() const {
+    return std::make_unique<StatisticalCheckResult<ValueType>>(*this);
+}
+
+template<typename ValueType>
+bool StatisticalCheckResult<ValueType>::isStatisticalCheckResult() const {
+    return true;
+}
+
+template<typename ValueType>
+ValueType const& StatisticalCheckResult<ValueType>::getEstimate() const {
+    return (*this)[state];
+}
+
+template<typename ValueType>
+ValueType const& StatisticalCheckResult<ValueType>::getLowerBound() const {
+    return lowerBound;
+}
+
+template<typename ValueType>
+ValueType const& StatisticalCheckResult<ValueType>::getUpperBound() const {
+    return upperBound;
+}
+
+template<typename ValueType>
+double StatisticalCheckResult<ValueType>::getConfidence() const {
+    return confidence;
+}
+
+template<typename ValueType>
+uint64_t StatisticalCheckResult<ValueType>::getNumberOfSamples() const {
+    return numberOfSamples;
+}
+
+template<typename ValueType>
+std::ostream& StatisticalCheckResult<ValueType>::writeToStream(std::ostream& out) const {
+    out << getEstimate() << " (" << confidence * 100.0 << "% confidence interval [" << lowerBound << ", " << upperBound << "], " << numberOfSamples
+        << " samples)";
+    return out;
+}
+
+template<typename ValueType>
+void StatisticalCheckResult<ValueType>::oneMinus() {
+    ExplicitQuantitativeCheckResult<ValueType>::oneMinus();
+    ValueType newLowerBound = storm::utility::one<ValueType>() - upperBound;
+    upperBound = storm::utility::one<ValueType>() - lowerBound;
+    lowerBound = newLowerBound;
+}
+
+template class StatisticalCheckResult<double>;
+
+}  // namespace modelchecker
+}  // namespace storm
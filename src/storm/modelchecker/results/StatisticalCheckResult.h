@@ -0,0 +1,56 @@
+#pragma once
+
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+
+namespace storm {
+namespace modelchecker {
+
+/*!
+ * The result of statistical model checking for a single state, i.e., an estimate of the value together with a confidence interval.
+ */
+template<typename ValueType>
+class StatisticalCheckResult : public ExplicitQuantitativeCheckResult<ValueType> {
+   public:
+    StatisticalCheckResult(storm::storage::sparse::state_type const& state, ValueType const& estimate, ValueType const& lowerBound,
+                           ValueType const& upperBound, double confidence, uint64_t numberOfSamples);
+    virtual ~StatisticalCheckResult() = default;
+
+    virtual std::unique_ptr<CheckResult> clone() const override;
+
+    virtual bool isStatisticalCheckResult() const override;
+
+    /*!
+     * Retrieves the estimated value.
+     */
+    ValueType const& getEstimate() const;
+
+    /*!
+     * Retrieves the bounds of the confidence interval.
+     */
+    ValueType const& getLowerBound() const;
+    ValueType const& getUpperBound() const;
+
+    /*!
+     * Retrieves the probability with which the actual value lies within the confidence interval.
+     */
+    double getConfidence() const;
+
+    /*!
+     * Retrieves the number of sampled paths the estimate is based on.
+     */
+    uint64_t getNumberOfSamples() const;
+
+    virtual std::ostream& writeToStream(std::ostream& out) const override;
+
+    virtual void oneMinus() override;
+
+   private:
+    storm::storage::sparse::state_type state;
+    ValueType lowerBound;
+    ValueType upperBound;
+    double confidence;
+    uint64_t numberOfSamples;
+};
+
+}  // namespace modelchecker
+}  // namespace storm
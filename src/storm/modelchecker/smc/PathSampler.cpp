@@ -0,0 +1,155 @@
+#include "storm/modelchecker/smc/PathSampler.h"
+
+#include <limits>
+
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/storage/expressions/ExpressionEvaluator.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace modelchecker {
+namespace smc {
+
+template<typename ValueType>
+PathSampler<ValueType>::PathSampler(std::unique_ptr<storm::generator::NextStateGenerator<ValueType, uint32_t>>&& generator,
+                                    std::vector<storm::expressions::Expression> const& stateFormulas, uint64_t seed)
+    : generator(std::move(generator)), absorbing(false), numberOfSuccessors(0), stateFormulas(stateFormulas), randomEngine(seed) {
+    STORM_LOG_THROW(this->generator->isDeterministicModel(), storm::exceptions::NotSupportedException,
+                    "Sampling paths is only supported for deterministic models.");
+    stateToIdCallback = [this](storm::generator::CompressedState const& state) { return this->addSuccessor(state); };
+
+    // Try to compile the state formulas. The evaluator is only created if that fails.
+    try {
+        stateFormulaBytecode = std::make_unique<storm::generator::ExpressionBytecode>();
+        for (auto const& formula : this->stateFormulas) {
+            stateFormulaOutputs.push_back(stateFormulaBytecode->addExpression(formula, this->generator->getVariableInformation()));
+        }
+    } catch (storm::exceptions::NotSupportedException const& e) {
+        STORM_LOG_DEBUG("Falling back to the expression evaluator for state formulas: " << e.what());
+        stateFormulaBytecode.reset();
+        stateFormulaOutputs.clear();
+        evaluator = std::make_unique<storm::expressions::ExpressionEvaluator<ValueType>>(this->stateFormulas.front().getManager());
+    }
+    stateFormulaValues.resize(this->stateFormulas.size());
+
+    // Computing the initial states may be expensive, so it is only done once.
+    std::vector<uint32_t> initialStates = this->generator->getInitialStates(stateToIdCallback);
+    STORM_LOG_THROW(initialStates.size() == 1, storm::exceptions::NotSupportedException, "Sampling paths requires a unique initial state.");
+    initialState = successors[initialStates.front()];
+}
+
+template<typename ValueType>
+PathSampler<ValueType>::~PathSampler() = default;
+
+template<typename ValueType>
+void PathSampler<ValueType>::resetToInitialState() {
+    currentState = initialState;
+    explore();
+}
+
+template<typename ValueType>
+void PathSampler<ValueType>::step() {
+    STORM_LOG_ASSERT(!absorbing, "Cannot leave an absorbing state.");
+    auto const& choice = behavior.getChoices().front();
+    double quantile = uniformDistribution(randomEngine) * storm::utility::convertNumber<double>(choice.getTotalMass());
+    uint32_t successor = 0;
+    for (auto const& entry : choice) {
+        // If the quantile is not reached due to numerical imprecisions, the last successor is taken.
+        successor = entry.first;
+        quantile -= storm::utility::convertNumber<double>(entry.second);
+        if (quantile < 0.0) {
+            break;
+        }
+    }
+    std::swap(currentState, successors[successor]);
+    explore();
+}
+
+template<typename ValueType>
+bool PathSampler<ValueType>::satisfies(uint64_t stateFormulaIndex) const {
+    return stateFormulaValues[stateFormulaIndex];
+}
+
+template<typename ValueType>
+bool PathSampler<ValueType>::isAbsorbing() const {
+    return absorbing;
+}
+
+template<typename ValueType>
+ValueType PathSampler<ValueType>::getStateReward(uint64_t rewardModelIndex) const {
+    return behavior.getStateRewards()[rewardModelIndex];
+}
+
+template<typename ValueType>
+ValueType PathSampler<ValueType>::getActionReward(uint64_t rewardModelIndex) const {
+    if (behavior.empty()) {
+        return storm::utility::zero<ValueType>();
+    }
+    return behavior.getChoices().front().getRewards()[rewardModelIndex];
+}
+
+template<typename ValueType>
+ValueType PathSampler<ValueType>::getExitRate() const {
+    if (behavior.empty()) {
+        return storm::utility::zero<ValueType>();
+    }
+    return behavior.getChoices().front().getTotalMass();
+}
+
+template<typename ValueType>
+double PathSampler<ValueType>::sampleSojournTime() {
+    if (absorbing) {
+        return std::numeric_limits<double>::infinity();
+    }
+    std::exponential_distribution<double> sojournTimeDistribution(storm::utility::convertNumber<double>(getExitRate()));
+    return sojournTimeDistribution(randomEngine);
+}
+
+template<typename ValueType>
+storm::generator::NextStateGenerator<ValueType, uint32_t> const& PathSampler<ValueType>::getGenerator() const {
+    return *generator;
+}
+
+template<typename ValueType>
+void PathSampler<ValueType>::explore() {
+    // The successors of the previous state are no longer needed.
+    numberOfSuccessors = 0;
+    generator->load(currentState);
+    behavior = generator->expand(stateToIdCallback);
+    STORM_LOG_ASSERT(behavior.getNumberOfChoices() <= 1, "Expected at most one choice for a deterministic model.");
+    if (behavior.empty()) {
+        absorbing = true;
+    } else {
+        auto const& choice = behavior.getChoices().front();
+        absorbing = choice.size() == 1 && successors[choice.begin()->first] == currentState;
+    }
+
+    if (stateFormulaBytecode) {
+        stateFormulaBytecode->execute(currentState);
+        for (uint64_t formulaIndex = 0; formulaIndex < stateFormulaOutputs.size(); ++formulaIndex) {
+            stateFormulaValues[formulaIndex] = stateFormulaBytecode->getBoolean(stateFormulaOutputs[formulaIndex]);
+        }
+    } else {
+        storm::generator::unpackStateIntoEvaluator(currentState, generator->getVariableInformation(), *evaluator);
+        for (uint64_t formulaIndex = 0; formulaIndex < stateFormulas.size(); ++formulaIndex) {
+            stateFormulaValues[formulaIndex] = evaluator->asBool(stateFormulas[formulaIndex]);
+        }
+    }
+}
+
+template<typename ValueType>
+uint32_t PathSampler<ValueType>::addSuccessor(storm::generator::CompressedState const& state) {
+    if (numberOfSuccessors < successors.size()) {
+        successors[numberOfSuccessors] = state;
+    } else {
+        successors.push_back(state);
+    }
+    return static_cast<uint32_t>(numberOfSuccessors++);
+}
+
+template class PathSampler<double>;
+
+}  // namespace smc
+}  // namespace modelchecker
+}  // namespace storm
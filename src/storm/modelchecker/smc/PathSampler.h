@@ -0,0 +1,123 @@
+#pragma once
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "storm/generator/CompressedState.h"
+#include "storm/generator/ExpressionBytecode.h"
+#include "storm/generator/NextStateGenerator.h"
+#include "storm/generator/StateBehavior.h"
+#include "storm/storage/expressions/Expression.h"
+
+namespace storm {
+namespace expressions {
+template<typename ValueType>
+class ExpressionEvaluator;
+}
+
+namespace modelchecker {
+namespace smc {
+
+/*!
+ * Samples paths of a deterministic model (DTMC or CTMC) directly from a next-state generator, i.e., without storing any part of the state space.
+ *
+ * The sampler keeps only the current state and its successors. A given set of state formulas is evaluated in every visited state. A sampler is not
+ * thread-safe, i.e., every thread needs to use its own sampler (and generator).
+ */
+template<typename ValueType>
+class PathSampler {
+   public:
+    /*!
+     * Creates a sampler for the model described by the given generator.
+     *
+     * @param generator The generator of the model. It has to describe a DTMC or a CTMC with a unique initial state.
+     * @param stateFormulas The (propositional) formulas that are to be evaluated in the visited states.
+     * @param seed The seed of the random number generator.
+     */
+    PathSampler(std::unique_ptr<storm::generator::NextStateGenerator<ValueType, uint32_t>>&& generator,
+                std::vector<storm::expressions::Expression> const& stateFormulas, uint64_t seed);
+
+    ~PathSampler();
+
+    /*!
+     * Starts a new path in the initial state.
+     */
+    void resetToInitialState();
+
+    /*!
+     * Moves to a randomly selected successor of the current state.
+     * @pre The current state is not absorbing.
+     */
+    void step();
+
+    /*!
+     * Retrieves whether the state formula with the given index holds in the current state.
+     */
+    bool satisfies(uint64_t stateFormulaIndex) const;
+
+    /*!
+     * Retrieves whether the current state can not be left, i.e., whether it is a deadlock state or only has a self-loop.
+     */
+    bool isAbsorbing() const;
+
+    /*!
+     * Retrieves the state reward of the current state for the reward model with the given index (w.r.t. the reward models of the generator).
+     */
+    ValueType getStateReward(uint64_t rewardModelIndex) const;
+
+    /*!
+     * Retrieves the reward that is earned when leaving the current state for the reward model with the given index.
+     */
+    ValueType getActionReward(uint64_t rewardModelIndex) const;
+
+    /*!
+     * Retrieves the exit rate of the current state of a CTMC (or the total probability mass of its successors for a DTMC).
+     */
+    ValueType getExitRate() const;
+
+    /*!
+     * Samples the time that is spent in the current state of a CTMC. For absorbing states, the result is infinity.
+     */
+    double sampleSojournTime();
+
+    /*!
+     * Retrieves the generator that is used to explore the states.
+     */
+    storm::generator::NextStateGenerator<ValueType, uint32_t> const& getGenerator() const;
+
+   private:
+    // Loads the current state into the generator, expands it and evaluates the state formulas.
+    void explore();
+
+    // Registers a successor state and returns its (temporary) index.
+    uint32_t addSuccessor(storm::generator::CompressedState const& state);
+
+    std::unique_ptr<storm::generator::NextStateGenerator<ValueType, uint32_t>> generator;
+    std::function<uint32_t(storm::generator::CompressedState const&)> stateToIdCallback;
+
+    // The initial state as well as the current state and its behavior.
+    storm::generator::CompressedState initialState;
+    storm::generator::CompressedState currentState;
+    storm::generator::StateBehavior<ValueType, uint32_t> behavior;
+    bool absorbing;
+
+    // The successors of the current state, indexed by the numbers passed to the generator. Only the first numberOfSuccessors entries are valid; the
+    // remaining ones are kept to reuse their memory.
+    std::vector<storm::generator::CompressedState> successors;
+    uint64_t numberOfSuccessors;
+
+    // The state formulas are evaluated with a bytecode program if possible and with an expression evaluator otherwise.
+    std::vector<storm::expressions::Expression> stateFormulas;
+    std::unique_ptr<storm::generator::ExpressionBytecode> stateFormulaBytecode;
+    std::vector<uint64_t> stateFormulaOutputs;
+    std::unique_ptr<storm::expressions::ExpressionEvaluator<ValueType>> evaluator;
+    std::vector<bool> stateFormulaValues;
+
+    std::mt19937_64 randomEngine;
+    std::uniform_real_distribution<double> uniformDistribution;
+};
+
+}  // namespace smc
+}  // namespace modelchecker
+}  // namespace storm
@@ -0,0 +1,493 @@
+#include "storm/modelchecker/smc/StatisticalModelChecker.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <mutex>
+#include <random>
+
+#include "storm/environment/Environment.h"
+#include "storm/environment/modelchecker/StatisticalModelCheckerEnvironment.h"
+#include "storm/generator/JaniNextStateGenerator.h"
+#include "storm/generator/PrismNextStateGenerator.h"
+#include "storm/logic/FragmentSpecification.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/StatisticalCheckResult.h"
+#include "storm/modelchecker/smc/PathSampler.h"
+#include "storm/modelchecker/smc/StatisticalTests.h"
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/jani/Model.h"
+#include "storm/storage/prism/Program.h"
+#include "storm/utility/TaskPool.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/InvalidPropertyException.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+namespace modelchecker {
+
+namespace {
+// The number of paths a thread samples before it merges its statistics and checks the stopping criterion.
+uint64_t const batchSize = 256;
+
+// Estimates of expected rewards rely on the sample variance, so they are based on at least this many samples.
+uint64_t const minimalNumberOfRewardSamples = 1000;
+
+void checkPathLength(uint64_t steps, uint64_t maximalPathLength) {
+    STORM_LOG_THROW(steps < maximalPathLength, storm::exceptions::NotSupportedException,
+                    "A sampled path was not decided within " << maximalPathLength << " steps. Consider increasing the maximal path length.");
+}
+}  // namespace
+
+template<typename ModelType>
+const bool StatisticalModelChecker<ModelType>::isContinuousTime =
+    std::is_same<ModelType, storm::models::sparse::Ctmc<typename ModelType::ValueType>>::value;
+
+template<typename ModelType>
+StatisticalModelChecker<ModelType>::StatisticalModelChecker(storm::storage::SymbolicModelDescription const& modelDescription) {
+    typedef storm::storage::SymbolicModelDescription::ModelType SymbolicModelType;
+    STORM_LOG_THROW(modelDescription.getModelType() == SymbolicModelType::DTMC || modelDescription.getModelType() == SymbolicModelType::CTMC,
+                    storm::exceptions::NotSupportedException, "Statistical model checking is only supported for DTMCs and CTMCs.");
+    STORM_LOG_THROW((modelDescription.getModelType() == SymbolicModelType::CTMC) == isContinuousTime, storm::exceptions::InvalidArgumentException,
+                    "The type of the model description does not match the type of the model checker.");
+    if (modelDescription.isPrismProgram()) {
+        storm::prism::Program program = modelDescription.asPrismProgram().substituteConstantsFormulas();
+        labelToExpressionMapping = program.getLabelToExpressionMapping();
+        this->modelDescription = program;
+    } else {
+        this->modelDescription = modelDescription;
+    }
+}
+
+template<typename ModelType>
+bool StatisticalModelChecker<ModelType>::canHandleStatic(CheckTask<storm::logic::Formula, ValueType> const& checkTask) {
+    storm::logic::FragmentSpecification fragment = storm::logic::propositional();
+    fragment.setProbabilityOperatorsAllowed(true);
+    fragment.setRewardOperatorsAllowed(true);
+    fragment.setUntilFormulasAllowed(true);
+    fragment.setReachabilityProbabilityFormulasAllowed(true);
+    fragment.setBoundedUntilFormulasAllowed(true);
+    fragment.setStepBoundedUntilFormulasAllowed(true);
+    fragment.setTimeBoundedUntilFormulasAllowed(true);
+    fragment.setCumulativeRewardFormulasAllowed(true);
+    fragment.setStepBoundedCumulativeRewardFormulasAllowed(true);
+    fragment.setTimeBoundedCumulativeRewardFormulasAllowed(true);
+    fragment.setInstantaneousFormulasAllowed(true);
+    fragment.setReachabilityRewardFormulasAllowed(true);
+    fragment.setOperatorAtTopLevelRequired(true);
+    fragment.setNestedOperatorsAllowed(false);
+    return checkTask.getFormula().isInFragment(fragment) && checkTask.isOnlyInitialStatesRelevantSet();
+}
+
+template<typename ModelType>
+bool StatisticalModelChecker<ModelType>::canHandle(CheckTask<storm::logic::Formula, ValueType> const& checkTask) const {
+    return canHandleStatic(checkTask);
+}
+
+template<typename ModelType>
+std::unique_ptr<CheckResult> StatisticalModelChecker<ModelType>::checkProbabilityOperatorFormula(
+    Environment const& env, CheckTask<storm::logic::ProbabilityOperatorFormula, ValueType> const& checkTask) {
+    auto const& smcEnv = env.modelchecker().smc();
+    if (checkTask.isBoundSet() && smcEnv.getStoppingCriterion() == smc::StoppingCriterion::Sprt) {
+        double threshold = checkTask.getBoundThreshold();
+        double epsilon = smcEnv.getEpsilon();
+        if (threshold - epsilon > 0.0 && threshold + epsilon < 1.0) {
+            SamplingTask task = createUntilTask(env, checkTask.getFormula().getSubformula());
+            double errorProbability = std::min(1.0 - smcEnv.getConfidence(), 0.49);
+            smc::SequentialProbabilityRatioTest test(threshold, epsilon, errorProbability);
+            SampleStatistics statistics =
+                sample(env, task, std::numeric_limits<uint64_t>::max(), [threshold, epsilon, errorProbability](SampleStatistics const& current) {
+                    smc::SequentialProbabilityRatioTest currentTest(threshold, epsilon, errorProbability);
+                    currentTest.addSamples(std::llround(current.sum), current.numberOfSamples);
+                    return currentTest.hasDecision();
+                });
+            test.addSamples(std::llround(statistics.sum), statistics.numberOfSamples);
+            STORM_LOG_INFO("Sequential probability ratio test decided after " << statistics.numberOfSamples << " samples.");
+            bool aboveThreshold = test.isAboveThreshold();
+            return std::make_unique<ExplicitQualitativeCheckResult>(0, storm::logic::isLowerBound(checkTask.getBoundComparisonType()) == aboveThreshold);
+        }
+        STORM_LOG_WARN("The indifference region of the sequential probability ratio test around the threshold "
+                       << threshold << " exceeds [0,1]. Estimating the probability instead.");
+    }
+    return AbstractModelChecker<ModelType>::checkProbabilityOperatorFormula(env, checkTask);
+}
+
+template<typename ModelType>
+std::unique_ptr<CheckResult> StatisticalModelChecker<ModelType>::computeBoundedUntilProbabilities(
+    Environment const& env, CheckTask<storm::logic::BoundedUntilFormula, ValueType> const& checkTask) {
+    return estimate(env, createUntilTask(env, checkTask.getFormula()));
+}
+
+template<typename ModelType>
+std::unique_ptr<CheckResult> StatisticalModelChecker<ModelType>::computeUntilProbabilities(Environment const& env,
+                                                                                            CheckTask<storm::logic::UntilFormula, ValueType> const& checkTask) {
+    return estimate(env, createUntilTask(env, checkTask.getFormula()));
+}
+
+template<typename ModelType>
+std::unique_ptr<CheckResult> StatisticalModelChecker<ModelType>::computeCumulativeRewards(
+    Environment const& env, CheckTask<storm::logic::CumulativeRewardFormula, ValueType> const& checkTask) {
+    storm::logic::CumulativeRewardFormula const& rewardPathFormula = checkTask.getFormula();
+    STORM_LOG_THROW(!rewardPathFormula.isMultiDimensional() && !rewardPathFormula.getTimeBoundReference().isRewardBound(),
+                    storm::exceptions::NotSupportedException, "Statistical model checking does not support reward-bounded cumulative reward formulas.");
+    STORM_LOG_THROW(!rewardPathFormula.hasRewardAccumulation(), storm::exceptions::NotSupportedException,
+                    "Statistical model checking does not support reward accumulations.");
+
+    SamplingTask task;
+    task.rewardModelName = checkTask.isRewardModelSet() ? checkTask.getRewardModel() : "";
+    task.isBernoulli = false;
+    if (isContinuousTime) {
+        double timeBound = rewardPathFormula.template getBound<double>();
+        task.evaluatePath = [timeBound](smc::PathSampler<ValueType>& sampler) {
+            double reward = 0.0;
+            double time = 0.0;
+            while (true) {
+                double sojournTime = sampler.sampleSojournTime();
+                reward += sampler.getStateReward(0) * std::min(sojournTime, timeBound - time);
+                if (time + sojournTime > timeBound) {
+                    return reward;
+                }
+                reward += sampler.getActionReward(0);
+                time += sojournTime;
+                sampler.step();
+            }
+        };
+    } else {
+        STORM_LOG_THROW(rewardPathFormula.hasIntegerBound(), storm::exceptions::InvalidPropertyException, "Formula needs to have a discrete time bound.");
+        uint64_t stepBound = rewardPathFormula.template getNonStrictBound<uint64_t>();
+        task.evaluatePath = [stepBound](smc::PathSampler<ValueType>& sampler) {
+            double reward = 0.0;
+            for (uint64_t step = 0; step < stepBound; ++step) {
+                double stepReward = sampler.getStateReward(0) + sampler.getActionReward(0);
+                if (sampler.isAbsorbing()) {
+                    // The remaining steps all collect the same reward.
+                    return reward + stepReward * static_cast<double>(stepBound - step);
+                }
+                reward += stepReward;
+                sampler.step();
+            }
+            return reward;
+        };
+    }
+    return estimate(env, task);
+}
+
+template<typename ModelType>
+std::unique_ptr<CheckResult> StatisticalModelChecker<ModelType>::computeInstantaneousRewards(
+    Environment const& env, CheckTask<storm::logic::InstantaneousRewardFormula, ValueType> const& checkTask) {
+    storm::logic::InstantaneousRewardFormula const& rewardPathFormula = checkTask.getFormula();
+
+    SamplingTask task;
+    task.rewardModelName = checkTask.isRewardModelSet() ? checkTask.getRewardModel() : "";
+    task.isBernoulli = false;
+    if (isContinuousTime) {
+        double timeBound = rewardPathFormula.template getBound<double>();
+        task.evaluatePath = [timeBound](smc::PathSampler<ValueType>& sampler) {
+            double time = 0.0;
+            while (true) {
+                time += sampler.sampleSojournTime();
+                if (time > timeBound) {
+                    return static_cast<double>(sampler.getStateReward(0));
+                }
+                sampler.step();
+            }
+        };
+    } else {
+        STORM_LOG_THROW(rewardPathFormula.hasIntegerBound(), storm::exceptions::InvalidPropertyException, "Formula needs to have a discrete time bound.");
+        uint64_t stepBound = rewardPathFormula.template getBound<uint64_t>();
+        task.evaluatePath = [stepBound](smc::PathSampler<ValueType>& sampler) {
+            for (uint64_t step = 0; step < stepBound && !sampler.isAbsorbing(); ++step) {
+                sampler.step();
+            }
+            return static_cast<double>(sampler.getStateReward(0));
+        };
+    }
+    return estimate(env, task);
+}
+
+template<typename ModelType>
+std::unique_ptr<CheckResult> StatisticalModelChecker<ModelType>::computeReachabilityRewards(
+    Environment const& env, CheckTask<storm::logic::EventuallyFormula, ValueType> const& checkTask) {
+    SamplingTask task;
+    task.stateFormulas.push_back(getStateExpression(checkTask.getFormula().getSubformula()));
+    task.rewardModelName = checkTask.isRewardModelSet() ? checkTask.getRewardModel() : "";
+    task.isBernoulli = false;
+    uint64_t maximalPathLength = env.modelchecker().smc().getMaximalPathLength();
+    bool continuousTime = isContinuousTime;
+    task.evaluatePath = [maximalPathLength, continuousTime](smc::PathSampler<ValueType>& sampler) {
+        double reward = 0.0;
+        for (uint64_t step = 0; !sampler.satisfies(0); ++step) {
+            if (sampler.isAbsorbing()) {
+                // The target is never reached, so the expected reward is infinite.
+                return storm::utility::infinity<double>();
+            }
+            checkPathLength(step, maximalPathLength);
+            // For CTMCs, state rewards are collected at the expected sojourn time, which avoids the variance of sampling it.
+            double stateReward = sampler.getStateReward(0);
+            reward += (continuousTime ? stateReward / sampler.getExitRate() : stateReward) + sampler.getActionReward(0);
+            sampler.step();
+        }
+        return reward;
+    };
+    return estimate(env, task);
+}
+
+template<typename ModelType>
+void StatisticalModelChecker<ModelType>::SampleStatistics::add(double value) {
+    if (std::isinf(value)) {
+        infinite = true;
+        ++numberOfSamples;
+        return;
+    }
+    // Update the statistics using Welford's algorithm.
+    double previousMean = getMean();
+    ++numberOfSamples;
+    sum += value;
+    squaredDeviations += (value - previousMean) * (value - getMean());
+}
+
+template<typename ModelType>
+void StatisticalModelChecker<ModelType>::SampleStatistics::add(SampleStatistics const& other) {
+    if (other.numberOfSamples == 0) {
+        return;
+    }
+    if (numberOfSamples == 0) {
+        *this = other;
+        return;
+    }
+    // Merge the statistics as proposed by Chan et al.
+    double delta = other.getMean() - getMean();
+    double totalNumberOfSamples = static_cast<double>(numberOfSamples + other.numberOfSamples);
+    squaredDeviations += other.squaredDeviations +
+                         delta * delta * static_cast<double>(numberOfSamples) * static_cast<double>(other.numberOfSamples) / totalNumberOfSamples;
+    sum += other.sum;
+    numberOfSamples += other.numberOfSamples;
+    infinite |= other.infinite;
+}
+
+template<typename ModelType>
+double StatisticalModelChecker<ModelType>::SampleStatistics::getMean() const {
+    return numberOfSamples == 0 ? 0.0 : sum / static_cast<double>(numberOfSamples);
+}
+
+template<typename ModelType>
+double StatisticalModelChecker<ModelType>::SampleStatistics::getVariance() const {
+    return numberOfSamples < 2 ? 0.0 : squaredDeviations / static_cast<double>(numberOfSamples - 1);
+}
+
+template<typename ModelType>
+typename StatisticalModelChecker<ModelType>::SampleStatistics StatisticalModelChecker<ModelType>::sample(
+    Environment const& env, SamplingTask const& task, uint64_t maximalNumberOfSamples, std::function<bool(SampleStatistics const&)> const& isDone) const {
+    auto const& smcEnv = env.modelchecker().smc();
+    uint64_t numberOfThreads = std::max<uint64_t>(1, smcEnv.getNumberOfThreads());
+    uint64_t baseSeed = smcEnv.isSeedSet() ? smcEnv.getSeed() : (static_cast<uint64_t>(std::random_device()()) << 32) | std::random_device()();
+
+    SampleStatistics statistics;
+    std::mutex statisticsMutex;
+    std::atomic<uint64_t> claimedSamples(0);
+    std::atomic<bool> done(false);
+
+    // Every thread samples with its own generator and random number generator. The seeds of the threads are derived from the base seed.
+    storm::utility::TaskPool pool(numberOfThreads);
+    for (uint64_t thread = 0; thread < numberOfThreads; ++thread) {
+        pool.submit([&, thread]() {
+            try {
+                std::seed_seq seedSequence{static_cast<uint32_t>(baseSeed), static_cast<uint32_t>(baseSeed >> 32), static_cast<uint32_t>(thread)};
+                std::array<uint32_t, 2> seeds;
+                seedSequence.generate(seeds.begin(), seeds.end());
+                std::unique_ptr<smc::PathSampler<ValueType>> sampler = createSampler(task, (static_cast<uint64_t>(seeds[0]) << 32) | seeds[1]);
+
+                while (!done) {
+                    uint64_t firstSample = claimedSamples.fetch_add(batchSize);
+                    if (firstSample >= maximalNumberOfSamples) {
+                        break;
+                    }
+                    uint64_t numberOfBatchSamples = std::min(batchSize, maximalNumberOfSamples - firstSample);
+                    SampleStatistics batch;
+                    for (uint64_t sample = 0; sample < numberOfBatchSamples && !batch.infinite; ++sample) {
+                        sampler->resetToInitialState();
+                        batch.add(task.evaluatePath(*sampler));
+                    }
+
+                    std::lock_guard<std::mutex> lock(statisticsMutex);
+                    if (done) {
+                        break;
+                    }
+                    statistics.add(batch);
+                    if (statistics.infinite || isDone(statistics)) {
+                        done = true;
+                    }
+                }
+            } catch (...) {
+                // Let the other threads stop as well.
+                done = true;
+                throw;
+            }
+        });
+    }
+    pool.wait();
+    STORM_LOG_INFO("Sampled " << statistics.numberOfSamples << " paths using " << numberOfThreads << " threads.");
+    return statistics;
+}
+
+template<typename ModelType>
+std::unique_ptr<CheckResult> StatisticalModelChecker<ModelType>::estimate(Environment const& env, SamplingTask const& task) const {
+    auto const& smcEnv = env.modelchecker().smc();
+    double epsilon = smcEnv.getEpsilon();
+    double confidence = smcEnv.getConfidence();
+    uint64_t const unbounded = std::numeric_limits<uint64_t>::max();
+
+    SampleStatistics statistics;
+    std::pair<double, double> interval;
+    if (task.isBernoulli && smcEnv.getStoppingCriterion() == smc::StoppingCriterion::ChernoffHoeffding) {
+        uint64_t numberOfSamples = smc::getChernoffHoeffdingSampleCount(epsilon, confidence);
+        statistics = sample(env, task, numberOfSamples,
+                            [numberOfSamples](SampleStatistics const& current) { return current.numberOfSamples >= numberOfSamples; });
+        interval = {std::max(0.0, statistics.getMean() - epsilon), std::min(1.0, statistics.getMean() + epsilon)};
+    } else if (task.isBernoulli) {
+        STORM_LOG_WARN_COND(smcEnv.getStoppingCriterion() == smc::StoppingCriterion::ClopperPearson,
+                            "The sequential probability ratio test requires a probability bound. Using Clopper-Pearson intervals instead.");
+        statistics = sample(env, task, unbounded, [epsilon, confidence](SampleStatistics const& current) {
+            auto currentInterval = smc::getClopperPearsonInterval(std::llround(current.sum), current.numberOfSamples, confidence);
+            return currentInterval.second - currentInterval.first <= 2.0 * epsilon;
+        });
+        interval = smc::getClopperPearsonInterval(std::llround(statistics.sum), statistics.numberOfSamples, confidence);
+    } else {
+        // Rewards are not bounded a priori, so the interval is based on the central limit theorem.
+        STORM_LOG_INFO_COND(smcEnv.getStoppingCriterion() != smc::StoppingCriterion::ChernoffHoeffding,
+                            "Expected rewards are estimated using normal confidence intervals.");
+        statistics = sample(env, task, unbounded, [epsilon, confidence](SampleStatistics const& current) {
+            if (current.numberOfSamples < minimalNumberOfRewardSamples) {
+                return false;
+            }
+            auto currentInterval = smc::getNormalInterval(current.getMean(), current.getVariance(), current.numberOfSamples, confidence);
+            return currentInterval.second - currentInterval.first <= 2.0 * epsilon;
+        });
+        if (statistics.infinite) {
+            double infinity = storm::utility::infinity<double>();
+            return std::make_unique<StatisticalCheckResult<ValueType>>(0, infinity, infinity, infinity, confidence, statistics.numberOfSamples);
+        }
+        interval = smc::getNormalInterval(statistics.getMean(), statistics.getVariance(), statistics.numberOfSamples, confidence);
+    }
+    return std::make_unique<StatisticalCheckResult<ValueType>>(0, statistics.getMean(), interval.first, interval.second, confidence,
+                                                               statistics.numberOfSamples);
+}
+
+template<typename ModelType>
+std::unique_ptr<smc::PathSampler<typename ModelType::ValueType>> StatisticalModelChecker<ModelType>::createSampler(SamplingTask const& task,
+                                                                                                                  uint64_t seed) const {
+    storm::builder::BuilderOptions options;
+    if (task.rewardModelName) {
+        options.addRewardModel(task.rewardModelName.get());
+    }
+    std::unique_ptr<storm::generator::NextStateGenerator<ValueType, uint32_t>> generator;
+    if (modelDescription.isPrismProgram()) {
+        // Evaluating guards and updates dominates the time to sample a path, so the expressions are evaluated with bytecode where possible.
+        options.setBytecodeEvaluation();
+        generator = std::make_unique<storm::generator::PrismNextStateGenerator<ValueType, uint32_t>>(modelDescription.asPrismProgram(), options);
+    } else {
+        generator = std::make_unique<storm::generator::JaniNextStateGenerator<ValueType, uint32_t>>(modelDescription.asJaniModel(), options);
+    }
+    STORM_LOG_ASSERT(!task.rewardModelName || generator->getNumberOfRewardModels() == 1, "Expected exactly one reward model.");
+    return std::make_unique<smc::PathSampler<ValueType>>(std::move(generator), task.stateFormulas, seed);
+}
+
+template<typename ModelType>
+storm::expressions::Expression StatisticalModelChecker<ModelType>::getStateExpression(storm::logic::Formula const& stateFormula) const {
+    storm::expressions::ExpressionManager const& manager =
+        modelDescription.isPrismProgram() ? modelDescription.asPrismProgram().getManager() : modelDescription.asJaniModel().getManager();
+    return stateFormula.toExpression(manager, labelToExpressionMapping);
+}
+
+template<typename ModelType>
+typename StatisticalModelChecker<ModelType>::SamplingTask StatisticalModelChecker<ModelType>::createUntilTask(Environment const& env,
+                                                                                                            storm::logic::Formula const& pathFormula) const {
+    SamplingTask task;
+    task.isBernoulli = true;
+    bool hasUpperBound = false;
+    double lowerBound = 0.0;
+    double upperBound = storm::utility::infinity<double>();
+    if (pathFormula.isBoundedUntilFormula()) {
+        storm::logic::BoundedUntilFormula const& untilFormula = pathFormula.asBoundedUntilFormula();
+        STORM_LOG_THROW(!untilFormula.isMultiDimensional() && !untilFormula.getTimeBoundReference().isRewardBound(), storm::exceptions::NotSupportedException,
+                        "Statistical model checking does not support reward-bounded until formulas.");
+        task.stateFormulas.push_back(getStateExpression(untilFormula.getLeftSubformula()));
+        task.stateFormulas.push_back(getStateExpression(untilFormula.getRightSubformula()));
+        hasUpperBound = untilFormula.hasUpperBound();
+        if (isContinuousTime) {
+            lowerBound = untilFormula.hasLowerBound() ? untilFormula.template getLowerBound<double>() : 0.0;
+            upperBound = hasUpperBound ? untilFormula.template getUpperBound<double>() : upperBound;
+        } else {
+            STORM_LOG_THROW(untilFormula.hasIntegerLowerBound() && (!hasUpperBound || untilFormula.hasIntegerUpperBound()),
+                            storm::exceptions::InvalidPropertyException, "Formula needs to have discrete step bounds.");
+            lowerBound = untilFormula.hasLowerBound() ? static_cast<double>(untilFormula.template getNonStrictLowerBound<uint64_t>()) : 0.0;
+            upperBound = hasUpperBound ? static_cast<double>(untilFormula.template getNonStrictUpperBound<uint64_t>()) : upperBound;
+        }
+    } else if (pathFormula.isUntilFormula()) {
+        task.stateFormulas.push_back(getStateExpression(pathFormula.asUntilFormula().getLeftSubformula()));
+        task.stateFormulas.push_back(getStateExpression(pathFormula.asUntilFormula().getRightSubformula()));
+    } else {
+        STORM_LOG_THROW(pathFormula.isReachabilityProbabilityFormula(), storm::exceptions::NotSupportedException,
+                        "Statistical model checking does not support the formula " << pathFormula << ".");
+        task.stateFormulas.push_back(getStateExpression(*storm::logic::Formula::getTrueFormula()));
+        task.stateFormulas.push_back(getStateExpression(pathFormula.asReachabilityProbabilityFormula().getSubformula()));
+    }
+
+    // The indices of the state formulas for the left and right subformula.
+    uint64_t const phi = 0;
+    uint64_t const psi = 1;
+    uint64_t maximalPathLength = env.modelchecker().smc().getMaximalPathLength();
+    if (isContinuousTime) {
+        task.evaluatePath = [lowerBound, upperBound, maximalPathLength](smc::PathSampler<ValueType>& sampler) {
+            double time = 0.0;
+            for (uint64_t step = 0;; ++step) {
+                checkPathLength(step, maximalPathLength);
+                // The path stays in the current state during [time, time + sojournTime).
+                double sojournTime = sampler.sampleSojournTime();
+                if (sampler.satisfies(psi) && time <= upperBound && time + sojournTime > lowerBound && (time >= lowerBound || sampler.satisfies(phi))) {
+                    return 1.0;
+                }
+                if (!sampler.satisfies(phi) || time + sojournTime > upperBound || sampler.isAbsorbing()) {
+                    return 0.0;
+                }
+                time += sojournTime;
+                sampler.step();
+            }
+        };
+    } else {
+        uint64_t stepLowerBound = static_cast<uint64_t>(lowerBound);
+        uint64_t stepUpperBound = hasUpperBound ? static_cast<uint64_t>(upperBound) : std::numeric_limits<uint64_t>::max();
+        task.evaluatePath = [stepLowerBound, stepUpperBound, hasUpperBound, maximalPathLength](smc::PathSampler<ValueType>& sampler) {
+            for (uint64_t step = 0;; ++step) {
+                if (step >= stepLowerBound && sampler.satisfies(psi)) {
+                    return 1.0;
+                }
+                if (!sampler.satisfies(phi) || step >= stepUpperBound) {
+                    return 0.0;
+                }
+                if (sampler.isAbsorbing()) {
+                    // The path stays in the current state forever, so it satisfies the formula iff the lower bound is not reached yet.
+                    return step < stepLowerBound && stepLowerBound <= stepUpperBound && sampler.satisfies(psi) ? 1.0 : 0.0;
+                }
+                if (!hasUpperBound) {
+                    checkPathLength(step, maximalPathLength);
+                }
+                sampler.step();
+            }
+        };
+    }
+    return task;
+}
+
+template class StatisticalModelChecker<storm::models::sparse::Dtmc<double>>;
+template class StatisticalModelChecker<storm::models::sparse::Ctmc<double>>;
+
+}  // namespace modelchecker
+}  // namespace storm
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "storm/modelchecker/AbstractModelChecker.h"
+#include "storm/storage/SymbolicModelDescription.h"
+
+namespace storm {
+
+class Environment;
+
+namespace modelchecker {
+namespace smc {
+template<typename ValueType>
+class PathSampler;
+}
+
+/*!
+ * A model checker that estimates the values of properties of deterministic models (DTMCs and CTMCs) by sampling paths.
+ *
+ * Paths are sampled directly from the PRISM or JANI next-state generator, so the state space is never stored. Several threads sample paths
+ * concurrently, each one with its own generator and an independent stream of random numbers. The number of sampled paths is determined by the stopping
+ * criterion that is set in the environment. The results are given together with a confidence interval for the initial state.
+ */
+template<typename ModelType>
+class StatisticalModelChecker : public AbstractModelChecker<ModelType> {
+   public:
+    typedef typename ModelType::ValueType ValueType;
+
+    explicit StatisticalModelChecker(storm::storage::SymbolicModelDescription const& modelDescription);
+
+    static bool canHandleStatic(CheckTask<storm::logic::Formula, ValueType> const& checkTask);
+
+    virtual bool canHandle(CheckTask<storm::logic::Formula, ValueType> const& checkTask) const override;
+
+    virtual std::unique_ptr<CheckResult> checkProbabilityOperatorFormula(
+        Environment const& env, CheckTask<storm::logic::ProbabilityOperatorFormula, ValueType> const& checkTask) override;
+
+    virtual std::unique_ptr<CheckResult> computeBoundedUntilProbabilities(Environment const& env,
+                                                                          CheckTask<storm::logic::BoundedUntilFormula, ValueType> const& checkTask) override;
+    virtual std::unique_ptr<CheckResult> computeUntilProbabilities(Environment const& env,
+                                                                   CheckTask<storm::logic::UntilFormula, ValueType> const& checkTask) override;
+
+    virtual std::unique_ptr<CheckResult> computeCumulativeRewards(Environment const& env,
+                                                                  CheckTask<storm::logic::CumulativeRewardFormula, ValueType> const& checkTask) override;
+    virtual std::unique_ptr<CheckResult> computeInstantaneousRewards(Environment const& env,
+                                                                     CheckTask<storm::logic::InstantaneousRewardFormula, ValueType> const& checkTask) override;
+    virtual std::unique_ptr<CheckResult> computeReachabilityRewards(Environment const& env,
+                                                                    CheckTask<storm::logic::EventuallyFormula, ValueType> const& checkTask) override;
+
+   private:
+    // Assigns a value to the path that is currently sampled. The sampler is in the initial state when the function is called.
+    typedef std::function<double(smc::PathSampler<ValueType>&)> PathEvaluator;
+
+    // A description of the values that are sampled.
+    struct SamplingTask {
+        // The state formulas that are evaluated along the paths.
+        std::vector<storm::expressions::Expression> stateFormulas;
+        // The reward model that is needed to evaluate paths (if any).
+        boost::optional<std::string> rewardModelName;
+        PathEvaluator evaluatePath;
+        // Whether all values are in {0,1}.
+        bool isBernoulli;
+    };
+
+    // The (merged) statistics of the sampled values.
+    struct SampleStatistics {
+        uint64_t numberOfSamples = 0;
+        double sum = 0.0;
+        // The sum of squared deviations from the mean.
+        double squaredDeviations = 0.0;
+        // Set if one of the values is infinite.
+        bool infinite = false;
+
+        void add(double value);
+        void add(SampleStatistics const& other);
+        double getMean() const;
+        double getVariance() const;
+    };
+
+    /*!
+     * Samples paths until the given function indicates that enough samples have been drawn.
+     *
+     * @param maximalNumberOfSamples The number of samples after which sampling is stopped in any case.
+     * @param isDone Called with the statistics of all samples drawn so far whenever a batch of samples has been added.
+     */
+    SampleStatistics sample(Environment const& env, SamplingTask const& task, uint64_t maximalNumberOfSamples,
+                            std::function<bool(SampleStatistics const&)> const& isDone) const;
+
+    /*!
+     * Estimates the expected value of the sampled values according to the stopping criterion of the environment.
+     */
+    std::unique_ptr<CheckResult> estimate(Environment const& env, SamplingTask const& task) const;
+
+    std::unique_ptr<smc::PathSampler<ValueType>> createSampler(SamplingTask const& task, uint64_t seed) const;
+
+    storm::expressions::Expression getStateExpression(storm::logic::Formula const& stateFormula) const;
+
+    SamplingTask createUntilTask(Environment const& env, storm::logic::Formula const& pathFormula) const;
+
+    // Whether the model is a CTMC (as opposed to a DTMC).
+    static const bool isContinuousTime;
+
+    storm::storage::SymbolicModelDescription modelDescription;
+    std::map<std::string, storm::expressions::Expression> labelToExpressionMapping;
+};
+
+}  // namespace modelchecker
+}  // namespace storm
@@ -0,0 +1,67 @@
+#include "storm/modelchecker/smc/StatisticalTests.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <boost/math/distributions/beta.hpp>
+#include <boost/math/distributions/normal.hpp>
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace modelchecker {
+namespace smc {
+
+uint64_t getChernoffHoeffdingSampleCount(double epsilon, double confidence) {
+    STORM_LOG_THROW(epsilon > 0.0 && confidence > 0.0 && confidence < 1.0, storm::exceptions::InvalidArgumentException,
+                    "The error bound must be positive and the confidence must lie in (0,1).");
+    return static_cast<uint64_t>(std::ceil(std::log(2.0 / (1.0 - confidence)) / (2.0 * epsilon * epsilon)));
+}
+
+std::pair<double, double> getClopperPearsonInterval(uint64_t successes, uint64_t samples, double confidence) {
+    STORM_LOG_ASSERT(samples > 0 && successes <= samples, "Invalid number of samples.");
+    double alpha = 1.0 - confidence;
+    double successCount = static_cast<double>(successes);
+    double failureCount = static_cast<double>(samples - successes);
+    double lower = successes == 0 ? 0.0 : boost::math::quantile(boost::math::beta_distribution<double>(successCount, failureCount + 1.0), alpha / 2.0);
+    double upper =
+        successes == samples ? 1.0 : boost::math::quantile(boost::math::beta_distribution<double>(successCount + 1.0, failureCount), 1.0 - alpha / 2.0);
+    return {lower, upper};
+}
+
+std::pair<double, double> getNormalInterval(double mean, double variance, uint64_t samples, double confidence) {
+    STORM_LOG_ASSERT(samples > 0, "Invalid number of samples.");
+    double quantile = boost::math::quantile(boost::math::normal_distribution<double>(), 1.0 - (1.0 - confidence) / 2.0);
+    double halfWidth = quantile * std::sqrt(std::max(variance, 0.0) / static_cast<double>(samples));
+    return {mean - halfWidth, mean + halfWidth};
+}
+
+SequentialProbabilityRatioTest::SequentialProbabilityRatioTest(double threshold, double indifference, double errorProbability)
+    : probabilityAbove(threshold + indifference), probabilityBelow(threshold - indifference), logLikelihoodRatio(0.0) {
+    STORM_LOG_THROW(probabilityBelow > 0.0 && probabilityAbove < 1.0, storm::exceptions::InvalidArgumentException,
+                    "The indifference region [" << probabilityBelow << ", " << probabilityAbove << "] needs to lie within (0,1).");
+    STORM_LOG_THROW(errorProbability > 0.0 && errorProbability < 0.5, storm::exceptions::InvalidArgumentException,
+                    "The error probability must lie in (0,0.5).");
+    aboveBound = std::log(errorProbability / (1.0 - errorProbability));
+    belowBound = std::log((1.0 - errorProbability) / errorProbability);
+}
+
+void SequentialProbabilityRatioTest::addSamples(uint64_t successes, uint64_t samples) {
+    STORM_LOG_ASSERT(successes <= samples, "Invalid number of samples.");
+    logLikelihoodRatio += static_cast<double>(successes) * std::log(probabilityBelow / probabilityAbove) +
+                          static_cast<double>(samples - successes) * std::log((1.0 - probabilityBelow) / (1.0 - probabilityAbove));
+}
+
+bool SequentialProbabilityRatioTest::hasDecision() const {
+    return logLikelihoodRatio <= aboveBound || logLikelihoodRatio >= belowBound;
+}
+
+bool SequentialProbabilityRatioTest::isAboveThreshold() const {
+    STORM_LOG_ASSERT(hasDecision(), "The test has not decided yet.");
+    return logLikelihoodRatio <= aboveBound;
+}
+
+}  // namespace smc
+}  // namespace modelchecker
+}  // namespace storm
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstdint>
+#include <utility>
+
+namespace storm {
+namespace modelchecker {
+namespace smc {
+
+/*!
+ * Computes the number of samples that suffices to estimate the mean of a [0,1]-valued random variable (e.g. a probability) up to the given absolute
+ * error with the given confidence, according to the Chernoff-Hoeffding bound (also known as Okamoto bound).
+ *
+ * @param epsilon The maximal absolute error.
+ * @param confidence The probability with which the error must not be exceeded.
+ */
+uint64_t getChernoffHoeffdingSampleCount(double epsilon, double confidence);
+
+/*!
+ * Computes the (exact) Clopper-Pearson confidence interval for the success probability of a Bernoulli experiment.
+ *
+ * @param successes The number of successful samples.
+ * @param samples The number of samples (must be positive).
+ * @param confidence The confidence level of the interval.
+ * @return The lower and upper bound of the interval.
+ */
+std::pair<double, double> getClopperPearsonInterval(uint64_t successes, uint64_t samples, double confidence);
+
+/*!
+ * Computes the confidence interval for the mean of a random variable based on the normal approximation (central limit theorem).
+ *
+ * @param mean The sample mean.
+ * @param variance The (unbiased) sample variance.
+ * @param samples The number of samples (must be positive).
+ * @param confidence The confidence level of the interval.
+ * @return The lower and upper bound of the interval.
+ */
+std::pair<double, double> getNormalInterval(double mean, double variance, uint64_t samples, double confidence);
+
+/*!
+ * Wald's sequential probability ratio test that decides whether a success probability p is above or below a threshold.
+ *
+ * The test distinguishes the hypotheses p >= threshold + indifference and p <= threshold - indifference. If p lies within the indifference region, either
+ * decision may be taken.
+ */
+class SequentialProbabilityRatioTest {
+   public:
+    /*!
+     * @param threshold The threshold to compare the success probability with.
+     * @param indifference The half-width of the region around the threshold in which both decisions are acceptable.
+     * @param errorProbability The probability with which the test may decide wrongly (both for type I and type II errors).
+     */
+    SequentialProbabilityRatioTest(double threshold, double indifference, double errorProbability);
+
+    /*!
+     * Adds the outcome of the given number of samples.
+     */
+    void addSamples(uint64_t successes, uint64_t samples);
+
+    /*!
+     * Retrieves whether the test has decided.
+     */
+    bool hasDecision() const;
+
+    /*!
+     * Retrieves whether the test decided that the success probability is above the threshold.
+     * @pre The test has decided.
+     */
+    bool isAboveThreshold() const;
+
+   private:
+    // The success probabilities of the two hypotheses.
+    double probabilityAbove;
+    double probabilityBelow;
+
+    // The test decides as soon as the log-likelihood ratio leaves the interval (aboveBound, belowBound).
+    double aboveBound;
+    double belowBound;
+    double logLikelihoodRatio;
+};
+
+}  // namespace smc
+}  // namespace modelchecker
+}  // namespace storm
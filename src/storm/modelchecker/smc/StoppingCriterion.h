@@ -0,0 +1,18 @@
+#pragma once
+
+namespace storm {
+namespace modelchecker {
+namespace smc {
+
+/*!
+ * The criteria that determine when statistical model checking stops sampling paths.
+ */
+enum class StoppingCriterion {
+    ChernoffHoeffding,  /// A fixed number of samples that is derived from the Chernoff-Hoeffding bound
+    ClopperPearson,     /// Sample until the (exact) Clopper-Pearson confidence interval is narrow enough
+    Sprt                /// Wald's sequential probability ratio test (only for probability bounds)
+};
+
+}  // namespace smc
+}  // namespace modelchecker
+}  // namespace storm
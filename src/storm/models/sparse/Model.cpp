@@ -11,6 +11,8 @@
 #include "storm/models/sparse/Ctmc.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
 #include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/ModelCheckerSettings.h"
 #include "storm/storage/SparseMatrixOperations.h"
 #include "storm/utility/NumberTraits.h"
 #include "storm/utility/rationalfunction.h"
@@ -22,6 +24,33 @@ namespace storm {
 namespace models {
 namespace sparse {
 
+template<typename ValueType, typename RewardModelType>
+Model<ValueType, RewardModelType>::Model(Model<ValueType, RewardModelType> const& other)
+    : storm::models::Model<ValueType>(other),
+      transitionMatrix(other.transitionMatrix),
+      stateLabeling(other.stateLabeling),
+      rewardModels(other.rewardModels),
+      choiceLabeling(other.choiceLabeling),
+      stateValuations(other.stateValuations),
+      choiceOrigins(other.choiceOrigins) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType, typename RewardModelType>
+Model<ValueType, RewardModelType>& Model<ValueType, RewardModelType>::operator=(Model<ValueType, RewardModelType> const& other) {
+    if (this != &other) {
+        storm::models::Model<ValueType>::operator=(other);
+        transitionMatrix = other.transitionMatrix;
+        stateLabeling = other.stateLabeling;
+        rewardModels = other.rewardModels;
+        choiceLabeling = other.choiceLabeling;
+        stateValuations = other.stateValuations;
+        choiceOrigins = other.choiceOrigins;
+        invalidateAnalysisCache();
+    }
+    return *this;
+}
+
 template<typename ValueType, typename RewardModelType>
 Model<ValueType, RewardModelType>::Model(ModelType modelType, storm::storage::sparse::ModelComponents<ValueType, RewardModelType> const& components)
     : storm::models::Model<ValueType>(modelType),
@@ -153,6 +182,25 @@ storm::storage::SparseMatrix<ValueType> Model<ValueType, RewardModelType>::getBa
     return this->getTransitionMatrix().transpose(true);
 }
 
+template<typename ValueType, typename RewardModelType>
+std::shared_ptr<ModelAnalysisCache<ValueType>> Model<ValueType, RewardModelType>::getAnalysisCache() const {
+    std::lock_guard<std::mutex> lock(analysisCacheMutex);
+    if (!analysisCache) {
+        uint64_t memoryBudget = ModelAnalysisCache<ValueType>::defaultMemoryBudget;
+        if (storm::settings::hasModule<storm::settings::modules::ModelCheckerSettings>()) {
+            memoryBudget = storm::settings::getModule<storm::settings::modules::ModelCheckerSettings>().getAnalysisCacheBudget();
+        }
+        analysisCache = std::make_shared<ModelAnalysisCache<ValueType>>(transitionMatrix, memoryBudget);
+    }
+    return analysisCache;
+}
+
+template<typename ValueType, typename RewardModelType>
+void Model<ValueType, RewardModelType>::invalidateAnalysisCache() {
+    std::lock_guard<std::mutex> lock(analysisCacheMutex);
+    analysisCache.reset();
+}
+
 template<typename ValueType, typename RewardModelType>
 typename storm::storage::SparseMatrix<ValueType>::const_rows Model<ValueType, RewardModelType>::getRows(storm::storage::sparse::state_type state) const {
     return this->getTransitionMatrix().getRowGroup(state);
@@ -200,6 +248,8 @@ storm::storage::SparseMatrix<ValueType> const& Model<ValueType, RewardModelType>
 
 template<typename ValueType, typename RewardModelType>
 storm::storage::SparseMatrix<ValueType>& Model<ValueType, RewardModelType>::getTransitionMatrix() {
+    // The matrix might be modified, which invalidates all cached analyses.
+    invalidateAnalysisCache();
     return transitionMatrix;
 }
 
@@ -620,11 +670,13 @@ std::set<std::string> Model<ValueType, RewardModelType>::getLabelsOfState(storm:
 template<typename ValueType, typename RewardModelType>
 void Model<ValueType, RewardModelType>::setTransitionMatrix(storm::storage::SparseMatrix<ValueType> const& transitionMatrix) {
     this->transitionMatrix = transitionMatrix;
+    invalidateAnalysisCache();
 }
 
 template<typename ValueType, typename RewardModelType>
 void Model<ValueType, RewardModelType>::setTransitionMatrix(storm::storage::SparseMatrix<ValueType>&& transitionMatrix) {
     this->transitionMatrix = std::move(transitionMatrix);
+    invalidateAnalysisCache();
 }
 
 template<typename ValueType, typename RewardModelType>
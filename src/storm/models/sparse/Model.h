@@ -1,5 +1,6 @@
 #pragma once
 
+#include <mutex>
 #include <optional>
 #include <unordered_map>
 #include <vector>
@@ -7,6 +8,7 @@
 #include "storm/models/Model.h"
 #include "storm/models/ModelRepresentation.h"
 #include "storm/models/sparse/ChoiceLabeling.h"
+#include "storm/models/sparse/ModelAnalysisCache.h"
 #include "storm/models/sparse/StateLabeling.h"
 #include "storm/storage/SparseMatrix.h"
 #include "storm/storage/sparse/ChoiceOrigins.h"
@@ -36,8 +38,9 @@ class Model : public storm::models::Model<CValueType> {
     typedef CRewardModelType RewardModelType;
     static const storm::models::ModelRepresentation Representation = ModelRepresentation::Sparse;
 
-    Model(Model<ValueType, RewardModelType> const& other) = default;
-    Model& operator=(Model<ValueType, RewardModelType> const& other) = default;
+    // A copy does not share the analysis cache of the original, since the cached results refer to the transition matrix of the original.
+    Model(Model<ValueType, RewardModelType> const& other);
+    Model& operator=(Model<ValueType, RewardModelType> const& other);
 
     /*!
      * Constructs a model from the given data.
@@ -58,6 +61,19 @@ class Model : public storm::models::Model<CValueType> {
      */
     storm::storage::SparseMatrix<ValueType> getBackwardTransitions() const;
 
+    /*!
+     * Retrieves the cache for graph analyses of this model, which is shared by all properties that are checked on this model. The cache is created upon the
+     * first call. This method may be called concurrently.
+     *
+     * @return The analysis cache of this model.
+     */
+    std::shared_ptr<ModelAnalysisCache<ValueType>> getAnalysisCache() const;
+
+    /*!
+     * Discards all cached analyses.
+     */
+    void invalidateAnalysisCache();
+
     /*!
      * Returns an object representing the matrix rows associated with the given state.
      *
@@ -125,7 +141,7 @@ class Model : public storm::models::Model<CValueType> {
     storm::storage::SparseMatrix<ValueType> const& getTransitionMatrix() const;
 
     /*!
-     * Retrieves the matrix representing the transitions of the model.
+     * Retrieves the matrix representing the transitions of the model. As the matrix might be modified, the analysis cache is discarded.
      *
      * @return A matrix representing the transitions of the model.
      */
@@ -454,6 +470,12 @@ class Model : public storm::models::Model<CValueType> {
     //  A matrix representing transition relation.
     storm::storage::SparseMatrix<ValueType> transitionMatrix;
 
+    // The (lazily created) cache for graph analyses of the transition matrix.
+    mutable std::shared_ptr<ModelAnalysisCache<ValueType>> analysisCache;
+
+    // Guards the creation of the analysis cache.
+    mutable std::mutex analysisCacheMutex;
+
     // The labeling of the states.
     storm::models::sparse::StateLabeling stateLabeling;
 
@@ -0,0 +1,171 @@
+#include "storm/models/sparse/ModelAnalysisCache.h"
+
+#include <boost/functional/hash.hpp>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/storage/MaximalEndComponentDecomposition.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/graph.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace models {
+namespace sparse {
+
+namespace {
+// The following functions estimate the number of bytes occupied by the cached results.
+uint64_t getSize(std::pair<storm::storage::BitVector, storm::storage::BitVector> const& stateSets) {
+    return sizeof(stateSets) + stateSets.first.getSizeInBytes() + stateSets.second.getSizeInBytes();
+}
+
+template<typename ValueType>
+uint64_t getSize(storm::storage::SparseMatrix<ValueType> const& matrix) {
+    using IndexType = typename storm::storage::SparseMatrix<ValueType>::index_type;
+    return sizeof(matrix) + matrix.getEntryCount() * sizeof(storm::storage::MatrixEntry<IndexType, ValueType>) +
+           (matrix.getRowCount() + matrix.getRowGroupCount() + 2) * sizeof(IndexType);
+}
+
+template<typename ValueType>
+uint64_t getSize(storm::storage::MaximalEndComponentDecomposition<ValueType> const& decomposition) {
+    // Each state of a MEC occupies a node of a hash map and a set of choices.
+    uint64_t size = sizeof(decomposition);
+    for (auto const& mec : decomposition) {
+        size += sizeof(mec);
+        for (auto const& stateChoices : mec) {
+            size += 4 * sizeof(uint64_t) + sizeof(stateChoices) + stateChoices.second.size() * sizeof(uint64_t);
+        }
+    }
+    return size;
+}
+}  // namespace
+
+template<typename ValueType>
+const uint64_t ModelAnalysisCache<ValueType>::defaultMemoryBudget = 512ull * 1024ull * 1024ull;
+
+template<typename ValueType>
+ModelAnalysisCache<ValueType>::ModelAnalysisCache(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, uint64_t memoryBudget)
+    : transitionMatrix(transitionMatrix), memoryBudget(memoryBudget), memoryUsage(0) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+bool ModelAnalysisCache<ValueType>::isCacheFor(storm::storage::SparseMatrix<ValueType> const& transitionMatrix) const {
+    return &this->transitionMatrix == &transitionMatrix;
+}
+
+template<typename ValueType>
+std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> ModelAnalysisCache<ValueType>::getBackwardTransitions() {
+    return getOrCompute<storm::storage::SparseMatrix<ValueType>>(Key{Analysis::BackwardTransitions, {}},
+                                                                 [this]() { return transitionMatrix.transpose(true); });
+}
+
+template<typename ValueType>
+std::shared_ptr<std::pair<storm::storage::BitVector, storm::storage::BitVector> const> ModelAnalysisCache<ValueType>::getProb01(
+    storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
+    return getOrCompute<std::pair<storm::storage::BitVector, storm::storage::BitVector>>(
+        Key{Analysis::Prob01, {phiStates, psiStates}},
+        [this, &phiStates, &psiStates]() { return storm::utility::graph::performProb01(*getBackwardTransitions(), phiStates, psiStates); });
+}
+
+template<typename ValueType>
+std::shared_ptr<std::pair<storm::storage::BitVector, storm::storage::BitVector> const> ModelAnalysisCache<ValueType>::getProb01(
+    storm::OptimizationDirection direction, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
+    bool minimize = storm::solver::minimize(direction);
+    return getOrCompute<std::pair<storm::storage::BitVector, storm::storage::BitVector>>(
+        Key{minimize ? Analysis::Prob01Min : Analysis::Prob01Max, {phiStates, psiStates}}, [this, minimize, &phiStates, &psiStates]() {
+            auto backwardTransitions = getBackwardTransitions();
+            if (minimize) {
+                return storm::utility::graph::performProb01Min(transitionMatrix, transitionMatrix.getRowGroupIndices(), *backwardTransitions, phiStates,
+                                                               psiStates);
+            } else {
+                return storm::utility::graph::performProb01Max(transitionMatrix, transitionMatrix.getRowGroupIndices(), *backwardTransitions, phiStates,
+                                                               psiStates);
+            }
+        });
+}
+
+template<typename ValueType>
+std::shared_ptr<storm::storage::MaximalEndComponentDecomposition<ValueType> const> ModelAnalysisCache<ValueType>::getMaximalEndComponentDecomposition(
+    storm::storage::BitVector const& states, uint64_t numberOfThreads) {
+    return getOrCompute<storm::storage::MaximalEndComponentDecomposition<ValueType>>(
+        Key{Analysis::MaximalEndComponents, {states}}, [this, &states, numberOfThreads]() {
+            return storm::storage::MaximalEndComponentDecomposition<ValueType>(transitionMatrix, *getBackwardTransitions(), states, numberOfThreads);
+        });
+}
+
+template<typename ValueType>
+uint64_t ModelAnalysisCache<ValueType>::getMemoryUsage() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return memoryUsage;
+}
+
+template<typename ValueType>
+void ModelAnalysisCache<ValueType>::clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    entries.clear();
+    recentUses.clear();
+    memoryUsage = 0;
+}
+
+template<typename ValueType>
+bool ModelAnalysisCache<ValueType>::Key::operator==(Key const& other) const {
+    return analysis == other.analysis && stateSets == other.stateSets;
+}
+
+template<typename ValueType>
+std::size_t ModelAnalysisCache<ValueType>::KeyHash::operator()(Key const& key) const {
+    std::size_t seed = static_cast<std::size_t>(key.analysis);
+    for (auto const& stateSet : key.stateSets) {
+        boost::hash_combine(seed, std::hash<storm::storage::BitVector>()(stateSet));
+    }
+    return seed;
+}
+
+template<typename ValueType>
+template<typename ResultType, typename ComputeFunction>
+std::shared_ptr<ResultType const> ModelAnalysisCache<ValueType>::getOrCompute(Key&& key, ComputeFunction const& compute) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto entryIt = entries.find(key);
+        if (entryIt != entries.end()) {
+            recentUses.splice(recentUses.begin(), recentUses, entryIt->second.recentUse);
+            return std::static_pointer_cast<ResultType const>(entryIt->second.result);
+        }
+    }
+
+    // The result is computed without holding the lock, such that other results can be retrieved in the meantime.
+    auto result = std::make_shared<ResultType const>(compute());
+    uint64_t size = getSize(*result);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (size > memoryBudget || entries.count(key) > 0) {
+        // The result does not fit into the cache or has been inserted concurrently.
+        return result;
+    }
+    recentUses.push_front(key);
+    entries.emplace(std::move(key), Entry{result, size, recentUses.begin()});
+    memoryUsage += size;
+    evict();
+    return result;
+}
+
+template<typename ValueType>
+void ModelAnalysisCache<ValueType>::evict() {
+    while (memoryUsage > memoryBudget) {
+        STORM_LOG_ASSERT(!recentUses.empty(), "Memory is used although no results are cached.");
+        auto entryIt = entries.find(recentUses.back());
+        STORM_LOG_TRACE("Evicting an analysis result of " << entryIt->second.size << " bytes from the model analysis cache.");
+        memoryUsage -= entryIt->second.size;
+        entries.erase(entryIt);
+        recentUses.pop_back();
+    }
+}
+
+template class ModelAnalysisCache<double>;
+template class ModelAnalysisCache<storm::RationalNumber>;
+template class ModelAnalysisCache<storm::RationalFunction>;
+template class ModelAnalysisCache<storm::Interval>;
+
+}  // namespace sparse
+}  // namespace models
+}  // namespace storm
@@ -0,0 +1,129 @@
+#pragma once
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+namespace storage {
+template<typename ValueType>
+class SparseMatrix;
+template<typename ValueType>
+class MaximalEndComponentDecomposition;
+}  // namespace storage
+
+namespace models {
+namespace sparse {
+
+/*!
+ * Caches the results of graph analyses of a model (backward transitions, qualitative reachability and end component decompositions), such that queries
+ * that are checked one after another on the same model do not need to repeat them.
+ *
+ * Results are identified by the kind of analysis and the state sets (and optimization direction) it depends on. The cache stays within a memory budget by
+ * evicting the least recently used results. Retrieved results are shared, i.e., they stay valid even if they are evicted afterwards.
+ * All methods may be called concurrently.
+ */
+template<typename ValueType>
+class ModelAnalysisCache {
+   public:
+    /*!
+     * The memory budget (in bytes) that is used if none is specified in the settings.
+     */
+    static const uint64_t defaultMemoryBudget;
+
+    /*!
+     * Creates an empty cache for the given transition matrix.
+     *
+     * @param transitionMatrix The transition matrix of the model. The cache does not take ownership, i.e., the matrix has to outlive the cache.
+     * @param memoryBudget The (approximate) number of bytes that the cached results may occupy. If zero, no results are kept.
+     */
+    ModelAnalysisCache(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, uint64_t memoryBudget);
+
+    /*!
+     * Retrieves whether this cache holds results for the given matrix, i.e., whether it is the matrix the cache was created for.
+     */
+    bool isCacheFor(storm::storage::SparseMatrix<ValueType> const& transitionMatrix) const;
+
+    /*!
+     * Retrieves the backward transitions (in which the row groups are joined).
+     */
+    std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> getBackwardTransitions();
+
+    /*!
+     * Retrieves the states that have probability 0 and 1, respectively, of satisfying phi U psi in a deterministic model.
+     */
+    std::shared_ptr<std::pair<storm::storage::BitVector, storm::storage::BitVector> const> getProb01(storm::storage::BitVector const& phiStates,
+                                                                                                    storm::storage::BitVector const& psiStates);
+
+    /*!
+     * Retrieves the states that have minimal or maximal probability 0 and 1, respectively, of satisfying phi U psi in a nondeterministic model.
+     */
+    std::shared_ptr<std::pair<storm::storage::BitVector, storm::storage::BitVector> const> getProb01(storm::OptimizationDirection direction,
+                                                                                                    storm::storage::BitVector const& phiStates,
+                                                                                                    storm::storage::BitVector const& psiStates);
+
+    /*!
+     * Retrieves the maximal end component decomposition of the subsystem induced by the given states.
+     *
+     * @param numberOfThreads The number of threads that are used if the decomposition needs to be computed.
+     */
+    std::shared_ptr<storm::storage::MaximalEndComponentDecomposition<ValueType> const> getMaximalEndComponentDecomposition(
+        storm::storage::BitVector const& states, uint64_t numberOfThreads = 1);
+
+    /*!
+     * Retrieves the (approximate) number of bytes occupied by the cached results.
+     */
+    uint64_t getMemoryUsage() const;
+
+    /*!
+     * Removes all cached results.
+     */
+    void clear();
+
+   private:
+    enum class Analysis { BackwardTransitions, Prob01, Prob01Min, Prob01Max, MaximalEndComponents };
+
+    struct Key {
+        Analysis analysis;
+        std::vector<storm::storage::BitVector> stateSets;
+
+        bool operator==(Key const& other) const;
+    };
+
+    struct KeyHash {
+        std::size_t operator()(Key const& key) const;
+    };
+
+    struct Entry {
+        std::shared_ptr<void const> result;
+        uint64_t size;
+        typename std::list<Key>::iterator recentUse;
+    };
+
+    // Retrieves the result for the given key and computes (and inserts) it if it is not cached.
+    template<typename ResultType, typename ComputeFunction>
+    std::shared_ptr<ResultType const> getOrCompute(Key&& key, ComputeFunction const& compute);
+
+    // Evicts the least recently used results until the cached results fit into the budget.
+    void evict();
+
+    storm::storage::SparseMatrix<ValueType> const& transitionMatrix;
+    uint64_t memoryBudget;
+
+    mutable std::mutex mutex;
+    std::unordered_map<Key, Entry, KeyHash> entries;
+    // The keys of all entries, most recently used first.
+    std::list<Key> recentUses;
+    uint64_t memoryUsage;
+};
+
+}  // namespace sparse
+}  // namespace models
+}  // namespace storm
@@ -22,6 +22,7 @@ const std::string BisimulationSettings::reuseOptionName = "reuse";
 const std::string BisimulationSettings::initialPartitionOptionName = "init";
 const std::string BisimulationSettings::refinementModeOptionName = "refine";
 const std::string BisimulationSettings::exactArithmeticDdOptionName = "ddexact";
+const std::string BisimulationSettings::sparseSignatureRefinementOptionName = "sparsesig";
 
 BisimulationSettings::BisimulationSettings() : ModuleSettings(moduleName) {
     std::vector<std::string> types = {"strong", "weak"};
@@ -55,6 +56,11 @@ BisimulationSettings::BisimulationSettings() : ModuleSettings(moduleName) {
         storm::settings::OptionBuilder(moduleName, exactArithmeticDdOptionName, false, "Sets whether to use exact arithmetic in dd-based bisimulation.")
             .setIsAdvanced()
             .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, sparseSignatureRefinementOptionName, false,
+                                                   "Sets whether sparse strong bisimulation refines the partition based on the signatures of all states in "
+                                                   "parallel (uses the number of solver threads).")
+                        .setIsAdvanced()
+                        .build());
 
     std::vector<std::string> signatureModes = {"eager", "lazy"};
     this->addOption(storm::settings::OptionBuilder(moduleName, signatureModeOptionName, false, "Sets the signature computation mode.")
@@ -173,6 +179,10 @@ BisimulationSettings::RefinementMode BisimulationSettings::getRefinementMode() c
     return RefinementMode::Full;
 }
 
+bool BisimulationSettings::isSparseSignatureRefinementSet() const {
+    return this->getOption(sparseSignatureRefinementOptionName).getHasOptionBeenSet();
+}
+
 bool BisimulationSettings::check() const {
     bool optionsSet = this->getOption(typeOptionName).getHasOptionBeenSet();
     STORM_LOG_WARN_COND(storm::settings::getModule<storm::settings::modules::GeneralSettings>().isBisimulationSet() || !optionsSet,
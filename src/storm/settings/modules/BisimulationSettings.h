@@ -96,6 +96,12 @@ class BisimulationSettings : public ModuleSettings {
      */
     RefinementMode getRefinementMode() const;
 
+    /*!
+     * Retrieves whether the sparse bisimulation is to refine the partition based on the signatures of all states.
+     * NOTE: only applies to sparse strong bisimulation.
+     */
+    bool isSparseSignatureRefinementSet() const;
+
     virtual bool check() const override;
 
     // The name of the module.
@@ -113,6 +119,7 @@ class BisimulationSettings : public ModuleSettings {
     static const std::string refinementModeOptionName;
     static const std::string parallelismModeOptionName;
     static const std::string exactArithmeticDdOptionName;
+    static const std::string sparseSignatureRefinementOptionName;
 };
 }  // namespace modules
 }  // namespace settings
@@ -11,6 +11,7 @@
 
 #include "storm/exceptions/IllegalArgumentValueException.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/threads.h"
 
 namespace storm {
 namespace settings {
@@ -40,6 +41,12 @@ const std::string noSimplifyOptionName = "no-simplify";
 const std::string bitsForUnboundedVariablesOptionName = "int-bits";
 const std::string performLocationElimination = "location-elimination";
 const std::string explorationStateLimitOptionName = "state-limit";
+const std::string explorationThreadsOptionName = "exploration-threads";
+const std::string concurrentStateStorageOptionName = "concurrent-state-storage";
+const std::string jitOptionName = "jit";
+const std::string jitCompilerOptionName = "jit-compiler";
+const std::string jitCacheOptionName = "jit-cache";
+const std::string bytecodeOptionName = "bytecode";
 
 BuildSettings::BuildSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, prismCompatibilityOptionName, false,
@@ -122,6 +129,35 @@ BuildSettings::BuildSettings() : ModuleSettings(moduleName) {
                         .setIsAdvanced()
                         .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("number", "states to explore before stopping.").build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, explorationThreadsOptionName, false,
+                                                   "Sets the number of threads that expand states during the explicit state space exploration.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("number", "The number of threads (0 means 'auto-detect').")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, concurrentStateStorageOptionName, false,
+                                                   "If set, the threads of the parallel exploration share a lock-free map for newly discovered states.")
+                        .setIsAdvanced()
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, jitOptionName, false,
+                                                   "If set, the expressions of PRISM models are compiled to native code before the explicit exploration.")
+                        .setIsAdvanced()
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, jitCompilerOptionName, false, "Sets the compiler that is used for compiling expressions.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("command", "The command that invokes the compiler.")
+                                         .setDefaultValueString("c++")
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, jitCacheOptionName, false, "Sets the directory in which compiled expressions are cached.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("directory", "The cache directory.").build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, bytecodeOptionName, false,
+                                                   "If set, the expressions of PRISM models are evaluated with bytecode during the explicit exploration.")
+                        .setIsAdvanced()
+                        .build());
 }
 
 bool BuildSettings::isExplorationOrderSet() const {
@@ -222,6 +258,38 @@ uint64_t BuildSettings::getExplorationStateLimit() const {
     return this->getOption(explorationStateLimitOptionName).getArgumentByName("number").getValueAsUnsignedInteger();
 }
 
+uint64_t BuildSettings::getNumberOfExplorationThreads() const {
+    uint64_t numberOfThreads = this->getOption(explorationThreadsOptionName).getArgumentByName("number").getValueAsUnsignedInteger();
+    if (numberOfThreads == 0) {
+        numberOfThreads = std::max(1u, storm::utility::getNumberOfThreads());
+    }
+    return numberOfThreads;
+}
+
+bool BuildSettings::isConcurrentStateStorageSet() const {
+    return this->getOption(concurrentStateStorageOptionName).getHasOptionBeenSet();
+}
+
+bool BuildSettings::isJitSet() const {
+    return this->getOption(jitOptionName).getHasOptionBeenSet();
+}
+
+std::string BuildSettings::getJitCompiler() const {
+    return this->getOption(jitCompilerOptionName).getArgumentByName("command").getValueAsString();
+}
+
+bool BuildSettings::isJitCacheDirectorySet() const {
+    return this->getOption(jitCacheOptionName).getHasOptionBeenSet();
+}
+
+std::string BuildSettings::getJitCacheDirectory() const {
+    return this->getOption(jitCacheOptionName).getArgumentByName("directory").getValueAsString();
+}
+
+bool BuildSettings::isBytecodeSet() const {
+    return this->getOption(bytecodeOptionName).getHasOptionBeenSet();
+}
+
 }  // namespace modules
 
 }  // namespace settings
@@ -149,6 +149,41 @@ class BuildSettings : public ModuleSettings {
      */
     uint64_t getExplorationStateLimit() const;
 
+    /*!
+     * Retrieves the number of threads that are used to explore the state space of the model.
+     */
+    uint64_t getNumberOfExplorationThreads() const;
+
+    /*!
+     * Retrieves whether the threads of the parallel exploration share a concurrent map for newly discovered states.
+     */
+    bool isConcurrentStateStorageSet() const;
+
+    /*!
+     * Retrieves whether the expressions of the model are to be compiled to native code before the exploration.
+     */
+    bool isJitSet() const;
+
+    /*!
+     * Retrieves the compiler that is used for compiling expressions.
+     */
+    std::string getJitCompiler() const;
+
+    /*!
+     * Retrieves whether a directory for caching compiled expressions has been set.
+     */
+    bool isJitCacheDirectorySet() const;
+
+    /*!
+     * Retrieves the directory in which compiled expressions are cached.
+     */
+    std::string getJitCacheDirectory() const;
+
+    /*!
+     * Retrieves whether the expressions of the model are to be evaluated with bytecode during the exploration.
+     */
+    bool isBytecodeSet() const;
+
     // The name of the module.
     static const std::string moduleName;
 };
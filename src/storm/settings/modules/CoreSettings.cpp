@@ -14,6 +14,7 @@
 #include "storm/exceptions/IllegalArgumentValueException.h"
 #include "storm/exceptions/InvalidOptionException.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/threads.h"
 
 namespace storm {
 namespace settings {
@@ -30,6 +31,7 @@ const std::string CoreSettings::engineOptionShortName = "e";
 const std::string CoreSettings::ddLibraryOptionName = "ddlib";
 const std::string CoreSettings::intelTbbOptionName = "enable-tbb";
 const std::string CoreSettings::intelTbbOptionShortName = "tbb";
+const std::string CoreSettings::solverThreadsOptionName = "solver-threads";
 
 CoreSettings::CoreSettings() : ModuleSettings(moduleName), engine(storm::utility::Engine::Sparse) {
     std::vector<std::string> engines;
@@ -86,6 +88,13 @@ CoreSettings::CoreSettings() : ModuleSettings(moduleName), engine(storm::utility
         storm::settings::OptionBuilder(moduleName, intelTbbOptionName, false, "Sets whether to use Intel TBB (if Storm was built with support for TBB).")
             .setShortName(intelTbbOptionShortName)
             .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, solverThreadsOptionName, false, "Sets the number of threads that solvers may use.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("number", "The number of threads (0 means 'auto-detect').")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .build())
+                        .build());
 }
 
 storm::solver::EquationSolverType CoreSettings::getEquationSolver() const {
@@ -164,6 +173,14 @@ bool CoreSettings::isUseIntelTbbSet() const {
     return this->getOption(intelTbbOptionName).getHasOptionBeenSet();
 }
 
+uint64_t CoreSettings::getNumberOfSolverThreads() const {
+    uint64_t numberOfThreads = this->getOption(solverThreadsOptionName).getArgumentByName("number").getValueAsUnsignedInteger();
+    if (numberOfThreads == 0) {
+        numberOfThreads = std::max(1u, storm::utility::getNumberOfThreads());
+    }
+    return numberOfThreads;
+}
+
 storm::utility::Engine CoreSettings::getEngine() const {
     return engine;
 }
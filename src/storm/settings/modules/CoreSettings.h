@@ -102,6 +102,13 @@ class CoreSettings : public ModuleSettings {
      */
     bool isUseIntelTbbSet() const;
 
+    /*!
+     * Retrieves the number of threads that solvers may use.
+     *
+     * @return The number of threads.
+     */
+    uint64_t getNumberOfSolverThreads() const;
+
     /*!
      * Retrieves the selected engine.
      *
@@ -134,6 +141,7 @@ class CoreSettings : public ModuleSettings {
     static const std::string ddLibraryOptionName;
     static const std::string intelTbbOptionName;
     static const std::string intelTbbOptionShortName;
+    static const std::string solverThreadsOptionName;
 };
 
 }  // namespace modules
@@ -1,4 +1,7 @@
 #include "storm/settings/modules/ExplorationSettings.h"
+
+#include <algorithm>
+
 #include "storm/settings/Argument.h"
 #include "storm/settings/ArgumentBuilder.h"
 #include "storm/settings/Option.h"
@@ -9,6 +12,7 @@
 #include "storm/exceptions/IllegalArgumentValueException.h"
 #include "storm/utility/Engine.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/threads.h"
 
 namespace storm {
 namespace settings {
@@ -21,6 +25,7 @@ const std::string ExplorationSettings::numberOfSampledPathsUntilPrecomputationOp
 const std::string ExplorationSettings::nextStateHeuristicOptionName = "nextstate";
 const std::string ExplorationSettings::precisionOptionName = "precision";
 const std::string ExplorationSettings::precisionOptionShortName = "eps";
+const std::string ExplorationSettings::numberOfThreadsOptionName = "threads";
 
 ExplorationSettings::ExplorationSettings() : ModuleSettings(moduleName) {
     std::vector<std::string> types = {"local", "global"};
@@ -67,6 +72,13 @@ ExplorationSettings::ExplorationSettings() : ModuleSettings(moduleName) {
                                          .addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0))
                                          .build())
                         .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, numberOfThreadsOptionName, true, "Sets the number of threads that sample paths.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads (0 means 'auto-detect').")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .build())
+                        .build());
 }
 
 bool ExplorationSettings::isLocalPrecomputationSet() const {
@@ -121,11 +133,20 @@ double ExplorationSettings::getPrecision() const {
     return this->getOption(precisionOptionName).getArgumentByName("value").getValueAsDouble();
 }
 
+uint_fast64_t ExplorationSettings::getNumberOfThreads() const {
+    uint_fast64_t numberOfThreads = this->getOption(numberOfThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+    if (numberOfThreads == 0) {
+        numberOfThreads = std::max(1u, storm::utility::getNumberOfThreads());
+    }
+    return numberOfThreads;
+}
+
 bool ExplorationSettings::check() const {
     bool optionsSet = this->getOption(precomputationTypeOptionName).getHasOptionBeenSet() ||
                       this->getOption(numberOfExplorationStepsUntilPrecomputationOptionName).getHasOptionBeenSet() ||
                       this->getOption(numberOfSampledPathsUntilPrecomputationOptionName).getHasOptionBeenSet() ||
-                      this->getOption(nextStateHeuristicOptionName).getHasOptionBeenSet();
+                      this->getOption(nextStateHeuristicOptionName).getHasOptionBeenSet() ||
+                      this->getOption(numberOfThreadsOptionName).getHasOptionBeenSet();
     STORM_LOG_WARN_COND(storm::settings::getModule<storm::settings::modules::CoreSettings>().getEngine() == storm::utility::Engine::Exploration || !optionsSet,
                         "Exploration engine is not selected, so setting options for it has no effect.");
     return true;
@@ -1,5 +1,7 @@
 #include "storm/settings/modules/IOSettings.h"
 
+#include <algorithm>
+
 #include "storm/exceptions/InvalidSettingsException.h"
 #include "storm/parser/CSVParser.h"
 #include "storm/settings/Argument.h"
@@ -10,6 +12,7 @@
 #include "storm/settings/SettingsManager.h"
 
 #include "storm/exceptions/IllegalArgumentValueException.h"
+#include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 
 namespace storm {
@@ -31,6 +34,9 @@ const std::string IOSettings::explicitOptionName = "explicit";
 const std::string IOSettings::explicitOptionShortName = "exp";
 const std::string IOSettings::explicitDrnOptionName = "explicit-drn";
 const std::string IOSettings::explicitDrnOptionShortName = "drn";
+const std::string IOSettings::drnThreadsOptionName = "drn-threads";
+const std::string IOSettings::explicitDrbOptionName = "explicit-drb";
+const std::string IOSettings::explicitDrbOptionShortName = "drb";
 const std::string IOSettings::explicitImcaOptionName = "explicit-imca";
 const std::string IOSettings::explicitImcaOptionShortName = "imca";
 const std::string IOSettings::prismInputOptionName = "prism";
@@ -49,6 +55,7 @@ const std::string IOSettings::propertyOptionName = "prop";
 const std::string IOSettings::propertyOptionShortName = "prop";
 const std::string IOSettings::steadyStateDistrOptionName = "steadystate";
 const std::string IOSettings::expectedVisitingTimesOptionName = "expvisittimes";
+const std::string IOSettings::timeBoundsOptionName = "timebounds";
 
 const std::string IOSettings::qvbsInputOptionName = "qvbs";
 const std::string IOSettings::qvbsInputOptionShortName = "qvbs";
@@ -74,7 +81,7 @@ IOSettings::IOSettings() : ModuleSettings(moduleName) {
                                          .setDefaultValueUnsignedInteger(0)
                                          .build())
                         .build());
-    std::vector<std::string> exportFormats({"auto", "dot", "drdd", "drn", "json"});
+    std::vector<std::string> exportFormats({"auto", "dot", "drdd", "drn", "drb", "json"});
     this->addOption(
         storm::settings::OptionBuilder(moduleName, exportBuildOptionName, false, "Exports the built model to a file.")
             .addArgument(storm::settings::ArgumentBuilder::createStringArgument("file", "The output file.").build())
@@ -143,6 +150,19 @@ IOSettings::IOSettings() : ModuleSettings(moduleName) {
                                          .addValidatorString(ArgumentValidatorFactory::createExistingFileValidator())
                                          .build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, drnThreadsOptionName, false,
+                                                   "Sets the number of threads that parse a model given in the DRN format.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("number", "The number of threads (0 means 'auto-detect').")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, explicitDrbOptionName, false, "Loads the model given in the binary drb format.")
+                        .setShortName(explicitDrbOptionShortName)
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("drb filename", "The name of the drb file containing the model.")
+                                         .addValidatorString(ArgumentValidatorFactory::createExistingFileValidator())
+                                         .build())
+                        .build());
     this->addOption(storm::settings::OptionBuilder(moduleName, explicitImcaOptionName, false, "Parses the model given in the IMCA format.")
                         .setShortName(explicitImcaOptionShortName)
                         .addArgument(storm::settings::ArgumentBuilder::createStringArgument("imca filename", "The name of the imca file containing the model.")
@@ -235,6 +255,11 @@ IOSettings::IOSettings() : ModuleSettings(moduleName) {
                                                    "state (CTMC). Result can be exported using --" +
                                                        exportCheckResultOptionName + ".")
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, timeBoundsOptionName, false,
+                                                   "Checks time-bounded reachability properties of CTMCs for each of the given time bounds (replacing the "
+                                                   "bound of the property) in a single pass.")
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("values", "A comma separated list of time bounds.").build())
+                        .build());
 
     this->addOption(storm::settings::OptionBuilder(moduleName, qvbsInputOptionName, false, "Selects a model from the Quantitative Verification Benchmark Set.")
                         .setShortName(qvbsInputOptionShortName)
@@ -371,6 +396,18 @@ std::string IOSettings::getExplicitDRNFilename() const {
     return this->getOption(explicitDrnOptionName).getArgumentByName("drn filename").getValueAsString();
 }
 
+uint64_t IOSettings::getNumberOfDrnParserThreads() const {
+    return this->getOption(drnThreadsOptionName).getArgumentByName("number").getValueAsUnsignedInteger();
+}
+
+bool IOSettings::isExplicitDRBSet() const {
+    return this->getOption(explicitDrbOptionName).getHasOptionBeenSet();
+}
+
+std::string IOSettings::getExplicitDRBFilename() const {
+    return this->getOption(explicitDrbOptionName).getArgumentByName("drb filename").getValueAsString();
+}
+
 bool IOSettings::isExplicitIMCASet() const {
     return this->getOption(explicitImcaOptionName).getHasOptionBeenSet();
 }
@@ -482,6 +519,20 @@ bool IOSettings::isComputeExpectedVisitingTimesSet() const {
     return this->getOption(expectedVisitingTimesOptionName).getHasOptionBeenSet();
 }
 
+bool IOSettings::isTimeBoundsSet() const {
+    return this->getOption(timeBoundsOptionName).getHasOptionBeenSet();
+}
+
+std::vector<double> IOSettings::getTimeBounds() const {
+    std::vector<double> timeBounds;
+    for (auto const& value : storm::parser::parseCommaSeperatedValues(this->getOption(timeBoundsOptionName).getArgumentByName("values").getValueAsString())) {
+        timeBounds.push_back(storm::utility::convertNumber<double>(value));
+        STORM_LOG_THROW(timeBounds.back() >= 0.0, storm::exceptions::IllegalArgumentValueException, "The time bound " << value << " is negative.");
+    }
+    std::sort(timeBounds.begin(), timeBounds.end());
+    return timeBounds;
+}
+
 bool IOSettings::isQvbsInputSet() const {
     return this->getOption(qvbsInputOptionName).getHasOptionBeenSet();
 }
@@ -541,6 +592,7 @@ bool IOSettings::check() const {
     // Ensure that not two explicit input models were given.
     uint64_t numExplicitInputs = isExplicitSet() ? 1 : 0;
     numExplicitInputs += isExplicitDRNSet() ? 1 : 0;
+    numExplicitInputs += isExplicitDRBSet() ? 1 : 0;
     numExplicitInputs += isExplicitIMCASet() ? 1 : 0;
     STORM_LOG_THROW(numExplicitInputs <= 1, storm::exceptions::InvalidSettingsException, "Multiple explicit input models");
 
@@ -168,6 +168,27 @@ class IOSettings : public ModuleSettings {
      */
     std::string getExplicitDRNFilename() const;
 
+    /*!
+     * Retrieves the number of threads that parse a model given in the DRN format.
+     *
+     * @return The number of threads (0 means 'auto-detect').
+     */
+    uint64_t getNumberOfDrnParserThreads() const;
+
+    /*!
+     * Retrieves whether the explicit option with the binary drb format was set.
+     *
+     * @return True if the explicit option with the binary drb format was set.
+     */
+    bool isExplicitDRBSet() const;
+
+    /*!
+     * Retrieves the name of the file that contains the model in the binary drb format.
+     *
+     * @return The name of the drb file that contains the model.
+     */
+    std::string getExplicitDRBFilename() const;
+
     /*!
      * Retrieves whether we prevent the usage of placeholders in the explicit DRN format
      * @return
@@ -344,6 +365,16 @@ class IOSettings : public ModuleSettings {
      */
     bool isComputeExpectedVisitingTimesSet() const;
 
+    /*!
+     * Retrieves whether time-bounded properties are to be checked for multiple time bounds.
+     */
+    bool isTimeBoundsSet() const;
+
+    /*!
+     * Retrieves the time bounds for which time-bounded properties are to be checked, in ascending order.
+     */
+    std::vector<double> getTimeBounds() const;
+
     /*!
      * Retrieves whether the input model is to be read from the quantitative verification benchmark set (QVBS)
      */
@@ -396,6 +427,9 @@ class IOSettings : public ModuleSettings {
     static const std::string explicitOptionShortName;
     static const std::string explicitDrnOptionName;
     static const std::string explicitDrnOptionShortName;
+    static const std::string drnThreadsOptionName;
+    static const std::string explicitDrbOptionName;
+    static const std::string explicitDrbOptionShortName;
     static const std::string explicitImcaOptionName;
     static const std::string explicitImcaOptionShortName;
     static const std::string prismInputOptionName;
@@ -412,6 +446,7 @@ class IOSettings : public ModuleSettings {
     static const std::string propertyOptionShortName;
     static const std::string steadyStateDistrOptionName;
     static const std::string expectedVisitingTimesOptionName;
+    static const std::string timeBoundsOptionName;
     static const std::string qvbsInputOptionName;
     static const std::string qvbsInputOptionShortName;
     static const std::string qvbsRootOptionName;
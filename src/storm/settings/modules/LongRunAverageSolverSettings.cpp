@@ -19,6 +19,7 @@ const std::string LongRunAverageSolverSettings::maximalIterationsOptionShortName
 const std::string LongRunAverageSolverSettings::precisionOptionName = "precision";
 const std::string LongRunAverageSolverSettings::absoluteOptionName = "absolute";
 const std::string LongRunAverageSolverSettings::aperiodicFactorOptionName = "aperiodicfactor";
+const std::string LongRunAverageSolverSettings::mecBatchSizeOptionName = "mecbatchsize";
 
 LongRunAverageSolverSettings::LongRunAverageSolverSettings() : ModuleSettings(moduleName) {
     std::vector<std::string> detLraMethods = {"gb", "gain-bias-equations", "distr", "lra-distribution-equations", "vi", "value-iteration"};
@@ -69,6 +70,15 @@ LongRunAverageSolverSettings::LongRunAverageSolverSettings() : ModuleSettings(mo
                                          .addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0))
                                          .build())
                         .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, mecBatchSizeOptionName, true,
+                                                   "If value iteration is used on models with nondeterminism, small maximal end components are analyzed "
+                                                   "together in a single run. This sets the maximal number of states of such a batch (0 disables batching).")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("size", "The maximal number of states in a batch.")
+                                         .setDefaultValueUnsignedInteger(0)
+                                         .build())
+                        .build());
 }
 
 storm::solver::LraMethod LongRunAverageSolverSettings::getDetLraMethod() const {
@@ -131,6 +141,10 @@ double LongRunAverageSolverSettings::getAperiodicFactor() const {
     return this->getOption(aperiodicFactorOptionName).getArgumentByName("value").getValueAsDouble();
 }
 
+uint64_t LongRunAverageSolverSettings::getMecBatchSize() const {
+    return this->getOption(mecBatchSizeOptionName).getArgumentByName("size").getValueAsUnsignedInteger();
+}
+
 }  // namespace modules
 }  // namespace settings
 }  // namespace storm
@@ -73,6 +73,12 @@ class LongRunAverageSolverSettings : public ModuleSettings {
      */
     double getAperiodicFactor() const;
 
+    /*!
+     * Retrieves the maximal number of states of maximal end components that are analyzed together in a single value iteration run.
+     * A value of zero means that every maximal end component is analyzed on its own.
+     */
+    uint64_t getMecBatchSize() const;
+
     // The name of the module.
     static const std::string moduleName;
 
@@ -84,6 +90,7 @@ class LongRunAverageSolverSettings : public ModuleSettings {
     static const std::string precisionOptionName;
     static const std::string absoluteOptionName;
     static const std::string aperiodicFactorOptionName;
+    static const std::string mecBatchSizeOptionName;
 };
 
 }  // namespace modules
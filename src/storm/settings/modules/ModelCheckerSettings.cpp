@@ -14,6 +14,7 @@ namespace modules {
 const std::string ModelCheckerSettings::moduleName = "modelchecker";
 const std::string ModelCheckerSettings::filterRewZeroOptionName = "filterrewzero";
 const std::string ModelCheckerSettings::ltl2daToolOptionName = "ltl2datool";
+const std::string ModelCheckerSettings::analysisCacheOptionName = "analysiscache";
 
 ModelCheckerSettings::ModelCheckerSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, filterRewZeroOptionName, false,
@@ -27,6 +28,14 @@ ModelCheckerSettings::ModelCheckerSettings() : ModuleSettings(moduleName) {
                                          "filename", "A script that can be called with a prefix formula and a name for the output automaton.")
                                          .build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, analysisCacheOptionName, false,
+                                                   "Sets the memory budget for caching graph analyses of the model that are shared among properties.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument(
+                                         "megabytes", "The budget in megabytes (0 disables the cache).")
+                                         .setDefaultValueUnsignedInteger(512)
+                                         .build())
+                        .build());
 }
 
 bool ModelCheckerSettings::isFilterRewZeroSet() const {
@@ -41,6 +50,10 @@ std::string ModelCheckerSettings::getLtl2daTool() const {
     return this->getOption(ltl2daToolOptionName).getArgumentByName("filename").getValueAsString();
 }
 
+uint64_t ModelCheckerSettings::getAnalysisCacheBudget() const {
+    return this->getOption(analysisCacheOptionName).getArgumentByName("megabytes").getValueAsUnsignedInteger() * 1024ull * 1024ull;
+}
+
 }  // namespace modules
 }  // namespace settings
 }  // namespace storm
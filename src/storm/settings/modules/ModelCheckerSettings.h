@@ -35,6 +35,13 @@ class ModelCheckerSettings : public ModuleSettings {
      */
     std::string getLtl2daTool() const;
 
+    /*!
+     * Retrieves the memory budget of the cache for graph analyses of a model.
+     *
+     * @return The budget in bytes.
+     */
+    uint64_t getAnalysisCacheBudget() const;
+
     // The name of the module.
     static const std::string moduleName;
 
@@ -42,6 +49,7 @@ class ModelCheckerSettings : public ModuleSettings {
     // Define the string names of the options as constants.
     static const std::string filterRewZeroOptionName;
     static const std::string ltl2daToolOptionName;
+    static const std::string analysisCacheOptionName;
 };
 
 }  // namespace modules
@@ -24,6 +24,7 @@ const std::string NativeEquationSolverSettings::precisionOptionName = "precision
 const std::string NativeEquationSolverSettings::absoluteOptionName = "absolute";
 const std::string NativeEquationSolverSettings::powerMethodMultiplicationStyleOptionName = "powmult";
 const std::string NativeEquationSolverSettings::intervalIterationSymmetricUpdatesOptionName = "symmetricupdates";
+const std::string NativeEquationSolverSettings::slicedMatrixOptionName = "sliced-matrix";
 
 NativeEquationSolverSettings::NativeEquationSolverSettings() : ModuleSettings(moduleName) {
     std::vector<std::string> methods = {"jacobi", "gaussseidel",           "sor", "walkerchae",
@@ -80,6 +81,12 @@ NativeEquationSolverSettings::NativeEquationSolverSettings() : ModuleSettings(mo
                                                    "If set, interval iteration performs an update on both, lower and upper bound in each iteration")
                         .setIsAdvanced()
                         .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, slicedMatrixOptionName, false,
+                                                   "If set, value iteration on deterministic models stores an additional copy of the matrix in a sliced format "
+                                                   "that allows for SIMD instructions.")
+                        .setIsAdvanced()
+                        .build());
 }
 
 bool NativeEquationSolverSettings::isLinearEquationSystemTechniqueSet() const {
@@ -159,6 +166,10 @@ bool NativeEquationSolverSettings::isForceIntervalIterationSymmetricUpdatesSet()
     return this->getOption(intervalIterationSymmetricUpdatesOptionName).getHasOptionBeenSet();
 }
 
+bool NativeEquationSolverSettings::isUseSlicedMatrixSet() const {
+    return this->getOption(slicedMatrixOptionName).getHasOptionBeenSet();
+}
+
 bool NativeEquationSolverSettings::check() const {
     return true;
 }
@@ -98,6 +98,11 @@ class NativeEquationSolverSettings : public ModuleSettings {
      */
     bool isForceIntervalIterationSymmetricUpdatesSet() const;
 
+    /*!
+     * Retrieves whether value iteration on deterministic models shall use a sliced copy of the matrix.
+     */
+    bool isUseSlicedMatrixSet() const;
+
     /*!
      * Retrieves the multiplication style to use in the power method.
      *
@@ -124,6 +129,7 @@ class NativeEquationSolverSettings : public ModuleSettings {
     static const std::string precisionOptionName;
     static const std::string absoluteOptionName;
     static const std::string intervalIterationSymmetricUpdatesOptionName;
+    static const std::string slicedMatrixOptionName;
     static const std::string powerMethodMultiplicationStyleOptionName;
     static const std::string forceBoundsOptionName;
 };
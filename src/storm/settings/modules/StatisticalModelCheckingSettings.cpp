@@ -0,0 +1,124 @@
+#include "storm/settings/modules/StatisticalModelCheckingSettings.h"
+
+#include <algorithm>
+
+#include "storm/settings/Argument.h"
+#include "storm/settings/ArgumentBuilder.h"
+#include "storm/settings/Option.h"
+#include "storm/settings/OptionBuilder.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+
+#include "storm/utility/Engine.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/threads.h"
+
+namespace storm {
+namespace settings {
+namespace modules {
+
+const std::string StatisticalModelCheckingSettings::moduleName = "smc";
+const std::string StatisticalModelCheckingSettings::criterionOptionName = "criterion";
+const std::string StatisticalModelCheckingSettings::epsilonOptionName = "epsilon";
+const std::string StatisticalModelCheckingSettings::confidenceOptionName = "confidence";
+const std::string StatisticalModelCheckingSettings::threadsOptionName = "threads";
+const std::string StatisticalModelCheckingSettings::seedOptionName = "seed";
+const std::string StatisticalModelCheckingSettings::maxPathLengthOptionName = "maxpathlength";
+
+StatisticalModelCheckingSettings::StatisticalModelCheckingSettings() : ModuleSettings(moduleName) {
+    std::vector<std::string> criteria = {"chernoff", "clopper-pearson", "sprt"};
+    this->addOption(
+        storm::settings::OptionBuilder(moduleName, criterionOptionName, false, "Sets the criterion that determines when to stop sampling paths.")
+            .addArgument(storm::settings::ArgumentBuilder::createStringArgument(
+                             "name",
+                             "The name of the criterion. 'chernoff' samples a fixed number of paths given by the Chernoff-Hoeffding bound, 'clopper-pearson' "
+                             "samples until the Clopper-Pearson interval is narrow enough and 'sprt' performs a sequential probability ratio test for "
+                             "probability bounds.")
+                             .addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(criteria))
+                             .setDefaultValueString("chernoff")
+                             .build())
+            .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, epsilonOptionName, false,
+                                                   "Sets the maximal absolute error of estimates and the half-width of the indifference region of tests.")
+                        .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The error bound.")
+                                         .setDefaultValueDouble(0.01)
+                                         .addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, confidenceOptionName, false, "Sets the probability with which the result has to be correct.")
+                        .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The confidence.")
+                                         .setDefaultValueDouble(0.95)
+                                         .addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, threadsOptionName, false, "Sets the number of threads that sample paths.")
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("number", "The number of threads (0 means 'auto-detect').")
+                                         .setDefaultValueUnsignedInteger(0)
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, seedOptionName, false,
+                                                   "Sets the seed for the random number generators. Results are only reproducible with a single thread.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("value", "The seed.").build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, maxPathLengthOptionName, false,
+                                                   "Sets the number of steps after which sampling an undecided path is aborted with an error.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("number", "The maximal number of steps.")
+                                         .setDefaultValueUnsignedInteger(1000000)
+                                         .build())
+                        .build());
+}
+
+storm::modelchecker::smc::StoppingCriterion StatisticalModelCheckingSettings::getStoppingCriterion() const {
+    std::string criterionAsString = this->getOption(criterionOptionName).getArgumentByName("name").getValueAsString();
+    if (criterionAsString == "chernoff") {
+        return storm::modelchecker::smc::StoppingCriterion::ChernoffHoeffding;
+    } else if (criterionAsString == "clopper-pearson") {
+        return storm::modelchecker::smc::StoppingCriterion::ClopperPearson;
+    } else {
+        STORM_LOG_ASSERT(criterionAsString == "sprt", "Unexpected stopping criterion for statistical model checking.");
+        return storm::modelchecker::smc::StoppingCriterion::Sprt;
+    }
+}
+
+double StatisticalModelCheckingSettings::getEpsilon() const {
+    return this->getOption(epsilonOptionName).getArgumentByName("value").getValueAsDouble();
+}
+
+double StatisticalModelCheckingSettings::getConfidence() const {
+    return this->getOption(confidenceOptionName).getArgumentByName("value").getValueAsDouble();
+}
+
+uint64_t StatisticalModelCheckingSettings::getNumberOfThreads() const {
+    uint64_t numberOfThreads = this->getOption(threadsOptionName).getArgumentByName("number").getValueAsUnsignedInteger();
+    if (numberOfThreads == 0) {
+        numberOfThreads = std::max(1u, storm::utility::getNumberOfThreads());
+    }
+    return numberOfThreads;
+}
+
+bool StatisticalModelCheckingSettings::isSeedSet() const {
+    return this->getOption(seedOptionName).getHasOptionBeenSet();
+}
+
+uint64_t StatisticalModelCheckingSettings::getSeed() const {
+    return this->getOption(seedOptionName).getArgumentByName("value").getValueAsUnsignedInteger();
+}
+
+uint64_t StatisticalModelCheckingSettings::getMaximalPathLength() const {
+    return this->getOption(maxPathLengthOptionName).getArgumentByName("number").getValueAsUnsignedInteger();
+}
+
+bool StatisticalModelCheckingSettings::check() const {
+    bool optionsSet = this->getOption(criterionOptionName).getHasOptionBeenSet() || this->getOption(epsilonOptionName).getHasOptionBeenSet() ||
+                      this->getOption(confidenceOptionName).getHasOptionBeenSet() || this->getOption(threadsOptionName).getHasOptionBeenSet() ||
+                      this->getOption(seedOptionName).getHasOptionBeenSet() || this->getOption(maxPathLengthOptionName).getHasOptionBeenSet();
+    STORM_LOG_WARN_COND(storm::settings::getModule<storm::settings::modules::CoreSettings>().getEngine() == storm::utility::Engine::Smc || !optionsSet,
+                        "Statistical model checking engine is not selected, so setting options for it has no effect.");
+    return true;
+}
+
+}  // namespace modules
+}  // namespace settings
+}  // namespace storm
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "storm/modelchecker/smc/StoppingCriterion.h"
+#include "storm/settings/modules/ModuleSettings.h"
+
+namespace storm {
+namespace settings {
+namespace modules {
+
+/*!
+ * This class represents the settings for statistical model checking.
+ */
+class StatisticalModelCheckingSettings : public ModuleSettings {
+   public:
+    /*!
+     * Creates a new set of statistical model checking settings.
+     */
+    StatisticalModelCheckingSettings();
+
+    /*!
+     * Retrieves the criterion that determines when to stop sampling.
+     */
+    storm::modelchecker::smc::StoppingCriterion getStoppingCriterion() const;
+
+    /*!
+     * Retrieves the maximal absolute error of estimated values (or the half-width of the indifference region for hypothesis tests).
+     */
+    double getEpsilon() const;
+
+    /*!
+     * Retrieves the probability with which the result has to be correct.
+     */
+    double getConfidence() const;
+
+    /*!
+     * Retrieves the number of threads that sample paths.
+     */
+    uint64_t getNumberOfThreads() const;
+
+    /*!
+     * Retrieves whether a seed for the random number generators has been set.
+     */
+    bool isSeedSet() const;
+
+    /*!
+     * Retrieves the seed for the random number generators.
+     */
+    uint64_t getSeed() const;
+
+    /*!
+     * Retrieves the number of steps after which a path that has not been decided yet is considered to be erroneous.
+     */
+    uint64_t getMaximalPathLength() const;
+
+    virtual bool check() const override;
+
+    // The name of the module.
+    static const std::string moduleName;
+
+   private:
+    // Define the string names of the options as constants.
+    static const std::string criterionOptionName;
+    static const std::string epsilonOptionName;
+    static const std::string confidenceOptionName;
+    static const std::string threadsOptionName;
+    static const std::string seedOptionName;
+    static const std::string maxPathLengthOptionName;
+};
+
+}  // namespace modules
+}  // namespace settings
+}  // namespace storm
@@ -117,11 +117,12 @@ bool IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::internalSolve
 }
 
 template<typename ValueType, typename SolutionType>
-void IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::setUpViOperator() const {
+void IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::setUpViOperator(uint64_t numberOfThreads) const {
     if (!viOperator) {
         viOperator = std::make_shared<helper::ValueIterationOperator<ValueType, false, SolutionType>>();
         viOperator->setMatrixBackwards(*this->A);
     }
+    viOperator->setNumberOfThreads(numberOfThreads);
     if (this->choiceFixedForRowGroup) {
         // Ignore those rows that are not selected
         assert(this->initialScheduler);
@@ -133,8 +134,9 @@ void IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::setUpViOperat
 }
 
 template<typename ValueType, typename SolutionType>
-void IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::extractScheduler(std::vector<SolutionType>& x, std::vector<ValueType> const& b,
-                                                                                    OptimizationDirection const& dir, bool updateX, bool robust) const {
+void IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::extractScheduler(Environment const& env, std::vector<SolutionType>& x,
+                                                                                    std::vector<ValueType> const& b, OptimizationDirection const& dir,
+                                                                                    bool updateX, bool robust) const {
     // Make sure that storage for scheduler choices is available
     if (!this->schedulerChoices) {
         this->schedulerChoices = std::vector<uint64_t>(x.size(), 0);
@@ -144,7 +146,7 @@ void IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::extractSchedu
     // Set the correct choices.
     STORM_LOG_WARN_COND(viOperator, "Expected VI operator to be initialized for scheduler extraction. Initializing now, but this is inefficient.");
     if (!viOperator) {
-        setUpViOperator();
+        setUpViOperator(env.solver().getNumberOfThreads());
     }
     storm::solver::helper::SchedulerTrackingHelper<ValueType, SolutionType> schedHelper(viOperator);
     schedHelper.computeScheduler(x, b, dir, *this->schedulerChoices, robust, updateX ? &x : nullptr);
@@ -434,7 +436,7 @@ bool IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::solveEquation
             return true;
         }
 
-        setUpViOperator();
+        setUpViOperator(env.solver().getNumberOfThreads());
 
         helper::OptimisticValueIterationHelper<ValueType, false> oviHelper(viOperator);
         auto prec = storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision());
@@ -462,7 +464,7 @@ bool IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::solveEquation
 
         // If requested, we store the scheduler for retrieval.
         if (this->isTrackSchedulerSet()) {
-            this->extractScheduler(x, b, dir, this->isUncertaintyRobust());
+            this->extractScheduler(env, x, b, dir, this->isUncertaintyRobust());
         }
 
         if (!this->isCachingEnabled()) {
@@ -477,7 +479,7 @@ template<typename ValueType, typename SolutionType>
 bool IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::solveEquationsValueIteration(Environment const& env, OptimizationDirection dir,
                                                                                                 std::vector<SolutionType>& x,
                                                                                                 std::vector<ValueType> const& b) const {
-    setUpViOperator();
+    setUpViOperator(env.solver().getNumberOfThreads());
     // By default, we can not provide any guarantee
     SolverGuarantee guarantee = SolverGuarantee::None;
 
@@ -544,7 +546,7 @@ bool IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::solveEquation
 
     // If requested, we store the scheduler for retrieval.
     if (this->isTrackSchedulerSet()) {
-        this->extractScheduler(x, b, dir, this->isUncertaintyRobust());
+        this->extractScheduler(env, x, b, dir, this->isUncertaintyRobust());
     }
 
     if (!this->isCachingEnabled()) {
@@ -573,7 +575,7 @@ bool IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::solveEquation
         STORM_LOG_THROW(false, storm::exceptions::NotImplementedException, "We did not implement intervaliteration for interval-based models");
         return false;
     } else {
-        setUpViOperator();
+        setUpViOperator(env.solver().getNumberOfThreads());
         helper::IntervalIterationHelper<ValueType, false> iiHelper(viOperator);
         auto prec = storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision());
         auto lowerBoundsCallback = [&](std::vector<SolutionType>& vector) { this->createLowerBoundsVector(vector); };
@@ -597,7 +599,7 @@ bool IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::solveEquation
 
         // If requested, we store the scheduler for retrieval.
         if (this->isTrackSchedulerSet()) {
-            this->extractScheduler(x, b, dir, this->isUncertaintyRobust());
+            this->extractScheduler(env, x, b, dir, this->isUncertaintyRobust());
         }
 
         if (!this->isCachingEnabled()) {
@@ -627,7 +629,7 @@ bool IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::solveEquation
             upperBound = this->getUpperBound(true);
         }
 
-        setUpViOperator();
+        setUpViOperator(env.solver().getNumberOfThreads());
 
         auto precision = storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision());
         uint64_t numIterations{0};
@@ -648,7 +650,7 @@ bool IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::solveEquation
 
         // If requested, we store the scheduler for retrieval.
         if (this->isTrackSchedulerSet()) {
-            this->extractScheduler(x, b, dir, this->isUncertaintyRobust());
+            this->extractScheduler(env, x, b, dir, this->isUncertaintyRobust());
         }
 
         this->reportStatus(status, numIterations);
@@ -704,7 +706,7 @@ bool IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::solveEquation
         return false;
     } else {
         // Set up two value iteration operators. One for exact and one for imprecise computations
-        setUpViOperator();
+        setUpViOperator(env.solver().getNumberOfThreads());
         std::shared_ptr<helper::ValueIterationOperator<storm::RationalNumber, false>> exactOp;
         std::shared_ptr<helper::ValueIterationOperator<double, false>> impreciseOp;
         std::function<bool(uint64_t, uint64_t)> fixedChoicesCallback;
@@ -745,7 +747,7 @@ bool IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::solveEquation
 
         // If requested, we store the scheduler for retrieval.
         if (this->isTrackSchedulerSet()) {
-            this->extractScheduler(x, b, dir, this->isUncertaintyRobust());
+            this->extractScheduler(env, x, b, dir, this->isUncertaintyRobust());
         }
 
         if (!this->isCachingEnabled()) {
@@ -58,8 +58,8 @@ class IterativeMinMaxLinearEquationSolver : public StandardMinMaxLinearEquationS
 
     bool solveEquationsRationalSearch(Environment const& env, OptimizationDirection dir, std::vector<SolutionType>& x, std::vector<ValueType> const& b) const;
 
-    void setUpViOperator() const;
-    void extractScheduler(std::vector<SolutionType>& x, std::vector<ValueType> const& b, OptimizationDirection const& dir, bool robust,
+    void setUpViOperator(uint64_t numberOfThreads) const;
+    void extractScheduler(Environment const& env, std::vector<SolutionType>& x, std::vector<ValueType> const& b, OptimizationDirection const& dir, bool robust,
                           bool updateX = true) const;
 
     void createLinearEquationSolver(Environment const& env) const;
@@ -59,6 +59,7 @@ bool LpMinMaxLinearEquationSolver<ValueType>::solveEquationsViToLp(Environment c
         } else {
             viOperator->setMatrixBackwards(this->A->template toValueType<double>(), &this->A->getRowGroupIndices());
         }
+        viOperator->setNumberOfThreads(env.solver().getNumberOfThreads());
         storm::solver::helper::ValueIterationHelper<double, false> viHelper(viOperator);
         uint64_t numIterations{0};
         auto viCallback = [&](SolverStatus const& current) {
@@ -52,11 +52,13 @@ void NativeLinearEquationSolver<ValueType>::setMatrix(storm::storage::SparseMatr
 }
 
 template<typename ValueType>
-void NativeLinearEquationSolver<ValueType>::setUpViOperator() const {
+void NativeLinearEquationSolver<ValueType>::setUpViOperator(storm::Environment const& env) const {
     if (!viOperator) {
         viOperator = std::make_shared<helper::ValueIterationOperator<ValueType, true>>();
+        viOperator->setUseSlicedMatrix(env.solver().native().isUseSlicedMatrixSet());
         viOperator->setMatrixBackwards(*this->A);
     }
+    viOperator->setNumberOfThreads(env.solver().getNumberOfThreads());
 }
 
 template<typename ValueType>
@@ -360,7 +362,7 @@ template<typename ValueType>
 bool NativeLinearEquationSolver<ValueType>::solveEquationsPower(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
     STORM_LOG_INFO("Solving linear equation system (" << x.size() << " rows) with NativeLinearEquationSolver (Power)");
     // Prepare the solution vectors.
-    setUpViOperator();
+    setUpViOperator(env);
 
     SolverGuarantee guarantee = SolverGuarantee::None;
     if (this->hasCustomTerminationCondition()) {
@@ -424,7 +426,7 @@ bool NativeLinearEquationSolver<ValueType>::solveEquationsIntervalIteration(Envi
     STORM_LOG_THROW(this->hasLowerBound(), storm::exceptions::UnmetRequirementException, "Solver requires lower bound, but none was given.");
     STORM_LOG_THROW(this->hasUpperBound(), storm::exceptions::UnmetRequirementException, "Solver requires upper bound, but none was given.");
     STORM_LOG_INFO("Solving linear equation system (" << x.size() << " rows) with NativeLinearEquationSolver (IntervalIteration)");
-    setUpViOperator();
+    setUpViOperator(env);
     helper::IntervalIterationHelper<ValueType, true> iiHelper(viOperator);
     auto prec = storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision());
     auto lowerBoundsCallback = [&](std::vector<ValueType>& vector) { this->createLowerBoundsVector(vector); };
@@ -467,7 +469,7 @@ bool NativeLinearEquationSolver<ValueType>::solveEquationsSoundValueIteration(En
         upperBound = this->getUpperBound(true);
     }
 
-    setUpViOperator();
+    setUpViOperator(env);
 
     auto precision = storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision());
     uint64_t numIterations{0};
@@ -504,7 +506,7 @@ bool NativeLinearEquationSolver<ValueType>::solveEquationsOptimisticValueIterati
         return true;
     }
 
-    setUpViOperator();
+    setUpViOperator(env);
 
     helper::OptimisticValueIterationHelper<ValueType, true> oviHelper(viOperator);
     auto prec = storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision());
@@ -540,7 +542,7 @@ template<typename ValueType>
 bool NativeLinearEquationSolver<ValueType>::solveEquationsRationalSearch(Environment const& env, std::vector<ValueType>& x,
                                                                          std::vector<ValueType> const& b) const {
     // Set up two value iteration operators. One for exact and one for imprecise computations
-    setUpViOperator();
+    setUpViOperator(env);
     std::shared_ptr<helper::ValueIterationOperator<storm::RationalNumber, true>> exactOp;
     std::shared_ptr<helper::ValueIterationOperator<double, true>> impreciseOp;
 
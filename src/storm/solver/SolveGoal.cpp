@@ -145,6 +145,15 @@ void SolveGoal<ValueType, SolutionType>::setRelevantValues(storm::storage::BitVe
     relevantValueVector = std::move(values);
 }
 
+template<typename ValueType, typename SolutionType>
+storm::models::sparse::ModelAnalysisCache<ValueType>* SolveGoal<ValueType, SolutionType>::getAnalysisCache(
+    storm::storage::SparseMatrix<ValueType> const& transitionMatrix) const {
+    if (analysisCache && analysisCache->isCacheFor(transitionMatrix)) {
+        return analysisCache.get();
+    }
+    return nullptr;
+}
+
 template class SolveGoal<double>;
 template class SolveGoal<storm::RationalNumber>;
 template class SolveGoal<storm::RationalFunction>;
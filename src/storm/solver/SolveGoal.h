@@ -5,6 +5,7 @@
 #include <boost/optional.hpp>
 
 #include "storm/logic/ComparisonType.h"
+#include "storm/models/sparse/ModelAnalysisCache.h"
 #include "storm/solver/OptimizationDirection.h"
 #include "storm/storage/BitVector.h"
 
@@ -57,6 +58,7 @@ class SolveGoal {
             threshold = checkTask.getBoundThreshold();
         }
         robustAgainstUncertainty = checkTask.getRobustUncertainty();
+        analysisCache = model.getAnalysisCache();
     }
 
     SolveGoal(bool minimize);
@@ -94,6 +96,12 @@ class SolveGoal {
     void restrictRelevantValues(storm::storage::BitVector const& filter);
     void setRelevantValues(storm::storage::BitVector&& values);
 
+    /*!
+     * Retrieves the cache of analysis results of the model for which this goal was created (if any) provided that the given matrix is the transition matrix
+     * of that model. Otherwise, nullptr is returned.
+     */
+    storm::models::sparse::ModelAnalysisCache<ValueType>* getAnalysisCache(storm::storage::SparseMatrix<ValueType> const& transitionMatrix) const;
+
    private:
     boost::optional<OptimizationDirection> optimizationDirection;
 
@@ -101,6 +109,7 @@ class SolveGoal {
     boost::optional<SolutionType> threshold;
     boost::optional<storm::storage::BitVector> relevantValueVector;
     bool robustAgainstUncertainty = true;  // If set to false, the uncertainty is interpreted as controllable.
+    std::shared_ptr<storm::models::sparse::ModelAnalysisCache<ValueType>> analysisCache;
 };
 
 template<typename ValueType, typename MatrixType, typename SolutionType>
@@ -1,5 +1,8 @@
 #include "storm/solver/TopologicalLinearEquationSolver.h"
 
+#include <atomic>
+#include <type_traits>
+
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
 
 #include "storm/adapters/RationalFunctionAdapter.h"
@@ -9,6 +12,7 @@
 #include "storm/utility/ProgressMeasurement.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/Stopwatch.h"
+#include "storm/utility/TaskPool.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/vector.h"
 
@@ -69,7 +73,7 @@ bool TopologicalLinearEquationSolver<ValueType>::internalSolveEquations(Environm
     if (!this->sortedSccDecomposition || (needAdaptPrecision && !this->longestSccChainSize)) {
         STORM_LOG_TRACE("Creating SCC decomposition.");
         storm::utility::Stopwatch sccSw(true);
-        createSortedSccDecomposition(needAdaptPrecision);
+        createSortedSccDecomposition(needAdaptPrecision, env.solver().getNumberOfThreads());
         sccSw.stop();
         STORM_LOG_INFO("SCC decomposition computed in "
                        << sccSw << ". Found " << this->sortedSccDecomposition->size() << " SCC(s) containing a total of " << x.size()
@@ -112,26 +116,31 @@ bool TopologicalLinearEquationSolver<ValueType>::internalSolveEquations(Environm
                 }
             }
         }
-        storm::storage::BitVector sccAsBitVector(x.size(), false);
-        uint64_t sccIndex = 0;
-        storm::utility::ProgressMeasurement progress("states");
-        progress.setMaxCount(x.size());
-        progress.startNewMeasurement(0);
-        for (auto const& scc : *this->sortedSccDecomposition) {
-            if (scc.size() == 1) {
-                returnValue = solveTrivialScc(*scc.begin(), x, b) && returnValue;
-            } else {
-                sccAsBitVector.clear();
-                for (auto const& state : scc) {
-                    sccAsBitVector.set(state, true);
+        // Exact arithmetic (in particular rational functions) relies on caches that are not thread-safe, so SCCs are only solved concurrently for doubles.
+        if (std::is_same_v<ValueType, double> && env.solver().getNumberOfThreads() > 1) {
+            returnValue = solveSccsConcurrently(sccSolverEnvironment, env.solver().getNumberOfThreads(), x, b, newRelevantValues);
+        } else {
+            storm::storage::BitVector sccAsBitVector(x.size(), false);
+            uint64_t sccIndex = 0;
+            storm::utility::ProgressMeasurement progress("states");
+            progress.setMaxCount(x.size());
+            progress.startNewMeasurement(0);
+            for (auto const& scc : *this->sortedSccDecomposition) {
+                if (scc.size() == 1) {
+                    returnValue = solveTrivialScc(*scc.begin(), x, b) && returnValue;
+                } else {
+                    sccAsBitVector.clear();
+                    for (auto const& state : scc) {
+                        sccAsBitVector.set(state, true);
+                    }
+                    returnValue = solveScc(sccSolverEnvironment, this->sccSolver, sccAsBitVector, x, b, newRelevantValues) && returnValue;
+                }
+                ++sccIndex;
+                progress.updateProgress(sccIndex);
+                if (storm::utility::resources::isTerminate()) {
+                    STORM_LOG_WARN("Topological solver aborted after analyzing " << sccIndex << "/" << this->sortedSccDecomposition->size() << " SCCs.");
+                    break;
                 }
-                returnValue = solveScc(sccSolverEnvironment, sccAsBitVector, x, b, newRelevantValues) && returnValue;
-            }
-            ++sccIndex;
-            progress.updateProgress(sccIndex);
-            if (storm::utility::resources::isTerminate()) {
-                STORM_LOG_WARN("Topological solver aborted after analyzing " << sccIndex << "/" << this->sortedSccDecomposition->size() << " SCCs.");
-                break;
             }
         }
     }
@@ -144,15 +153,62 @@ bool TopologicalLinearEquationSolver<ValueType>::internalSolveEquations(Environm
 }
 
 template<typename ValueType>
-void TopologicalLinearEquationSolver<ValueType>::createSortedSccDecomposition(bool needLongestChainSize) const {
+void TopologicalLinearEquationSolver<ValueType>::createSortedSccDecomposition(bool needLongestChainSize, uint64_t numberOfThreads) const {
     // Obtain the scc decomposition
     this->sortedSccDecomposition = std::make_unique<storm::storage::StronglyConnectedComponentDecomposition<ValueType>>(
-        *this->A, storm::storage::StronglyConnectedComponentDecompositionOptions().forceTopologicalSort().computeSccDepths(needLongestChainSize));
+        *this->A, storm::storage::StronglyConnectedComponentDecompositionOptions()
+                      .forceTopologicalSort()
+                      .computeSccDepths(needLongestChainSize)
+                      .useThreads(numberOfThreads));
+    this->sccScheduler.reset();
     if (needLongestChainSize) {
         this->longestSccChainSize = this->sortedSccDecomposition->getMaxSccDepth() + 1;
     }
 }
 
+template<typename ValueType>
+bool TopologicalLinearEquationSolver<ValueType>::solveSccsConcurrently(storm::Environment const& sccSolverEnvironment, uint64_t numberOfThreads,
+                                                                       std::vector<ValueType>& x, std::vector<ValueType> const& b,
+                                                                       std::optional<storm::storage::BitVector> const& globalRelevantValues) const {
+    if (!this->sccScheduler) {
+        this->sccScheduler = std::make_unique<storm::solver::helper::TopologicalSccScheduler>(*this->A, *this->sortedSccDecomposition);
+    }
+    STORM_LOG_INFO("Solving " << this->sortedSccDecomposition->size() << " SCCs in " << this->sccScheduler->getNumberOfTasks() << " tasks with "
+                              << numberOfThreads << " threads.");
+
+    // The SCCs are solved concurrently, so the solvers for the individual SCCs use a single thread.
+    storm::Environment singleThreadedSccSolverEnvironment = sccSolverEnvironment;
+    singleThreadedSccSolverEnvironment.solver().setNumberOfThreads(1);
+    storm::utility::TaskPool pool(numberOfThreads);
+    this->concurrentSccSolvers.resize(pool.getNumberOfThreads());
+    std::vector<storm::storage::BitVector> sccAsBitVectors(pool.getNumberOfThreads(), storm::storage::BitVector(x.size(), false));
+    std::atomic<bool> returnValue(true);
+
+    bool const completed = this->sccScheduler->process(
+        pool,
+        [&](auto stateIt, auto stateIte) {
+            for (; stateIt != stateIte; ++stateIt) {
+                solveTrivialScc(*stateIt, x, b);
+            }
+        },
+        [&](uint64_t sccIndex) {
+            uint64_t const threadIndex = pool.getCurrentThreadIndex();
+            auto const& scc = (*this->sortedSccDecomposition)[sccIndex];
+            storm::storage::BitVector& sccAsBitVector = sccAsBitVectors[threadIndex];
+            for (auto const& state : scc) {
+                sccAsBitVector.set(state, true);
+            }
+            if (!solveScc(singleThreadedSccSolverEnvironment, this->concurrentSccSolvers[threadIndex], sccAsBitVector, x, b, globalRelevantValues)) {
+                returnValue = false;
+            }
+            for (auto const& state : scc) {
+                sccAsBitVector.set(state, false);
+            }
+        });
+    STORM_LOG_WARN_COND(completed, "Topological solver aborted before all SCCs were analyzed.");
+    return returnValue;
+}
+
 template<typename ValueType>
 bool TopologicalLinearEquationSolver<ValueType>::solveTrivialScc(uint64_t const& sccState, std::vector<ValueType>& globalX,
                                                                  std::vector<ValueType> const& globalB) const {
@@ -207,25 +263,27 @@ bool TopologicalLinearEquationSolver<ValueType>::solveFullyConnectedEquationSyst
 }
 
 template<typename ValueType>
-bool TopologicalLinearEquationSolver<ValueType>::solveScc(storm::Environment const& sccSolverEnvironment, storm::storage::BitVector const& scc,
-                                                          std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB,
+bool TopologicalLinearEquationSolver<ValueType>::solveScc(storm::Environment const& sccSolverEnvironment,
+                                                          std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>>& sccSolver,
+                                                          storm::storage::BitVector const& scc, std::vector<ValueType>& globalX,
+                                                          std::vector<ValueType> const& globalB,
                                                           std::optional<storm::storage::BitVector> const& globalRelevantValues) const {
     // Set up the SCC solver
-    if (!this->sccSolver) {
-        this->sccSolver = GeneralLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
-        this->sccSolver->setCachingEnabled(true);
+    if (!sccSolver) {
+        sccSolver = GeneralLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
+        sccSolver->setCachingEnabled(true);
     }
     if (globalRelevantValues) {
-        this->sccSolver->setRelevantValues((*globalRelevantValues) % scc);
+        sccSolver->setRelevantValues((*globalRelevantValues) % scc);
     }
 
     // Matrix
-    bool asEquationSystem = this->sccSolver->getEquationProblemFormat(sccSolverEnvironment) == LinearEquationSolverProblemFormat::EquationSystem;
+    bool asEquationSystem = sccSolver->getEquationProblemFormat(sccSolverEnvironment) == LinearEquationSolverProblemFormat::EquationSystem;
     storm::storage::SparseMatrix<ValueType> sccA = this->A->getSubmatrix(true, scc, scc, asEquationSystem);
     if (asEquationSystem) {
         sccA.convertToEquationSystem();
     }
-    this->sccSolver->setMatrix(std::move(sccA));
+    sccSolver->setMatrix(std::move(sccA));
 
     // x Vector
     auto sccX = storm::utility::vector::filterVector(globalX, scc);
@@ -245,20 +303,20 @@ bool TopologicalLinearEquationSolver<ValueType>::solveScc(storm::Environment con
 
     // lower/upper bounds
     if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
-        this->sccSolver->setLowerBound(this->getLowerBound());
+        sccSolver->setLowerBound(this->getLowerBound());
     } else if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
-        this->sccSolver->setLowerBounds(storm::utility::vector::filterVector(this->getLowerBounds(), scc));
+        sccSolver->setLowerBounds(storm::utility::vector::filterVector(this->getLowerBounds(), scc));
     }
     if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
-        this->sccSolver->setUpperBound(this->getUpperBound());
+        sccSolver->setUpperBound(this->getUpperBound());
     } else if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
-        this->sccSolver->setUpperBounds(storm::utility::vector::filterVector(this->getUpperBounds(), scc));
+        sccSolver->setUpperBounds(storm::utility::vector::filterVector(this->getUpperBounds(), scc));
     }
 
     // std::cout << "rhs is " << storm::utility::vector::toString(sccB) << '\n';
     // std::cout << "x is " << storm::utility::vector::toString(sccX) << '\n';
 
-    bool returnvalue = this->sccSolver->solveEquations(sccSolverEnvironment, sccX, sccB);
+    bool returnvalue = sccSolver->solveEquations(sccSolverEnvironment, sccX, sccB);
     storm::utility::vector::setVectorValues(globalX, scc, sccX);
     return returnvalue;
 }
@@ -279,6 +337,8 @@ void TopologicalLinearEquationSolver<ValueType>::clearCache() const {
     sortedSccDecomposition.reset();
     longestSccChainSize = boost::none;
     sccSolver.reset();
+    sccScheduler.reset();
+    concurrentSccSolvers.clear();
     LinearEquationSolver<ValueType>::clearCache();
 }
 
@@ -3,6 +3,7 @@
 #include "storm/solver/LinearEquationSolver.h"
 
 #include "storm/solver/SolverSelectionOptions.h"
+#include "storm/solver/helper/TopologicalSccScheduler.h"
 #include "storm/solver/multiplier/NativeMultiplier.h"
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
 
@@ -37,16 +38,21 @@ class TopologicalLinearEquationSolver : public LinearEquationSolver<ValueType> {
     storm::Environment getEnvironmentForUnderlyingSolver(storm::Environment const& env, bool adaptPrecision = false) const;
 
     // Creates an SCC decomposition and sorts the SCCs according to a topological sort.
-    void createSortedSccDecomposition(bool needLongestChainSize) const;
+    void createSortedSccDecomposition(bool needLongestChainSize, uint64_t numberOfThreads) const;
+
+    // Solves the SCCs with the given number of threads. SCCs that do not depend on each other are solved concurrently.
+    bool solveSccsConcurrently(storm::Environment const& sccSolverEnvironment, uint64_t numberOfThreads, std::vector<ValueType>& x,
+                               std::vector<ValueType> const& b, std::optional<storm::storage::BitVector> const& globalRelevantValues) const;
 
     // Solves the SCC with the given index
     // ... for the case that the SCC is trivial
     bool solveTrivialScc(uint64_t const& sccState, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const;
     // ... for the case that there is just one large SCC
     bool solveFullyConnectedEquationSystem(storm::Environment const& sccSolverEnvironment, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
-    // ... for the remaining cases (1 < scc.size() < x.size())
-    bool solveScc(storm::Environment const& sccSolverEnvironment, storm::storage::BitVector const& scc, std::vector<ValueType>& globalX,
-                  std::vector<ValueType> const& globalB, std::optional<storm::storage::BitVector> const& globalRelevantValues) const;
+    // ... for the remaining cases (1 < scc.size() < x.size()), using (and creating, if necessary) the given solver
+    bool solveScc(storm::Environment const& sccSolverEnvironment, std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>>& sccSolver,
+                  storm::storage::BitVector const& scc, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB,
+                  std::optional<storm::storage::BitVector> const& globalRelevantValues) const;
 
     // If the solver takes posession of the matrix, we store the moved matrix in this member, so it gets deleted
     // when the solver is destructed.
@@ -60,6 +66,8 @@ class TopologicalLinearEquationSolver : public LinearEquationSolver<ValueType> {
     mutable std::unique_ptr<storm::storage::StronglyConnectedComponentDecomposition<ValueType>> sortedSccDecomposition;
     mutable boost::optional<uint64_t> longestSccChainSize;
     mutable std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> sccSolver;
+    mutable std::unique_ptr<storm::solver::helper::TopologicalSccScheduler> sccScheduler;
+    mutable std::vector<std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>>> concurrentSccSolvers;  // one solver per thread
 };
 
 template<typename ValueType>
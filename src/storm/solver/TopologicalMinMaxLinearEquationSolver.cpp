@@ -1,5 +1,8 @@
 #include "storm/solver/TopologicalMinMaxLinearEquationSolver.h"
 
+#include <atomic>
+#include <type_traits>
+
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
 
@@ -10,6 +13,7 @@
 #include "storm/utility/ProgressMeasurement.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/Stopwatch.h"
+#include "storm/utility/TaskPool.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/vector.h"
 
@@ -61,7 +65,7 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::internalSol
     if (!this->sortedSccDecomposition || (needAdaptPrecision && !this->longestSccChainSize)) {
         STORM_LOG_TRACE("Creating SCC decomposition.");
         storm::utility::Stopwatch sccSw(true);
-        createSortedSccDecomposition(needAdaptPrecision);
+        createSortedSccDecomposition(needAdaptPrecision, env.solver().getNumberOfThreads());
         sccSw.stop();
         STORM_LOG_INFO("SCC decomposition computed in "
                        << sccSw << ". Found " << this->sortedSccDecomposition->size() << " SCC(s) containing a total of " << x.size()
@@ -114,39 +118,34 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::internalSol
                 }
             }
         }
-        storm::storage::BitVector sccRowGroupsAsBitVector(x.size(), false);
-        storm::storage::BitVector sccRowsAsBitVector(b.size(), false);
-        uint64_t sccIndex = 0;
-        storm::utility::ProgressMeasurement progress("states");
-        progress.setMaxCount(x.size());
-        progress.startNewMeasurement(0);
-        for (auto const& scc : *this->sortedSccDecomposition) {
-            if (scc.size() == 1) {
-                returnValue = solveTrivialScc(*scc.begin(), dir, x, b) && returnValue;
-            } else {
-                STORM_LOG_TRACE("Solving SCC of size " << scc.size() << ".");
-                sccRowGroupsAsBitVector.clear();
-                sccRowsAsBitVector.clear();
-                for (auto const& group : scc) {  // Group refers to state
-                    sccRowGroupsAsBitVector.set(group, true);
-
-                    if (!this->choiceFixedForRowGroup || !this->choiceFixedForRowGroup.get()[group]) {
-                        for (uint64_t row = this->A->getRowGroupIndices()[group]; row < this->A->getRowGroupIndices()[group + 1]; ++row) {
-                            sccRowsAsBitVector.set(row, true);
-                        }
-                    } else {
-                        auto row = this->A->getRowGroupIndices()[group] + this->getInitialScheduler()[group];
-                        sccRowsAsBitVector.set(row, true);
-                        STORM_LOG_TRACE("Fixing state " << group << " to choice " << this->getInitialScheduler()[group] << ".");
-                    }
+        // Exact arithmetic (in particular rational functions) relies on caches that are not thread-safe, so SCCs are only solved concurrently for doubles.
+        if (std::is_same_v<ValueType, double> && env.solver().getNumberOfThreads() > 1) {
+            returnValue = solveSccsConcurrently(sccSolverEnvironment, dir, env.solver().getNumberOfThreads(), x, b, newRelevantValues);
+        } else {
+            storm::storage::BitVector sccRowGroupsAsBitVector(x.size(), false);
+            storm::storage::BitVector sccRowsAsBitVector(b.size(), false);
+            uint64_t sccIndex = 0;
+            storm::utility::ProgressMeasurement progress("states");
+            progress.setMaxCount(x.size());
+            progress.startNewMeasurement(0);
+            for (auto const& scc : *this->sortedSccDecomposition) {
+                if (scc.size() == 1) {
+                    returnValue = solveTrivialScc(*scc.begin(), dir, x, b) && returnValue;
+                } else {
+                    STORM_LOG_TRACE("Solving SCC of size " << scc.size() << ".");
+                    sccRowGroupsAsBitVector.clear();
+                    sccRowsAsBitVector.clear();
+                    setSccRowGroupsAndRows(scc, sccRowGroupsAsBitVector, sccRowsAsBitVector, true);
+                    returnValue =
+                        solveScc(sccSolverEnvironment, dir, this->sccSolver, sccRowGroupsAsBitVector, sccRowsAsBitVector, x, b, newRelevantValues) &&
+                        returnValue;
+                }
+                ++sccIndex;
+                progress.updateProgress(sccIndex);
+                if (storm::utility::resources::isTerminate()) {
+                    STORM_LOG_WARN("Topological solver aborted after analyzing " << sccIndex << "/" << this->sortedSccDecomposition->size() << " SCCs.");
+                    break;
                 }
-                returnValue = solveScc(sccSolverEnvironment, dir, sccRowGroupsAsBitVector, sccRowsAsBitVector, x, b, newRelevantValues) && returnValue;
-            }
-            ++sccIndex;
-            progress.updateProgress(sccIndex);
-            if (storm::utility::resources::isTerminate()) {
-                STORM_LOG_WARN("Topological solver aborted after analyzing " << sccIndex << "/" << this->sortedSccDecomposition->size() << " SCCs.");
-                break;
             }
         }
 
@@ -168,13 +167,78 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::internalSol
 }
 
 template<typename ValueType, typename SolutionType>
-void TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::createSortedSccDecomposition(bool needLongestChainSize) const {
+void TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::createSortedSccDecomposition(bool needLongestChainSize, uint64_t numberOfThreads) const {
     // Obtain the scc decomposition
     this->sortedSccDecomposition = std::make_unique<storm::storage::StronglyConnectedComponentDecomposition<ValueType>>(
-        *this->A, storm::storage::StronglyConnectedComponentDecompositionOptions().forceTopologicalSort().computeSccDepths(needLongestChainSize));
+        *this->A, storm::storage::StronglyConnectedComponentDecompositionOptions()
+                      .forceTopologicalSort()
+                      .computeSccDepths(needLongestChainSize)
+                      .useThreads(numberOfThreads));
     if (needLongestChainSize) {
         this->longestSccChainSize = this->sortedSccDecomposition->getMaxSccDepth() + 1;
     }
+    this->sccScheduler.reset();
+}
+
+template<typename ValueType, typename SolutionType>
+bool TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::solveSccsConcurrently(
+    storm::Environment const& sccSolverEnvironment, OptimizationDirection dir, uint64_t numberOfThreads, std::vector<ValueType>& x,
+    std::vector<ValueType> const& b, std::optional<storm::storage::BitVector> const& globalRelevantValues) const {
+    if (!this->sccScheduler) {
+        this->sccScheduler = std::make_unique<storm::solver::helper::TopologicalSccScheduler>(*this->A, *this->sortedSccDecomposition);
+    }
+    STORM_LOG_INFO("Solving " << this->sortedSccDecomposition->size() << " SCCs in " << this->sccScheduler->getNumberOfTasks() << " tasks with "
+                              << numberOfThreads << " threads.");
+
+    // The SCCs are solved concurrently, so the solvers for the individual SCCs use a single thread.
+    storm::Environment singleThreadedSccSolverEnvironment = sccSolverEnvironment;
+    singleThreadedSccSolverEnvironment.solver().setNumberOfThreads(1);
+    storm::utility::TaskPool pool(numberOfThreads);
+    this->concurrentSccSolvers.resize(pool.getNumberOfThreads());
+    std::vector<storm::storage::BitVector> sccRowGroupsAsBitVectors(pool.getNumberOfThreads(), storm::storage::BitVector(x.size(), false));
+    std::vector<storm::storage::BitVector> sccRowsAsBitVectors(pool.getNumberOfThreads(), storm::storage::BitVector(b.size(), false));
+    std::atomic<bool> returnValue(true);
+
+    bool const completed = this->sccScheduler->process(
+        pool,
+        [&](auto stateIt, auto stateIte) {
+            for (; stateIt != stateIte; ++stateIt) {
+                solveTrivialScc(*stateIt, dir, x, b);
+            }
+        },
+        [&](uint64_t sccIndex) {
+            uint64_t const threadIndex = pool.getCurrentThreadIndex();
+            auto const& scc = (*this->sortedSccDecomposition)[sccIndex];
+            STORM_LOG_TRACE("Solving SCC of size " << scc.size() << ".");
+            storm::storage::BitVector& sccRowGroupsAsBitVector = sccRowGroupsAsBitVectors[threadIndex];
+            storm::storage::BitVector& sccRowsAsBitVector = sccRowsAsBitVectors[threadIndex];
+            setSccRowGroupsAndRows(scc, sccRowGroupsAsBitVector, sccRowsAsBitVector, true);
+            if (!solveScc(singleThreadedSccSolverEnvironment, dir, this->concurrentSccSolvers[threadIndex], sccRowGroupsAsBitVector, sccRowsAsBitVector, x,
+                          b, globalRelevantValues)) {
+                returnValue = false;
+            }
+            setSccRowGroupsAndRows(scc, sccRowGroupsAsBitVector, sccRowsAsBitVector, false);
+        });
+    STORM_LOG_WARN_COND(completed, "Topological solver aborted before all SCCs were analyzed.");
+    return returnValue;
+}
+
+template<typename ValueType, typename SolutionType>
+void TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::setSccRowGroupsAndRows(storm::storage::StronglyConnectedComponent const& scc,
+                                                                                            storm::storage::BitVector& sccRowGroups,
+                                                                                            storm::storage::BitVector& sccRows, bool value) const {
+    for (auto const& group : scc) {  // Group refers to state
+        sccRowGroups.set(group, value);
+        if (!this->choiceFixedForRowGroup || !this->choiceFixedForRowGroup.get()[group]) {
+            for (uint64_t row = this->A->getRowGroupIndices()[group]; row < this->A->getRowGroupIndices()[group + 1]; ++row) {
+                sccRows.set(row, value);
+            }
+        } else {
+            auto row = this->A->getRowGroupIndices()[group] + this->getInitialScheduler()[group];
+            sccRows.set(row, value);
+            STORM_LOG_TRACE("Fixing state " << group << " to choice " << this->getInitialScheduler()[group] << ".");
+        }
+    }
 }
 
 template<typename ValueType, typename SolutionType>
@@ -311,20 +375,21 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::solveFullyC
 
 template<typename ValueType, typename SolutionType>
 bool TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::solveScc(storm::Environment const& sccSolverEnvironment, OptimizationDirection dir,
+                                                                              std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>>& sccSolver,
                                                                               storm::storage::BitVector const& sccRowGroups,
                                                                               storm::storage::BitVector const& sccRows, std::vector<ValueType>& globalX,
                                                                               std::vector<ValueType> const& globalB,
                                                                               std::optional<storm::storage::BitVector> const& globalRelevantValues) const {
     // Set up the SCC solver
-    if (!this->sccSolver) {
-        this->sccSolver = GeneralMinMaxLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
-        this->sccSolver->setCachingEnabled(true);
+    if (!sccSolver) {
+        sccSolver = GeneralMinMaxLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
+        sccSolver->setCachingEnabled(true);
     }
-    this->sccSolver->setHasUniqueSolution(this->hasUniqueSolution());
-    this->sccSolver->setHasNoEndComponents(this->hasNoEndComponents());
-    this->sccSolver->setTrackScheduler(this->isTrackSchedulerSet());
+    sccSolver->setHasUniqueSolution(this->hasUniqueSolution());
+    sccSolver->setHasNoEndComponents(this->hasNoEndComponents());
+    sccSolver->setTrackScheduler(this->isTrackSchedulerSet());
     if (globalRelevantValues) {
-        this->sccSolver->setRelevantValues((*globalRelevantValues) % sccRowGroups);
+        sccSolver->setRelevantValues((*globalRelevantValues) % sccRowGroups);
     }
 
     storm::storage::SparseMatrix<ValueType> sccA;
@@ -339,7 +404,7 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::solveScc(st
             // As we removed the entries where the choice was fixed, we need to change the scheduler.
             // We set the scheduler to 0 for those states.
             storm::utility::vector::setVectorValues<uint_fast64_t>(sccInitChoices, choiceFixedForStateSCC, 0);
-            this->sccSolver->setInitialScheduler(std::move(sccInitChoices));
+            sccSolver->setInitialScheduler(std::move(sccInitChoices));
         }
 
     } else {
@@ -348,11 +413,11 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::solveScc(st
         // initial scheduler
         if (this->hasInitialScheduler()) {
             auto sccInitChoices = storm::utility::vector::filterVector(this->getInitialScheduler(), sccRowGroups);
-            this->sccSolver->setInitialScheduler(std::move(sccInitChoices));
+            sccSolver->setInitialScheduler(std::move(sccInitChoices));
         }
     }
 
-    this->sccSolver->setMatrix(std::move(sccA));
+    sccSolver->setMatrix(std::move(sccA));
 
     // x Vector
     auto sccX = storm::utility::vector::filterVector(globalX, sccRowGroups);
@@ -370,21 +435,21 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::solveScc(st
         sccB.push_back(std::move(bi));
     }
 
-    auto req = this->sccSolver->getRequirements(sccSolverEnvironment, dir);
-    this->sccSolver->clearBounds();
+    auto req = sccSolver->getRequirements(sccSolverEnvironment, dir);
+    sccSolver->clearBounds();
     // lower/upper bounds
     if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
-        this->sccSolver->setLowerBound(this->getLowerBound());
+        sccSolver->setLowerBound(this->getLowerBound());
         req.clearLowerBounds();
     } else if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
-        this->sccSolver->setLowerBounds(storm::utility::vector::filterVector(this->getLowerBounds(), sccRowGroups));
+        sccSolver->setLowerBounds(storm::utility::vector::filterVector(this->getLowerBounds(), sccRowGroups));
         req.clearLowerBounds();
     }
     if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
-        this->sccSolver->setUpperBound(this->getUpperBound());
+        sccSolver->setUpperBound(this->getUpperBound());
         req.clearUpperBounds();
     } else if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
-        this->sccSolver->setUpperBounds(storm::utility::vector::filterVector(this->getUpperBounds(), sccRowGroups));
+        sccSolver->setUpperBounds(storm::utility::vector::filterVector(this->getUpperBounds(), sccRowGroups));
         req.clearUpperBounds();
     }
 
@@ -397,14 +462,14 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::solveScc(st
     }
     STORM_LOG_THROW(!req.hasEnabledCriticalRequirement(), storm::exceptions::UncheckedRequirementException,
                     "Solver requirements " + req.getEnabledRequirementsAsString() + " not checked.");
-    this->sccSolver->setRequirementsChecked(true);
+    sccSolver->setRequirementsChecked(true);
 
     // Invoke scc solver
-    bool res = this->sccSolver->solveEquations(sccSolverEnvironment, dir, sccX, sccB);
+    bool res = sccSolver->solveEquations(sccSolverEnvironment, dir, sccX, sccB);
 
     // Set Scheduler choices
     if (this->isTrackSchedulerSet()) {
-        storm::utility::vector::setVectorValues(this->schedulerChoices.get(), sccRowGroups, this->sccSolver->getSchedulerChoices());
+        storm::utility::vector::setVectorValues(this->schedulerChoices.get(), sccRowGroups, sccSolver->getSchedulerChoices());
     }
 
     // Set solution
@@ -428,6 +493,8 @@ void TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::clearCache(
     longestSccChainSize = boost::none;
     sccSolver.reset();
     auxiliaryRowGroupVector.reset();
+    sccScheduler.reset();
+    concurrentSccSolvers.clear();
     StandardMinMaxLinearEquationSolver<ValueType, SolutionType>::clearCache();
 }
 
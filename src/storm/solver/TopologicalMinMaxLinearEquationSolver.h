@@ -5,6 +5,7 @@
 #include "storm/solver/StandardMinMaxLinearEquationSolver.h"
 
 #include "storm/solver/SolverSelectionOptions.h"
+#include "storm/solver/helper/TopologicalSccScheduler.h"
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
 
 namespace storm {
@@ -36,7 +37,15 @@ class TopologicalMinMaxLinearEquationSolver : public StandardMinMaxLinearEquatio
     storm::Environment getEnvironmentForUnderlyingSolver(storm::Environment const& env, bool adaptPrecision = false) const;
 
     // Creates an SCC decomposition and sorts the SCCs according to a topological sort.
-    void createSortedSccDecomposition(bool needLongestChainSize) const;
+    void createSortedSccDecomposition(bool needLongestChainSize, uint64_t numberOfThreads) const;
+
+    // Solves all SCCs using the given number of threads, where SCCs that do not depend on each other are solved concurrently.
+    bool solveSccsConcurrently(storm::Environment const& sccSolverEnvironment, OptimizationDirection d, uint64_t numberOfThreads, std::vector<ValueType>& x,
+                               std::vector<ValueType> const& b, std::optional<storm::storage::BitVector> const& globalRelevantValues) const;
+
+    // Sets the given value for the row groups of the SCC and their rows that are not excluded by a fixed choice.
+    void setSccRowGroupsAndRows(storm::storage::StronglyConnectedComponent const& scc, storm::storage::BitVector& sccRowGroups,
+                                storm::storage::BitVector& sccRows, bool value) const;
 
     // Solves the SCC with the given index
     // ... for the case that the SCC is trivial
@@ -45,7 +54,8 @@ class TopologicalMinMaxLinearEquationSolver : public StandardMinMaxLinearEquatio
     bool solveFullyConnectedEquationSystem(storm::Environment const& sccSolverEnvironment, OptimizationDirection d, std::vector<SolutionType>& x,
                                            std::vector<ValueType> const& b) const;
     // ... for the remaining cases (1 < scc.size() < x.size())
-    bool solveScc(storm::Environment const& sccSolverEnvironment, OptimizationDirection d, storm::storage::BitVector const& sccRowGroups,
+    bool solveScc(storm::Environment const& sccSolverEnvironment, OptimizationDirection d,
+                  std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>>& sccSolver, storm::storage::BitVector const& sccRowGroups,
                   storm::storage::BitVector const& sccRows, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB,
                   std::optional<storm::storage::BitVector> const& globalRelevantValues) const;
 
@@ -54,6 +64,8 @@ class TopologicalMinMaxLinearEquationSolver : public StandardMinMaxLinearEquatio
     mutable boost::optional<uint64_t> longestSccChainSize;
     mutable std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> sccSolver;
     mutable std::unique_ptr<std::vector<ValueType>> auxiliaryRowGroupVector;  // A.rowGroupCount() entries
+    mutable std::unique_ptr<helper::TopologicalSccScheduler> sccScheduler;
+    mutable std::vector<std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>>> concurrentSccSolvers;  // one solver per thread
 };
 }  // namespace solver
 }  // namespace storm
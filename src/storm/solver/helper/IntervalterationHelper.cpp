@@ -49,6 +49,10 @@ class IIBackend {
         return false;
     }
 
+    void merge(IIBackend const&) {
+        // intentionally left empty.
+    }
+
    private:
     storm::utility::Extremum<Dir, ValueType> xBest, yBest;
 };
@@ -58,6 +58,10 @@ class GSVIBackend {
         return false;
     }
 
+    void merge(GSVIBackend const& other) {
+        isConverged &= other.isConverged;
+    }
+
    private:
     storm::utility::Extremum<Dir, ValueType> best;
     ValueType const precision;
@@ -168,6 +172,13 @@ class OVIBackend {
         return crossed;
     }
 
+    void merge(OVIBackend const& other) {
+        isAllUp &= other.isAllUp;
+        isAllDown &= other.isAllDown;
+        crossed |= other.crossed;
+        errorValue &= other.errorValue;
+    }
+
     ValueType error() {
         return *errorValue;
     }
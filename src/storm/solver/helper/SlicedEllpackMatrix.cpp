@@ -0,0 +1,174 @@
+#include "storm/solver/helper/SlicedEllpackMatrix.h"
+
+#include <algorithm>
+
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/macros.h"
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define STORM_SLICED_ELLPACK_X86_KERNELS
+#include <immintrin.h>
+#endif
+
+namespace storm::solver::helper {
+
+namespace {
+
+uint64_t getRowOfPosition(uint64_t position, uint64_t numberOfRows, bool reverseRowOrder) {
+    return reverseRowOrder ? numberOfRows - 1 - position : position;
+}
+
+template<typename Callback>
+void forEachSliceWidth(storm::storage::SparseMatrix<double> const& matrix, bool reverseRowOrder, Callback const& callback) {
+    uint64_t const numberOfRows = matrix.getRowCount();
+    for (uint64_t sliceBegin = 0; sliceBegin < numberOfRows; sliceBegin += SlicedEllpackMatrix::SliceSize) {
+        uint64_t width = 0;
+        for (uint64_t position = sliceBegin; position < std::min(sliceBegin + SlicedEllpackMatrix::SliceSize, numberOfRows); ++position) {
+            width = std::max<uint64_t>(width, matrix.getRow(getRowOfPosition(position, numberOfRows, reverseRowOrder)).getNumberOfEntries());
+        }
+        callback(width);
+    }
+}
+
+void multiplyAddScalar(uint32_t const* columns, double const* values, uint64_t const* sliceOffsets, uint64_t firstSlice, uint64_t endSlice, double const* x,
+                       double* result) {
+    for (uint64_t slice = firstSlice; slice < endSlice; ++slice, result += SlicedEllpackMatrix::SliceSize) {
+        for (uint64_t position = sliceOffsets[slice]; position < sliceOffsets[slice + 1]; position += SlicedEllpackMatrix::SliceSize) {
+            for (uint64_t lane = 0; lane < SlicedEllpackMatrix::SliceSize; ++lane) {
+                if (columns[position + lane] != std::numeric_limits<uint32_t>::max()) {
+                    result[lane] += x[columns[position + lane]] * values[position + lane];
+                }
+            }
+        }
+    }
+}
+
+#ifdef STORM_SLICED_ELLPACK_X86_KERNELS
+static_assert(SlicedEllpackMatrix::SliceSize == 8, "The SIMD kernels assume slices of size 8.");
+
+__attribute__((target("avx2"))) void multiplyAddAvx2(uint32_t const* columns, double const* values, uint64_t const* sliceOffsets, uint64_t firstSlice,
+                                                      uint64_t endSlice, double const* x, double* result) {
+    __m128i const padding = _mm_set1_epi32(-1);
+    for (uint64_t slice = firstSlice; slice < endSlice; ++slice, result += SlicedEllpackMatrix::SliceSize) {
+        __m256d lowerResult = _mm256_loadu_pd(result);
+        __m256d upperResult = _mm256_loadu_pd(result + 4);
+        for (uint64_t position = sliceOffsets[slice]; position < sliceOffsets[slice + 1]; position += SlicedEllpackMatrix::SliceSize) {
+            __m128i const lowerColumns = _mm_loadu_si128(reinterpret_cast<__m128i const*>(columns + position));
+            __m128i const upperColumns = _mm_loadu_si128(reinterpret_cast<__m128i const*>(columns + position + 4));
+            // Padding entries are masked out so that the gather does not access x at an invalid position.
+            __m256d const lowerMask = _mm256_castsi256_pd(_mm256_cvtepi32_epi64(_mm_xor_si128(_mm_cmpeq_epi32(lowerColumns, padding), padding)));
+            __m256d const upperMask = _mm256_castsi256_pd(_mm256_cvtepi32_epi64(_mm_xor_si128(_mm_cmpeq_epi32(upperColumns, padding), padding)));
+            __m256d const lowerX = _mm256_mask_i32gather_pd(_mm256_setzero_pd(), x, lowerColumns, lowerMask, 8);
+            __m256d const upperX = _mm256_mask_i32gather_pd(_mm256_setzero_pd(), x, upperColumns, upperMask, 8);
+            lowerResult = _mm256_add_pd(lowerResult, _mm256_mul_pd(lowerX, _mm256_loadu_pd(values + position)));
+            upperResult = _mm256_add_pd(upperResult, _mm256_mul_pd(upperX, _mm256_loadu_pd(values + position + 4)));
+        }
+        _mm256_storeu_pd(result, lowerResult);
+        _mm256_storeu_pd(result + 4, upperResult);
+    }
+}
+
+__attribute__((target("avx512f"))) void multiplyAddAvx512(uint32_t const* columns, double const* values, uint64_t const* sliceOffsets, uint64_t firstSlice,
+                                                           uint64_t endSlice, double const* x, double* result) {
+    __m256i const padding = _mm256_set1_epi32(-1);
+    for (uint64_t slice = firstSlice; slice < endSlice; ++slice, result += SlicedEllpackMatrix::SliceSize) {
+        __m512d sliceResult = _mm512_loadu_pd(result);
+        for (uint64_t position = sliceOffsets[slice]; position < sliceOffsets[slice + 1]; position += SlicedEllpackMatrix::SliceSize) {
+            __m256i const sliceColumns = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(columns + position));
+            // Padding entries are masked out so that the gather does not access x at an invalid position.
+            __mmask8 const mask = _mm512_cmpneq_epi64_mask(_mm512_cvtepu32_epi64(sliceColumns), _mm512_cvtepu32_epi64(padding));
+            __m512d const sliceX = _mm512_mask_i32gather_pd(_mm512_setzero_pd(), mask, sliceColumns, x, 8);
+            sliceResult = _mm512_add_pd(sliceResult, _mm512_mul_pd(sliceX, _mm512_loadu_pd(values + position)));
+        }
+        _mm512_storeu_pd(result, sliceResult);
+    }
+}
+#endif
+
+}  // namespace
+
+SlicedEllpackMatrix::SlicedEllpackMatrix(storm::storage::SparseMatrix<double> const& matrix, bool reverseRowOrder)
+    : numberOfRows(matrix.getRowCount()), kernel(getBestSupportedKernel()) {
+    STORM_LOG_ASSERT(isApplicable(matrix), "The matrix has too many columns for the sliced ELLPACK format.");
+    sliceOffsets.reserve(getNumberOfSlices() + 1);
+    sliceOffsets.push_back(0);
+    forEachSliceWidth(matrix, reverseRowOrder, [this](uint64_t width) { sliceOffsets.push_back(sliceOffsets.back() + width * SliceSize); });
+    columns.assign(sliceOffsets.back(), PaddingColumn);
+    values.assign(sliceOffsets.back(), 0.0);
+
+    for (uint64_t position = 0; position < numberOfRows; ++position) {
+        uint64_t entryPosition = sliceOffsets[position / SliceSize] + position % SliceSize;
+        for (auto const& entry : matrix.getRow(getRowOfPosition(position, numberOfRows, reverseRowOrder))) {
+            columns[entryPosition] = static_cast<uint32_t>(entry.getColumn());
+            values[entryPosition] = entry.getValue();
+            entryPosition += SliceSize;
+        }
+    }
+}
+
+uint64_t SlicedEllpackMatrix::getNumberOfStoredEntries(storm::storage::SparseMatrix<double> const& matrix) {
+    uint64_t result = 0;
+    forEachSliceWidth(matrix, false, [&result](uint64_t width) { result += width * SliceSize; });
+    return result;
+}
+
+bool SlicedEllpackMatrix::isApplicable(storm::storage::SparseMatrix<double> const& matrix) {
+    // The SIMD gathers interpret the column indices as signed 32 bit integers.
+    return matrix.getColumnCount() <= static_cast<uint64_t>(std::numeric_limits<int32_t>::max());
+}
+
+void SlicedEllpackMatrix::multiplyAdd(uint64_t firstSlice, uint64_t endSlice, double const* x, double* result) const {
+    STORM_LOG_ASSERT(firstSlice <= endSlice && endSlice <= getNumberOfSlices(), "Invalid slice range.");
+    switch (kernel) {
+#ifdef STORM_SLICED_ELLPACK_X86_KERNELS
+        case Kernel::Avx512:
+            multiplyAddAvx512(columns.data(), values.data(), sliceOffsets.data(), firstSlice, endSlice, x, result);
+            break;
+        case Kernel::Avx2:
+            multiplyAddAvx2(columns.data(), values.data(), sliceOffsets.data(), firstSlice, endSlice, x, result);
+            break;
+#endif
+        default:
+            multiplyAddScalar(columns.data(), values.data(), sliceOffsets.data(), firstSlice, endSlice, x, result);
+    }
+}
+
+uint64_t SlicedEllpackMatrix::getNumberOfRows() const {
+    return numberOfRows;
+}
+
+uint64_t SlicedEllpackMatrix::getNumberOfSlices() const {
+    return (numberOfRows + SliceSize - 1) / SliceSize;
+}
+
+SlicedEllpackMatrix::Kernel SlicedEllpackMatrix::getKernel() const {
+    return kernel;
+}
+
+void SlicedEllpackMatrix::setKernel(Kernel kernel) {
+    STORM_LOG_THROW(isSupported(kernel), storm::exceptions::NotSupportedException, "The selected kernel is not supported on this machine.");
+    this->kernel = kernel;
+}
+
+bool SlicedEllpackMatrix::isSupported(Kernel kernel) {
+    switch (kernel) {
+        case Kernel::Scalar:
+            return true;
+#ifdef STORM_SLICED_ELLPACK_X86_KERNELS
+        case Kernel::Avx2:
+            return __builtin_cpu_supports("avx2");
+        case Kernel::Avx512:
+            return __builtin_cpu_supports("avx512f");
+#endif
+        default:
+            return false;
+    }
+}
+
+SlicedEllpackMatrix::Kernel SlicedEllpackMatrix::getBestSupportedKernel() {
+    static Kernel const bestKernel = isSupported(Kernel::Avx512) ? Kernel::Avx512 : (isSupported(Kernel::Avx2) ? Kernel::Avx2 : Kernel::Scalar);
+    return bestKernel;
+}
+
+}  // namespace storm::solver::helper
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace storm {
+
+namespace storage {
+template<typename T>
+class SparseMatrix;
+}
+
+namespace solver::helper {
+
+/*!
+ * Stores the rows of a (double-valued) sparse matrix in the sliced ELLPACK format:
+ * The rows are grouped into slices of SliceSize consecutive rows. Within a slice, all rows are padded to the length of the longest row of the slice and
+ * the entries are stored column-major, i.e., the j-th entries of the rows of the slice are stored next to each other.
+ * This allows to multiply all rows of a slice with a vector simultaneously using SIMD gather instructions.
+ * The rows are not reordered so that the row results are obtained in the original order.
+ */
+class SlicedEllpackMatrix {
+   public:
+    /*!
+     * The number of rows of a slice. This corresponds to the number of doubles in an AVX-512 register.
+     */
+    static constexpr uint64_t SliceSize = 8;
+
+    /*!
+     * The kernels that can be used for multiplication.
+     */
+    enum class Kernel { Scalar, Avx2, Avx512 };
+
+    /*!
+     * Creates the sliced representation of the given matrix.
+     * @param matrix the matrix. Must have less than 2^31 columns
+     * @param reverseRowOrder if true, the i'th row of this representation is the i'th last row of the given matrix
+     */
+    SlicedEllpackMatrix(storm::storage::SparseMatrix<double> const& matrix, bool reverseRowOrder);
+
+    /*!
+     * @return the number of entries (including padding entries) the sliced representation of the given matrix has.
+     */
+    static uint64_t getNumberOfStoredEntries(storm::storage::SparseMatrix<double> const& matrix);
+
+    /*!
+     * @return true if the given matrix can be represented in this format.
+     */
+    static bool isApplicable(storm::storage::SparseMatrix<double> const& matrix);
+
+    /*!
+     * Adds the products of the rows within the given slices and the given vector to the given row results, i.e., result[i] += row(firstSlice*SliceSize + i) * x
+     * @param firstSlice the first slice to consider
+     * @param endSlice one past the last slice to consider
+     * @param x the vector to multiply the rows with
+     * @param result the row results. Must have space for (endSlice - firstSlice) * SliceSize values. Values for rows past the last row are unspecified.
+     */
+    void multiplyAdd(uint64_t firstSlice, uint64_t endSlice, double const* x, double* result) const;
+
+    uint64_t getNumberOfRows() const;
+    uint64_t getNumberOfSlices() const;
+
+    /*!
+     * @return the kernel that is used for multiplication.
+     */
+    Kernel getKernel() const;
+
+    /*!
+     * Sets the kernel that is used for multiplication. Throws if the kernel is not supported on this machine.
+     */
+    void setKernel(Kernel kernel);
+
+    /*!
+     * @return true iff the given kernel is supported on this machine.
+     */
+    static bool isSupported(Kernel kernel);
+
+    /*!
+     * @return the fastest kernel that is supported on this machine.
+     */
+    static Kernel getBestSupportedKernel();
+
+   private:
+    /*!
+     * The column that is used for padding entries.
+     */
+    static constexpr uint32_t PaddingColumn = std::numeric_limits<uint32_t>::max();
+
+    uint64_t numberOfRows;
+
+    /*!
+     * The position of the first entry of each slice. Has one additional entry that marks the end of the last slice.
+     */
+    std::vector<uint64_t> sliceOffsets;
+
+    /*!
+     * The columns and values of the entries, stored column-major within each slice. Padding entries have column PaddingColumn and value zero.
+     */
+    std::vector<uint32_t> columns;
+    std::vector<double> values;
+
+    Kernel kernel;
+};
+
+}  // namespace solver::helper
+}  // namespace storm
@@ -34,9 +34,8 @@ class SVIBackend {
     static const SVIStage CurrentStage = Stage;
     using RowValueStorageType = std::vector<std::pair<ValueType, ValueType>>;
 
-    SVIBackend(RowValueStorageType& rowValueStorage, std::optional<ValueType> const& a, std::optional<ValueType> const& b,
-               std::optional<ValueType> const& d = {})
-        : currRowValues(rowValueStorage) {
+    SVIBackend(uint64_t rowValueStorageSize, std::optional<ValueType> const& a, std::optional<ValueType> const& b, std::optional<ValueType> const& d = {})
+        : currRowValues(rowValueStorageSize) {
         if (a.has_value()) {
             aValue &= *a;
         }
@@ -158,6 +157,13 @@ class SVIBackend {
         return false;
     }
 
+    void merge(SVIBackend const& other) {
+        allYLessOne &= other.allYLessOne;
+        curr_a &= other.curr_a;
+        curr_b &= other.curr_b;
+        dValue &= other.dValue;
+    }
+
     std::optional<ValueType> a() const {
         return aValue.getOptionalValue();
     }
@@ -181,7 +187,7 @@ class SVIBackend {
             d = *bValue;
         else if (NewStage != SVIStage::Initial && !dValue.empty())
             d = *dValue;
-        return SVIBackend<ValueType, Dir, NewStage, TrivialRowGrouping>(currRowValues, a(), b(), d);
+        return SVIBackend<ValueType, Dir, NewStage, TrivialRowGrouping>(currRowValues.size(), a(), b(), d);
     }
 
     SVIStage const& getNextStage() const {
@@ -211,7 +217,7 @@ class SVIBackend {
 
     std::pair<ValueType, ValueType> best;
     ExtremumDir bestValue;
-    RowValueStorageType& currRowValues;
+    RowValueStorageType currRowValues;
     uint64_t currRowValuesIndex{0};
 };
 
@@ -365,9 +371,8 @@ typename SoundValueIterationHelper<ValueType, TrivialRowGrouping>::SVIData Sound
     std::pair<std::vector<ValueType>, std::vector<ValueType>>& xy, std::pair<std::vector<ValueType> const*, ValueType> const& offsets, uint64_t& numIterations,
     bool relative, ValueType const& precision, std::optional<ValueType> const& a, std::optional<ValueType> const& b,
     std::function<SolverStatus(SVIData const&)> const& iterationCallback, std::optional<storm::storage::BitVector> const& relevantValues) const {
-    typename SVIBackend<ValueType, Dir, SVIStage::Initial, TrivialRowGrouping>::RowValueStorageType rowValueStorage;
-    rowValueStorage.resize(sizeOfLargestRowGroup - 1);
-    return SVI(xy, offsets, numIterations, relative, precision, SVIBackend<ValueType, Dir, SVIStage::Initial, TrivialRowGrouping>(rowValueStorage, a, b),
+    return SVI(xy, offsets, numIterations, relative, precision,
+               SVIBackend<ValueType, Dir, SVIStage::Initial, TrivialRowGrouping>(sizeOfLargestRowGroup - 1, a, b),
                iterationCallback, relevantValues);
 }
 
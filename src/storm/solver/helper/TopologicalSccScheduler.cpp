@@ -0,0 +1,174 @@
+#include "storm/solver/helper/TopologicalSccScheduler.h"
+
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/utility/SignalHandler.h"
+#include "storm/utility/TaskPool.h"
+#include "storm/utility/macros.h"
+
+namespace storm::solver::helper {
+
+template<typename ValueType>
+TopologicalSccScheduler::TopologicalSccScheduler(storm::storage::SparseMatrix<ValueType> const& matrix,
+                                                 storm::storage::StronglyConnectedComponentDecomposition<ValueType> const& sortedSccDecomposition,
+                                                 uint64_t maximalBatchSize) {
+    uint64_t const numberOfStates = matrix.getRowGroupCount();
+    uint64_t const numberOfSccs = sortedSccDecomposition.size();
+    std::vector<uint64_t> const stateToSccMap = sortedSccDecomposition.computeStateToSccIndexMap(numberOfStates);
+
+    // Compute the length of the longest chain of successor SCCs for every SCC.
+    std::vector<uint64_t> sccLevels(numberOfSccs, 0);
+    uint64_t numberOfLevels = 0;
+    for (uint64_t sccIndex = 0; sccIndex < numberOfSccs; ++sccIndex) {
+        for (auto const state : sortedSccDecomposition[sccIndex]) {
+            for (auto const& entry : matrix.getRowGroup(state)) {
+                uint64_t const successorScc = stateToSccMap[entry.getColumn()];
+                if (successorScc != sccIndex) {
+                    STORM_LOG_ASSERT(successorScc < sccIndex, "The SCC decomposition is not sorted topologically.");
+                    sccLevels[sccIndex] = std::max(sccLevels[sccIndex], sccLevels[successorScc] + 1);
+                }
+            }
+        }
+        numberOfLevels = std::max(numberOfLevels, sccLevels[sccIndex] + 1);
+    }
+
+    // Sort the trivial SCCs by their level.
+    std::vector<uint64_t> levelIndications(numberOfLevels + 1, 0);
+    for (uint64_t sccIndex = 0; sccIndex < numberOfSccs; ++sccIndex) {
+        if (sortedSccDecomposition[sccIndex].size() == 1) {
+            ++levelIndications[sccLevels[sccIndex] + 1];
+        }
+    }
+    std::partial_sum(levelIndications.begin(), levelIndications.end(), levelIndications.begin());
+    trivialSccStates.resize(levelIndications.back());
+    std::vector<uint64_t> nextLevelPosition(levelIndications.begin(), levelIndications.end() - 1);
+    for (uint64_t sccIndex = 0; sccIndex < numberOfSccs; ++sccIndex) {
+        if (sortedSccDecomposition[sccIndex].size() == 1) {
+            trivialSccStates[nextLevelPosition[sccLevels[sccIndex]]++] = *sortedSccDecomposition[sccIndex].begin();
+        }
+    }
+
+    // Create one task for every non-trivial SCC and split the trivial SCCs of each level into batches.
+    // The tasks of non-trivial SCCs come first and get empty ranges of trivial SCCs.
+    std::vector<uint64_t> stateToTaskMap(numberOfStates);
+    taskStateIndications.push_back(0);
+    for (uint64_t sccIndex = 0; sccIndex < numberOfSccs; ++sccIndex) {
+        if (sortedSccDecomposition[sccIndex].size() > 1) {
+            for (auto const state : sortedSccDecomposition[sccIndex]) {
+                stateToTaskMap[state] = taskSccIndices.size();
+            }
+            taskSccIndices.push_back(sccIndex);
+            taskStateIndications.push_back(0);
+        }
+    }
+    for (uint64_t level = 0; level < numberOfLevels; ++level) {
+        for (uint64_t batchStart = levelIndications[level]; batchStart < levelIndications[level + 1]; batchStart += maximalBatchSize) {
+            uint64_t const batchEnd = std::min(batchStart + maximalBatchSize, levelIndications[level + 1]);
+            for (uint64_t position = batchStart; position < batchEnd; ++position) {
+                stateToTaskMap[trivialSccStates[position]] = taskSccIndices.size();
+            }
+            taskSccIndices.push_back(NoScc);
+            taskStateIndications.push_back(batchEnd);
+        }
+    }
+
+    // Find the dependencies between the tasks.
+    uint64_t const numberOfTasks = taskSccIndices.size();
+    numberOfDependencies.assign(numberOfTasks, 0);
+    dependentTaskIndications.assign(numberOfTasks + 1, 0);
+    std::vector<std::pair<uint64_t, uint64_t>> dependencies;  // pairs of tasks and tasks that depend on them
+    std::vector<uint64_t> taskDependencies;
+    auto addDependenciesOfState = [&](uint64_t task, uint64_t state) {
+        for (auto const& entry : matrix.getRowGroup(state)) {
+            uint64_t const successorTask = stateToTaskMap[entry.getColumn()];
+            if (successorTask != task) {
+                taskDependencies.push_back(successorTask);
+            }
+        }
+    };
+    for (uint64_t task = 0; task < numberOfTasks; ++task) {
+        taskDependencies.clear();
+        if (taskSccIndices[task] == NoScc) {
+            for (uint64_t position = taskStateIndications[task]; position < taskStateIndications[task + 1]; ++position) {
+                addDependenciesOfState(task, trivialSccStates[position]);
+            }
+        } else {
+            for (auto const state : sortedSccDecomposition[taskSccIndices[task]]) {
+                addDependenciesOfState(task, state);
+            }
+        }
+        std::sort(taskDependencies.begin(), taskDependencies.end());
+        taskDependencies.erase(std::unique(taskDependencies.begin(), taskDependencies.end()), taskDependencies.end());
+        numberOfDependencies[task] = taskDependencies.size();
+        for (auto const dependency : taskDependencies) {
+            dependencies.emplace_back(dependency, task);
+            ++dependentTaskIndications[dependency + 1];
+        }
+    }
+    std::partial_sum(dependentTaskIndications.begin(), dependentTaskIndications.end(), dependentTaskIndications.begin());
+    dependentTasks.resize(dependencies.size());
+    std::vector<uint64_t> nextDependentPosition(dependentTaskIndications.begin(), dependentTaskIndications.end() - 1);
+    for (auto const& [task, dependentTask] : dependencies) {
+        dependentTasks[nextDependentPosition[task]++] = dependentTask;
+    }
+}
+
+bool TopologicalSccScheduler::process(storm::utility::TaskPool& pool, TrivialSccsCallback const& processTrivialSccs, SccCallback const& processScc) const {
+    uint64_t const numberOfTasks = getNumberOfTasks();
+    std::vector<std::atomic<uint64_t>> remainingDependencies(numberOfTasks);
+    for (uint64_t task = 0; task < numberOfTasks; ++task) {
+        remainingDependencies[task].store(numberOfDependencies[task], std::memory_order_relaxed);
+    }
+    std::atomic<bool> aborted(false);
+
+    std::function<void(uint64_t)> runTask = [&](uint64_t task) {
+        if (aborted.load(std::memory_order_relaxed)) {
+            return;
+        }
+        if (storm::utility::resources::isTerminate()) {
+            aborted = true;
+            return;
+        }
+        if (taskSccIndices[task] == NoScc) {
+            processTrivialSccs(trivialSccStates.begin() + taskStateIndications[task], trivialSccStates.begin() + taskStateIndications[task + 1]);
+        } else {
+            processScc(taskSccIndices[task]);
+        }
+        // Start the tasks for which this was the last remaining dependency.
+        for (uint64_t position = dependentTaskIndications[task]; position < dependentTaskIndications[task + 1]; ++position) {
+            uint64_t const dependentTask = dependentTasks[position];
+            if (remainingDependencies[dependentTask].fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                pool.submit([&runTask, dependentTask]() { runTask(dependentTask); });
+            }
+        }
+    };
+
+    for (uint64_t task = 0; task < numberOfTasks; ++task) {
+        if (numberOfDependencies[task] == 0) {
+            pool.submit([&runTask, task]() { runTask(task); });
+        }
+    }
+    pool.wait();
+    return !aborted;
+}
+
+uint64_t TopologicalSccScheduler::getNumberOfTasks() const {
+    return taskSccIndices.size();
+}
+
+template TopologicalSccScheduler::TopologicalSccScheduler(storm::storage::SparseMatrix<double> const& matrix,
+                                                          storm::storage::StronglyConnectedComponentDecomposition<double> const& sortedSccDecomposition,
+                                                          uint64_t maximalBatchSize);
+template TopologicalSccScheduler::TopologicalSccScheduler(
+    storm::storage::SparseMatrix<storm::RationalNumber> const& matrix,
+    storm::storage::StronglyConnectedComponentDecomposition<storm::RationalNumber> const& sortedSccDecomposition, uint64_t maximalBatchSize);
+template TopologicalSccScheduler::TopologicalSccScheduler(
+    storm::storage::SparseMatrix<storm::RationalFunction> const& matrix,
+    storm::storage::StronglyConnectedComponentDecomposition<storm::RationalFunction> const& sortedSccDecomposition, uint64_t maximalBatchSize);
+
+}  // namespace storm::solver::helper
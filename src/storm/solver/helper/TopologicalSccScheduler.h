@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <vector>
+
+namespace storm {
+namespace storage {
+template<typename ValueType>
+class SparseMatrix;
+template<typename ValueType>
+class StronglyConnectedComponentDecomposition;
+}  // namespace storage
+
+namespace utility {
+class TaskPool;
+}
+
+namespace solver::helper {
+
+/*!
+ * Schedules the SCCs of a topologically sorted SCC decomposition such that SCCs that do not depend on each other are processed concurrently.
+ *
+ * The SCCs are grouped into tasks which form a directed acyclic graph. A task is started as soon as all tasks that contain successors of its states are
+ * finished. Every non-trivial SCC forms a task on its own. Trivial SCCs (i.e., single states) are processed in batches: Two trivial SCCs whose longest chains
+ * of successor SCCs have the same length can not depend on each other, so a batch consists of such trivial SCCs. This avoids the overhead of handling many
+ * small tasks.
+ */
+class TopologicalSccScheduler {
+   public:
+    // Processes the trivial SCCs whose states are given by the range.
+    typedef std::function<void(std::vector<uint64_t>::const_iterator, std::vector<uint64_t>::const_iterator)> TrivialSccsCallback;
+    // Processes the non-trivial SCC with the given index.
+    typedef std::function<void(uint64_t)> SccCallback;
+
+    /*!
+     * Creates the tasks for the given decomposition.
+     *
+     * @param matrix The matrix whose row groups are the states of the decomposition.
+     * @param sortedSccDecomposition The SCC decomposition in which every SCC only has successors in SCCs with a smaller index.
+     * @param maximalBatchSize The maximal number of trivial SCCs that are processed in one task.
+     */
+    template<typename ValueType>
+    TopologicalSccScheduler(storm::storage::SparseMatrix<ValueType> const& matrix,
+                            storm::storage::StronglyConnectedComponentDecomposition<ValueType> const& sortedSccDecomposition, uint64_t maximalBatchSize = 1024);
+
+    /*!
+     * Processes all SCCs with the threads of the given pool. The callbacks are invoked concurrently for SCCs that do not depend on each other.
+     *
+     * @return False if the computation was aborted because termination was requested, in which case some SCCs might not have been processed.
+     */
+    bool process(storm::utility::TaskPool& pool, TrivialSccsCallback const& processTrivialSccs, SccCallback const& processScc) const;
+
+    /*!
+     * Retrieves the number of tasks, i.e., the number of non-trivial SCCs plus the number of batches of trivial SCCs.
+     */
+    uint64_t getNumberOfTasks() const;
+
+   private:
+    static constexpr uint64_t NoScc = std::numeric_limits<uint64_t>::max();
+
+    // For each task, the index of its non-trivial SCC or NoScc if the task is a batch of trivial SCCs.
+    std::vector<uint64_t> taskSccIndices;
+
+    // For each task, the range of its trivial SCCs in trivialSccStates.
+    std::vector<uint64_t> taskStateIndications;
+    std::vector<uint64_t> trivialSccStates;
+
+    // For each task, the number of tasks it depends on and the range of the tasks that depend on it in dependentTasks.
+    std::vector<uint64_t> numberOfDependencies;
+    std::vector<uint64_t> dependentTaskIndications;
+    std::vector<uint64_t> dependentTasks;
+};
+
+}  // namespace solver::helper
+}  // namespace storm
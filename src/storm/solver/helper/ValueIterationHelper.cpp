@@ -48,6 +48,10 @@ class VIOperatorBackend {
         return false;
     }
 
+    void merge(VIOperatorBackend const& other) {
+        isConverged &= other.isConverged;
+    }
+
    private:
     storm::utility::Extremum<Dir, ValueType> best;
     ValueType const precision;
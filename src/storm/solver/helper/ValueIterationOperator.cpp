@@ -1,6 +1,7 @@
 #include "storm/solver/helper/ValueIterationOperator.h"
 
 #include <optional>
+#include <type_traits>
 
 #include "storm/adapters/RationalNumberAdapter.h"
 #include "storm/storage/SparseMatrix.h"
@@ -24,33 +25,60 @@ void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::setMat
     }
     this->backwards = Backward;
     this->hasSkippedRows = false;
-    auto const numRows = matrix.getRowCount();
+    // Compact columns can be used if all column indices as well as the number of entries skipped for an ignored row (which is at most #columns + 1) can be
+    // distinguished from the row indicators.
+    this->useCompactColumns = matrix.getColumnCount() < SkipNumEntriesMask<uint32_t>;
     matrixValues.clear();
-    matrixColumns.clear();
+    if (useCompactColumns) {
+        matrixColumns.clear();
+        matrixColumns.shrink_to_fit();
+        setMatrixEntries<Backward, uint32_t>(matrix);
+    } else {
+        compactMatrixColumns.clear();
+        compactMatrixColumns.shrink_to_fit();
+        setMatrixEntries<Backward, IndexType>(matrix);
+    }
+    slicedMatrix.reset();
+    if constexpr (TrivialRowGrouping && std::is_same_v<ValueType, double>) {
+        // The sliced representation is only worth its additional memory if the rows within a slice have similar lengths.
+        if (useSlicedMatrix && SlicedEllpackMatrix::isApplicable(matrix) &&
+            SlicedEllpackMatrix::getNumberOfStoredEntries(matrix) <= matrix.getEntryCount() * 3 / 2) {
+            slicedMatrix.emplace(matrix, Backward);
+        }
+    }
+    computeChunks();
+}
+
+template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
+template<bool Backward, typename ColumnType>
+void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::setMatrixEntries(storm::storage::SparseMatrix<ValueType> const& matrix) {
+    auto const numRows = matrix.getRowCount();
+    auto& columns = getMatrixColumns<ColumnType>();
+    columns.clear();
     matrixValues.reserve(matrix.getNonzeroEntryCount());
-    matrixColumns.reserve(matrix.getNonzeroEntryCount() + numRows + 1);  // matrixColumns also contain indications for when a row(group) starts
+    columns.reserve(matrix.getNonzeroEntryCount() + numRows + 1);  // columns also contain indications for when a row(group) starts
     if constexpr (!TrivialRowGrouping) {
-        matrixColumns.push_back(StartOfRowGroupIndicator);  // indicate start of first row(group)
+        columns.push_back(StartOfRowGroupIndicator<ColumnType>);  // indicate start of first row(group)
         for (auto groupIndex : indexRange<Backward>(0, this->rowGroupIndices->size() - 1)) {
             STORM_LOG_ASSERT(this->rowGroupIndices->at(groupIndex) != this->rowGroupIndices->at(groupIndex + 1),
                              "There is an empty row group. This is not expected.");
             for (auto rowIndex : indexRange<false>((*this->rowGroupIndices)[groupIndex], (*this->rowGroupIndices)[groupIndex + 1])) {
                 for (auto const& entry : matrix.getRow(rowIndex)) {
                     matrixValues.push_back(entry.getValue());
-                    matrixColumns.push_back(entry.getColumn());
+                    columns.push_back(static_cast<ColumnType>(entry.getColumn()));
                 }
-                matrixColumns.push_back(StartOfRowIndicator);  // Indicate start of next row
+                columns.push_back(StartOfRowIndicator<ColumnType>);  // Indicate start of next row
             }
-            matrixColumns.back() = StartOfRowGroupIndicator;  // This is the start of the next row group
+            columns.back() = StartOfRowGroupIndicator<ColumnType>;  // This is the start of the next row group
         }
     } else {
-        matrixColumns.push_back(StartOfRowIndicator);  // Indicate start of first row
+        columns.push_back(StartOfRowIndicator<ColumnType>);  // Indicate start of first row
         for (auto rowIndex : indexRange<Backward>(0, numRows)) {
             for (auto const& entry : matrix.getRow(rowIndex)) {
                 matrixValues.push_back(entry.getValue());
-                matrixColumns.push_back(entry.getColumn());
+                columns.push_back(static_cast<ColumnType>(entry.getColumn()));
             }
-            matrixColumns.push_back(StartOfRowIndicator);  // Indicate start of next row
+            columns.push_back(StartOfRowIndicator<ColumnType>);  // Indicate start of next row
         }
     }
 }
@@ -68,42 +96,131 @@ void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::setMat
 }
 
 template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
+void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::setNumberOfThreads(uint64_t numberOfThreads) {
+    STORM_LOG_ASSERT(numberOfThreads > 0, "Invalid number of threads.");
+    if constexpr (!std::is_same_v<ValueType, double>) {
+        // Parallel application is only supported for double values (see SupportsParallelApply).
+        STORM_LOG_INFO_COND(numberOfThreads == 1, "Value iteration with non-double values is performed sequentially.");
+        numberOfThreads = 1;
+    }
+    if (this->numberOfThreads != numberOfThreads) {
+        this->numberOfThreads = numberOfThreads;
+        if (numberOfThreads > 1) {
+            threadPool = std::make_unique<storm::utility::TaskPool>(numberOfThreads);
+        } else {
+            threadPool.reset();
+        }
+        computeChunks();
+    }
+}
+
+template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
+void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::setUseSlicedMatrix(bool value) {
+    useSlicedMatrix = value;
+}
+
+template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
+void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::computeChunks() {
+    if (useCompactColumns) {
+        computeChunks<uint32_t>();
+    } else {
+        computeChunks<IndexType>();
+    }
+}
+
+template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
+template<typename ColumnType>
+void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::computeChunks() {
+    chunks.clear();
+    previousOperand.first.clear();
+    previousOperand.second.clear();
+    auto const& columns = getMatrixColumns<ColumnType>();
+    if (numberOfThreads <= 1 || columns.empty()) {
+        return;
+    }
+
+    // The chunks should be small enough to balance the load among the threads but large enough so that parallelization pays off.
+    uint64_t const minimalChunkSize = 1ull << 16;
+    uint64_t const chunksPerThread = 4;
+    uint64_t const chunkSize = std::max<uint64_t>(minimalChunkSize, columns.size() / (numberOfThreads * chunksPerThread));
+    ColumnType const startOfGroupIndicator = TrivialRowGrouping ? StartOfRowIndicator<ColumnType> : StartOfRowGroupIndicator<ColumnType>;
+
+    Chunk currentChunk{0, 0, 0, 0};
+    IndexType numberOfGroups = 0;
+    IndexType numberOfValues = 0;
+    // The last entry of the columns is the indicator after the last row group
+    for (IndexType position = 0; position + 1 < columns.size(); ++position) {
+        if (columns[position] >= startOfGroupIndicator) {
+            // For deterministic models, the chunks have to be aligned with the slices of the sliced matrix.
+            bool const isStartOfSlice = !TrivialRowGrouping || numberOfGroups % SlicedEllpackMatrix::SliceSize == 0;
+            if (isStartOfSlice && position - currentChunk.columnOffset >= chunkSize) {
+                currentChunk.numberOfGroups = numberOfGroups - currentChunk.firstGroup;
+                chunks.push_back(currentChunk);
+                currentChunk = Chunk{numberOfGroups, 0, position, numberOfValues};
+            }
+            ++numberOfGroups;
+        } else if (columns[position] < StartOfRowIndicator<ColumnType>) {
+            ++numberOfValues;
+        }
+    }
+    currentChunk.numberOfGroups = numberOfGroups - currentChunk.firstGroup;
+    chunks.push_back(currentChunk);
+    STORM_LOG_ASSERT(numberOfValues == matrixValues.size(), "Unexpected number of matrix values.");
+
+    if (chunks.size() < 2) {
+        // Parallelization does not pay off.
+        chunks.clear();
+    }
+}
+
+template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
+void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::unsetIgnoredRows() {
+    if (useCompactColumns) {
+        unsetIgnoredRows<uint32_t>();
+    } else {
+        unsetIgnoredRows<IndexType>();
+    }
+}
+
+template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
+template<typename ColumnType>
 void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::unsetIgnoredRows() {
-    for (auto& c : matrixColumns) {
-        if (c >= StartOfRowIndicator) {
-            c &= StartOfRowGroupIndicator;
+    for (auto& c : getMatrixColumns<ColumnType>()) {
+        if (c >= StartOfRowIndicator<ColumnType>) {
+            c &= StartOfRowGroupIndicator<ColumnType>;
         }
     }
     hasSkippedRows = false;
 }
 
 template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
-template<bool Backward>
+template<bool Backward, typename ColumnType>
 void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::setIgnoredRows(bool useLocalRowIndices,
                                                                                          std::function<bool(IndexType, IndexType)> const& ignore) {
     STORM_LOG_ASSERT(!TrivialRowGrouping, "Tried to ignroe rows but the row grouping is trivial.");
-    auto colIt = matrixColumns.begin();
+    auto& columns = getMatrixColumns<ColumnType>();
+    auto colIt = columns.begin();
     for (auto groupIndex : indexRange<Backward>(0, this->rowGroupIndices->size() - 1)) {
-        STORM_LOG_ASSERT(colIt != matrixColumns.end(), "VI Operator in invalid state.");
-        STORM_LOG_ASSERT(*colIt >= StartOfRowGroupIndicator, "VI Operator in invalid state.");
+        STORM_LOG_ASSERT(colIt != columns.end(), "VI Operator in invalid state.");
+        STORM_LOG_ASSERT(*colIt >= StartOfRowGroupIndicator<ColumnType>, "VI Operator in invalid state.");
         auto const rowIndexRange = useLocalRowIndices ? indexRange<false>(0ull, (*this->rowGroupIndices)[groupIndex + 1] - (*this->rowGroupIndices)[groupIndex])
                                                       : indexRange<false>((*this->rowGroupIndices)[groupIndex], (*this->rowGroupIndices)[groupIndex + 1]);
         for (auto const rowIndex : rowIndexRange) {
             if (!ignore(groupIndex, rowIndex)) {
-                *colIt &= StartOfRowGroupIndicator;  // Clear number of skipped entries
-                moveToEndOfRow(colIt);
-            } else if ((*colIt & SkipNumEntriesMask) == 0) {  // i.e. should ignore but is not already ignored
+                *colIt &= StartOfRowGroupIndicator<ColumnType>;  // Clear number of skipped entries
+                moveToEndOfRow<ColumnType>(colIt);
+            } else if ((*colIt & SkipNumEntriesMask<ColumnType>) == 0) {  // i.e. should ignore but is not already ignored
                 auto currColIt = colIt;
-                moveToEndOfRow(colIt);
+                moveToEndOfRow<ColumnType>(colIt);
                 *currColIt += std::distance(currColIt, colIt);  // set number of skipped entries
             }
             STORM_LOG_ASSERT(
                 !std::all_of(rowIndexRange.begin(), rowIndexRange.end(), [&ignore, &groupIndex](IndexType rowIndex) { return ignore(groupIndex, rowIndex); }),
                 "All rows in row group " << groupIndex << " are ignored.");
-            STORM_LOG_ASSERT(colIt != matrixColumns.end(), "VI Operator in invalid state.");
-            STORM_LOG_ASSERT(*colIt >= StartOfRowIndicator, "VI Operator in invalid state.");
+            STORM_LOG_ASSERT(colIt != columns.end(), "VI Operator in invalid state.");
+            STORM_LOG_ASSERT(*colIt >= StartOfRowIndicator<ColumnType>, "VI Operator in invalid state.");
         }
-        STORM_LOG_ASSERT(*colIt == StartOfRowGroupIndicator, "VI Operator in invalid state.");
+        STORM_LOG_ASSERT(*colIt == StartOfRowGroupIndicator<ColumnType>, "VI Operator in invalid state.");
     }
     hasSkippedRows = true;
 }
@@ -111,10 +228,18 @@ void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::setIgn
 template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
 void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::setIgnoredRows(bool useLocalRowIndices,
                                                                                          std::function<bool(IndexType, IndexType)> const& ignore) {
-    if (backwards) {
-        setIgnoredRows<true>(useLocalRowIndices, ignore);
+    if (useCompactColumns) {
+        if (backwards) {
+            setIgnoredRows<true, uint32_t>(useLocalRowIndices, ignore);
+        } else {
+            setIgnoredRows<false, uint32_t>(useLocalRowIndices, ignore);
+        }
     } else {
-        setIgnoredRows<false>(useLocalRowIndices, ignore);
+        if (backwards) {
+            setIgnoredRows<true, IndexType>(useLocalRowIndices, ignore);
+        } else {
+            setIgnoredRows<false, IndexType>(useLocalRowIndices, ignore);
+        }
     }
 }
 
@@ -144,34 +269,11 @@ void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::freeAu
 }
 
 template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
-void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::moveToEndOfRow(std::vector<IndexType>::iterator& matrixColumnIt) const {
+template<typename ColumnType>
+void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::moveToEndOfRow(typename std::vector<ColumnType>::iterator& matrixColumnIt) const {
     do {
         ++matrixColumnIt;
-    } while (*matrixColumnIt < StartOfRowIndicator);
-}
-
-template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
-bool ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::skipIgnoredRow(std::vector<IndexType>::const_iterator& matrixColumnIt,
-                                                                                         typename std::vector<ValueType>::const_iterator& matrixValueIt) const {
-    if (IndexType entriesToSkip = (*matrixColumnIt & SkipNumEntriesMask)) {
-        matrixColumnIt += entriesToSkip;
-        matrixValueIt += entriesToSkip - 1;
-        return true;
-    }
-    return false;
-}
-
-template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
-uint64_t ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::skipMultipleIgnoredRows(
-    std::vector<IndexType>::const_iterator& matrixColumnIt, typename std::vector<ValueType>::const_iterator& matrixValueIt) const {
-    IndexType result{0ull};
-    while (skipIgnoredRow(matrixColumnIt, matrixValueIt)) {
-        ++result;
-        STORM_LOG_ASSERT(*matrixColumnIt >= StartOfRowIndicator, "Undexpected state of VI operator");
-        // We (currently) don't use this past the end of a row group, so we may have this additional sanity check:
-        STORM_LOG_ASSERT(*matrixColumnIt < StartOfRowGroupIndicator, "Undexpected state of VI operator");
-    }
-    return result;
+    } while (*matrixColumnIt < StartOfRowIndicator<ColumnType>);
 }
 
 template class ValueIterationOperator<double, true>;
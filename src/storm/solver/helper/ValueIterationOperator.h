@@ -1,14 +1,23 @@
 #pragma once
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
 #include <functional>
+#include <limits>
+#include <memory>
 #include <optional>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 #include <boost/range/adaptor/reversed.hpp>
 #include <boost/range/irange.hpp>
 
+#include "storm/solver/helper/SlicedEllpackMatrix.h"
 #include "storm/solver/helper/ValueIterationOperatorForward.h"
 #include "storm/storage/sparse/StateType.h"
+#include "storm/utility/TaskPool.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/vector.h"  // TODO
 
@@ -76,6 +85,16 @@ class ValueIterationOperator {
      * * backend.endOfIteration(); invoked when all groups are processed
      * * backend.converged(); invoked when abort() returns true or all groups are processed. Determines the return value of this method
      *
+     * If more than one thread is set (see `setNumberOfThreads`), the row groups are split into chunks that are processed concurrently, provided that the
+     * values are doubles and the backend is copyable and implements
+     * * backend.merge(otherBackend); which combines the results (e.g. the convergence status) of the given backend into this one.
+     * In this case, every thread processes its chunks with its own copy of the backend (taken after startNewIteration() was invoked) and the copies are
+     * merged into the given backend before endOfIteration() is invoked. Backends without a merge method are always applied sequentially.
+     * If operandIn and operandOut are the same object, the chunks are updated in a block Gauss-Seidel fashion, i.e., entries that belong to the chunk that
+     * is currently processed are read from the updated operand whereas all other entries are read from the operand of the previous iteration.
+     * If enabled (see `setUseSlicedMatrix`), applications for deterministic models with double values where operandIn and operandOut are different
+     * objects compute the row results with SIMD instructions (if available) on a sliced representation of the matrix.
+     *
      * @tparam OperandType The type of input and output operand. Can be a value vector or a pair of two value vectors with one entry per group.
      *                      In the latter case, the rowResult for backend.firstRow and backend.nextRow is a pair of values and
      *                      applyUpdate gets two operandOutReference's to write the group result to.
@@ -98,18 +117,10 @@ class ValueIterationOperator {
 
     template<OptimizationDirection RobustDir, typename OperandType, typename OffsetType, typename BackendType>
     bool applyRobust(OperandType const& operandIn, OperandType& operandOut, OffsetType const& offsets, BackendType& backend) const {
-        if (hasSkippedRows) {
-            if (backwards) {
-                return apply<OperandType, OffsetType, BackendType, true, true, RobustDir>(operandOut, operandIn, offsets, backend);
-            } else {
-                return apply<OperandType, OffsetType, BackendType, false, true, RobustDir>(operandOut, operandIn, offsets, backend);
-            }
+        if (useCompactColumns) {
+            return applyWithColumnType<uint32_t, RobustDir>(operandOut, operandIn, offsets, backend);
         } else {
-            if (backwards) {
-                return apply<OperandType, OffsetType, BackendType, true, false, RobustDir>(operandOut, operandIn, offsets, backend);
-            } else {
-                return apply<OperandType, OffsetType, BackendType, false, false, RobustDir>(operandOut, operandIn, offsets, backend);
-            }
+            return applyWithColumnType<IndexType, RobustDir>(operandOut, operandIn, offsets, backend);
         }
     }
 
@@ -126,6 +137,21 @@ class ValueIterationOperator {
         return applyRobust<RobustDir>(operand, operand, offsets, backend);
     }
 
+    /*!
+     * Sets the number of threads that are used when applying the operator with a backend that supports parallel application (see `apply`).
+     * Small matrices as well as operators with non-double values are always processed sequentially.
+     * The threads are kept alive in a pool owned by this operator and reused for all applications.
+     * @param numberOfThreads the number of threads (including the calling thread)
+     */
+    void setNumberOfThreads(uint64_t numberOfThreads);
+
+    /*!
+     * Sets whether deterministic models with double values are additionally stored in the sliced ELLPACK format (see `apply`).
+     * This pays off if the operator is applied many times but requires a copy of the matrix. Disabled by default.
+     * @note Only takes effect for matrices that are set after calling this method.
+     */
+    void setUseSlicedMatrix(bool value);
+
     /*!
      * Sets rows that will be skipped when applying the operator.
      * @note each row group shall have at least one row that is not ignored
@@ -159,34 +185,196 @@ class ValueIterationOperator {
     void freeAuxiliaryVector();
 
    private:
+    /*!
+     * Internal variant of `applyRobust` for the given type of entries of the column vector
+     */
+    template<typename ColumnType, OptimizationDirection RobustDir, typename OperandType, typename OffsetType, typename BackendType>
+    bool applyWithColumnType(OperandType& operandOut, OperandType const& operandIn, OffsetType const& offsets, BackendType& backend) const {
+        if (hasSkippedRows) {
+            if (backwards) {
+                return apply<ColumnType, OperandType, OffsetType, BackendType, true, true, RobustDir>(operandOut, operandIn, offsets, backend);
+            } else {
+                return apply<ColumnType, OperandType, OffsetType, BackendType, false, true, RobustDir>(operandOut, operandIn, offsets, backend);
+            }
+        } else {
+            if (backwards) {
+                return apply<ColumnType, OperandType, OffsetType, BackendType, true, false, RobustDir>(operandOut, operandIn, offsets, backend);
+            } else {
+                return apply<ColumnType, OperandType, OffsetType, BackendType, false, false, RobustDir>(operandOut, operandIn, offsets, backend);
+            }
+        }
+    }
+
     /*!
      * Internal variant of `apply`
      * @note This and other apply methods are intentionally implemented in the header file as there are potentially many different BackendTypes
      */
-    template<typename OperandType, typename OffsetType, typename BackendType, bool Backward, bool SkipIgnoredRows, OptimizationDirection RobustDirection>
+    template<typename ColumnType, typename OperandType, typename OffsetType, typename BackendType, bool Backward, bool SkipIgnoredRows,
+             OptimizationDirection RobustDirection>
     bool apply(OperandType& operandOut, OperandType const& operandIn, OffsetType const& offsets, BackendType& backend) const {
         STORM_LOG_ASSERT(getSize(operandIn) == getSize(operandOut), "Input and Output Operands have different sizes.");
         auto const operandSize = getSize(operandIn);
         STORM_LOG_ASSERT(TrivialRowGrouping || rowGroupIndices->size() == operandSize + 1, "Dimension mismatch");
         backend.startNewIteration();
+        if constexpr (SupportsSlicedApply<OperandType, OffsetType>) {
+            if (slicedMatrix && &operandIn != &operandOut) {
+                return applySliced<Backward>(operandOut, operandIn, offsets, backend);
+            }
+        }
+        if constexpr (SupportsParallelApply<BackendType>) {
+            if (!chunks.empty()) {
+                return applyParallel<ColumnType, OperandType, OffsetType, BackendType, Backward, SkipIgnoredRows, RobustDirection>(operandOut, operandIn,
+                                                                                                                                   offsets, backend);
+            }
+        }
+        auto const& columns = getMatrixColumns<ColumnType>();
         auto matrixValueIt = matrixValues.cbegin();
-        auto matrixColumnIt = matrixColumns.cbegin();
-        for (auto groupIndex : indexRange<Backward>(0, operandSize)) {
-            STORM_LOG_ASSERT(matrixColumnIt != matrixColumns.end(), "VI Operator in invalid state.");
-            STORM_LOG_ASSERT(*matrixColumnIt >= StartOfRowIndicator, "VI Operator in invalid state.");
-            //            STORM_LOG_ASSERT(matrixValueIt != matrixValues.end(), "VI Operator in invalid state.");
+        auto matrixColumnIt = columns.cbegin();
+        if (!applyGroups<ColumnType, Backward, SkipIgnoredRows, RobustDirection>(0, operandSize, matrixColumnIt, matrixValueIt, operandOut, operandIn, offsets,
+                                                                                 backend)) {
+            return backend.converged();
+        }
+        STORM_LOG_ASSERT(matrixColumnIt + 1 == columns.cend(), "Unexpected position of matrix column iterator.");
+        STORM_LOG_ASSERT(matrixValueIt == matrixValues.cend(), "Unexpected position of matrix column iterator.");
+        backend.endOfIteration();
+        return backend.converged();
+    }
+
+    /*!
+     * Variant of `apply` that processes the chunks concurrently. Each thread uses its own copy of the backend.
+     */
+    template<typename ColumnType, typename OperandType, typename OffsetType, typename BackendType, bool Backward, bool SkipIgnoredRows,
+             OptimizationDirection RobustDirection>
+    bool applyParallel(OperandType& operandOut, OperandType const& operandIn, OffsetType const& offsets, BackendType& backend) const {
+        auto const operandSize = getSize(operandIn);
+        auto const& columns = getMatrixColumns<ColumnType>();
+        bool const inPlace = &operandIn == &operandOut;
+        // For in-place updates, entries of other chunks are read from the values of the previous iteration.
+        OperandType const& previous = inPlace ? storePreviousOperand(operandIn) : operandIn;
+
+        return applyChunksInParallel(backend, [&](Chunk const& chunk, BackendType& threadBackend) {
+            IndexType const groupBegin = Backward ? operandSize - chunk.firstGroup - chunk.numberOfGroups : chunk.firstGroup;
+            IndexType const groupEnd = groupBegin + chunk.numberOfGroups;
+            auto matrixColumnIt = columns.cbegin() + chunk.columnOffset;
+            auto matrixValueIt = matrixValues.cbegin() + chunk.valueOffset;
+            if (inPlace) {
+                return applyGroups<ColumnType, Backward, SkipIgnoredRows, RobustDirection>(groupBegin, groupEnd, matrixColumnIt, matrixValueIt, operandOut,
+                                                                                         makeBlockOperand(operandOut, previous, groupBegin, groupEnd),
+                                                                                         offsets, threadBackend);
+            } else {
+                return applyGroups<ColumnType, Backward, SkipIgnoredRows, RobustDirection>(groupBegin, groupEnd, matrixColumnIt, matrixValueIt, operandOut,
+                                                                                         operandIn, offsets, threadBackend);
+            }
+        });
+    }
+
+    /*!
+     * Processes the chunks concurrently by invoking processChunk(chunk, threadBackend) for each chunk, where each thread uses its own copy of the backend.
+     * processChunk shall return false if the backend requested to abort. Afterwards, the thread backends are merged into the given backend.
+     */
+    template<typename BackendType, typename ProcessChunkType>
+    bool applyChunksInParallel(BackendType& backend, ProcessChunkType const& processChunk) const {
+        STORM_LOG_ASSERT(threadPool, "No thread pool for parallel application.");
+        std::atomic<bool> aborted{false};
+        std::vector<BackendType> threadBackends(threadPool->getNumberOfThreads(), backend);
+        for (auto const& chunk : chunks) {
+            threadPool->submit([&, chunkPtr = &chunk]() {
+                if (!aborted.load(std::memory_order_relaxed) && !processChunk(*chunkPtr, threadBackends[threadPool->getCurrentThreadIndex()])) {
+                    aborted = true;
+                }
+            });
+        }
+        // Exceptions thrown while processing a chunk are rethrown here
+        threadPool->wait();
+
+        for (auto const& threadBackend : threadBackends) {
+            backend.merge(threadBackend);
+        }
+        if (aborted) {
+            return backend.converged();
+        }
+        backend.endOfIteration();
+        return backend.converged();
+    }
+
+    /*!
+     * Variant of `apply` for deterministic models with double values that uses the sliced representation of the matrix. Only used if operandIn and operandOut
+     * are different objects so that the rows within one slice can be processed simultaneously.
+     */
+    template<bool Backward, typename BackendType>
+    bool applySliced(std::vector<double>& operandOut, std::vector<double> const& operandIn, std::vector<double> const& offsets, BackendType& backend) const {
+        if constexpr (SupportsParallelApply<BackendType>) {
+            if (!chunks.empty()) {
+                return applyChunksInParallel(backend, [&](Chunk const& chunk, BackendType& threadBackend) {
+                    return applySlicedRows<Backward>(chunk.firstGroup, chunk.firstGroup + chunk.numberOfGroups, operandOut, operandIn, offsets, threadBackend);
+                });
+            }
+        }
+        if (!applySlicedRows<Backward>(0, operandIn.size(), operandOut, operandIn, offsets, backend)) {
+            return backend.converged();
+        }
+        backend.endOfIteration();
+        return backend.converged();
+    }
+
+    /*!
+     * Applies the operator to the rows at the positions in [positionBegin, positionEnd) of the sliced representation of the matrix.
+     * The row results are computed in batches of slices before the backend is invoked for each row.
+     * @return false if the backend requested to abort
+     */
+    template<bool Backward, typename BackendType>
+    bool applySlicedRows(IndexType positionBegin, IndexType positionEnd, std::vector<double>& operandOut, std::vector<double> const& operandIn,
+                         std::vector<double> const& offsets, BackendType& backend) const {
+        constexpr uint64_t SliceSize = SlicedEllpackMatrix::SliceSize;
+        constexpr uint64_t RowsPerBatch = 64 * SliceSize;
+        STORM_LOG_ASSERT(positionBegin % SliceSize == 0, "Range of rows does not start at a slice.");
+        IndexType const numberOfRows = operandIn.size();
+        std::array<double, RowsPerBatch> rowResults;
+        for (IndexType batchBegin = positionBegin; batchBegin < positionEnd; batchBegin += RowsPerBatch) {
+            IndexType const batchEnd = std::min<IndexType>(batchBegin + RowsPerBatch, positionEnd);
+            IndexType const sliceBegin = batchBegin / SliceSize;
+            IndexType const sliceEnd = (batchEnd + SliceSize - 1) / SliceSize;
+            for (IndexType position = batchBegin; position < batchEnd; ++position) {
+                rowResults[position - batchBegin] = offsets[Backward ? numberOfRows - 1 - position : position];
+            }
+            std::fill(rowResults.begin() + (batchEnd - batchBegin), rowResults.begin() + (sliceEnd - sliceBegin) * SliceSize, 0.0);
+            slicedMatrix->multiplyAdd(sliceBegin, sliceEnd, operandIn.data(), rowResults.data());
+            for (IndexType position = batchBegin; position < batchEnd; ++position) {
+                IndexType const groupIndex = Backward ? numberOfRows - 1 - position : position;
+                backend.firstRow(std::move(rowResults[position - batchBegin]), groupIndex, groupIndex);
+                backend.applyUpdate(operandOut[groupIndex], groupIndex);
+                if (backend.abort()) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    /*!
+     * Applies the operator to the row groups with indices in [groupBegin, groupEnd), starting at the given positions of the matrix.
+     * @return false if the backend requested to abort
+     */
+    template<typename ColumnType, bool Backward, bool SkipIgnoredRows, OptimizationDirection RobustDirection, typename OperandType, typename InputOperandType,
+             typename OffsetType, typename BackendType>
+    bool applyGroups(IndexType groupBegin, IndexType groupEnd, typename std::vector<ColumnType>::const_iterator& matrixColumnIt,
+                     typename std::vector<ValueType>::const_iterator& matrixValueIt, OperandType& operandOut, InputOperandType const& operandIn,
+                     OffsetType const& offsets, BackendType& backend) const {
+        for (auto groupIndex : indexRange<Backward>(groupBegin, groupEnd)) {
+            STORM_LOG_ASSERT(*matrixColumnIt >= StartOfRowIndicator<ColumnType>, "VI Operator in invalid state.");
             if constexpr (TrivialRowGrouping) {
-                backend.firstRow(applyRow<RobustDirection>(matrixColumnIt, matrixValueIt, operandIn, offsets, groupIndex), groupIndex, groupIndex);
+                backend.firstRow(applyRow<RobustDirection, ColumnType>(matrixColumnIt, matrixValueIt, operandIn, offsets, groupIndex), groupIndex, groupIndex);
             } else {
                 IndexType rowIndex = (*rowGroupIndices)[groupIndex];
                 if constexpr (SkipIgnoredRows) {
-                    rowIndex += skipMultipleIgnoredRows(matrixColumnIt, matrixValueIt);
+                    rowIndex += skipMultipleIgnoredRows<ColumnType>(matrixColumnIt, matrixValueIt);
                 }
-                backend.firstRow(applyRow<RobustDirection>(matrixColumnIt, matrixValueIt, operandIn, offsets, rowIndex), groupIndex, rowIndex);
-                while (*matrixColumnIt < StartOfRowGroupIndicator) {
+                backend.firstRow(applyRow<RobustDirection, ColumnType>(matrixColumnIt, matrixValueIt, operandIn, offsets, rowIndex), groupIndex, rowIndex);
+                while (*matrixColumnIt < StartOfRowGroupIndicator<ColumnType>) {
                     ++rowIndex;
-                    if (!SkipIgnoredRows || !skipIgnoredRow(matrixColumnIt, matrixValueIt)) {
-                        backend.nextRow(applyRow<RobustDirection>(matrixColumnIt, matrixValueIt, operandIn, offsets, rowIndex), groupIndex, rowIndex);
+                    if (!SkipIgnoredRows || !skipIgnoredRow<ColumnType>(matrixColumnIt, matrixValueIt)) {
+                        backend.nextRow(applyRow<RobustDirection, ColumnType>(matrixColumnIt, matrixValueIt, operandIn, offsets, rowIndex), groupIndex,
+                                        rowIndex);
                     }
                 }
             }
@@ -196,50 +384,96 @@ class ValueIterationOperator {
                 backend.applyUpdate(operandOut[groupIndex], groupIndex);
             }
             if (backend.abort()) {
-                return backend.converged();
+                return false;
             }
         }
-        STORM_LOG_ASSERT(matrixColumnIt + 1 == matrixColumns.cend(), "Unexpected position of matrix column iterator.");
-        STORM_LOG_ASSERT(matrixValueIt == matrixValues.cend(), "Unexpected position of matrix column iterator.");
-        backend.endOfIteration();
-        return backend.converged();
+        return true;
+    }
+
+    /*!
+     * Read access to an operand vector for block Gauss-Seidel updates: Entries of the current block are read from the vector that is being updated whereas
+     * all other entries are read from the values of the previous iteration.
+     */
+    template<typename T>
+    struct BlockOperand {
+        using value_type = T;
+
+        T const& operator[](IndexType index) const {
+            return (index >= blockBegin && index < blockEnd) ? current[index] : previous[index];
+        }
+
+        std::vector<T> const& current;
+        std::vector<T> const& previous;
+        IndexType const blockBegin;
+        IndexType const blockEnd;
+    };
+
+    template<typename T>
+    BlockOperand<T> makeBlockOperand(std::vector<T> const& current, std::vector<T> const& previous, IndexType blockBegin, IndexType blockEnd) const {
+        return {current, previous, blockBegin, blockEnd};
+    }
+
+    template<typename T1, typename T2>
+    std::pair<BlockOperand<T1>, BlockOperand<T2>> makeBlockOperand(std::pair<std::vector<T1>, std::vector<T2>> const& current,
+                                                                   std::pair<std::vector<T1>, std::vector<T2>> const& previous, IndexType blockBegin,
+                                                                   IndexType blockEnd) const {
+        return {makeBlockOperand(current.first, previous.first, blockBegin, blockEnd), makeBlockOperand(current.second, previous.second, blockBegin, blockEnd)};
+    }
+
+    /*!
+     * Copies the given operand to the storage for the operand of the previous iteration
+     */
+    std::vector<SolutionType> const& storePreviousOperand(std::vector<SolutionType> const& operand) const {
+        previousOperand.first.assign(operand.begin(), operand.end());
+        return previousOperand.first;
+    }
+
+    std::pair<std::vector<SolutionType>, std::vector<SolutionType>> const& storePreviousOperand(
+        std::pair<std::vector<SolutionType>, std::vector<SolutionType>> const& operand) const {
+        previousOperand.first.assign(operand.first.begin(), operand.first.end());
+        previousOperand.second.assign(operand.second.begin(), operand.second.end());
+        return previousOperand;
     }
 
     // Auxiliary methods to deal with various OperandTypes and OffsetTypes
 
-    template<typename OpT, typename OffT>
-    OpT initializeRowRes(std::vector<OpT> const&, std::vector<OffT> const& offsets, uint64_t offsetIndex) const {
+    // Operand vectors are either std::vectors or BlockOperands
+    template<typename OpVecT, typename OffT>
+    typename OpVecT::value_type initializeRowRes(OpVecT const&, std::vector<OffT> const& offsets, uint64_t offsetIndex) const {
         return offsets[offsetIndex];
     }
 
-    template<typename OpT1, typename OpT2, typename OffT>
-    std::pair<OpT1, OpT2> initializeRowRes(std::pair<std::vector<OpT1>, std::vector<OpT2>> const&, std::vector<OffT> const& offsets,
-                                           uint64_t offsetIndex) const {
+    template<typename OpVecT1, typename OpVecT2, typename OffT>
+    std::pair<typename OpVecT1::value_type, typename OpVecT2::value_type> initializeRowRes(std::pair<OpVecT1, OpVecT2> const&,
+                                                                                           std::vector<OffT> const& offsets, uint64_t offsetIndex) const {
         return {offsets[offsetIndex], offsets[offsetIndex]};
     }
 
-    template<typename OpT1, typename OpT2, typename OffT1, typename OffT2>
-    std::pair<OpT1, OpT2> initializeRowRes(std::pair<std::vector<OpT1>, std::vector<OpT2>> const&, std::pair<std::vector<OffT1> const*, OffT2> const& offsets,
-                                           uint64_t offsetIndex) const {
+    template<typename OpVecT1, typename OpVecT2, typename OffT1, typename OffT2>
+    std::pair<typename OpVecT1::value_type, typename OpVecT2::value_type> initializeRowRes(std::pair<OpVecT1, OpVecT2> const&,
+                                                                                           std::pair<std::vector<OffT1> const*, OffT2> const& offsets,
+                                                                                           uint64_t offsetIndex) const {
         return {(*offsets.first)[offsetIndex], offsets.second};
     }
 
-    template<OptimizationDirection RobustDirection, typename OpT, typename OffT>
-    OpT robustInitializeRowRes(std::vector<OpT> const&, std::vector<OffT> const& offsets, uint64_t offsetIndex) const {
+    template<OptimizationDirection RobustDirection, typename OpVecT, typename OffT>
+    typename OpVecT::value_type robustInitializeRowRes(OpVecT const&, std::vector<OffT> const& offsets, uint64_t offsetIndex) const {
         return offsets[offsetIndex].upper();
     }
 
-    template<OptimizationDirection RobustDirection, typename OpT1, typename OpT2, typename OffT>
-    std::pair<OpT1, OpT2> robustInitializeRowRes(std::pair<std::vector<OpT1>, std::vector<OpT2>> const&, std::vector<OffT> const& offsets,
-                                                 uint64_t offsetIndex) const {
+    template<OptimizationDirection RobustDirection, typename OpVecT1, typename OpVecT2, typename OffT>
+    std::pair<typename OpVecT1::value_type, typename OpVecT2::value_type> robustInitializeRowRes(std::pair<OpVecT1, OpVecT2> const&,
+                                                                                                 std::vector<OffT> const& offsets,
+                                                                                                 uint64_t offsetIndex) const {
         STORM_LOG_THROW(false, storm::exceptions::NotImplementedException, "Value Iteration is not implemented with pairs and interval-models.");
 
         return {offsets[offsetIndex].upper(), offsets[offsetIndex].upper()};
     }
 
-    template<OptimizationDirection RobustDirection, typename OpT1, typename OpT2, typename OffT1, typename OffT2>
-    std::pair<OpT1, OpT2> robustInitializeRowRes(std::pair<std::vector<OpT1>, std::vector<OpT2>> const&,
-                                                 std::pair<std::vector<OffT1> const*, OffT2> const& offsets, uint64_t offsetIndex) const {
+    template<OptimizationDirection RobustDirection, typename OpVecT1, typename OpVecT2, typename OffT1, typename OffT2>
+    std::pair<typename OpVecT1::value_type, typename OpVecT2::value_type> robustInitializeRowRes(std::pair<OpVecT1, OpVecT2> const&,
+                                                                                                 std::pair<std::vector<OffT1> const*, OffT2> const& offsets,
+                                                                                                 uint64_t offsetIndex) const {
         STORM_LOG_THROW(false, storm::exceptions::NotImplementedException, "Value Iteration is not implemented with pairs and interval-models.");
 
         return {(*offsets.first)[offsetIndex], offsets.second};
@@ -248,22 +482,22 @@ class ValueIterationOperator {
     /*!
      * Computes the result for a single row and advances the given iterators to the end of the row
      */
-    template<OptimizationDirection RobustDirection, typename OperandType, typename OffsetType>
-    auto applyRow(std::vector<IndexType>::const_iterator& matrixColumnIt, typename std::vector<ValueType>::const_iterator& matrixValueIt,
+    template<OptimizationDirection RobustDirection, typename ColumnType, typename OperandType, typename OffsetType>
+    auto applyRow(typename std::vector<ColumnType>::const_iterator& matrixColumnIt, typename std::vector<ValueType>::const_iterator& matrixValueIt,
                   OperandType const& operand, OffsetType const& offsets, uint64_t offsetIndex) const {
         if constexpr (std::is_same_v<ValueType, storm::Interval>) {
-            return applyRowRobust<RobustDirection>(matrixColumnIt, matrixValueIt, operand, offsets, offsetIndex);
+            return applyRowRobust<RobustDirection, ColumnType>(matrixColumnIt, matrixValueIt, operand, offsets, offsetIndex);
         } else {
-            return applyRowStandard(matrixColumnIt, matrixValueIt, operand, offsets, offsetIndex);
+            return applyRowStandard<ColumnType>(matrixColumnIt, matrixValueIt, operand, offsets, offsetIndex);
         }
     }
 
-    template<typename OperandType, typename OffsetType>
-    auto applyRowStandard(std::vector<IndexType>::const_iterator& matrixColumnIt, typename std::vector<ValueType>::const_iterator& matrixValueIt,
+    template<typename ColumnType, typename OperandType, typename OffsetType>
+    auto applyRowStandard(typename std::vector<ColumnType>::const_iterator& matrixColumnIt, typename std::vector<ValueType>::const_iterator& matrixValueIt,
                           OperandType const& operand, OffsetType const& offsets, uint64_t offsetIndex) const {
-        STORM_LOG_ASSERT(*matrixColumnIt >= StartOfRowIndicator, "VI Operator in invalid state.");
+        STORM_LOG_ASSERT(*matrixColumnIt >= StartOfRowIndicator<ColumnType>, "VI Operator in invalid state.");
         auto result{initializeRowRes(operand, offsets, offsetIndex)};
-        for (++matrixColumnIt; *matrixColumnIt < StartOfRowIndicator; ++matrixColumnIt, ++matrixValueIt) {
+        for (++matrixColumnIt; *matrixColumnIt < StartOfRowIndicator<ColumnType>; ++matrixColumnIt, ++matrixValueIt) {
             if constexpr (isPair<OperandType>::value) {
                 result.first += operand.first[*matrixColumnIt] * (*matrixValueIt);
                 result.second += operand.second[*matrixColumnIt] * (*matrixValueIt);
@@ -286,16 +520,16 @@ class ValueIterationOperator {
         }
     };
 
-    template<OptimizationDirection RobustDirection, typename OperandType, typename OffsetType>
-    auto applyRowRobust(std::vector<IndexType>::const_iterator& matrixColumnIt, typename std::vector<ValueType>::const_iterator& matrixValueIt,
+    template<OptimizationDirection RobustDirection, typename ColumnType, typename OperandType, typename OffsetType>
+    auto applyRowRobust(typename std::vector<ColumnType>::const_iterator& matrixColumnIt, typename std::vector<ValueType>::const_iterator& matrixValueIt,
                         OperandType const& operand, OffsetType const& offsets, uint64_t offsetIndex) const {
-        STORM_LOG_ASSERT(*matrixColumnIt >= StartOfRowIndicator, "VI Operator in invalid state.");
+        STORM_LOG_ASSERT(*matrixColumnIt >= StartOfRowIndicator<ColumnType>, "VI Operator in invalid state.");
         auto result{robustInitializeRowRes<RobustDirection>(operand, offsets, offsetIndex)};
         AuxCompare<RobustDirection> compare;
         applyCache.robustOrder.clear();
 
         SolutionType remainingValue{storm::utility::one<SolutionType>()};
-        for (++matrixColumnIt; *matrixColumnIt < StartOfRowIndicator; ++matrixColumnIt, ++matrixValueIt) {
+        for (++matrixColumnIt; *matrixColumnIt < StartOfRowIndicator<ColumnType>; ++matrixColumnIt, ++matrixValueIt) {
             auto const lower = matrixValueIt->lower();
             if constexpr (isPair<OperandType>::value) {
                 STORM_LOG_THROW(false, storm::exceptions::NotImplementedException, "Value Iteration is not implemented with pairs and interval-models.");
@@ -353,27 +587,105 @@ class ValueIterationOperator {
     template<typename T1, typename T2>
     struct isPair<std::pair<T1, T2>> : std::true_type {};
 
+    /*!
+     * True iff the operator can be applied in parallel using the given backend type (see `apply`).
+     * This is only supported for double values: the robust row application for interval models uses a shared cache and copies of exact numbers
+     * may share (reference counted) data among threads.
+     */
+    template<typename BackendType>
+    static constexpr bool SupportsParallelApply = std::is_same_v<ValueType, double> && std::is_copy_constructible_v<BackendType> &&
+                                                  requires(BackendType& backend, BackendType const& other) { backend.merge(other); };
+
+    /*!
+     * True iff the operator can be applied using the sliced representation of the matrix with the given operand and offset types.
+     */
+    template<typename OperandType, typename OffsetType>
+    static constexpr bool SupportsSlicedApply = TrivialRowGrouping && std::is_same_v<ValueType, double> && std::is_same_v<OperandType, std::vector<double>> &&
+                                                std::is_same_v<OffsetType, std::vector<double>>;
+
+    /*!
+     * Splits the row groups into chunks that can be processed in parallel.
+     * For deterministic models, each chunk starts at a slice of the sliced representation of the matrix.
+     */
+    void computeChunks();
+
+    template<typename ColumnType>
+    void computeChunks();
+
+    /*!
+     * Internal variant of setMatrix that fills the column vector of the given type
+     */
+    template<bool Backward, typename ColumnType>
+    void setMatrixEntries(storm::storage::SparseMatrix<ValueType> const& matrix);
+
     /*!
      * Internal variant of setIgnoredRows
      */
-    template<bool Backward = true>
+    template<bool Backward, typename ColumnType>
     void setIgnoredRows(bool useLocalRowIndices, std::function<bool(IndexType, IndexType)> const& ignore);
 
+    /*!
+     * Internal variant of unsetIgnoredRows
+     */
+    template<typename ColumnType>
+    void unsetIgnoredRows();
+
     /*!
      * Moves the given iterator to the end of the current row
      */
-    void moveToEndOfRow(std::vector<IndexType>::iterator& matrixColumnIt) const;
+    template<typename ColumnType>
+    void moveToEndOfRow(typename std::vector<ColumnType>::iterator& matrixColumnIt) const;
 
     /*!
      * Skips the current row, if it is ignored. Advances the iterators accordingly
      */
-    bool skipIgnoredRow(std::vector<IndexType>::const_iterator& matrixColumnIt, typename std::vector<ValueType>::const_iterator& matrixValueIt) const;
+    template<typename ColumnType>
+    bool skipIgnoredRow(typename std::vector<ColumnType>::const_iterator& matrixColumnIt,
+                        typename std::vector<ValueType>::const_iterator& matrixValueIt) const {
+        if (ColumnType entriesToSkip = (*matrixColumnIt & SkipNumEntriesMask<ColumnType>)) {
+            matrixColumnIt += entriesToSkip;
+            matrixValueIt += entriesToSkip - 1;
+            return true;
+        }
+        return false;
+    }
 
     /*!
      * Skips all ignored rows, advancing the iterators to the first successor row that is not ignored
      */
-    uint64_t skipMultipleIgnoredRows(std::vector<IndexType>::const_iterator& matrixColumnIt,
-                                     typename std::vector<ValueType>::const_iterator& matrixValueIt) const;
+    template<typename ColumnType>
+    uint64_t skipMultipleIgnoredRows(typename std::vector<ColumnType>::const_iterator& matrixColumnIt,
+                                     typename std::vector<ValueType>::const_iterator& matrixValueIt) const {
+        IndexType result{0ull};
+        while (skipIgnoredRow<ColumnType>(matrixColumnIt, matrixValueIt)) {
+            ++result;
+            STORM_LOG_ASSERT(*matrixColumnIt >= StartOfRowIndicator<ColumnType>, "Undexpected state of VI operator");
+            // We (currently) don't use this past the end of a row group, so we may have this additional sanity check:
+            STORM_LOG_ASSERT(*matrixColumnIt < StartOfRowGroupIndicator<ColumnType>, "Undexpected state of VI operator");
+        }
+        return result;
+    }
+
+    /*!
+     * @return the vector of row indicators and columns with the given type of entries
+     */
+    template<typename ColumnType>
+    std::vector<ColumnType> const& getMatrixColumns() const {
+        if constexpr (std::is_same_v<ColumnType, uint32_t>) {
+            return compactMatrixColumns;
+        } else {
+            return matrixColumns;
+        }
+    }
+
+    template<typename ColumnType>
+    std::vector<ColumnType>& getMatrixColumns() {
+        if constexpr (std::is_same_v<ColumnType, uint32_t>) {
+            return compactMatrixColumns;
+        } else {
+            return matrixColumns;
+        }
+    }
 
     /*!
      * The non-zero matrix entries.
@@ -386,6 +698,57 @@ class ValueIterationOperator {
      */
     std::vector<IndexType> matrixColumns;
 
+    /*!
+     * Same as matrixColumns but with 32 bit entries. This is used instead of matrixColumns if the column indices (and the row indicators) fit into 32 bits,
+     * which reduces the amount of memory that needs to be read when applying the operator.
+     */
+    std::vector<uint32_t> compactMatrixColumns;
+
+    /*!
+     * True iff compactMatrixColumns is used instead of matrixColumns
+     */
+    bool useCompactColumns{false};
+
+    /*!
+     * The matrix in the sliced ELLPACK format which allows SIMD-vectorized row computations. Only set for deterministic models with double values.
+     */
+    std::optional<SlicedEllpackMatrix> slicedMatrix;
+
+    /*!
+     * True iff the sliced representation of the matrix shall be built when setting the matrix.
+     */
+    bool useSlicedMatrix{false};
+
+    /*!
+     * A consecutive range of row groups that is processed by a single thread
+     */
+    struct Chunk {
+        IndexType firstGroup;      // The position of the first row group of this chunk (w.r.t. the order in which the groups are processed)
+        IndexType numberOfGroups;  // The number of row groups in this chunk
+        IndexType columnOffset;    // The position of the first row indicator of this chunk in the vector of columns
+        IndexType valueOffset;     // The position of the first value of this chunk
+    };
+
+    /*!
+     * The chunks for parallel application. Empty if the operator is applied sequentially.
+     */
+    std::vector<Chunk> chunks;
+
+    /*!
+     * The number of threads used for parallel application
+     */
+    uint64_t numberOfThreads{1};
+
+    /*!
+     * The threads that process the chunks. Only present if more than one thread is used.
+     */
+    std::unique_ptr<storm::utility::TaskPool> threadPool;
+
+    /*!
+     * Storage for the operand of the previous iteration when applying the operator in parallel and in-place
+     */
+    mutable std::pair<std::vector<SolutionType>, std::vector<SolutionType>> previousOperand;
+
     /*!
      * Row group indices as in the sparse matrix (even if the matrix is set in backwards order, this vector will not be reversed)
      */
@@ -427,19 +790,22 @@ class ValueIterationOperator {
     ApplyCache<ValueType, int> applyCache;
 
     /*!
-     * Bitmask that indicates the start of a row in the 'matrixColumns' vector
+     * Bitmask that indicates the start of a row in the 'matrixColumns' (or 'compactMatrixColumns') vector
      */
-    IndexType const StartOfRowIndicator = 1ull << 63;  // 10000..0
+    template<typename ColumnType>
+    static constexpr ColumnType StartOfRowIndicator = ColumnType(1) << (std::numeric_limits<ColumnType>::digits - 1);  // 10000..0
 
     /*!
-     * Bitmask that indicates the start of a row group in the 'matrixColumns' vector
+     * Bitmask that indicates the start of a row group in the 'matrixColumns' (or 'compactMatrixColumns') vector
      */
-    IndexType const StartOfRowGroupIndicator = StartOfRowIndicator + (1ull << 62);  // 11000..0
+    template<typename ColumnType>
+    static constexpr ColumnType StartOfRowGroupIndicator = StartOfRowIndicator<ColumnType> + (StartOfRowIndicator<ColumnType> >> 1);  // 11000..0
 
     /*!
      * Ignored rows are encoded by adding the number of skipped entries to the row indicator. This Bitmask helps to get the number of skipped entries
      */
-    IndexType const SkipNumEntriesMask = ~StartOfRowGroupIndicator;  // 00111..1
+    template<typename ColumnType>
+    static constexpr ColumnType SkipNumEntriesMask = ~StartOfRowGroupIndicator<ColumnType>;  // 00111..1
 };
 
 }  // namespace solver::helper
@@ -1,9 +1,11 @@
 #include <algorithm>
+#include <bit>
 #include <bitset>
 #include <iostream>
 
 #include "storm/storage/BitVector.h"
 
+#include "storm/storage/BitVectorRankIndex.h"
 #include "storm/storage/BoostTypes.h"
 #include "storm/utility/Hash.h"
 #include "storm/utility/OsDetection.h"
@@ -13,22 +15,165 @@
 #define ASSERT_BITVECTOR
 #endif
 
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define STORM_BITVECTOR_X86_KERNELS
+#include <immintrin.h>
+#endif
+
 namespace storm {
 namespace storage {
 
-BitVector::const_iterator::const_iterator() : dataPtr(nullptr), currentIndex(0), endIndex(0) {};
+namespace {
+
+/*!
+ * The word-wise operations that are used to implement the bulk operations of bit vectors.
+ */
+enum class WordOperation { And, Or, Xor, Implies, Not };
+
+template<WordOperation Operation>
+uint64_t applyToWord(uint64_t first, uint64_t second) {
+    if constexpr (Operation == WordOperation::And) {
+        return first & second;
+    } else if constexpr (Operation == WordOperation::Or) {
+        return first | second;
+    } else if constexpr (Operation == WordOperation::Xor) {
+        return first ^ second;
+    } else if constexpr (Operation == WordOperation::Implies) {
+        return ~first | second;
+    } else {
+        return ~first;
+    }
+}
+
+template<WordOperation Operation>
+void applyWordwiseScalar(uint64_t* result, uint64_t const* first, uint64_t const* second, uint64_t numberOfWords) {
+    for (uint64_t word = 0; word < numberOfWords; ++word) {
+        result[word] = applyToWord<Operation>(first[word], second[word]);
+    }
+}
+
+uint64_t countSetBitsScalar(uint64_t const* words, uint64_t numberOfWords) {
+    uint64_t result = 0;
+    for (uint64_t word = 0; word < numberOfWords; ++word) {
+        result += std::popcount(words[word]);
+    }
+    return result;
+}
+
+#ifdef STORM_BITVECTOR_X86_KERNELS
+template<WordOperation Operation>
+__attribute__((target("avx2"))) void applyWordwiseAvx2(uint64_t* result, uint64_t const* first, uint64_t const* second, uint64_t numberOfWords) {
+    uint64_t word = 0;
+    for (; word + 4 <= numberOfWords; word += 4) {
+        __m256i const firstWords = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(first + word));
+        __m256i const secondWords = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(second + word));
+        __m256i resultWords;
+        if constexpr (Operation == WordOperation::And) {
+            resultWords = _mm256_and_si256(firstWords, secondWords);
+        } else if constexpr (Operation == WordOperation::Or) {
+            resultWords = _mm256_or_si256(firstWords, secondWords);
+        } else if constexpr (Operation == WordOperation::Xor) {
+            resultWords = _mm256_xor_si256(firstWords, secondWords);
+        } else if constexpr (Operation == WordOperation::Implies) {
+            resultWords = _mm256_or_si256(_mm256_xor_si256(firstWords, _mm256_set1_epi64x(-1)), secondWords);
+        } else {
+            resultWords = _mm256_xor_si256(firstWords, _mm256_set1_epi64x(-1));
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(result + word), resultWords);
+    }
+    applyWordwiseScalar<Operation>(result + word, first + word, second + word, numberOfWords - word);
+}
+
+/*!
+ * Checks whether (first[i] & ~second[i]) == 0 (if Subset is true) or (first[i] & second[i]) == 0 (otherwise) holds for all words.
+ */
+template<bool Subset>
+__attribute__((target("avx2"))) bool testWordsAvx2(uint64_t const* first, uint64_t const* second, uint64_t numberOfWords) {
+    uint64_t word = 0;
+    for (; word + 4 <= numberOfWords; word += 4) {
+        __m256i const firstWords = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(first + word));
+        __m256i const secondWords = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(second + word));
+        // testc checks whether (~secondWords & firstWords) is zero, testz whether (secondWords & firstWords) is zero.
+        if (!(Subset ? _mm256_testc_si256(secondWords, firstWords) : _mm256_testz_si256(secondWords, firstWords))) {
+            return false;
+        }
+    }
+    for (; word < numberOfWords; ++word) {
+        if ((first[word] & (Subset ? ~second[word] : second[word])) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+__attribute__((target("popcnt"))) uint64_t countSetBitsPopcnt(uint64_t const* words, uint64_t numberOfWords) {
+    // Use multiple accumulators to break the dependency chain between the popcnt instructions.
+    uint64_t result0 = 0, result1 = 0, result2 = 0, result3 = 0;
+    uint64_t word = 0;
+    for (; word + 4 <= numberOfWords; word += 4) {
+        result0 += __builtin_popcountll(words[word]);
+        result1 += __builtin_popcountll(words[word + 1]);
+        result2 += __builtin_popcountll(words[word + 2]);
+        result3 += __builtin_popcountll(words[word + 3]);
+    }
+    for (; word < numberOfWords; ++word) {
+        result0 += __builtin_popcountll(words[word]);
+    }
+    return result0 + result1 + result2 + result3;
+}
+
+bool hasAvx2() {
+    static bool const result = __builtin_cpu_supports("avx2");
+    return result;
+}
+
+bool hasPopcnt() {
+    static bool const result = __builtin_cpu_supports("popcnt");
+    return result;
+}
+#endif
+
+/*!
+ * Sets result[i] to the result of the given operation on first[i] and second[i] for all words. The result may alias the inputs.
+ * For WordOperation::Not, the second operand is ignored.
+ */
+template<WordOperation Operation>
+void applyWordwise(uint64_t* result, uint64_t const* first, uint64_t const* second, uint64_t numberOfWords) {
+#ifdef STORM_BITVECTOR_X86_KERNELS
+    if (hasAvx2()) {
+        applyWordwiseAvx2<Operation>(result, first, second, numberOfWords);
+        return;
+    }
+#endif
+    applyWordwiseScalar<Operation>(result, first, second, numberOfWords);
+}
+
+uint64_t countSetBits(uint64_t const* words, uint64_t numberOfWords) {
+#ifdef STORM_BITVECTOR_X86_KERNELS
+    if (hasPopcnt()) {
+        return countSetBitsPopcnt(words, numberOfWords);
+    }
+#endif
+    return countSetBitsScalar(words, numberOfWords);
+}
+
+}  // namespace
+
+BitVector::const_iterator::const_iterator() : dataPtr(nullptr), currentIndex(0), endIndex(0), remainingBitsInBucket(0) {};
 
 BitVector::const_iterator::const_iterator(uint64_t const* dataPtr, uint_fast64_t startIndex, uint_fast64_t endIndex, bool setOnFirstBit)
-    : dataPtr(dataPtr), endIndex(endIndex) {
+    : dataPtr(dataPtr), endIndex(endIndex), remainingBitsInBucket(0) {
     if (setOnFirstBit) {
         // Set the index of the first set bit in the vector.
         currentIndex = getNextIndexWithValue<true>(dataPtr, startIndex, endIndex);
+        loadRemainingBitsInBucket();
     } else {
         currentIndex = startIndex;
     }
 }
 
-BitVector::const_iterator::const_iterator(const_iterator const& other) : dataPtr(other.dataPtr), currentIndex(other.currentIndex), endIndex(other.endIndex) {
+BitVector::const_iterator::const_iterator(const_iterator const& other)
+    : dataPtr(other.dataPtr), currentIndex(other.currentIndex), endIndex(other.endIndex), remainingBitsInBucket(other.remainingBitsInBucket) {
     // Intentionally left empty.
 }
 
@@ -38,15 +183,11 @@ BitVector::const_iterator& BitVector::const_iterator::operator=(const_iterator c
         dataPtr = other.dataPtr;
         currentIndex = other.currentIndex;
         endIndex = other.endIndex;
+        remainingBitsInBucket = other.remainingBitsInBucket;
     }
     return *this;
 }
 
-BitVector::const_iterator& BitVector::const_iterator::operator++() {
-    currentIndex = getNextIndexWithValue<true>(dataPtr, ++currentIndex, endIndex);
-    return *this;
-}
-
 BitVector::const_iterator BitVector::const_iterator::operator++(int) {
     BitVector::const_iterator copy{*this};
     ++(*this);
@@ -55,21 +196,23 @@ BitVector::const_iterator BitVector::const_iterator::operator++(int) {
 
 BitVector::const_iterator& BitVector::const_iterator::operator+=(size_t n) {
     for (size_t i = 0; i < n; ++i) {
-        currentIndex = getNextIndexWithValue<true>(dataPtr, ++currentIndex, endIndex);
+        ++(*this);
     }
     return *this;
 }
 
-uint_fast64_t BitVector::const_iterator::operator*() const {
-    return currentIndex;
+void BitVector::const_iterator::moveToNextBucket() {
+    currentIndex = getNextIndexWithValue<true>(dataPtr, (currentIndex | mod64mask) + 1, endIndex);
+    loadRemainingBitsInBucket();
 }
 
-bool BitVector::const_iterator::operator!=(const_iterator const& other) const {
-    return currentIndex != other.currentIndex;
-}
-
-bool BitVector::const_iterator::operator==(const_iterator const& other) const {
-    return currentIndex == other.currentIndex;
+void BitVector::const_iterator::loadRemainingBitsInBucket() {
+    if (currentIndex < endIndex) {
+        // Keep only the bits after the current index. The shift is split into two parts as shifting by 64 is undefined.
+        remainingBitsInBucket = dataPtr[currentIndex >> 6] & ((-1ull >> (currentIndex & mod64mask)) >> 1);
+    } else {
+        remainingBitsInBucket = 0;
+    }
 }
 
 BitVector::const_reverse_iterator::const_reverse_iterator() : dataPtr(nullptr), currentIndex(0), lowerBound(0) {};
@@ -351,38 +494,33 @@ void BitVector::grow(uint_fast64_t minimumLength, bool init) {
 BitVector BitVector::operator&(BitVector const& other) const {
     STORM_LOG_ASSERT(bitCount == other.bitCount, "Length of the bit vectors does not match.");
     BitVector result(bitCount);
-    std::transform(this->buckets, this->buckets + this->bucketCount(), other.buckets, result.buckets,
-                   [](uint64_t const& a, uint64_t const& b) { return a & b; });
+    applyWordwise<WordOperation::And>(result.buckets, this->buckets, other.buckets, this->bucketCount());
     return result;
 }
 
 BitVector& BitVector::operator&=(BitVector const& other) {
     STORM_LOG_ASSERT(bitCount == other.bitCount, "Length of the bit vectors does not match.");
-    std::transform(this->buckets, this->buckets + this->bucketCount(), other.buckets, this->buckets,
-                   [](uint64_t const& a, uint64_t const& b) { return a & b; });
+    applyWordwise<WordOperation::And>(this->buckets, this->buckets, other.buckets, this->bucketCount());
     return *this;
 }
 
 BitVector BitVector::operator|(BitVector const& other) const {
     STORM_LOG_ASSERT(bitCount == other.bitCount, "Length of the bit vectors does not match.");
     BitVector result(bitCount);
-    std::transform(this->buckets, this->buckets + this->bucketCount(), other.buckets, result.buckets,
-                   [](uint64_t const& a, uint64_t const& b) { return a | b; });
+    applyWordwise<WordOperation::Or>(result.buckets, this->buckets, other.buckets, this->bucketCount());
     return result;
 }
 
 BitVector& BitVector::operator|=(BitVector const& other) {
     STORM_LOG_ASSERT(bitCount == other.bitCount, "Length of the bit vectors does not match.");
-    std::transform(this->buckets, this->buckets + this->bucketCount(), other.buckets, this->buckets,
-                   [](uint64_t const& a, uint64_t const& b) { return a | b; });
+    applyWordwise<WordOperation::Or>(this->buckets, this->buckets, other.buckets, this->bucketCount());
     return *this;
 }
 
 BitVector BitVector::operator^(BitVector const& other) const {
     STORM_LOG_ASSERT(bitCount == other.bitCount, "Length of the bit vectors does not match.");
     BitVector result(bitCount);
-    std::transform(this->buckets, this->buckets + this->bucketCount(), other.buckets, result.buckets,
-                   [](uint64_t const& a, uint64_t const& b) { return a ^ b; });
+    applyWordwise<WordOperation::Xor>(result.buckets, this->buckets, other.buckets, this->bucketCount());
     result.truncateLastBucket();
     return result;
 }
@@ -403,11 +541,12 @@ BitVector BitVector::operator%(BitVector const& filter) const {
             ++position;
         }
     } else {
-        // If the given bit vector had much fewer elements, we iterate over its elements and accept calling the
-        // more costly operation getNumberOfSetBitsBeforeIndex on the current bit vector.
+        // If the given bit vector had much fewer elements, we iterate over its elements and use a rank index of the
+        // filter to compute the positions in the result.
+        BitVectorRankIndex const filterRankIndex(filter);
         for (auto bit : (*this)) {
             if (filter[bit]) {
-                result.set(filter.getNumberOfSetBitsBeforeIndex(bit));
+                result.set(filterRankIndex.getNumberOfSetBitsBeforeIndex(bit));
             }
         }
     }
@@ -417,13 +556,13 @@ BitVector BitVector::operator%(BitVector const& filter) const {
 
 BitVector BitVector::operator~() const {
     BitVector result(this->bitCount);
-    std::transform(this->buckets, this->buckets + this->bucketCount(), result.buckets, [](uint64_t const& a) { return ~a; });
+    applyWordwise<WordOperation::Not>(result.buckets, this->buckets, this->buckets, this->bucketCount());
     result.truncateLastBucket();
     return result;
 }
 
 void BitVector::complement() {
-    std::transform(this->buckets, this->buckets + this->bucketCount(), this->buckets, [](uint64_t const& a) { return ~a; });
+    applyWordwise<WordOperation::Not>(this->buckets, this->buckets, this->buckets, this->bucketCount());
     truncateLastBucket();
 }
 
@@ -457,8 +596,7 @@ BitVector BitVector::implies(BitVector const& other) const {
     STORM_LOG_ASSERT(bitCount == other.bitCount, "Length of the bit vectors does not match.");
 
     BitVector result(bitCount);
-    std::transform(this->buckets, this->buckets + this->bucketCount(), other.buckets, result.buckets,
-                   [](uint64_t const& a, uint64_t const& b) { return (~a | b); });
+    applyWordwise<WordOperation::Implies>(result.buckets, this->buckets, other.buckets, this->bucketCount());
     result.truncateLastBucket();
     return result;
 }
@@ -466,6 +604,11 @@ BitVector BitVector::implies(BitVector const& other) const {
 bool BitVector::isSubsetOf(BitVector const& other) const {
     STORM_LOG_ASSERT(bitCount == other.bitCount, "Length of the bit vectors does not match.");
 
+#ifdef STORM_BITVECTOR_X86_KERNELS
+    if (hasAvx2()) {
+        return testWordsAvx2<true>(buckets, other.buckets, bucketCount());
+    }
+#endif
     uint64_t const* it1 = buckets;
     uint64_t const* ite1 = buckets + bucketCount();
     uint64_t const* it2 = other.buckets;
@@ -481,6 +624,11 @@ bool BitVector::isSubsetOf(BitVector const& other) const {
 bool BitVector::isDisjointFrom(BitVector const& other) const {
     STORM_LOG_ASSERT(bitCount == other.bitCount, "Length of the bit vectors does not match.");
 
+#ifdef STORM_BITVECTOR_X86_KERNELS
+    if (hasAvx2()) {
+        return testWordsAvx2<false>(buckets, other.buckets, bucketCount());
+    }
+#endif
     uint64_t const* it1 = buckets;
     uint64_t const* ite1 = buckets + bucketCount();
     uint64_t const* it2 = other.buckets;
@@ -713,60 +861,37 @@ uint_fast64_t BitVector::getNumberOfSetBits() const {
 }
 
 uint_fast64_t BitVector::getNumberOfSetBitsBeforeIndex(uint_fast64_t index) const {
-    uint_fast64_t result = 0;
-
     // First, count all full buckets.
     uint_fast64_t bucket = index >> 6;
-    for (uint_fast64_t i = 0; i < bucket; ++i) {
-        // Check if we are using g++ or clang++ and, if so, use the built-in function
-#if (defined(__GNUG__) || defined(__clang__))
-        result += __builtin_popcountll(buckets[i]);
-#elif defined WINDOWS
-#include <nmmintrin.h>
-        // If the target machine does not support SSE4, this will fail.
-        result += _mm_popcnt_u64(bucketVector[i]);
-#else
-        uint_fast32_t cnt;
-        uint_fast64_t bitset = buckets[i];
-        for (cnt = 0; bitset; cnt++) {
-            bitset &= bitset - 1;
-        }
-        result += cnt;
-#endif
-    }
+    uint_fast64_t result = countSetBits(buckets, bucket);
 
     // Now check if we have to count part of a bucket.
     uint64_t tmp = index & mod64mask;
     if (tmp != 0) {
         tmp = ~((1ll << (64 - (tmp & mod64mask))) - 1ll);
         tmp &= buckets[bucket];
-        // Check if we are using g++ or clang++ and, if so, use the built-in function
-#if (defined(__GNUG__) || defined(__clang__))
-        result += __builtin_popcountll(tmp);
-#else
-        uint_fast32_t cnt;
-        uint64_t bitset = tmp;
-        for (cnt = 0; bitset; cnt++) {
-            bitset &= bitset - 1;
-        }
-        result += cnt;
-#endif
+        result += std::popcount(tmp);
     }
 
     return result;
 }
 
 std::vector<uint_fast64_t> BitVector::getNumberOfSetBitsBeforeIndices() const {
-    std::vector<uint_fast64_t> bitsSetBeforeIndices;
-    bitsSetBeforeIndices.reserve(this->size());
-    uint_fast64_t lastIndex = 0;
+    // Note that the entries after the last set bit are not part of the result.
+    uint_fast64_t const resultSize = getStartOfZeroSequenceBefore(bitCount);
+    std::vector<uint_fast64_t> bitsSetBeforeIndices(resultSize);
     uint_fast64_t currentNumberOfSetBits = 0;
-    for (auto index : *this) {
-        while (lastIndex <= index) {
-            bitsSetBeforeIndices.push_back(currentNumberOfSetBits);
-            ++lastIndex;
+    for (uint_fast64_t bucketStart = 0; bucketStart < resultSize; bucketStart += 64) {
+        uint64_t bucket = buckets[bucketStart >> 6];
+        uint_fast64_t const bucketEnd = std::min<uint_fast64_t>(bucketStart + 64, resultSize);
+        if (bucket == 0) {
+            std::fill(bitsSetBeforeIndices.begin() + bucketStart, bitsSetBeforeIndices.begin() + bucketEnd, currentNumberOfSetBits);
+            continue;
+        }
+        for (uint_fast64_t index = bucketStart; index < bucketEnd; ++index, bucket <<= 1) {
+            bitsSetBeforeIndices[index] = currentNumberOfSetBits;
+            currentNumberOfSetBits += bucket >> 63;
         }
-        ++currentNumberOfSetBits;
     }
     return bitsSetBeforeIndices;
 }
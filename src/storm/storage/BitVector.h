@@ -1,6 +1,8 @@
 #ifndef STORM_STORAGE_BITVECTOR_H_
 #define STORM_STORAGE_BITVECTOR_H_
 
+#include <algorithm>
+#include <bit>
 #include <cmath>
 #include <cstdint>
 #include <functional>
@@ -108,6 +110,16 @@ class BitVector {
         bool operator==(const_iterator const& other) const;
 
        private:
+        /*!
+         * Moves the iterator to the first set bit after the bucket that contains the current index.
+         */
+        void moveToNextBucket();
+
+        /*!
+         * Loads the bits of the bucket containing the current index that come after the current index.
+         */
+        void loadRemainingBitsInBucket();
+
         // The underlying bit vector of this iterator.
         uint64_t const* dataPtr;
 
@@ -116,6 +128,10 @@ class BitVector {
 
         // The index of the bit that is past the end of the range of this iterator.
         uint_fast64_t endIndex;
+
+        // The bits of the bucket containing the current index that come after the current index. This allows to decode the set bits of a bucket
+        // one after another without accessing the underlying storage again.
+        uint64_t remainingBitsInBucket;
     };
     /*!
      * A class that enables iterating over the indices of the bit vector whose corresponding bits are set to
@@ -707,6 +723,8 @@ class BitVector {
     template<typename StateType>
     friend struct Murmur3BitVectorHash;
 
+    friend class BitVectorRankIndex;
+
    private:
     /*!
      * Creates an empty bit vector with the given number of buckets.
@@ -779,6 +797,30 @@ class BitVector {
     static const uint_fast64_t mod64mask = (1 << 6) - 1;
 };
 
+inline BitVector::const_iterator& BitVector::const_iterator::operator++() {
+    if (remainingBitsInBucket != 0) {
+        // Decode the next set bit directly from the current bucket. Notice that the bits are stored starting at the most significant bit.
+        uint_fast64_t const bitInBucket = std::countl_zero(remainingBitsInBucket);
+        remainingBitsInBucket &= ~(1ull << (63 - bitInBucket));
+        currentIndex = std::min<uint_fast64_t>((currentIndex & ~mod64mask) + bitInBucket, endIndex);
+    } else {
+        moveToNextBucket();
+    }
+    return *this;
+}
+
+inline uint_fast64_t BitVector::const_iterator::operator*() const {
+    return currentIndex;
+}
+
+inline bool BitVector::const_iterator::operator!=(const_iterator const& other) const {
+    return currentIndex != other.currentIndex;
+}
+
+inline bool BitVector::const_iterator::operator==(const_iterator const& other) const {
+    return currentIndex == other.currentIndex;
+}
+
 static_assert(std::ranges::forward_range<BitVector>);
 
 struct FNV1aBitVectorHash {
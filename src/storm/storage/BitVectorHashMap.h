@@ -3,6 +3,7 @@
 
 #include <cstdint>
 #include <functional>
+#include <optional>
 
 #include "storm/storage/BitVector.h"
 
@@ -109,6 +110,15 @@ class BitVectorHashMap {
      */
     ValueType getValue(uint64_t bucket) const;
 
+    /*!
+     * Retrieves the value associated with the given key if the key is contained in the map. As this does not modify
+     * the map, several threads may call this method concurrently as long as no thread modifies the map.
+     *
+     * @param key The key to search.
+     * @return The value associated with the given key or none if the key is not contained in the map.
+     */
+    std::optional<ValueType> find(storm::storage::BitVector const& key) const;
+
     /*!
      * Checks if the given key is already contained in the map.
      *
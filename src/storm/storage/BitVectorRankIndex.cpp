@@ -0,0 +1,67 @@
+#include "storm/storage/BitVectorRankIndex.h"
+
+#include <algorithm>
+#include <bit>
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace storage {
+
+BitVectorRankIndex::BitVectorRankIndex(BitVector const& bitVector) : bitVector(bitVector) {
+    uint64_t const numberOfBuckets = bitVector.bucketCount();
+    setBitsBeforeBlock.reserve((numberOfBuckets + BucketsPerBlock - 1) / BucketsPerBlock + 1);
+    uint64_t numberOfSetBits = 0;
+    for (uint64_t bucket = 0; bucket < numberOfBuckets; ++bucket) {
+        if (bucket % BucketsPerBlock == 0) {
+            setBitsBeforeBlock.push_back(numberOfSetBits);
+        }
+        numberOfSetBits += std::popcount(bitVector.buckets[bucket]);
+    }
+    setBitsBeforeBlock.push_back(numberOfSetBits);
+}
+
+uint64_t BitVectorRankIndex::getNumberOfSetBitsBeforeIndex(uint64_t index) const {
+    STORM_LOG_ASSERT(index <= bitVector.size(), "Index " << index << " is out of range.");
+    uint64_t const lastBucket = index >> 6;
+    uint64_t bucket = lastBucket - lastBucket % BucketsPerBlock;
+    uint64_t result = setBitsBeforeBlock[bucket / BucketsPerBlock];
+    for (; bucket < lastBucket; ++bucket) {
+        result += std::popcount(bitVector.buckets[bucket]);
+    }
+    uint64_t const bitsInLastBucket = index & BitVector::mod64mask;
+    if (bitsInLastBucket != 0) {
+        // The bits are stored starting at the most significant bit.
+        result += std::popcount(bitVector.buckets[lastBucket] >> (64 - bitsInLastBucket));
+    }
+    return result;
+}
+
+uint64_t BitVectorRankIndex::getIndexOfSetBit(uint64_t numberOfSetBitsBefore) const {
+    if (numberOfSetBitsBefore >= getNumberOfSetBits()) {
+        return bitVector.size();
+    }
+
+    // Find the last block that has at most the given number of set bits before it.
+    uint64_t const block = std::upper_bound(setBitsBeforeBlock.begin(), setBitsBeforeBlock.end(), numberOfSetBitsBefore) - setBitsBeforeBlock.begin() - 1;
+    uint64_t remainingSetBits = numberOfSetBitsBefore - setBitsBeforeBlock[block];
+    for (uint64_t bucket = block * BucketsPerBlock;; ++bucket) {
+        uint64_t bucketContent = bitVector.buckets[bucket];
+        uint64_t const setBitsInBucket = std::popcount(bucketContent);
+        if (remainingSetBits < setBitsInBucket) {
+            // Clear the first set bits of the bucket until the desired one is the first remaining set bit.
+            for (; remainingSetBits > 0; --remainingSetBits) {
+                bucketContent &= ~(1ull << (63 - std::countl_zero(bucketContent)));
+            }
+            return (bucket << 6) + std::countl_zero(bucketContent);
+        }
+        remainingSetBits -= setBitsInBucket;
+    }
+}
+
+uint64_t BitVectorRankIndex::getNumberOfSetBits() const {
+    return setBitsBeforeBlock.back();
+}
+
+}  // namespace storage
+}  // namespace storm
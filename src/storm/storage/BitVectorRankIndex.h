@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+namespace storage {
+
+/*!
+ * An acceleration structure that answers rank queries (the number of set bits before an index) and select queries (the index of the n-th set bit)
+ * on a fixed bit vector. For every block of 512 bits, the number of set bits before the block is stored, so a rank query needs to count the set bits
+ * of at most eight buckets. This makes repeated calls of BitVector::getNumberOfSetBitsBeforeIndex with arbitrary indices cheap.
+ *
+ * The index refers to the bit vector it was built for, which must neither be modified nor destroyed while the index is in use.
+ */
+class BitVectorRankIndex {
+   public:
+    /*!
+     * Builds the index for the given bit vector.
+     *
+     * @param bitVector The bit vector for which to build the index.
+     */
+    explicit BitVectorRankIndex(BitVector const& bitVector);
+
+    /*!
+     * Retrieves the number of bits set in the underlying bit vector with an index strictly smaller than the given one.
+     * The result coincides with BitVector::getNumberOfSetBitsBeforeIndex.
+     *
+     * @param index The index for which to retrieve the number of set bits with a smaller index. Must not be larger than the size of the bit vector.
+     * @return The number of bits set in the bit vector with an index strictly smaller than the given one.
+     */
+    uint64_t getNumberOfSetBitsBeforeIndex(uint64_t index) const;
+
+    /*!
+     * Retrieves the index of the set bit that has exactly the given number of set bits before it, i.e., the inverse of getNumberOfSetBitsBeforeIndex.
+     *
+     * @param numberOfSetBitsBefore The number of set bits with a smaller index.
+     * @return The index of the corresponding set bit or the size of the bit vector, if there are not enough set bits.
+     */
+    uint64_t getIndexOfSetBit(uint64_t numberOfSetBitsBefore) const;
+
+    /*!
+     * Retrieves the number of bits set in the underlying bit vector.
+     */
+    uint64_t getNumberOfSetBits() const;
+
+   private:
+    // The number of buckets that form a block.
+    static const uint64_t BucketsPerBlock = 8;
+
+    // The bit vector for which this index was built.
+    BitVector const& bitVector;
+
+    // The number of set bits before each block. The last entry holds the total number of set bits.
+    std::vector<uint64_t> setBitsBeforeBlock;
+};
+
+}  // namespace storage
+}  // namespace storm
@@ -0,0 +1,377 @@
+#include "storm/storage/ConcurrentBitVectorHashMap.h"
+
+#include <thread>
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace storage {
+
+namespace detail {
+// The number of buckets that a thread moves to the new storage at once when enlarging the map.
+static const uint64_t concurrentBitVectorHashMapMoveChunkSize = 1024;
+}  // namespace detail
+
+template<class ValueType, class Hash>
+ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator::ConcurrentBitVectorHashMapIterator(ConcurrentBitVectorHashMap const& map,
+                                                                                                                     uint64_t bucket)
+    : map(map), bucket(bucket) {
+    moveToOccupiedBucket();
+}
+
+template<class ValueType, class Hash>
+bool ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator::operator==(ConcurrentBitVectorHashMapIterator const& other) const {
+    return &map == &other.map && bucket == other.bucket;
+}
+
+template<class ValueType, class Hash>
+bool ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator::operator!=(ConcurrentBitVectorHashMapIterator const& other) const {
+    return !(*this == other);
+}
+
+template<class ValueType, class Hash>
+typename ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator&
+ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator::operator++() {
+    ++bucket;
+    moveToOccupiedBucket();
+    return *this;
+}
+
+template<class ValueType, class Hash>
+std::pair<storm::storage::BitVector, ValueType> ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator::operator*() const {
+    Table const& table = *map.currentTable.load(std::memory_order_acquire);
+    return std::make_pair(map.getKey(table, bucket), table.values[bucket]);
+}
+
+template<class ValueType, class Hash>
+void ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator::moveToOccupiedBucket() {
+    Table const& table = *map.currentTable.load(std::memory_order_acquire);
+    while (bucket < table.capacity() && table.getState(bucket) != Occupied) {
+        ++bucket;
+    }
+}
+
+template<class ValueType, class Hash>
+ConcurrentBitVectorHashMap<ValueType, Hash>::Table::Table(uint64_t bucketSize, uint64_t exponent)
+    : wordsPerBucket(bucketSize / 64),
+      exponent(exponent),
+      keys(wordsPerBucket << exponent, 0),
+      values(1ull << exponent),
+      states(new std::atomic<uint64_t>[((1ull << exponent) + 31) / 32]),
+      successor(nullptr),
+      resizeStarted(false),
+      nextChunkToMove(0),
+      numberOfMovedChunks(0) {
+    for (uint64_t word = 0; word < ((1ull << exponent) + 31) / 32; ++word) {
+        states[word].store(0, std::memory_order_relaxed);
+    }
+}
+
+template<class ValueType, class Hash>
+uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::Table::capacity() const {
+    return 1ull << exponent;
+}
+
+template<class ValueType, class Hash>
+typename ConcurrentBitVectorHashMap<ValueType, Hash>::BucketState ConcurrentBitVectorHashMap<ValueType, Hash>::Table::getState(uint64_t bucket,
+                                                                                                                              std::memory_order order) const {
+    return static_cast<BucketState>((states[bucket >> 5].load(order) >> ((bucket & 31) << 1)) & 3ull);
+}
+
+template<class ValueType, class Hash>
+bool ConcurrentBitVectorHashMap<ValueType, Hash>::Table::compareAndSetState(uint64_t bucket, BucketState& expectedState, BucketState newState) {
+    std::atomic<uint64_t>& word = states[bucket >> 5];
+    uint64_t const shift = (bucket & 31) << 1;
+    uint64_t currentWord = word.load(std::memory_order_acquire);
+    while (true) {
+        BucketState currentState = static_cast<BucketState>((currentWord >> shift) & 3ull);
+        if (currentState != expectedState) {
+            expectedState = currentState;
+            return false;
+        }
+        // Other buckets sharing the word may have changed, in which case we simply retry.
+        uint64_t newWord = (currentWord & ~(3ull << shift)) | (static_cast<uint64_t>(newState) << shift);
+        if (word.compare_exchange_weak(currentWord, newWord, std::memory_order_acq_rel, std::memory_order_acquire)) {
+            return true;
+        }
+    }
+}
+
+template<class ValueType, class Hash>
+bool ConcurrentBitVectorHashMap<ValueType, Hash>::Table::matches(uint64_t bucket, storm::storage::BitVector const& key) const {
+    uint64_t const* bucketWords = keys.data() + bucket * wordsPerBucket;
+    for (uint64_t word = 0; word < wordsPerBucket; ++word) {
+        if (bucketWords[word] != key.getAsInt(word << 6, 64)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<class ValueType, class Hash>
+ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMap(uint64_t bucketSize, uint64_t initialSize, double loadFactor)
+    : loadFactor(loadFactor), bucketSize(bucketSize), currentTable(nullptr), numberOfElements(0) {
+    STORM_LOG_ASSERT(bucketSize % 64 == 0, "Bucket size must be a multiple of 64.");
+
+    uint64_t exponent = 1;
+    while (initialSize > 0) {
+        ++exponent;
+        initialSize >>= 1;
+    }
+    currentTable.store(new Table(bucketSize, exponent), std::memory_order_release);
+}
+
+template<class ValueType, class Hash>
+ConcurrentBitVectorHashMap<ValueType, Hash>::~ConcurrentBitVectorHashMap() {
+    Table* table = currentTable.load(std::memory_order_acquire);
+    delete table->successor.load(std::memory_order_acquire);
+    delete table;
+}
+
+template<class ValueType, class Hash>
+ValueType ConcurrentBitVectorHashMap<ValueType, Hash>::findOrAdd(storm::storage::BitVector const& key, ValueType const& value) {
+    return findOrAddImpl(key, value).first;
+}
+
+template<class ValueType, class Hash>
+std::pair<ValueType, bool> ConcurrentBitVectorHashMap<ValueType, Hash>::findOrAddConsecutive(storm::storage::BitVector const& key) {
+    return findOrAddImpl(key, std::nullopt);
+}
+
+template<class ValueType, class Hash>
+std::pair<ValueType, bool> ConcurrentBitVectorHashMap<ValueType, Hash>::findOrAddImpl(storm::storage::BitVector const& key,
+                                                                                      std::optional<ValueType> const& value) {
+    STORM_LOG_ASSERT(key.size() == bucketSize, "Size of bit vector and size of buckets do not match");
+    while (true) {
+        Table* table = currentTable.load(std::memory_order_acquire);
+        if (table->successor.load(std::memory_order_acquire) != nullptr) {
+            helpMoving(table);
+            continue;
+        }
+
+        uint64_t const bucketMask = table->capacity() - 1;
+        uint64_t bucket = getStartingBucket(*table, key);
+        bool restart = false;
+        for (uint64_t probes = 0; probes <= bucketMask;) {
+            BucketState state = table->getState(bucket);
+            if (state == Busy) {
+                // Another thread is currently writing a key to this bucket, so we have to wait for it to finish.
+                std::this_thread::yield();
+                continue;
+            } else if (state == Moved) {
+                // The table is being replaced, so we need to restart on the new table.
+                restart = true;
+                break;
+            } else if (state == Occupied) {
+                if (table->matches(bucket, key)) {
+                    return std::make_pair(table->values[bucket], false);
+                }
+            } else {
+                // The bucket is empty, so the key is not yet contained in the map.
+                if (numberOfElements.load(std::memory_order_relaxed) >= loadFactor * table->capacity()) {
+                    increaseSize(table);
+                    restart = true;
+                    break;
+                }
+                BucketState expectedState = Empty;
+                if (!table->compareAndSetState(bucket, expectedState, Busy)) {
+                    // Another thread modified the bucket in the meantime, so we need to inspect it again.
+                    continue;
+                }
+                uint64_t index = numberOfElements.fetch_add(1, std::memory_order_relaxed);
+                ValueType newValue = value ? value.value() : static_cast<ValueType>(index);
+                uint64_t* bucketWords = table->keys.data() + bucket * table->wordsPerBucket;
+                for (uint64_t word = 0; word < table->wordsPerBucket; ++word) {
+                    bucketWords[word] = key.getAsInt(word << 6, 64);
+                }
+                table->values[bucket] = newValue;
+                expectedState = Busy;
+                table->compareAndSetState(bucket, expectedState, Occupied);
+                return std::make_pair(newValue, true);
+            }
+            bucket = (bucket + 1) & bucketMask;
+            ++probes;
+        }
+
+        if (!restart) {
+            // All buckets were inspected without finding the key or an empty bucket.
+            increaseSize(table);
+        }
+    }
+}
+
+template<class ValueType, class Hash>
+std::optional<ValueType> ConcurrentBitVectorHashMap<ValueType, Hash>::find(storm::storage::BitVector const& key) const {
+    STORM_LOG_ASSERT(key.size() == bucketSize, "Size of bit vector and size of buckets do not match");
+    while (true) {
+        Table* table = currentTable.load(std::memory_order_acquire);
+        uint64_t const bucketMask = table->capacity() - 1;
+        uint64_t bucket = getStartingBucket(*table, key);
+        for (uint64_t probes = 0; probes <= bucketMask;) {
+            BucketState state = table->getState(bucket);
+            if (state == Busy) {
+                std::this_thread::yield();
+                continue;
+            } else if (state == Moved) {
+                break;
+            } else if (state == Occupied) {
+                if (table->matches(bucket, key)) {
+                    return table->values[bucket];
+                }
+            } else {
+                return std::nullopt;
+            }
+            bucket = (bucket + 1) & bucketMask;
+            ++probes;
+        }
+
+        if (table->successor.load(std::memory_order_acquire) == nullptr) {
+            // All buckets were inspected without finding the key.
+            return std::nullopt;
+        }
+        helpMoving(table);
+    }
+}
+
+template<class ValueType, class Hash>
+bool ConcurrentBitVectorHashMap<ValueType, Hash>::contains(storm::storage::BitVector const& key) const {
+    return find(key).has_value();
+}
+
+template<class ValueType, class Hash>
+ValueType ConcurrentBitVectorHashMap<ValueType, Hash>::getValue(storm::storage::BitVector const& key) const {
+    std::optional<ValueType> value = find(key);
+    STORM_LOG_ASSERT(value.has_value(), "Unknown key.");
+    return value.value();
+}
+
+template<class ValueType, class Hash>
+void ConcurrentBitVectorHashMap<ValueType, Hash>::increaseSize(Table* table) const {
+    if (!table->resizeStarted.exchange(true, std::memory_order_acq_rel)) {
+        STORM_LOG_TRACE("Increasing size of concurrent hash map from " << table->capacity() << " to " << 2 * table->capacity() << ".");
+        table->successor.store(new Table(bucketSize, table->exponent + 1), std::memory_order_release);
+    }
+    helpMoving(table);
+}
+
+template<class ValueType, class Hash>
+void ConcurrentBitVectorHashMap<ValueType, Hash>::helpMoving(Table* table) const {
+    // Wait until the thread that started the resizing has created the new table.
+    Table* successor = table->successor.load(std::memory_order_acquire);
+    while (successor == nullptr) {
+        std::this_thread::yield();
+        successor = table->successor.load(std::memory_order_acquire);
+    }
+
+    // Move the keys chunk by chunk. Every bucket is marked as moved, which prevents further insertions into the old table.
+    uint64_t const numberOfChunks = (table->capacity() + detail::concurrentBitVectorHashMapMoveChunkSize - 1) / detail::concurrentBitVectorHashMapMoveChunkSize;
+    for (uint64_t chunk = table->nextChunkToMove.fetch_add(1, std::memory_order_relaxed); chunk < numberOfChunks;
+         chunk = table->nextChunkToMove.fetch_add(1, std::memory_order_relaxed)) {
+        uint64_t const chunkEnd = std::min(table->capacity(), (chunk + 1) * detail::concurrentBitVectorHashMapMoveChunkSize);
+        for (uint64_t bucket = chunk * detail::concurrentBitVectorHashMapMoveChunkSize; bucket < chunkEnd; ++bucket) {
+            BucketState state = table->getState(bucket);
+            while (state != Moved) {
+                if (state == Busy) {
+                    std::this_thread::yield();
+                    state = table->getState(bucket);
+                } else if (state == Empty) {
+                    if (table->compareAndSetState(bucket, state, Moved)) {
+                        state = Moved;
+                    }
+                } else {
+                    // Only the thread that claimed the chunk modifies occupied buckets, so this cannot fail.
+                    insertMovedKey(*successor, getKey(*table, bucket), table->values[bucket]);
+                    table->compareAndSetState(bucket, state, Moved);
+                    state = Moved;
+                }
+            }
+        }
+        table->numberOfMovedChunks.fetch_add(1, std::memory_order_acq_rel);
+    }
+
+    // Wait until all other threads have moved their chunks and make the new table the current one.
+    while (table->numberOfMovedChunks.load(std::memory_order_acquire) < numberOfChunks) {
+        std::this_thread::yield();
+    }
+    Table* expectedTable = table;
+    if (currentTable.compare_exchange_strong(expectedTable, successor, std::memory_order_acq_rel)) {
+        std::lock_guard<std::mutex> lock(retiredTablesMutex);
+        retiredTables.emplace_back(table);
+    }
+}
+
+template<class ValueType, class Hash>
+void ConcurrentBitVectorHashMap<ValueType, Hash>::insertMovedKey(Table& table, storm::storage::BitVector const& key, ValueType const& value) const {
+    uint64_t const bucketMask = table.capacity() - 1;
+    uint64_t bucket = getStartingBucket(table, key);
+    while (true) {
+        BucketState expectedState = Empty;
+        if (table.compareAndSetState(bucket, expectedState, Busy)) {
+            uint64_t* bucketWords = table.keys.data() + bucket * table.wordsPerBucket;
+            for (uint64_t word = 0; word < table.wordsPerBucket; ++word) {
+                bucketWords[word] = key.getAsInt(word << 6, 64);
+            }
+            table.values[bucket] = value;
+            expectedState = Busy;
+            table.compareAndSetState(bucket, expectedState, Occupied);
+            return;
+        }
+        bucket = (bucket + 1) & bucketMask;
+    }
+}
+
+template<class ValueType, class Hash>
+storm::storage::BitVector ConcurrentBitVectorHashMap<ValueType, Hash>::getKey(Table const& table, uint64_t bucket) const {
+    storm::storage::BitVector key(bucketSize);
+    uint64_t const* bucketWords = table.keys.data() + bucket * table.wordsPerBucket;
+    for (uint64_t word = 0; word < table.wordsPerBucket; ++word) {
+        key.setFromInt(word << 6, 64, bucketWords[word]);
+    }
+    return key;
+}
+
+template<class ValueType, class Hash>
+uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::getStartingBucket(Table const& table, storm::storage::BitVector const& key) const {
+    return hasher(key) >> (sizeof(decltype(hasher(storm::storage::BitVector()))) * 8 - table.exponent);
+}
+
+template<class ValueType, class Hash>
+typename ConcurrentBitVectorHashMap<ValueType, Hash>::const_iterator ConcurrentBitVectorHashMap<ValueType, Hash>::begin() const {
+    return const_iterator(*this, 0);
+}
+
+template<class ValueType, class Hash>
+typename ConcurrentBitVectorHashMap<ValueType, Hash>::const_iterator ConcurrentBitVectorHashMap<ValueType, Hash>::end() const {
+    return const_iterator(*this, capacity());
+}
+
+template<class ValueType, class Hash>
+uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::size() const {
+    return numberOfElements.load(std::memory_order_acquire);
+}
+
+template<class ValueType, class Hash>
+uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::capacity() const {
+    return currentTable.load(std::memory_order_acquire)->capacity();
+}
+
+template<class ValueType, class Hash>
+void ConcurrentBitVectorHashMap<ValueType, Hash>::remap(std::function<ValueType(ValueType const&)> const& remapping) {
+    Table& table = *currentTable.load(std::memory_order_acquire);
+    for (uint64_t bucket = 0; bucket < table.capacity(); ++bucket) {
+        if (table.getState(bucket) == Occupied) {
+            table.values[bucket] = remapping(table.values[bucket]);
+        }
+    }
+}
+
+template<class ValueType, class Hash>
+void ConcurrentBitVectorHashMap<ValueType, Hash>::releaseRetiredStorage() {
+    std::lock_guard<std::mutex> lock(retiredTablesMutex);
+    retiredTables.clear();
+}
+
+template class ConcurrentBitVectorHashMap<uint64_t>;
+template class ConcurrentBitVectorHashMap<uint32_t>;
+}  // namespace storage
+}  // namespace storm
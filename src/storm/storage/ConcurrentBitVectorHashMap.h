@@ -0,0 +1,267 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+namespace storage {
+
+/*!
+ * This class represents a hash-map whose keys are bit vectors and that may be accessed by several threads at the
+ * same time. Like the BitVectorHashMap, the keys are stored in consecutive buckets of the key length and the keys
+ * must be bit vectors with a length that is a multiple of 64.
+ *
+ * Queries and insertions are lock-free. If the load of the map becomes too high, the storage is enlarged
+ * cooperatively, i.e. every thread that accesses the map during the resizing process helps moving the keys to the new
+ * storage. All other methods (e.g. iterating over the map) must not be called while other threads modify the map.
+ */
+template<typename ValueType, typename Hash = Murmur3BitVectorHash<ValueType>>
+class ConcurrentBitVectorHashMap {
+   private:
+    struct Table;
+
+   public:
+    class ConcurrentBitVectorHashMapIterator {
+       public:
+        /*!
+         * Creates an iterator that points to the first occupied bucket with an index of at least the given one.
+         *
+         * @param map The map of the iterator.
+         * @param bucket The index of the first bucket to consider.
+         */
+        ConcurrentBitVectorHashMapIterator(ConcurrentBitVectorHashMap const& map, uint64_t bucket);
+
+        // Methods to compare two iterators.
+        bool operator==(ConcurrentBitVectorHashMapIterator const& other) const;
+        bool operator!=(ConcurrentBitVectorHashMapIterator const& other) const;
+
+        // Method to move iterator forward.
+        ConcurrentBitVectorHashMapIterator& operator++();
+
+        // Method to retrieve the currently pointed-to bit vector and its mapped-to value.
+        std::pair<storm::storage::BitVector, ValueType> operator*() const;
+
+       private:
+        // Moves the iterator to the next occupied bucket (starting from the current one).
+        void moveToOccupiedBucket();
+
+        // The map this iterator refers to.
+        ConcurrentBitVectorHashMap const& map;
+
+        // The index of the bucket this iterator points to.
+        uint64_t bucket;
+    };
+
+    typedef ConcurrentBitVectorHashMapIterator const_iterator;
+
+    /*!
+     * Creates a new hash map with the given bucket size and initial size.
+     *
+     * @param bucketSize The size of the buckets that this map can hold. This value must be a multiple of 64.
+     * @param initialSize The number of buckets that is initially available.
+     * @param loadFactor The load factor that determines at which point the size of the underlying storage is
+     * increased.
+     */
+    ConcurrentBitVectorHashMap(uint64_t bucketSize, uint64_t initialSize = 1000, double loadFactor = 0.75);
+
+    ~ConcurrentBitVectorHashMap();
+
+    ConcurrentBitVectorHashMap(ConcurrentBitVectorHashMap const&) = delete;
+    ConcurrentBitVectorHashMap& operator=(ConcurrentBitVectorHashMap const&) = delete;
+
+    /*!
+     * Searches for the given key in the map. If it is found, the mapped-to value is returned. Otherwise, the
+     * key is inserted with the given value. This method may be called concurrently.
+     *
+     * @param key The key to search or insert.
+     * @param value The value that is inserted if the key is not already found in the map.
+     * @return The found value if the key is already contained in the map and the provided new value otherwise.
+     */
+    ValueType findOrAdd(storm::storage::BitVector const& key, ValueType const& value);
+
+    /*!
+     * Searches for the given key in the map. If it is found, the mapped-to value is returned. Otherwise, the key is
+     * inserted and mapped to the number of keys that were inserted before. Hence, if only this method is used to
+     * insert keys, the keys are mapped to consecutive values starting from zero. This method may be called
+     * concurrently.
+     *
+     * @param key The key to search or insert.
+     * @return A pair whose first component is the value associated with the key and whose second component
+     * indicates whether the key was inserted by this call.
+     */
+    std::pair<ValueType, bool> findOrAddConsecutive(storm::storage::BitVector const& key);
+
+    /*!
+     * Retrieves the value associated with the given key if the key is contained in the map. This method may be
+     * called concurrently.
+     *
+     * @param key The key to search.
+     * @return The value associated with the given key or none if the key is not contained in the map.
+     */
+    std::optional<ValueType> find(storm::storage::BitVector const& key) const;
+
+    /*!
+     * Checks if the given key is already contained in the map. This method may be called concurrently.
+     *
+     * @param key The key to search
+     * @return True if the key is already contained in the map
+     */
+    bool contains(storm::storage::BitVector const& key) const;
+
+    /*!
+     * Retrieves the value associated with the given key (if any). If the key does not exist, the behaviour is
+     * undefined. This method may be called concurrently.
+     *
+     * @return The value associated with the given key (if any).
+     */
+    ValueType getValue(storm::storage::BitVector const& key) const;
+
+    /*!
+     * Retrieves an iterator to the elements of the map.
+     *
+     * @return The iterator.
+     */
+    const_iterator begin() const;
+
+    /*!
+     * Retrieves an iterator that points one past the elements of the map.
+     *
+     * @return The iterator.
+     */
+    const_iterator end() const;
+
+    /*!
+     * Retrieves the size of the map in terms of the number of key-value pairs it stores.
+     *
+     * @return The size of the map.
+     */
+    uint64_t size() const;
+
+    /*!
+     * Retrieves the capacity of the underlying container.
+     *
+     * @return The capacity of the underlying container.
+     */
+    uint64_t capacity() const;
+
+    /*!
+     * Performs a remapping of all values stored by applying the given remapping.
+     *
+     * @param remapping The remapping to apply.
+     */
+    void remap(std::function<ValueType(ValueType const&)> const& remapping);
+
+    /*!
+     * Frees the storage that was replaced while enlarging the map. As other threads might still read the old storage
+     * while the map is being enlarged, the old storage is only released by this method (or upon destruction). It
+     * must not be called while other threads access the map.
+     */
+    void releaseRetiredStorage();
+
+   private:
+    // The states a bucket can be in. Each state is stored in two bits.
+    enum BucketState : uint64_t { Empty = 0, Busy = 1, Occupied = 2, Moved = 3 };
+
+    // The underlying storage of the map.
+    struct Table {
+        Table(uint64_t bucketSize, uint64_t exponent);
+
+        // Retrieves the number of buckets of this table.
+        uint64_t capacity() const;
+
+        // Retrieves the state of the given bucket.
+        BucketState getState(uint64_t bucket, std::memory_order order = std::memory_order_acquire) const;
+
+        // Tries to change the state of the given bucket. If this fails, the current state is written to the expected state.
+        bool compareAndSetState(uint64_t bucket, BucketState& expectedState, BucketState newState);
+
+        // Checks whether the given bucket stores the given key.
+        bool matches(uint64_t bucket, storm::storage::BitVector const& key) const;
+
+        // The number of 64-bit words of a single bucket.
+        uint64_t wordsPerBucket;
+
+        // The number of buckets is 2^exponent.
+        uint64_t exponent;
+
+        // The keys stored in consecutive buckets of wordsPerBucket words each.
+        std::vector<uint64_t> keys;
+
+        // The mapped-to values. The entry at position i is the "target" of the key in bucket i.
+        std::vector<ValueType> values;
+
+        // The states of the buckets with 32 buckets packed into one word.
+        std::unique_ptr<std::atomic<uint64_t>[]> states;
+
+        // If this table is being replaced, this points to the new table.
+        std::atomic<Table*> successor;
+
+        // A flag indicating whether a thread has started to replace this table.
+        std::atomic<bool> resizeStarted;
+
+        // The index of the next chunk of buckets that is to be moved to the successor and the number of moved chunks.
+        std::atomic<uint64_t> nextChunkToMove;
+        std::atomic<uint64_t> numberOfMovedChunks;
+    };
+
+    /*!
+     * Searches for the given key and inserts it if it is not found. If no value is given, the number of inserted
+     * keys is used as the value of a new key.
+     */
+    std::pair<ValueType, bool> findOrAddImpl(storm::storage::BitVector const& key, std::optional<ValueType> const& value);
+
+    /*!
+     * Inserts a key that is known not to be contained in the given table.
+     */
+    void insertMovedKey(Table& table, storm::storage::BitVector const& key, ValueType const& value) const;
+
+    /*!
+     * Retrieves the key stored in the given bucket of the given table.
+     */
+    storm::storage::BitVector getKey(Table const& table, uint64_t bucket) const;
+
+    /*!
+     * Starts enlarging the given table (unless another thread has done so already) and helps moving the keys.
+     */
+    void increaseSize(Table* table) const;
+
+    /*!
+     * Helps moving the keys of the given table to its successor and returns once all keys have been moved and the
+     * successor has become the current table.
+     */
+    void helpMoving(Table* table) const;
+
+    /*!
+     * Retrieves the bucket at which the search for the given key starts in the given table.
+     */
+    uint64_t getStartingBucket(Table const& table, storm::storage::BitVector const& key) const;
+
+    // The load factor determining when the size of the map is increased.
+    double loadFactor;
+
+    // The size of one bucket.
+    uint64_t bucketSize;
+
+    // The table currently holding the elements of the map.
+    mutable std::atomic<Table*> currentTable;
+
+    // The number of elements in this map.
+    std::atomic<uint64_t> numberOfElements;
+
+    // Tables that have been replaced by larger ones but that may still be read by other threads.
+    mutable std::vector<std::unique_ptr<Table>> retiredTables;
+    mutable std::mutex retiredTablesMutex;
+
+    // Functor object that are used to perform the actual hashing.
+    Hash hasher;
+};
+
+}  // namespace storage
+}  // namespace storm
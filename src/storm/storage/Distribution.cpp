@@ -121,6 +121,28 @@ void Distribution<ValueType, StateType>::scale(StateType const& state) {
     }
 }
 
+template<typename ValueType, typename StateType>
+void Distribution<ValueType, StateType>::remapStates(std::function<StateType(StateType const&)> const& remapping) {
+    std::vector<std::pair<StateType, ValueType>> remappedEntries;
+    remappedEntries.reserve(this->distribution.size());
+    for (auto const& entry : this->distribution) {
+        remappedEntries.emplace_back(remapping(entry.first), entry.second);
+    }
+    std::sort(remappedEntries.begin(), remappedEntries.end(),
+              [](std::pair<StateType, ValueType> const& a, std::pair<StateType, ValueType> const& b) { return a.first < b.first; });
+
+    container_type newDistribution;
+    newDistribution.reserve(remappedEntries.size());
+    for (auto& entry : remappedEntries) {
+        if (!newDistribution.empty() && (newDistribution.end() - 1)->first == entry.first) {
+            (newDistribution.end() - 1)->second += entry.second;
+        } else {
+            newDistribution.insert(newDistribution.end(), std::move(entry));
+        }
+    }
+    this->distribution = std::move(newDistribution);
+}
+
 template<typename ValueType, typename StateType>
 std::size_t Distribution<ValueType, StateType>::size() const {
     return this->distribution.size();
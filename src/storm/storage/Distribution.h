@@ -2,6 +2,7 @@
 #define STORM_STORAGE_DISTRIBUTION_H_
 
 #include <boost/container/flat_map.hpp>
+#include <functional>
 #include <iosfwd>
 #include <vector>
 
@@ -130,6 +131,14 @@ class Distribution {
      */
     void scale(StateType const& state);
 
+    /*!
+     * Replaces every state in the support of the distribution by the state it is mapped to. The probabilities of
+     * states that are mapped to the same state are summed up.
+     *
+     * @param remapping The function mapping the old states to the new ones.
+     */
+    void remapStates(std::function<StateType(StateType const&)> const& remapping);
+
     /*!
      * Retrieves the size of the distribution, i.e. the size of the support set.
      */
@@ -6,11 +6,55 @@
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/storage/MaximalEndComponentDecomposition.h"
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/utility/TaskPool.h"
 #include "storm/utility/graph.h"
 
 namespace storm {
 namespace storage {
 
+namespace {
+
+/*!
+ * The choices of the considered states that leave the SCC of their state.
+ */
+struct SccLeavingChoices {
+    std::vector<uint64_t> choices;
+    // The SCCs that have a leaving choice.
+    std::vector<uint64_t> sccIndices;
+    // The states for which all choices leave the SCC.
+    std::vector<uint64_t> states;
+};
+
+template<typename ValueType>
+void findSccLeavingChoices(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, SccDecompositionResult const& sccDecRes,
+                           storm::storage::BitVector const& ecCandidates, storm::storage::BitVector const& ecChoices, uint64_t firstState, uint64_t endState,
+                           SccLeavingChoices& result) {
+    for (auto stateIt = ecCandidates.begin(firstState); stateIt != ecCandidates.end() && *stateIt < endState; ++stateIt) {
+        uint64_t const state = *stateIt;
+        auto const sccIndex = sccDecRes.stateToSccMapping[state];
+        bool stateCanStayInScc = false;
+        for (auto const choice : transitionMatrix.getRowGroupIndices(state)) {
+            if (!ecChoices.get(choice)) {
+                continue;
+            }
+            auto row = transitionMatrix.getRow(choice);
+            if (std::any_of(row.begin(), row.end(), [&sccIndex, &sccDecRes](auto const& entry) {
+                    return sccIndex != sccDecRes.stateToSccMapping[entry.getColumn()] && !storm::utility::isZero(entry.getValue());
+                })) {
+                result.choices.push_back(choice);       // The choice leaves the SCC
+                result.sccIndices.push_back(sccIndex);  // This SCC is not 'stable' yet
+            } else {
+                stateCanStayInScc = true;  // The choice stays in the SCC
+            }
+        }
+        if (!stateCanStayInScc) {
+            result.states.push_back(state);  // This state is not in an EC
+        }
+    }
+}
+
+}  // namespace
+
 template<typename ValueType>
 MaximalEndComponentDecomposition<ValueType>::MaximalEndComponentDecomposition() : Decomposition() {
     // Intentionally left empty.
@@ -25,23 +69,24 @@ MaximalEndComponentDecomposition<ValueType>::MaximalEndComponentDecomposition(
 
 template<typename ValueType>
 MaximalEndComponentDecomposition<ValueType>::MaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
-                                                                              storm::storage::SparseMatrix<ValueType> const& backwardTransitions) {
-    performMaximalEndComponentDecomposition(transitionMatrix, backwardTransitions);
+                                                                              storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+                                                                              uint64_t numberOfThreads) {
+    performMaximalEndComponentDecomposition(transitionMatrix, backwardTransitions, storm::NullRef, storm::NullRef, numberOfThreads);
 }
 
 template<typename ValueType>
 MaximalEndComponentDecomposition<ValueType>::MaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                                               storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
-                                                                              storm::storage::BitVector const& states) {
-    performMaximalEndComponentDecomposition(transitionMatrix, backwardTransitions, states);
+                                                                              storm::storage::BitVector const& states, uint64_t numberOfThreads) {
+    performMaximalEndComponentDecomposition(transitionMatrix, backwardTransitions, states, storm::NullRef, numberOfThreads);
 }
 
 template<typename ValueType>
 MaximalEndComponentDecomposition<ValueType>::MaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                                               storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
                                                                               storm::storage::BitVector const& states,
-                                                                              storm::storage::BitVector const& choices) {
-    performMaximalEndComponentDecomposition(transitionMatrix, backwardTransitions, states, choices);
+                                                                              storm::storage::BitVector const& choices, uint64_t numberOfThreads) {
+    performMaximalEndComponentDecomposition(transitionMatrix, backwardTransitions, states, choices, numberOfThreads);
 }
 
 template<typename ValueType>
@@ -110,9 +155,11 @@ template<typename ValueType>
 void MaximalEndComponentDecomposition<ValueType>::performMaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                                                           storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
                                                                                           storm::OptionalRef<storm::storage::BitVector const> states,
-                                                                                          storm::OptionalRef<storm::storage::BitVector const> choices) {
+                                                                                          storm::OptionalRef<storm::storage::BitVector const> choices,
+                                                                                          uint64_t numberOfThreads) {
     // Get some data for convenient access.
     auto const& nondeterministicChoiceIndices = transitionMatrix.getRowGroupIndices();
+    uint64_t const numberOfStates = transitionMatrix.getRowGroupCount();
 
     storm::storage::BitVector remainingEcCandidates, ecChoices;
     SccDecompositionResult sccDecRes;
@@ -129,57 +176,76 @@ void MaximalEndComponentDecomposition<ValueType>::performMaximalEndComponentDeco
         ecChoices.resize(transitionMatrix.getRowCount(), true);
     }
 
+    // If multiple threads are used, the leaving choices are searched for different ranges of states concurrently.
+    // The same pool is used for the SCC decompositions in every round.
+    std::unique_ptr<storm::utility::TaskPool> pool;
+    if (numberOfThreads > 1) {
+        pool = std::make_unique<storm::utility::TaskPool>(numberOfThreads);
+        sccDecOptions.useThreadPool(*pool);
+    }
+    std::vector<SccLeavingChoices> leavingChoices(pool ? std::min<uint64_t>(numberOfStates, numberOfThreads * 8) : 1);
+
     while (true) {
         performSccDecomposition(transitionMatrix, sccDecOptions, sccDecRes, sccDecCache);
 
         remainingEcCandidates = sccDecRes.nonTrivialStates;
         storm::storage::BitVector ecSccIndices(sccDecRes.sccCount, true);
         storm::storage::BitVector nonTrivSccIndices(sccDecRes.sccCount, false);
-        // find the choices that do not stay in their SCC
         for (auto state : remainingEcCandidates) {
-            auto const sccIndex = sccDecRes.stateToSccMapping[state];
-            nonTrivSccIndices.set(sccIndex, true);
-            bool stateCanStayInScc = false;
-            for (auto const choice : transitionMatrix.getRowGroupIndices(state)) {
-                if (!ecChoices.get(choice)) {
-                    continue;
-                }
-                auto row = transitionMatrix.getRow(choice);
-                if (std::any_of(row.begin(), row.end(), [&sccIndex, &sccDecRes](auto const& entry) {
-                        return sccIndex != sccDecRes.stateToSccMapping[entry.getColumn()] && !storm::utility::isZero(entry.getValue());
-                    })) {
-                    ecChoices.set(choice, false);       // The choice leaves the SCC
-                    ecSccIndices.set(sccIndex, false);  // This SCC is not 'stable' yet
-                } else {
-                    stateCanStayInScc = true;  // The choice stays in the SCC
-                }
+            nonTrivSccIndices.set(sccDecRes.stateToSccMapping[state], true);
+        }
+
+        // find the choices that do not stay in their SCC
+        for (uint64_t range = 0; range < leavingChoices.size(); ++range) {
+            auto findInRange = [&, range]() {
+                leavingChoices[range] = SccLeavingChoices();
+                findSccLeavingChoices(transitionMatrix, sccDecRes, remainingEcCandidates, ecChoices, range * numberOfStates / leavingChoices.size(),
+                                      (range + 1) * numberOfStates / leavingChoices.size(), leavingChoices[range]);
+            };
+            if (pool) {
+                pool->submit(findInRange);
+            } else {
+                findInRange();
+            }
+        }
+        if (pool) {
+            pool->wait();
+        }
+        for (auto const& rangeLeavingChoices : leavingChoices) {
+            for (auto const choice : rangeLeavingChoices.choices) {
+                ecChoices.set(choice, false);
+            }
+            for (auto const sccIndex : rangeLeavingChoices.sccIndices) {
+                ecSccIndices.set(sccIndex, false);
             }
-            if (!stateCanStayInScc) {
-                remainingEcCandidates.set(state, false);  // This state is not in an EC
+            for (auto const state : rangeLeavingChoices.states) {
+                remainingEcCandidates.set(state, false);
             }
         }
 
         // process the MECs that we've found, i.e. SCCs where every state can stay inside the SCC
         ecSccIndices &= nonTrivSccIndices;
+        std::vector<uint64_t> sccToMecIndex(sccDecRes.sccCount, std::numeric_limits<uint64_t>::max());
         for (auto sccIndex : ecSccIndices) {
-            MaximalEndComponent newMec;
-            for (auto state : remainingEcCandidates) {
-                // skip states from different SCCs
-                if (sccDecRes.stateToSccMapping[state] != sccIndex) {
-                    continue;
-                }
-                // This is no longer a candidate
-                remainingEcCandidates.set(state, false);
-                // Add choices to the MEC
-                MaximalEndComponent::set_type containedChoices;
-                for (auto ecChoiceIt = ecChoices.begin(nondeterministicChoiceIndices[state]); *ecChoiceIt < nondeterministicChoiceIndices[state + 1];
-                     ++ecChoiceIt) {
-                    containedChoices.insert(*ecChoiceIt);
-                }
-                STORM_LOG_ASSERT(!containedChoices.empty(), "The contained choices of any state in an MEC must be non-empty.");
-                newMec.addState(state, std::move(containedChoices));
+            sccToMecIndex[sccIndex] = this->blocks.size();
+            this->blocks.emplace_back();
+        }
+        for (auto state : remainingEcCandidates) {
+            // skip states from SCCs that are not MECs
+            uint64_t const mecIndex = sccToMecIndex[sccDecRes.stateToSccMapping[state]];
+            if (mecIndex == std::numeric_limits<uint64_t>::max()) {
+                continue;
+            }
+            // This is no longer a candidate
+            remainingEcCandidates.set(state, false);
+            // Add choices to the MEC
+            MaximalEndComponent::set_type containedChoices;
+            for (auto ecChoiceIt = ecChoices.begin(nondeterministicChoiceIndices[state]); *ecChoiceIt < nondeterministicChoiceIndices[state + 1];
+                 ++ecChoiceIt) {
+                containedChoices.insert(*ecChoiceIt);
             }
-            this->blocks.emplace_back(std::move(newMec));
+            STORM_LOG_ASSERT(!containedChoices.empty(), "The contained choices of any state in an MEC must be non-empty.");
+            this->blocks[mecIndex].addState(state, std::move(containedChoices));
         }
 
         if (nonTrivSccIndices == ecSccIndices) {
@@ -33,9 +33,10 @@ class MaximalEndComponentDecomposition : public Decomposition<MaximalEndComponen
      *
      * @param transitionMatrix The transition relation of model to decompose into MECs.
      * @param backwardTransition The reversed transition relation.
+     * @param numberOfThreads The number of threads used for the decomposition.
      */
     MaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
-                                     storm::storage::SparseMatrix<ValueType> const& backwardTransitions);
+                                     storm::storage::SparseMatrix<ValueType> const& backwardTransitions, uint64_t numberOfThreads = 1);
 
     /*
      * Creates an MEC decomposition of the given subsystem of given model (represented by a row-grouped matrix).
@@ -44,9 +45,11 @@ class MaximalEndComponentDecomposition : public Decomposition<MaximalEndComponen
      * @param transitionMatrix The transition relation of model to decompose into MECs.
      * @param backwardTransition The reversed transition relation.
      * @param states The states of the subsystem to decompose.
+     * @param numberOfThreads The number of threads used for the decomposition.
      */
     MaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
-                                     storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& states);
+                                     storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& states,
+                                     uint64_t numberOfThreads = 1);
 
     /*
      * Creates an MEC decomposition of the given subsystem of given model (represented by a row-grouped matrix).
@@ -57,10 +60,11 @@ class MaximalEndComponentDecomposition : public Decomposition<MaximalEndComponen
      * @param backwardTransition The reversed transition relation.
      * @param states The states of the subsystem to decompose.
      * @param choices The choices of the subsystem to decompose.
+     * @param numberOfThreads The number of threads used for the decomposition.
      */
     MaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                      storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& states,
-                                     storm::storage::BitVector const& choices);
+                                     storm::storage::BitVector const& choices, uint64_t numberOfThreads = 1);
 
     /*!
      * Creates an MEC decomposition of the given subsystem in the given model.
@@ -113,11 +117,13 @@ class MaximalEndComponentDecomposition : public Decomposition<MaximalEndComponen
      * @param backwardTransitions The reversed transition relation.
      * @param states The states of the subsystem to decompose. If not given, all states are considered.
      * @param choices The choices of the subsystem to decompose. If not given, all choices are considered.
+     * @param numberOfThreads The number of threads used for the decomposition. If more than one thread is used, the SCCs are computed in parallel and
+     * the choices leaving the SCCs are detected concurrently for different ranges of states.
      *
      */
     void performMaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                  storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
                                                  storm::OptionalRef<storm::storage::BitVector const> states = storm::NullRef,
-                                                 storm::OptionalRef<storm::storage::BitVector const> choices = storm::NullRef);
+                                                 storm::OptionalRef<storm::storage::BitVector const> choices = storm::NullRef, uint64_t numberOfThreads = 1);
 };
 }  // namespace storm::storage
@@ -1,7 +1,13 @@
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
 
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <numeric>
+
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/storage/SparseMatrix.h"
+#include "storm/utility/TaskPool.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/vector.h"
@@ -40,6 +46,17 @@ StronglyConnectedComponentDecompositionOptions& StronglyConnectedComponentDecomp
     return *this;
 }
 
+StronglyConnectedComponentDecompositionOptions& StronglyConnectedComponentDecompositionOptions::useThreads(uint64_t value) {
+    numberOfThreads = value;
+    return *this;
+}
+
+StronglyConnectedComponentDecompositionOptions& StronglyConnectedComponentDecompositionOptions::useThreadPool(storm::utility::TaskPool& pool) {
+    threadPool = &pool;
+    numberOfThreads = pool.getNumberOfThreads();
+    return *this;
+}
+
 void SccDecompositionMemoryCache::initialize(uint64_t numStates) {
     preorderNumbers.assign(numStates, std::numeric_limits<uint64_t>::max());
     recursionStateStack.clear();
@@ -223,6 +240,418 @@ void performSccDecompositionGCM(storm::storage::SparseMatrix<ValueType> const& t
     }
 }
 
+namespace {
+
+/*!
+ * The graph of the considered subsystem given by successor and predecessor lists of the states. It only contains the transitions of the considered choices
+ * that have a non-zero value and do not leave the subsystem. Self-loops are not included.
+ */
+struct SccGraph {
+    std::vector<uint64_t> successorIndications, successors;
+    std::vector<uint64_t> predecessorIndications, predecessors;
+};
+
+/*!
+ * Splits the states into ranges and processes these ranges in parallel.
+ */
+void processStateRangesInParallel(storm::utility::TaskPool& pool, uint64_t numberOfStates, std::function<void(uint64_t, uint64_t)> const& function) {
+    uint64_t const numberOfRanges = std::min<uint64_t>(numberOfStates, pool.getNumberOfThreads() * 8);
+    for (uint64_t range = 0; range < numberOfRanges; ++range) {
+        pool.submit([&function, range, numberOfRanges, numberOfStates]() {
+            function(range * numberOfStates / numberOfRanges, (range + 1) * numberOfStates / numberOfRanges);
+        });
+    }
+    pool.wait();
+}
+
+template<typename ValueType>
+SccGraph buildSccGraph(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::OptionalRef<storm::storage::BitVector const> subsystem,
+                       storm::OptionalRef<storm::storage::BitVector const> choices, std::vector<uint8_t>& hasSelfLoop, storm::utility::TaskPool& pool) {
+    uint64_t const numberOfStates = transitionMatrix.getRowGroupCount();
+    auto const& rowGroupIndices = transitionMatrix.getRowGroupIndices();
+    auto forEachSuccessor = [&](uint64_t state, auto const& callback) {
+        if (subsystem && !subsystem->get(state)) {
+            return;
+        }
+        for (uint64_t row = rowGroupIndices[state], rowEnd = rowGroupIndices[state + 1]; row != rowEnd; ++row) {
+            if (choices && !choices->get(row)) {
+                continue;
+            }
+            for (auto const& successor : transitionMatrix.getRow(row)) {
+                if ((!subsystem || subsystem->get(successor.getColumn())) && successor.getValue() != storm::utility::zero<ValueType>()) {
+                    callback(successor.getColumn());
+                }
+            }
+        }
+    };
+
+    SccGraph graph;
+    hasSelfLoop.assign(numberOfStates, 0);
+    graph.successorIndications.assign(numberOfStates + 1, 0);
+    processStateRangesInParallel(pool, numberOfStates, [&](uint64_t firstState, uint64_t endState) {
+        for (uint64_t state = firstState; state < endState; ++state) {
+            forEachSuccessor(state, [&](uint64_t successor) {
+                if (successor == state) {
+                    hasSelfLoop[state] = 1;
+                } else {
+                    ++graph.successorIndications[state + 1];
+                }
+            });
+        }
+    });
+    std::partial_sum(graph.successorIndications.begin(), graph.successorIndications.end(), graph.successorIndications.begin());
+    graph.successors.resize(graph.successorIndications.back());
+    processStateRangesInParallel(pool, numberOfStates, [&](uint64_t firstState, uint64_t endState) {
+        for (uint64_t state = firstState; state < endState; ++state) {
+            uint64_t position = graph.successorIndications[state];
+            forEachSuccessor(state, [&](uint64_t successor) {
+                if (successor != state) {
+                    graph.successors[position++] = successor;
+                }
+            });
+        }
+    });
+
+    graph.predecessorIndications.assign(numberOfStates + 1, 0);
+    for (auto const successor : graph.successors) {
+        ++graph.predecessorIndications[successor + 1];
+    }
+    std::partial_sum(graph.predecessorIndications.begin(), graph.predecessorIndications.end(), graph.predecessorIndications.begin());
+    graph.predecessors.resize(graph.successors.size());
+    std::vector<uint64_t> nextPredecessorPosition(graph.predecessorIndications.begin(), graph.predecessorIndications.end() - 1);
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        for (uint64_t position = graph.successorIndications[state]; position < graph.successorIndications[state + 1]; ++position) {
+            graph.predecessors[nextPredecessorPosition[graph.successors[position]]++] = state;
+        }
+    }
+    return graph;
+}
+
+/*!
+ * Finds SCCs with the forward-backward algorithm: The SCC of a pivot state is the intersection of the states reachable from the pivot and the states that can
+ * reach the pivot. The remaining states are split into three partitions such that every SCC is contained in one of them. These partitions are then processed
+ * concurrently. Small partitions are decomposed with Tarjan's algorithm.
+ *
+ * The states of a partition are identified by a common color. Each state belongs to at most one partition that is currently processed, so different tasks
+ * never modify the data of the same state. States whose SCC is known get the color FinishedColor.
+ */
+class ForwardBackwardSccSearch {
+   public:
+    static const uint64_t FinishedColor = std::numeric_limits<uint64_t>::max();
+
+    ForwardBackwardSccSearch(SccGraph const& graph, std::vector<uint64_t>& stateToSccMapping, storm::utility::TaskPool& pool)
+        : graph(graph),
+          stateToSccMapping(stateToSccMapping),
+          pool(pool),
+          colors(stateToSccMapping.size()),
+          preorderNumbers(stateToSccMapping.size(), std::numeric_limits<uint64_t>::max()),
+          lowlinks(stateToSccMapping.size()),
+          nextColor(1),
+          nextSccIndex(0) {
+        for (auto& color : colors) {
+            color.store(FinishedColor, std::memory_order_relaxed);
+        }
+    }
+
+    /*!
+     * Decomposes the given states into SCCs.
+     *
+     * @return the number of SCCs found. The SCC indices are stored in the state to SCC mapping.
+     */
+    uint64_t perform(std::vector<uint64_t>&& states) {
+        for (auto const state : states) {
+            setColor(state, 0);
+        }
+        states = trim(std::move(states));
+        if (!states.empty()) {
+            pool.submit([this, states = std::move(states)]() mutable { processPartition(std::move(states), 0); });
+            pool.wait();
+        }
+        return nextSccIndex;
+    }
+
+   private:
+    // Partitions with at most this many states are processed sequentially with Tarjan's algorithm.
+    static const uint64_t SequentialSearchThreshold = 4096;
+
+    uint64_t getColor(uint64_t state) const {
+        return colors[state].load(std::memory_order_relaxed);
+    }
+
+    void setColor(uint64_t state, uint64_t color) {
+        colors[state].store(color, std::memory_order_relaxed);
+    }
+
+    void addToScc(uint64_t state, uint64_t sccIndex) {
+        setColor(state, FinishedColor);
+        stateToSccMapping[state] = sccIndex;
+    }
+
+    /*!
+     * Repeatedly removes states without predecessors or successors. Each of these states forms a singleton SCC.
+     *
+     * @return the remaining states.
+     */
+    std::vector<uint64_t> trim(std::vector<uint64_t>&& states) {
+        std::vector<uint64_t> remainingPredecessors(colors.size()), remainingSuccessors(colors.size());
+        std::vector<uint64_t> trimmedStates;
+        for (auto const state : states) {
+            remainingPredecessors[state] = graph.predecessorIndications[state + 1] - graph.predecessorIndications[state];
+            remainingSuccessors[state] = graph.successorIndications[state + 1] - graph.successorIndications[state];
+            if (remainingPredecessors[state] == 0 || remainingSuccessors[state] == 0) {
+                addToScc(state, nextSccIndex++);
+                trimmedStates.push_back(state);
+            }
+        }
+        while (!trimmedStates.empty()) {
+            uint64_t const state = trimmedStates.back();
+            trimmedStates.pop_back();
+            for (uint64_t position = graph.successorIndications[state]; position < graph.successorIndications[state + 1]; ++position) {
+                uint64_t const successor = graph.successors[position];
+                if (getColor(successor) != FinishedColor && --remainingPredecessors[successor] == 0) {
+                    addToScc(successor, nextSccIndex++);
+                    trimmedStates.push_back(successor);
+                }
+            }
+            for (uint64_t position = graph.predecessorIndications[state]; position < graph.predecessorIndications[state + 1]; ++position) {
+                uint64_t const predecessor = graph.predecessors[position];
+                if (getColor(predecessor) != FinishedColor && --remainingSuccessors[predecessor] == 0) {
+                    addToScc(predecessor, nextSccIndex++);
+                    trimmedStates.push_back(predecessor);
+                }
+            }
+        }
+        std::erase_if(states, [this](uint64_t state) { return getColor(state) == FinishedColor; });
+        return std::move(states);
+    }
+
+    void processPartition(std::vector<uint64_t>&& states, uint64_t color) {
+        if (states.size() <= SequentialSearchThreshold) {
+            searchSequentially(states, color);
+            return;
+        }
+
+        // Mark the states reachable from the pivot.
+        uint64_t const pivot = states.front();
+        uint64_t const forwardColor = nextColor++;
+        uint64_t const backwardColor = nextColor++;
+        std::vector<uint64_t> stack = {pivot};
+        setColor(pivot, forwardColor);
+        while (!stack.empty()) {
+            uint64_t const state = stack.back();
+            stack.pop_back();
+            for (uint64_t position = graph.successorIndications[state]; position < graph.successorIndications[state + 1]; ++position) {
+                uint64_t const successor = graph.successors[position];
+                if (getColor(successor) == color) {
+                    setColor(successor, forwardColor);
+                    stack.push_back(successor);
+                }
+            }
+        }
+
+        // Search backwards from the pivot. Reached states that are also reachable from the pivot form the SCC of the pivot.
+        uint64_t const sccIndex = nextSccIndex++;
+        addToScc(pivot, sccIndex);
+        stack.push_back(pivot);
+        while (!stack.empty()) {
+            uint64_t const state = stack.back();
+            stack.pop_back();
+            for (uint64_t position = graph.predecessorIndications[state]; position < graph.predecessorIndications[state + 1]; ++position) {
+                uint64_t const predecessor = graph.predecessors[position];
+                uint64_t const predecessorColor = getColor(predecessor);
+                if (predecessorColor == forwardColor) {
+                    addToScc(predecessor, sccIndex);
+                    stack.push_back(predecessor);
+                } else if (predecessorColor == color) {
+                    setColor(predecessor, backwardColor);
+                    stack.push_back(predecessor);
+                }
+            }
+        }
+
+        // Every other SCC is either only forward reachable, only backward reachable, or neither.
+        std::vector<uint64_t> forwardStates, backwardStates, remainingStates;
+        for (auto const state : states) {
+            uint64_t const stateColor = getColor(state);
+            if (stateColor == forwardColor) {
+                forwardStates.push_back(state);
+            } else if (stateColor == backwardColor) {
+                backwardStates.push_back(state);
+            } else if (stateColor == color) {
+                remainingStates.push_back(state);
+            }
+        }
+        states.clear();
+        states.shrink_to_fit();
+        for (auto& [partition, partitionColor] : {std::make_pair(&forwardStates, forwardColor), std::make_pair(&backwardStates, backwardColor),
+                                                  std::make_pair(&remainingStates, color)}) {
+            if (!partition->empty()) {
+                pool.submit([this, partition = std::move(*partition), partitionColor]() mutable { processPartition(std::move(partition), partitionColor); });
+            }
+        }
+    }
+
+    /*!
+     * Decomposes the states of the partition with the given color using (an iterative version of) Tarjan's algorithm.
+     */
+    void searchSequentially(std::vector<uint64_t> const& states, uint64_t color) {
+        // A state is on the stack of Tarjan's algorithm iff it has a preorder number and still has the color of the partition.
+        std::vector<std::pair<uint64_t, uint64_t>> recursionStack;  // pairs of states and the positions of their next successors to consider
+        std::vector<uint64_t> tarjanStack;
+        uint64_t currentIndex = 0;
+        for (auto const startState : states) {
+            if (getColor(startState) != color || preorderNumbers[startState] != std::numeric_limits<uint64_t>::max()) {
+                continue;
+            }
+            preorderNumbers[startState] = lowlinks[startState] = currentIndex++;
+            tarjanStack.push_back(startState);
+            recursionStack.emplace_back(startState, graph.successorIndications[startState]);
+            while (!recursionStack.empty()) {
+                auto& [state, position] = recursionStack.back();
+                if (position < graph.successorIndications[state + 1]) {
+                    uint64_t const successor = graph.successors[position++];
+                    if (getColor(successor) != color) {
+                        // The successor is either in a different partition or its SCC is already known.
+                        continue;
+                    }
+                    if (preorderNumbers[successor] == std::numeric_limits<uint64_t>::max()) {
+                        preorderNumbers[successor] = lowlinks[successor] = currentIndex++;
+                        tarjanStack.push_back(successor);
+                        recursionStack.emplace_back(successor, graph.successorIndications[successor]);
+                    } else {
+                        lowlinks[state] = std::min(lowlinks[state], preorderNumbers[successor]);
+                    }
+                } else {
+                    uint64_t const finishedState = state;
+                    recursionStack.pop_back();
+                    if (!recursionStack.empty()) {
+                        uint64_t const parent = recursionStack.back().first;
+                        lowlinks[parent] = std::min(lowlinks[parent], lowlinks[finishedState]);
+                    }
+                    if (lowlinks[finishedState] == preorderNumbers[finishedState]) {
+                        uint64_t const sccIndex = nextSccIndex++;
+                        uint64_t poppedState;
+                        do {
+                            poppedState = tarjanStack.back();
+                            tarjanStack.pop_back();
+                            addToScc(poppedState, sccIndex);
+                        } while (poppedState != finishedState);
+                    }
+                }
+            }
+        }
+    }
+
+    SccGraph const& graph;
+    std::vector<uint64_t>& stateToSccMapping;
+    storm::utility::TaskPool& pool;
+    std::vector<std::atomic<uint64_t>> colors;
+    std::vector<uint64_t> preorderNumbers, lowlinks;
+    std::atomic<uint64_t> nextColor;
+    std::atomic<uint64_t> nextSccIndex;
+};
+
+/*!
+ * Computes the SCC decomposition with multiple threads. Afterwards, the SCCs are renumbered such that SCCs reachable from an SCC have smaller indices
+ * (as it is the case for the sequential algorithm).
+ */
+template<typename ValueType>
+void performSccDecompositionParallel(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                     StronglyConnectedComponentDecompositionOptions const& options, SccDecompositionResult& result) {
+    uint64_t const numberOfStates = transitionMatrix.getRowGroupCount();
+    // Use the pool of the caller (if given) so that repeated decompositions do not spawn new threads
+    std::unique_ptr<storm::utility::TaskPool> localPool;
+    if (!options.threadPool) {
+        localPool = std::make_unique<storm::utility::TaskPool>(options.numberOfThreads);
+    }
+    storm::utility::TaskPool& pool = options.threadPool ? *options.threadPool : *localPool;
+    std::vector<uint8_t> hasSelfLoop;
+    SccGraph const graph = buildSccGraph(transitionMatrix, options.optSubsystem, options.optChoices, hasSelfLoop, pool);
+
+    std::vector<uint64_t> states;
+    if (options.optSubsystem) {
+        states.assign(options.optSubsystem->begin(), options.optSubsystem->end());
+    } else {
+        states.resize(numberOfStates);
+        std::iota(states.begin(), states.end(), 0ull);
+    }
+    uint64_t const numberOfSccs = ForwardBackwardSccSearch(graph, result.stateToSccMapping, pool).perform(std::vector<uint64_t>(states));
+
+    // Number the SCCs in the order of their smallest states so that the result does not depend on the scheduling of the threads.
+    std::vector<uint64_t> sccIndexMapping(numberOfSccs, std::numeric_limits<uint64_t>::max());
+    std::vector<uint64_t> sccIndications(numberOfSccs + 1, 0);
+    uint64_t numberOfMappedSccs = 0;
+    for (auto const state : states) {
+        uint64_t& sccIndex = sccIndexMapping[result.stateToSccMapping[state]];
+        if (sccIndex == std::numeric_limits<uint64_t>::max()) {
+            sccIndex = numberOfMappedSccs++;
+        }
+        result.stateToSccMapping[state] = sccIndex;
+        ++sccIndications[sccIndex + 1];
+    }
+    std::partial_sum(sccIndications.begin(), sccIndications.end(), sccIndications.begin());
+    std::vector<uint64_t> sccStates(states.size());
+    std::vector<uint64_t> nextSccStatePosition(sccIndications.begin(), sccIndications.end() - 1);
+    for (auto const state : states) {
+        sccStates[nextSccStatePosition[result.stateToSccMapping[state]]++] = state;
+    }
+
+    // Sort the SCCs topologically, starting with the SCCs without outgoing transitions.
+    std::vector<uint64_t> remainingSuccessorSccs(numberOfSccs, 0);
+    for (auto const state : states) {
+        uint64_t const sccIndex = result.stateToSccMapping[state];
+        for (uint64_t position = graph.successorIndications[state]; position < graph.successorIndications[state + 1]; ++position) {
+            if (result.stateToSccMapping[graph.successors[position]] != sccIndex) {
+                ++remainingSuccessorSccs[sccIndex];
+            }
+        }
+    }
+    std::vector<uint64_t> sortedSccs;
+    sortedSccs.reserve(numberOfSccs);
+    for (uint64_t sccIndex = 0; sccIndex < numberOfSccs; ++sccIndex) {
+        if (remainingSuccessorSccs[sccIndex] == 0) {
+            sortedSccs.push_back(sccIndex);
+        }
+    }
+    std::vector<uint64_t> sccDepths(result.sccDepths ? numberOfSccs : 0, 0);
+    for (uint64_t sortedIndex = 0; sortedIndex < sortedSccs.size(); ++sortedIndex) {
+        uint64_t const sccIndex = sortedSccs[sortedIndex];
+        for (uint64_t statePosition = sccIndications[sccIndex]; statePosition < sccIndications[sccIndex + 1]; ++statePosition) {
+            uint64_t const state = sccStates[statePosition];
+            for (uint64_t position = graph.predecessorIndications[state]; position < graph.predecessorIndications[state + 1]; ++position) {
+                uint64_t const predecessorScc = result.stateToSccMapping[graph.predecessors[position]];
+                if (predecessorScc != sccIndex) {
+                    if (result.sccDepths) {
+                        sccDepths[predecessorScc] = std::max(sccDepths[predecessorScc], sccDepths[sccIndex] + 1);
+                    }
+                    if (--remainingSuccessorSccs[predecessorScc] == 0) {
+                        sortedSccs.push_back(predecessorScc);
+                    }
+                }
+            }
+        }
+    }
+    STORM_LOG_ASSERT(sortedSccs.size() == numberOfSccs, "The SCCs do not form a directed acyclic graph.");
+
+    std::vector<uint64_t> sortedSccIndices(numberOfSccs);
+    for (uint64_t sortedIndex = 0; sortedIndex < numberOfSccs; ++sortedIndex) {
+        sortedSccIndices[sortedSccs[sortedIndex]] = sortedIndex;
+        if (result.sccDepths) {
+            result.sccDepths->push_back(sccDepths[sortedSccs[sortedIndex]]);
+        }
+    }
+    for (auto const state : states) {
+        uint64_t const sccIndex = result.stateToSccMapping[state];
+        if (hasSelfLoop[state] || sccIndications[sccIndex + 1] - sccIndications[sccIndex] > 1) {
+            result.nonTrivialStates.set(state, true);
+        }
+        result.stateToSccMapping[state] = sortedSccIndices[sccIndex];
+    }
+    result.sccCount = numberOfSccs;
+}
+
+}  // namespace
+
 template<typename ValueType>
 void StronglyConnectedComponentDecomposition<ValueType>::performSccDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                                                  StronglyConnectedComponentDecompositionOptions const& options) {
@@ -282,6 +711,10 @@ void performSccDecomposition(storm::storage::SparseMatrix<ValueType> const& tran
 
     uint64_t numberOfStates = transitionMatrix.getRowGroupCount();
     result.initialize(numberOfStates, options.isComputeSccDepthsSet || options.areOnlyBottomSccsConsidered);
+    if (options.numberOfThreads > 1) {
+        performSccDecompositionParallel(transitionMatrix, options, result);
+        return;
+    }
     cache.initialize(numberOfStates);
 
     // Start the search for SCCs from every state in the block.
@@ -9,6 +9,10 @@
 #include "storm/utility/OptionalRef.h"
 namespace storm {
 
+namespace utility {
+class TaskPool;
+}
+
 namespace storage {
 
 template<typename ValueType>
@@ -33,12 +37,22 @@ struct StronglyConnectedComponentDecompositionOptions {
     /// Sets if scc depths can be retrieved.
     StronglyConnectedComponentDecompositionOptions& computeSccDepths(bool value = true);
 
+    /// Sets the number of threads. If more than one thread is used, a parallel forward-backward algorithm is used instead of the sequential one.
+    /// The resulting SCCs coincide but might be numbered differently.
+    StronglyConnectedComponentDecompositionOptions& useThreads(uint64_t value);
+
+    /// Sets a pool whose threads are used for the decomposition. The number of threads is set to the number of threads of the pool.
+    /// This allows to reuse the same threads if multiple SCC decompositions are computed. The pool must not be waited for by another thread meanwhile.
+    StronglyConnectedComponentDecompositionOptions& useThreadPool(storm::utility::TaskPool& pool);
+
     storm::OptionalRef<storm::storage::BitVector const> optSubsystem;
     storm::OptionalRef<storm::storage::BitVector const> optChoices;
     bool areNaiveSccsDropped = false;
     bool areOnlyBottomSccsConsidered = false;
     bool isTopologicalSortForced = false;
     bool isComputeSccDepthsSet = false;
+    uint64_t numberOfThreads = 1;
+    storm::utility::TaskPool* threadPool = nullptr;
 };
 
 /*!
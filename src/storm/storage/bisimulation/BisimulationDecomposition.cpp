@@ -1,6 +1,7 @@
 #include "storm/storage/bisimulation/BisimulationDecomposition.h"
 
 #include <chrono>
+#include <type_traits>
 
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/exceptions/AbortException.h"
@@ -24,6 +25,7 @@
 #include "storm/storage/bisimulation/DeterministicBlockData.h"
 
 #include "storm/utility/SignalHandler.h"
+#include "storm/utility/TaskPool.h"
 #include "storm/utility/macros.h"
 
 namespace storm {
@@ -60,6 +62,8 @@ BisimulationDecomposition<ModelType, BlockDataType>::Options::Options()
       psiStates(),
       respectedAtomicPropositions(),
       buildQuotient(true),
+      signatureRefinement(false),
+      numberOfThreads(1),
       keepRewards(false),
       type(BisimulationType::Strong),
       bounded(false) {
@@ -256,6 +260,14 @@ void BisimulationDecomposition<ModelType, BlockDataType>::computeBisimulationDec
 
 template<typename ModelType, typename BlockDataType>
 void BisimulationDecomposition<ModelType, BlockDataType>::performPartitionRefinement() {
+    if (options.signatureRefinement) {
+        if (options.getType() == BisimulationType::Strong) {
+            performSignatureRefinement();
+            return;
+        }
+        STORM_LOG_WARN("Signature refinement is only supported for strong bisimulation. Falling back to splitter-based refinement.");
+    }
+
     // Insert all blocks into the splitter queue as a (potential) splitter.
     std::vector<Block<BlockDataType>*> splitterQueue;
     std::for_each(partition.getBlocks().begin(), partition.getBlocks().end(), [&](std::unique_ptr<Block<BlockDataType>> const& block) {
@@ -288,6 +300,135 @@ void BisimulationDecomposition<ModelType, BlockDataType>::performPartitionRefine
     }
 }
 
+template<typename ModelType, typename BlockDataType>
+void BisimulationDecomposition<ModelType, BlockDataType>::performSignatureRefinement() {
+    // Blocks with fewer states are grouped into one task to avoid the overhead of many small tasks.
+    uint_fast64_t const minimalNumberOfStatesPerTask = 1024;
+
+    std::vector<Signature> signatures(model.getNumberOfStates());
+    auto signatureLess = [this, &signatures](storm::storage::sparse::state_type const& state1, storm::storage::sparse::state_type const& state2) {
+        return isSignatureLess(signatures[state1].begin(), signatures[state1].end(), signatures[state2].begin(), signatures[state2].end());
+    };
+
+    // Accumulating the probabilities of exact values (e.g. CLN numbers or rational functions) is not thread-safe, so they are handled by a single thread.
+    uint64_t numberOfThreads = options.numberOfThreads;
+    if constexpr (!std::is_same_v<ValueType, double>) {
+        STORM_LOG_INFO_COND(numberOfThreads <= 1, "Signature refinement uses a single thread as concurrency is only supported for double values.");
+        numberOfThreads = 1;
+    }
+    storm::utility::TaskPool pool(numberOfThreads);
+    uint_fast64_t iterations = 0;
+    bool partitionChanged = true;
+    while (partitionChanged) {
+        ++iterations;
+
+        // Only blocks with more than one state can be split. Absorbing blocks are never split, because the
+        // transitions of their states are irrelevant.
+        std::vector<Block<BlockDataType>*> blocksToRefine;
+        for (auto const& block : partition.getBlocks()) {
+            if (block->getNumberOfStates() > 1 && !block->data().absorbing()) {
+                blocksToRefine.push_back(block.get());
+            }
+        }
+
+        // Compute the signatures of the states and sort each block according to them. This neither changes the
+        // block of any state nor moves states across blocks, so distinct blocks can be processed concurrently.
+        std::vector<std::vector<storm::storage::sparse::state_type>> splitPositions(blocksToRefine.size());
+        auto sortBlocks = [&](uint_fast64_t firstBlockIndex, uint_fast64_t lastBlockIndex) {
+            for (uint_fast64_t blockIndex = firstBlockIndex; blockIndex < lastBlockIndex; ++blockIndex) {
+                Block<BlockDataType>& block = *blocksToRefine[blockIndex];
+                for (auto stateIt = partition.begin(block), stateIte = partition.end(block); stateIt != stateIte; ++stateIt) {
+                    signatures[*stateIt].clear();
+                    computeSignature(*stateIt, signatures[*stateIt]);
+                }
+                partition.sortBlock(block, signatureLess, true);
+                for (storm::storage::sparse::state_type position = block.getBeginIndex() + 1; position < block.getEndIndex(); ++position) {
+                    if (signatureLess(partition.getState(position - 1), partition.getState(position))) {
+                        splitPositions[blockIndex].push_back(position);
+                    }
+                }
+            }
+        };
+        uint_fast64_t firstBlockIndex = 0;
+        uint_fast64_t numberOfStatesInTask = 0;
+        for (uint_fast64_t blockIndex = 0; blockIndex < blocksToRefine.size(); ++blockIndex) {
+            numberOfStatesInTask += blocksToRefine[blockIndex]->getNumberOfStates();
+            if (numberOfStatesInTask >= minimalNumberOfStatesPerTask || blockIndex + 1 == blocksToRefine.size()) {
+                pool.submit([&sortBlocks, firstBlockIndex, blockIndex]() { sortBlocks(firstBlockIndex, blockIndex + 1); });
+                firstBlockIndex = blockIndex + 1;
+                numberOfStatesInTask = 0;
+            }
+        }
+        pool.wait();
+
+        // Now split the blocks wherever the signatures of two consecutive states differ.
+        partitionChanged = false;
+        for (uint_fast64_t blockIndex = 0; blockIndex < blocksToRefine.size(); ++blockIndex) {
+            for (auto const& position : splitPositions[blockIndex]) {
+                partition.splitBlock(*blocksToRefine[blockIndex], position);
+                partitionChanged = true;
+            }
+        }
+
+        if (storm::utility::resources::isTerminate()) {
+            std::cout << "Performed " << iterations << " iterations of signature refinement before abort.\n";
+            STORM_LOG_THROW(false, storm::exceptions::AbortException, "Aborted in bisimulation computation.");
+        }
+    }
+    STORM_LOG_DEBUG("Signature refinement terminated after " << iterations << " iterations with " << partition.size() << " blocks.");
+
+    finalizeSignatureRefinement();
+}
+
+template<typename ModelType, typename BlockDataType>
+void BisimulationDecomposition<ModelType, BlockDataType>::finalizeSignatureRefinement() {
+    // Intentionally left empty.
+}
+
+template<typename ModelType, typename BlockDataType>
+void BisimulationDecomposition<ModelType, BlockDataType>::appendBlockProbabilities(uint_fast64_t row, Signature& signature) const {
+    uint_fast64_t const firstIndex = signature.size();
+    for (auto const& entry : model.getTransitionMatrix().getRow(row)) {
+        if (!comparator.isZero(entry.getValue())) {
+            signature.emplace_back(partition.getBlock(entry.getColumn()).getId(), entry.getValue());
+        }
+    }
+    if (firstIndex == signature.size()) {
+        return;
+    }
+
+    // Sort the entries by block and sum up the values of entries with the same block.
+    std::sort(signature.begin() + firstIndex, signature.end(),
+              [](typename Signature::value_type const& a, typename Signature::value_type const& b) { return a.first < b.first; });
+    auto lastIt = signature.begin() + firstIndex;
+    for (auto it = std::next(lastIt), ite = signature.end(); it != ite; ++it) {
+        if (it->first == lastIt->first) {
+            lastIt->second += it->second;
+        } else {
+            *(++lastIt) = std::move(*it);
+        }
+    }
+    signature.erase(std::next(lastIt), signature.end());
+}
+
+template<typename ModelType, typename BlockDataType>
+bool BisimulationDecomposition<ModelType, BlockDataType>::isSignatureLess(typename Signature::const_iterator first1, typename Signature::const_iterator last1,
+                                                                          typename Signature::const_iterator first2,
+                                                                          typename Signature::const_iterator last2) const {
+    if (std::distance(first1, last1) != std::distance(first2, last2)) {
+        return std::distance(first1, last1) < std::distance(first2, last2);
+    }
+    for (; first1 != last1; ++first1, ++first2) {
+        if (first1->first != first2->first) {
+            return first1->first < first2->first;
+        }
+        if (!comparator.isEqual(first1->second, first2->second)) {
+            return comparator.isLess(first1->second, first2->second);
+        }
+    }
+    return false;
+}
+
 template<typename ModelType, typename BlockDataType>
 std::shared_ptr<ModelType> BisimulationDecomposition<ModelType, BlockDataType>::getQuotient() const {
     STORM_LOG_THROW(this->quotient != nullptr, storm::exceptions::IllegalFunctionCallException,
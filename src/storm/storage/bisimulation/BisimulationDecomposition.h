@@ -126,6 +126,14 @@ class BisimulationDecomposition : public Decomposition<StateBlock> {
         /// A flag that governs whether the quotient model is actually built or only the decomposition is computed.
         bool buildQuotient;
 
+        /// A flag that governs whether the partition is refined based on the signatures of all states instead of
+        /// splitters. This is only supported for strong bisimulation.
+        bool signatureRefinement;
+
+        /// The number of threads that compute the signatures of the states during signature refinement. Only models with double values
+        /// are refined concurrently.
+        uint64_t numberOfThreads;
+
        private:
         boost::optional<OptimizationDirection> optimalityType;
 
@@ -218,6 +226,43 @@ class BisimulationDecomposition : public Decomposition<StateBlock> {
     virtual void refinePartitionBasedOnSplitter(bisimulation::Block<BlockDataType>& splitter,
                                                 std::vector<bisimulation::Block<BlockDataType>*>& splitterQueue) = 0;
 
+    // The signature of a state is a sequence of pairs of block IDs and values.
+    typedef std::vector<std::pair<storm::storage::sparse::state_type, ValueType>> Signature;
+
+    /*!
+     * Refines the partition by splitting all blocks according to the signatures of their states until no block
+     * is split anymore. The signatures of the states of different blocks are computed concurrently.
+     */
+    void performSignatureRefinement();
+
+    /*!
+     * Computes the signature of the given state wrt. the current partition. Two states of a block remain in the
+     * same block iff their signatures are equal.
+     *
+     * @param state The state whose signature to compute.
+     * @param signature An empty signature that is filled with the signature of the state.
+     */
+    virtual void computeSignature(storm::storage::sparse::state_type state, Signature& signature) const = 0;
+
+    /*!
+     * A function that can update auxiliary data structures after the partition was refined using signatures.
+     */
+    virtual void finalizeSignatureRefinement();
+
+    /*!
+     * Appends the probabilities of moving from the given row of the transition matrix to the blocks of the
+     * current partition to the given signature. The entries are ordered by the block IDs and blocks that are
+     * reached with probability zero are omitted.
+     */
+    void appendBlockProbabilities(uint_fast64_t row, Signature& signature) const;
+
+    /*!
+     * Retrieves whether the first signature is considered to be less than the second one. The values of the
+     * signatures are compared using the comparator.
+     */
+    bool isSignatureLess(typename Signature::const_iterator first1, typename Signature::const_iterator last1, typename Signature::const_iterator first2,
+                         typename Signature::const_iterator last2) const;
+
     /*!
      * Builds the quotient model based on the previously computed equivalence classes (stored in the blocks
      * of the decomposition.
@@ -592,6 +592,13 @@ void DeterministicModelBisimulationDecomposition<ModelType>::refinePartitionBase
     }
 }
 
+template<typename ModelType>
+void DeterministicModelBisimulationDecomposition<ModelType>::computeSignature(
+    storm::storage::sparse::state_type state, typename BisimulationDecomposition<ModelType, BlockDataType>::Signature& signature) const {
+    // For strong bisimulation, the signature of a state consists of its probabilities to move to the blocks.
+    this->appendBlockProbabilities(state, signature);
+}
+
 template<typename ModelType>
 void DeterministicModelBisimulationDecomposition<ModelType>::buildQuotient() {
     // In order to create the quotient model, we need to construct
@@ -1,5 +1,7 @@
 #include "storm/storage/bisimulation/NondeterministicModelBisimulationDecomposition.h"
 
+#include <numeric>
+
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 
@@ -106,6 +108,55 @@ void NondeterministicModelBisimulationDecomposition<ModelType>::updateOrderedQuo
               });
 }
 
+template<typename ModelType>
+void NondeterministicModelBisimulationDecomposition<ModelType>::computeSignature(
+    storm::storage::sparse::state_type state, typename BisimulationDecomposition<ModelType, BlockDataType>::Signature& signature) const {
+    std::vector<uint_fast64_t> const& nondeterministicChoiceIndices = this->model.getTransitionMatrix().getRowGroupIndices();
+    bool const hasStateActionRewards =
+        this->options.getKeepRewards() && this->model.hasRewardModel() && this->model.getUniqueRewardModel().hasStateActionRewards();
+
+    // Every choice contributes a separator (that carries the reward of the choice) followed by its distribution
+    // over the blocks. As the separator does not refer to a block, the choices can be told apart.
+    storm::storage::sparse::state_type const separator = std::numeric_limits<storm::storage::sparse::state_type>::max();
+    std::vector<uint_fast64_t> choiceBeginIndices;
+    for (uint_fast64_t choice = nondeterministicChoiceIndices[state]; choice < nondeterministicChoiceIndices[state + 1]; ++choice) {
+        choiceBeginIndices.push_back(signature.size());
+        signature.emplace_back(separator,
+                               hasStateActionRewards ? this->model.getUniqueRewardModel().getStateActionReward(choice) : storm::utility::zero<ValueType>());
+        this->appendBlockProbabilities(choice, signature);
+    }
+    if (choiceBeginIndices.size() < 2) {
+        return;
+    }
+    choiceBeginIndices.push_back(signature.size());
+
+    // Only the set of distributions matters, so we order the distributions and drop duplicates.
+    auto distributionLess = [&](uint_fast64_t choiceOffset1, uint_fast64_t choiceOffset2) {
+        return this->isSignatureLess(signature.begin() + choiceBeginIndices[choiceOffset1], signature.begin() + choiceBeginIndices[choiceOffset1 + 1],
+                                     signature.begin() + choiceBeginIndices[choiceOffset2], signature.begin() + choiceBeginIndices[choiceOffset2 + 1]);
+    };
+    std::vector<uint_fast64_t> orderedChoiceOffsets(choiceBeginIndices.size() - 1);
+    std::iota(orderedChoiceOffsets.begin(), orderedChoiceOffsets.end(), 0);
+    std::sort(orderedChoiceOffsets.begin(), orderedChoiceOffsets.end(), distributionLess);
+
+    typename BisimulationDecomposition<ModelType, BlockDataType>::Signature orderedSignature;
+    orderedSignature.reserve(signature.size());
+    for (auto offsetIt = orderedChoiceOffsets.begin(), offsetIte = orderedChoiceOffsets.end(); offsetIt != offsetIte; ++offsetIt) {
+        if (offsetIt == orderedChoiceOffsets.begin() || distributionLess(*std::prev(offsetIt), *offsetIt)) {
+            orderedSignature.insert(orderedSignature.end(), signature.begin() + choiceBeginIndices[*offsetIt],
+                                    signature.begin() + choiceBeginIndices[*offsetIt + 1]);
+        }
+    }
+    signature = std::move(orderedSignature);
+}
+
+template<typename ModelType>
+void NondeterministicModelBisimulationDecomposition<ModelType>::finalizeSignatureRefinement() {
+    // The quotient distributions still refer to the initial partition, so we recompute them for the final one.
+    quotientDistributions.assign(this->model.getNumberOfChoices(), storm::storage::DistributionWithReward<ValueType>());
+    this->initializeQuotientDistributions();
+}
+
 template<typename ModelType>
 void NondeterministicModelBisimulationDecomposition<ModelType>::buildQuotient() {
     // In order to create the quotient model, we need to construct
@@ -40,6 +40,11 @@ class NondeterministicModelBisimulationDecomposition : public BisimulationDecomp
 
     virtual void initialize() override;
 
+    virtual void computeSignature(storm::storage::sparse::state_type state,
+                                  typename BisimulationDecomposition<ModelType, BlockDataType>::Signature& signature) const override;
+
+    virtual void finalizeSignatureRefinement() override;
+
    private:
     // Creates the mapping from the choice indices to the states.
     void createChoiceToStateMapping();
@@ -1,10 +1,15 @@
 #include "storm/storage/expressions/ToCppVisitor.h"
 
+#include <iomanip>
+#include <limits>
+#include <sstream>
+
 #include "storm/storage/expressions/Expressions.h"
 
 #include "storm/adapters/RationalFunctionAdapter.h"
 
 #include "storm/exceptions/NotSupportedException.h"
+#include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 
 namespace storm {
@@ -38,8 +43,10 @@ std::string ToCppVisitor::translate(storm::expressions::Expression const& expres
 boost::any ToCppVisitor::visit(IfThenElseExpression const& expression, boost::any const& data) {
     ToCppTranslationOptions const& options = boost::any_cast<ToCppTranslationOptions>(data);
 
-    // Clear the type cast for the condition.
-    ToCppTranslationOptions conditionOptions(options.getPrefixes(), options.getNames());
+    // Clear the type cast for the condition unless all numbers are to be treated as doubles.
+    ToCppTranslationOptions conditionOptions(
+        options.getPrefixes(), options.getNames(),
+        options.getMode() == ToCppTranslationMode::CastDouble ? ToCppTranslationMode::CastDouble : ToCppTranslationMode::KeepType);
     stream << "(";
     expression.getCondition()->accept(*this, conditionOptions);
     stream << " ? ";
@@ -145,14 +152,43 @@ boost::any ToCppVisitor::visit(BinaryNumericalFunctionExpression const& expressi
             stream << ")";
             break;
         case BinaryNumericalFunctionExpression::OperatorType::Modulo:
-            stream << "(";
+            if (boost::any_cast<ToCppTranslationOptions const&>(data).getMode() == ToCppTranslationMode::CastDouble) {
+                stream << "std::fmod(";
+                expression.getFirstOperand()->accept(*this, data);
+                stream << ", ";
+                expression.getSecondOperand()->accept(*this, data);
+                stream << ")";
+            } else {
+                stream << "(";
+                expression.getFirstOperand()->accept(*this, data);
+                stream << " % ";
+                expression.getSecondOperand()->accept(*this, data);
+                stream << ")";
+            }
+            break;
+        case BinaryNumericalFunctionExpression::OperatorType::Logarithm:
+            STORM_LOG_THROW(boost::any_cast<ToCppTranslationOptions const&>(data).getMode() == ToCppTranslationMode::CastDouble,
+                            storm::exceptions::NotSupportedException, "Log expressions are only implemented for C++ translation to doubles.");
+            if (expression.getSecondOperand()->isLiteral()) {
+                auto base = expression.getSecondOperand()->evaluateAsRational();
+                if (base == storm::utility::convertNumber<storm::RationalNumber, uint64_t>(2ull)) {
+                    stream << "std::log2(";
+                    expression.getFirstOperand()->accept(*this, data);
+                    stream << ")";
+                    break;
+                } else if (base == storm::utility::convertNumber<storm::RationalNumber, uint64_t>(10ull)) {
+                    stream << "std::log10(";
+                    expression.getFirstOperand()->accept(*this, data);
+                    stream << ")";
+                    break;
+                }
+            }
+            stream << "(std::log(";
             expression.getFirstOperand()->accept(*this, data);
-            stream << " % ";
+            stream << ") / std::log(";
             expression.getSecondOperand()->accept(*this, data);
-            stream << ")";
+            stream << "))";
             break;
-        case BinaryNumericalFunctionExpression::OperatorType::Logarithm:
-            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Log expressions not implemented for C++ translation.");
     }
     return boost::none;
 }
@@ -299,6 +335,14 @@ boost::any ToCppVisitor::visit(UnaryNumericalFunctionExpression const& expressio
             expression.getOperand()->accept(*this, data);
             stream << ")";
             break;
+        case UnaryNumericalFunctionExpression::OperatorType::Cos:
+        case UnaryNumericalFunctionExpression::OperatorType::Sin:
+            STORM_LOG_THROW(options.getMode() == ToCppTranslationMode::KeepType || options.getMode() == ToCppTranslationMode::CastDouble,
+                            storm::exceptions::NotSupportedException, "Trigonometric functions are only supported for doubles.");
+            stream << (expression.getOperatorType() == UnaryNumericalFunctionExpression::OperatorType::Cos ? "std::cos(" : "std::sin(");
+            expression.getOperand()->accept(*this, data);
+            stream << ")";
+            break;
     }
     return boost::none;
 }
@@ -333,9 +377,13 @@ boost::any ToCppVisitor::visit(RationalLiteralExpression const& expression, boos
         case ToCppTranslationMode::KeepType:
             stream << "(static_cast<double>(" << carl::getNum(expression.getValue()) << ")/" << carl::getDenom(expression.getValue()) << ")";
             break;
-        case ToCppTranslationMode::CastDouble:
-            stream << "static_cast<double>(" << expression.getValueAsDouble() << ")";
+        case ToCppTranslationMode::CastDouble: {
+            // Use a local stream such that the formatting of the shared stream is not affected.
+            std::ostringstream valueStream;
+            valueStream << std::scientific << std::setprecision(std::numeric_limits<double>::max_digits10) << expression.getValueAsDouble();
+            stream << "static_cast<double>(" << valueStream.str() << ")";
             break;
+        }
         case ToCppTranslationMode::CastRationalNumber:
             stream << "carl::rationalize<storm::RationalNumber>(\"" << expression.getValue() << "\")";
             break;
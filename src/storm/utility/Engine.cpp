@@ -6,6 +6,7 @@
 #include "storm/modelchecker/prctl/SparseDtmcPrctlModelChecker.h"
 #include "storm/modelchecker/prctl/SparseMdpPrctlModelChecker.h"
 #include "storm/modelchecker/rpatl/SparseSmgRpatlModelChecker.h"
+#include "storm/modelchecker/smc/StatisticalModelChecker.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/models/symbolic/MarkovAutomaton.h"
 #include "storm/models/symbolic/StandardRewardModel.h"
@@ -52,6 +53,8 @@ std::string toString(Engine const& engine) {
             return "expl";
         case Engine::AbstractionRefinement:
             return "abs";
+        case Engine::Smc:
+            return "smc";
         case Engine::Automatic:
             return "automatic";
         case Engine::Unknown:
@@ -95,6 +98,8 @@ storm::builder::BuilderType getBuilderType(Engine const& engine) {
             return storm::builder::BuilderType::Explicit;
         case Engine::AbstractionRefinement:
             return storm::builder::BuilderType::Dd;
+        case Engine::Smc:
+            return storm::builder::BuilderType::Explicit;
         default:
             STORM_LOG_THROW(false, storm::exceptions::InvalidArgumentException, "The given engine has no builder type to it.");
             return storm::builder::BuilderType::Explicit;
@@ -190,6 +195,23 @@ bool canHandle(storm::utility::Engine const& engine, storm::storage::SymbolicMod
                     return false;
             }
             break;
+        case Engine::Smc:
+            if constexpr (!std::is_same_v<ValueType, double>) {
+                return false;
+            } else {
+                switch (modelType) {
+                    case ModelType::DTMC:
+                        return storm::modelchecker::StatisticalModelChecker<storm::models::sparse::Dtmc<ValueType>>::canHandleStatic(checkTask);
+                    case ModelType::CTMC:
+                        return storm::modelchecker::StatisticalModelChecker<storm::models::sparse::Ctmc<ValueType>>::canHandleStatic(checkTask);
+                    case ModelType::MDP:
+                    case ModelType::MA:
+                    case ModelType::POMDP:
+                    case ModelType::SMG:
+                        return false;
+                }
+            }
+            break;
         default:
             STORM_LOG_ERROR("The selected engine " << engine << " is not considered.");
     }
@@ -251,6 +273,7 @@ bool canHandle<storm::RationalFunction>(storm::utility::Engine const& engine, st
             break;
         case Engine::Exploration:
         case Engine::AbstractionRefinement:
+        case Engine::Smc:
             return false;
         default:
             STORM_LOG_ERROR("The selected engine" << engine << " is not considered.");
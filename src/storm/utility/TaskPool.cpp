@@ -0,0 +1,150 @@
+#include "storm/utility/TaskPool.h"
+
+#include <algorithm>
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace utility {
+
+namespace {
+struct CurrentThread {
+    TaskPool const* pool = nullptr;
+    uint64_t index = 0;
+};
+
+thread_local CurrentThread currentThread;
+}  // namespace
+
+TaskPool::TaskPool(uint64_t numberOfThreads) : queuedTasks(0), unfinishedTasks(0), aborted(false), stopped(false) {
+    numberOfThreads = std::max<uint64_t>(1, numberOfThreads);
+    for (uint64_t workerIndex = 0; workerIndex < numberOfThreads; ++workerIndex) {
+        workers.push_back(std::make_unique<Worker>());
+    }
+    threads.reserve(numberOfThreads - 1);
+    for (uint64_t workerIndex = 1; workerIndex < numberOfThreads; ++workerIndex) {
+        threads.emplace_back(&TaskPool::workerLoop, this, workerIndex);
+    }
+}
+
+TaskPool::~TaskPool() {
+    {
+        std::lock_guard<std::mutex> lock(stateMutex);
+        stopped = true;
+    }
+    stateChanged.notify_all();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+void TaskPool::submit(Task task) {
+    uint64_t const workerIndex = currentThread.pool == this ? currentThread.index : 0;
+    ++unfinishedTasks;
+    ++queuedTasks;
+    {
+        std::lock_guard<std::mutex> lock(workers[workerIndex]->mutex);
+        workers[workerIndex]->tasks.push_back(std::move(task));
+    }
+    if (workers.size() > 1) {
+        // Acquiring the mutex ensures that no thread misses the notification between checking for tasks and going to sleep.
+        { std::lock_guard<std::mutex> lock(stateMutex); }
+        stateChanged.notify_one();
+    }
+}
+
+void TaskPool::wait() {
+    STORM_LOG_ASSERT(currentThread.pool != this, "Waiting for a task pool from within one of its tasks.");
+    CurrentThread const previousThread = currentThread;
+    currentThread = {this, 0};
+    while (unfinishedTasks > 0) {
+        Task task;
+        if (tryGetTask(0, task)) {
+            runTask(task);
+        } else {
+            std::unique_lock<std::mutex> lock(stateMutex);
+            stateChanged.wait(lock, [this]() { return queuedTasks > 0 || unfinishedTasks == 0; });
+        }
+    }
+    currentThread = previousThread;
+
+    aborted = false;
+    if (firstException) {
+        std::exception_ptr exception = firstException;
+        firstException = nullptr;
+        std::rethrow_exception(exception);
+    }
+}
+
+uint64_t TaskPool::getNumberOfThreads() const {
+    return workers.size();
+}
+
+uint64_t TaskPool::getCurrentThreadIndex() const {
+    return currentThread.pool == this ? currentThread.index : 0;
+}
+
+bool TaskPool::tryGetTask(uint64_t workerIndex, Task& task) {
+    if (queuedTasks == 0) {
+        return false;
+    }
+    {
+        Worker& worker = *workers[workerIndex];
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        if (!worker.tasks.empty()) {
+            task = std::move(worker.tasks.back());
+            worker.tasks.pop_back();
+            --queuedTasks;
+            return true;
+        }
+    }
+    for (uint64_t offset = 1; offset < workers.size(); ++offset) {
+        Worker& victim = *workers[(workerIndex + offset) % workers.size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.tasks.empty()) {
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+            --queuedTasks;
+            return true;
+        }
+    }
+    return false;
+}
+
+void TaskPool::runTask(Task& task) {
+    if (!aborted) {
+        try {
+            task();
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(stateMutex);
+            if (!firstException) {
+                firstException = std::current_exception();
+            }
+            aborted = true;
+        }
+    }
+    task = nullptr;
+    if (--unfinishedTasks == 0) {
+        { std::lock_guard<std::mutex> lock(stateMutex); }
+        stateChanged.notify_all();
+    }
+}
+
+void TaskPool::workerLoop(uint64_t workerIndex) {
+    currentThread = {this, workerIndex};
+    while (true) {
+        Task task;
+        if (tryGetTask(workerIndex, task)) {
+            runTask(task);
+        } else {
+            std::unique_lock<std::mutex> lock(stateMutex);
+            stateChanged.wait(lock, [this]() { return stopped || queuedTasks > 0; });
+            if (stopped) {
+                return;
+            }
+        }
+    }
+}
+
+}  // namespace utility
+}  // namespace storm
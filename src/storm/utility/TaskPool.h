@@ -0,0 +1,98 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace storm {
+namespace utility {
+
+/*!
+ * A pool of threads that executes tasks. Tasks may submit further tasks to the pool.
+ *
+ * Every thread has its own queue of tasks. A thread processes the most recently submitted task of its own queue first and steals the oldest task from the
+ * queue of another thread if its own queue is empty. This keeps related tasks on the same thread while balancing the load among all threads.
+ *
+ * The thread that calls wait() participates in processing the tasks, i.e., a pool with n threads starts n-1 additional threads.
+ */
+class TaskPool {
+   public:
+    using Task = std::function<void()>;
+
+    /*!
+     * Creates a pool with the given number of threads (including the thread calling wait()).
+     *
+     * @param numberOfThreads The number of threads. Zero is treated as one.
+     */
+    explicit TaskPool(uint64_t numberOfThreads);
+
+    ~TaskPool();
+
+    TaskPool(TaskPool const&) = delete;
+    TaskPool& operator=(TaskPool const&) = delete;
+
+    /*!
+     * Submits a task to the pool. This may be called from within tasks of this pool.
+     */
+    void submit(Task task);
+
+    /*!
+     * Processes tasks until all submitted tasks (including the ones submitted while waiting) are finished.
+     * If a task throws an exception, the tasks that have not been started yet are skipped and the first exception is rethrown.
+     * Must not be called from within a task of this pool.
+     */
+    void wait();
+
+    /*!
+     * Retrieves the number of threads of this pool.
+     */
+    uint64_t getNumberOfThreads() const;
+
+    /*!
+     * Retrieves the index of the calling thread within this pool, i.e., a number in [0, getNumberOfThreads()).
+     * The thread calling wait() has index 0. This can be used to access thread-local data within tasks.
+     */
+    uint64_t getCurrentThreadIndex() const;
+
+   private:
+    struct Worker {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    /*!
+     * Retrieves a task from the queue of the given worker or steals one from another worker.
+     *
+     * @return True if a task was found.
+     */
+    bool tryGetTask(uint64_t workerIndex, Task& task);
+
+    void runTask(Task& task);
+
+    void workerLoop(uint64_t workerIndex);
+
+    std::vector<std::unique_ptr<Worker>> workers;
+    std::vector<std::thread> threads;
+
+    // Used to let idle threads sleep until new tasks arrive or all tasks are finished.
+    std::mutex stateMutex;
+    std::condition_variable stateChanged;
+
+    // The number of tasks that are queued but not started and the number of tasks that are queued or running, respectively.
+    std::atomic<uint64_t> queuedTasks;
+    std::atomic<uint64_t> unfinishedTasks;
+
+    std::atomic<bool> aborted;
+    bool stopped;
+    std::exception_ptr firstException;
+};
+
+}  // namespace utility
+}  // namespace storm
@@ -0,0 +1,94 @@
+#include "storm/utility/sha256.h"
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace storm {
+namespace utility {
+
+namespace {
+std::array<uint32_t, 64> const roundConstants = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5, 0xd807aa98, 0x12835b01, 0x243185be,
+    0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174, 0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa,
+    0x5cb0a9dc, 0x76f988da, 0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967, 0x27b70a85,
+    0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85, 0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3,
+    0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070, 0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f,
+    0x682e6ff3, 0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2};
+
+uint32_t rotateRight(uint32_t value, uint32_t bits) {
+    return (value >> bits) | (value << (32 - bits));
+}
+
+// Processes one block of 64 bytes.
+void compress(std::array<uint32_t, 8>& state, unsigned char const* block) {
+    std::array<uint32_t, 64> w;
+    for (uint64_t i = 0; i < 16; ++i) {
+        w[i] = (static_cast<uint32_t>(block[4 * i]) << 24) | (static_cast<uint32_t>(block[4 * i + 1]) << 16) |
+               (static_cast<uint32_t>(block[4 * i + 2]) << 8) | static_cast<uint32_t>(block[4 * i + 3]);
+    }
+    for (uint64_t i = 16; i < 64; ++i) {
+        uint32_t const s0 = rotateRight(w[i - 15], 7) ^ rotateRight(w[i - 15], 18) ^ (w[i - 15] >> 3);
+        uint32_t const s1 = rotateRight(w[i - 2], 17) ^ rotateRight(w[i - 2], 19) ^ (w[i - 2] >> 10);
+        w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+    }
+
+    uint32_t a = state[0], b = state[1], c = state[2], d = state[3], e = state[4], f = state[5], g = state[6], h = state[7];
+    for (uint64_t i = 0; i < 64; ++i) {
+        uint32_t const s1 = rotateRight(e, 6) ^ rotateRight(e, 11) ^ rotateRight(e, 25);
+        uint32_t const choice = (e & f) ^ (~e & g);
+        uint32_t const temp1 = h + s1 + choice + roundConstants[i] + w[i];
+        uint32_t const s0 = rotateRight(a, 2) ^ rotateRight(a, 13) ^ rotateRight(a, 22);
+        uint32_t const majority = (a & b) ^ (a & c) ^ (b & c);
+        uint32_t const temp2 = s0 + majority;
+        h = g;
+        g = f;
+        f = e;
+        e = d + temp1;
+        d = c;
+        c = b;
+        b = a;
+        a = temp1 + temp2;
+    }
+    state[0] += a;
+    state[1] += b;
+    state[2] += c;
+    state[3] += d;
+    state[4] += e;
+    state[5] += f;
+    state[6] += g;
+    state[7] += h;
+}
+}  // namespace
+
+std::string sha256(std::string const& data) {
+    std::array<uint32_t, 8> state = {0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19};
+
+    // Pad the message with a single one bit, zeros and the message length in bits such that its length is a multiple of 512 bits.
+    std::vector<unsigned char> message(data.begin(), data.end());
+    uint64_t const numberOfBits = static_cast<uint64_t>(data.size()) * 8;
+    message.push_back(0x80);
+    while (message.size() % 64 != 56) {
+        message.push_back(0x00);
+    }
+    for (int shift = 56; shift >= 0; shift -= 8) {
+        message.push_back(static_cast<unsigned char>(numberOfBits >> shift));
+    }
+
+    for (uint64_t offset = 0; offset < message.size(); offset += 64) {
+        compress(state, message.data() + offset);
+    }
+
+    static char const digits[] = "0123456789abcdef";
+    std::string result;
+    result.reserve(64);
+    for (auto const word : state) {
+        for (int shift = 28; shift >= 0; shift -= 4) {
+            result.push_back(digits[(word >> shift) & 0xf]);
+        }
+    }
+    return result;
+}
+
+}  // namespace utility
+}  // namespace storm
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <string>
+
+namespace storm {
+namespace utility {
+
+/*!
+ * Computes the SHA-256 digest (FIPS 180-4) of the given data.
+ * @return The digest as a string of 64 lowercase hexadecimal digits.
+ */
+std::string sha256(std::string const& data);
+
+}  // namespace utility
+}  // namespace storm
@@ -64,7 +64,30 @@ static std::vector<ModularizerTestData> modularizerTestData{
         STORM_TEST_RESOURCES_DIR "/dft/mcs.dft",
         0.9984947969,
     },
+    {
+        "HECS",
+        STORM_TEST_RESOURCES_DIR "/dft/hecs_2_2.dft",
+        0.00021997582,
+    },
 };
 INSTANTIATE_TEST_SUITE_P(BddModularizer, BddModularizerTest, testing::ValuesIn(modularizerTestData), [](auto const &info) { return info.param.testname; });
 
+TEST(DftModularizationCheckerTest, IsomorphicModulesConcurrently) {
+    // Both subsystems contain the same dynamic module
+    auto dft{storm::dft::api::loadDFTGalileoFile<double>(STORM_TEST_RESOURCES_DIR "/dft/hecs_2_2.dft")};
+    storm::dft::modelchecker::DftModularizationChecker<double> sequentialChecker(dft);
+    storm::dft::modelchecker::DftModularizationChecker<double> concurrentChecker(dft, 4, true);
+    // Only one of the two isomorphic modules is analysed if they are merged
+    EXPECT_EQ(2ul, sequentialChecker.getNumberOfDynamicModules());
+    EXPECT_EQ(2ul, sequentialChecker.getNumberOfIsomorphismClasses());
+    EXPECT_EQ(2ul, concurrentChecker.getNumberOfDynamicModules());
+    EXPECT_EQ(1ul, concurrentChecker.getNumberOfIsomorphismClasses());
+    auto const sequentialResults{sequentialChecker.getProbabilitiesAtTimepoints({0.5, 1, 2})};
+    auto const concurrentResults{concurrentChecker.getProbabilitiesAtTimepoints({0.5, 1, 2})};
+    ASSERT_EQ(sequentialResults.size(), concurrentResults.size());
+    for (size_t i{0}; i < sequentialResults.size(); ++i) {
+        EXPECT_NEAR(sequentialResults[i], concurrentResults[i], 1e-10);
+    }
+}
+
 }  // namespace
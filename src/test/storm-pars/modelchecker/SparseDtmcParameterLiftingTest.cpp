@@ -150,6 +150,45 @@ TYPED_TEST(SparseDtmcParameterLiftingTest, Brp_Prob_no_simplification) {
                                            storm::modelchecker::RegionResult::Unknown, true));
 }
 
+TYPED_TEST(SparseDtmcParameterLiftingTest, Brp_Prob_parallelRefinement) {
+    typedef typename TestFixture::ValueType ValueType;
+
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm";
+    std::string formulaAsString = "P<=0.84 [F s=5 ]";
+    std::string constantsAsString = "";  // e.g. pL=0.9,TOACK=0.5
+
+    // Program and formula
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program = storm::utility::prism::preprocess(program, constantsAsString);
+    std::vector<std::shared_ptr<const storm::logic::Formula>> formulas =
+        storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+    std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> model =
+        storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+
+    auto modelParameters = storm::models::sparse::getProbabilityParameters(*model);
+    auto rewParameters = storm::models::sparse::getRewardParameters(*model);
+    modelParameters.insert(rewParameters.begin(), rewParameters.end());
+
+    std::vector<std::shared_ptr<storm::modelchecker::RegionModelChecker<storm::RationalFunction>>> regionCheckers;
+    for (uint64_t thread = 0; thread < 3; ++thread) {
+        regionCheckers.push_back(storm::api::initializeParameterLiftingRegionModelChecker<storm::RationalFunction, ValueType>(
+            this->env(), model, storm::api::createTask<storm::RationalFunction>(formulas[0], true)));
+    }
+
+    // start testing
+    auto region = storm::api::parseRegion<storm::RationalFunction>("0.1<=pL<=0.9,0.2<=pK<=0.95", modelParameters);
+    auto sequentialResult = regionCheckers.front()->performRegionRefinement(this->env(), region, boost::none, 4);
+    auto parallelResult = storm::modelchecker::RegionModelChecker<storm::RationalFunction>::performParallelRegionRefinement(this->env(), regionCheckers,
+                                                                                                                          region, boost::none, 4);
+
+    // Without a coverage threshold, all regions up to the given depth are analyzed, independent of the order in which this happens.
+    EXPECT_EQ(sequentialResult->getRegionResults().size(), parallelResult->getRegionResults().size());
+    EXPECT_EQ(sequentialResult->getSatFraction(), parallelResult->getSatFraction());
+    EXPECT_EQ(sequentialResult->getUnsatFraction(), parallelResult->getUnsatFraction());
+    EXPECT_LT(storm::utility::zero<storm::RationalNumber>(), parallelResult->getSatFraction());
+    EXPECT_LT(storm::utility::zero<storm::RationalNumber>(), parallelResult->getUnsatFraction());
+}
+
 TYPED_TEST(SparseDtmcParameterLiftingTest, Brp_Rew) {
     typedef typename TestFixture::ValueType ValueType;
     std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp_rewards16_2.pm";
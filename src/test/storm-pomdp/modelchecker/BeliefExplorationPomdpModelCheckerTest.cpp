@@ -101,6 +101,26 @@ class FineDoubleVIEnvironment {
     static PreprocessingType const preprocessingType = PreprocessingType::None;
 };
 
+class FixedPointFineDoubleVIEnvironment {
+   public:
+    typedef double ValueType;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-6));
+        return env;
+    }
+    static bool const isExactModelChecking = false;
+    static ValueType precision() {
+        return storm::utility::convertNumber<ValueType>(0.02);
+    }  // there actually aren't any precision guarantees, but we still want to detect if results are weird.
+    static void adaptOptions(storm::pomdp::modelchecker::BeliefExplorationPomdpModelCheckerOptions<ValueType>& options) {
+        options.resolutionInit = 24;
+        options.beliefFixedPointBits = 40;
+    }
+    static PreprocessingType const preprocessingType = PreprocessingType::None;
+};
+
 class RefineDoubleVIEnvironment {
    public:
     typedef double ValueType;
@@ -121,6 +141,46 @@ class RefineDoubleVIEnvironment {
     }
 };
 
+class ParallelRefineDoubleVIEnvironment {
+   public:
+    typedef double ValueType;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-6));
+        return env;
+    }
+    static bool const isExactModelChecking = false;
+    static ValueType precision() {
+        return storm::utility::convertNumber<ValueType>(0.005);
+    }
+    static PreprocessingType const preprocessingType = PreprocessingType::None;
+    static void adaptOptions(storm::pomdp::modelchecker::BeliefExplorationPomdpModelCheckerOptions<ValueType>& options) {
+        options.refine = true;
+        options.refinePrecision = precision();
+        options.explorationThreads = 4;
+    }
+};
+
+class PointBasedDoubleVIEnvironment {
+   public:
+    typedef double ValueType;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-6));
+        return env;
+    }
+    static bool const isExactModelChecking = false;
+    static ValueType precision() {
+        return storm::utility::convertNumber<ValueType>(0.12);
+    }  // there actually aren't any precision guarantees, but we still want to detect if results are weird.
+    static PreprocessingType const preprocessingType = PreprocessingType::None;
+    static void adaptOptions(storm::pomdp::modelchecker::BeliefExplorationPomdpModelCheckerOptions<ValueType>& options) {
+        options.pointBasedBeliefLimit = 200;
+    }
+};
+
 class PreprocessedRefineDoubleVIEnvironment {
    public:
     typedef double ValueType;
@@ -292,8 +352,9 @@ class BeliefExplorationPomdpModelCheckerTest : public ::testing::Test {
 };
 
 typedef ::testing::Types<DefaultDoubleVIEnvironment, SelfloopReductionDefaultDoubleVIEnvironment, QualitativeReductionDefaultDoubleVIEnvironment,
-                         PreprocessedDefaultDoubleVIEnvironment, FineDoubleVIEnvironment, RefineDoubleVIEnvironment, PreprocessedRefineDoubleVIEnvironment,
-                         DefaultDoubleOVIEnvironment, DefaultRationalPIEnvironment, PreprocessedDefaultRationalPIEnvironment>
+                         PreprocessedDefaultDoubleVIEnvironment, FineDoubleVIEnvironment, FixedPointFineDoubleVIEnvironment, RefineDoubleVIEnvironment,
+                         ParallelRefineDoubleVIEnvironment, PointBasedDoubleVIEnvironment, PreprocessedRefineDoubleVIEnvironment, DefaultDoubleOVIEnvironment,
+                         DefaultRationalPIEnvironment, PreprocessedDefaultRationalPIEnvironment>
     TestingTypes;
 
 TYPED_TEST_SUITE(BeliefExplorationPomdpModelCheckerTest, TestingTypes, );
@@ -0,0 +1,110 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm-pomdp/modelchecker/PointBasedPomdpModelChecker.h"
+#include "storm-pomdp/transformer/MakePOMDPCanonic.h"
+#include "storm/api/storm.h"
+
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/exceptions/InvalidOperationException.h"
+
+namespace {
+
+class PointBasedPomdpModelCheckerTest : public ::testing::Test {
+   protected:
+    typedef double ValueType;
+    typedef storm::models::sparse::Pomdp<ValueType> PomdpType;
+
+    void SetUp() override {
+#ifndef STORM_HAVE_Z3
+        GTEST_SKIP() << "Z3 not available.";
+#endif
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-6));
+    }
+
+    struct Input {
+        std::shared_ptr<PomdpType> model;
+        std::shared_ptr<storm::logic::Formula const> formula;
+    };
+
+    Input buildPrism(std::string const& programFile, std::string const& formulaAsString, std::string const& constantsAsString = "") const {
+        storm::prism::Program program = storm::api::parseProgram(programFile);
+        program = storm::utility::prism::preprocess(program, constantsAsString);
+        Input input;
+        input.formula = storm::api::parsePropertiesForPrismProgram(formulaAsString, program).front().getRawFormula();
+        input.model = storm::api::buildSparseModel<ValueType>(program, {input.formula})->template as<PomdpType>();
+        storm::transformer::MakePOMDPCanonic<ValueType> makeCanonic(*input.model);
+        input.model = makeCanonic.transform();
+        return input;
+    }
+
+    // There are no precision guarantees, but we still want to detect if results are weird.
+    ValueType precision() const {
+        return 0.12;
+    }
+    ValueType modelcheckingPrecision() const {
+        return 1e-6;
+    }
+
+    storm::Environment env;
+};
+
+TEST_F(PointBasedPomdpModelCheckerTest, simple_Pmax) {
+    auto data = buildPrism(STORM_TEST_RESOURCES_DIR "/pomdp/simple.prism", "Pmax=? [F \"goal\" ]", "slippery=0");
+    storm::pomdp::modelchecker::PointBasedPomdpModelChecker<PomdpType> checker(*data.model);
+    STORM_SILENT_EXPECT_THROW(checker.getAlphaVectorsAsValueList(), storm::exceptions::InvalidOperationException);
+    auto lowerBound = checker.check(env, *data.formula);
+
+    ValueType expected = 0.7;
+    EXPECT_LE(lowerBound, expected + modelcheckingPrecision());
+    EXPECT_GE(lowerBound, expected - precision());
+    // Every observation keeps at least one alpha vector
+    auto alphaVectors = checker.getAlphaVectorsAsValueList();
+    EXPECT_EQ(data.model->getNrObservations(), alphaVectors.size());
+    for (auto const& observationAlphaVectors : alphaVectors) {
+        EXPECT_FALSE(observationAlphaVectors.empty());
+    }
+}
+
+TEST_F(PointBasedPomdpModelCheckerTest, simple_Pmin) {
+    auto data = buildPrism(STORM_TEST_RESOURCES_DIR "/pomdp/simple.prism", "Pmin=? [F \"goal\" ]", "slippery=0");
+    storm::pomdp::modelchecker::PointBasedPomdpModelChecker<PomdpType> checker(*data.model);
+    auto upperBound = checker.check(env, *data.formula);
+
+    ValueType expected = 0.3;
+    EXPECT_GE(upperBound, expected - modelcheckingPrecision());
+    EXPECT_LE(upperBound, expected + precision());
+}
+
+TEST_F(PointBasedPomdpModelCheckerTest, simple_Rmax) {
+    auto data = buildPrism(STORM_TEST_RESOURCES_DIR "/pomdp/simple.prism", "Rmax=? [F s>4 ]", "slippery=0");
+    storm::pomdp::modelchecker::PointBasedPomdpModelChecker<PomdpType> checker(*data.model);
+    auto lowerBound = checker.check(env, *data.formula);
+
+    ValueType expected = 0.58;
+    EXPECT_LE(lowerBound, expected + modelcheckingPrecision());
+    EXPECT_GE(lowerBound, expected - precision());
+}
+
+TEST_F(PointBasedPomdpModelCheckerTest, simple_Rmin) {
+    auto data = buildPrism(STORM_TEST_RESOURCES_DIR "/pomdp/simple.prism", "Rmin=? [F s>4 ]", "slippery=0");
+    storm::pomdp::modelchecker::PointBasedPomdpModelChecker<PomdpType> checker(*data.model);
+    auto upperBound = checker.check(env, *data.formula);
+
+    ValueType expected = 0.38;
+    EXPECT_GE(upperBound, expected - modelcheckingPrecision());
+    EXPECT_LE(upperBound, expected + precision());
+}
+
+TEST_F(PointBasedPomdpModelCheckerTest, simple_Pmax_BeliefLimit) {
+    auto data = buildPrism(STORM_TEST_RESOURCES_DIR "/pomdp/simple.prism", "Pmax=? [F \"goal\" ]", "slippery=0");
+    storm::pomdp::modelchecker::PointBasedPomdpModelCheckerOptions<ValueType> options;
+    options.beliefLimit = 1;
+    storm::pomdp::modelchecker::PointBasedPomdpModelChecker<PomdpType> checker(*data.model, options);
+    // With a single belief, the bound is still sound
+    EXPECT_LE(checker.check(env, *data.formula), 0.7 + modelcheckingPrecision());
+}
+
+}  // namespace
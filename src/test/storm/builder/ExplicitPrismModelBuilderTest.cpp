@@ -1,4 +1,6 @@
 #include <storm/generator/PrismNextStateGenerator.h>
+#include <cstdlib>
+#include <filesystem>
 #include "storm-config.h"
 #include "storm-parsers/parser/PrismParser.h"
 #include "storm/builder/ExplicitModelBuilder.h"
@@ -123,6 +125,121 @@ TEST_F(ExplicitPrismModelBuilderTest, Mdp) {
     EXPECT_EQ(12ul, model->getNumberOfChoices());
 }
 
+TEST_F(ExplicitPrismModelBuilderTest, ParallelExploration) {
+    storm::builder::ExplicitModelBuilder<double>::Options parallelOptions;
+    parallelOptions.numberOfThreads = 4;
+    storm::generator::NextStateGeneratorOptions generatorOptions(true, true);
+
+    for (std::string const& file : {"/dtmc/crowds-5-5.pm", "/mdp/firewire3-0.5.nm", "/mdp/csma2-2.nm", "/mdp/enumerate_init.prism"}) {
+        storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR + file);
+        auto sequentialModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).build();
+        auto parallelModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, parallelOptions).build();
+
+        // The parallel exploration has to yield exactly the same model, including the numbering of the states.
+        EXPECT_EQ(sequentialModel->getNumberOfStates(), parallelModel->getNumberOfStates()) << file;
+        EXPECT_EQ(sequentialModel->getTransitionMatrix(), parallelModel->getTransitionMatrix()) << file;
+        EXPECT_EQ(sequentialModel->getStateLabeling(), parallelModel->getStateLabeling()) << file;
+        ASSERT_EQ(sequentialModel->getNumberOfRewardModels(), parallelModel->getNumberOfRewardModels()) << file;
+        for (auto const& rewardModel : sequentialModel->getRewardModels()) {
+            auto const& parallelRewardModel = parallelModel->getRewardModel(rewardModel.first);
+            ASSERT_EQ(rewardModel.second.hasStateRewards(), parallelRewardModel.hasStateRewards()) << file;
+            if (rewardModel.second.hasStateRewards()) {
+                EXPECT_EQ(rewardModel.second.getStateRewardVector(), parallelRewardModel.getStateRewardVector()) << file;
+            }
+            ASSERT_EQ(rewardModel.second.hasStateActionRewards(), parallelRewardModel.hasStateActionRewards()) << file;
+            if (rewardModel.second.hasStateActionRewards()) {
+                EXPECT_EQ(rewardModel.second.getStateActionRewardVector(), parallelRewardModel.getStateActionRewardVector()) << file;
+            }
+        }
+
+        // The same holds if the threads share a concurrent map for the newly discovered states.
+        auto concurrentStorageOptions = parallelOptions;
+        concurrentStorageOptions.useConcurrentStateStorage = true;
+        auto concurrentStorageModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, concurrentStorageOptions).build();
+        EXPECT_EQ(sequentialModel->getTransitionMatrix(), concurrentStorageModel->getTransitionMatrix()) << file;
+        EXPECT_EQ(sequentialModel->getStateLabeling(), concurrentStorageModel->getStateLabeling()) << file;
+    }
+}
+
+TEST_F(ExplicitPrismModelBuilderTest, JitCompilation) {
+    if (std::system("c++ --version > /dev/null 2>&1") != 0) {
+        GTEST_SKIP() << "No compiler available.";
+    }
+    // Use a fresh cache directory such that we can check that the expressions were actually compiled.
+    std::string temporaryDirectory = (std::filesystem::temp_directory_path() / "storm-jit-test-XXXXXX").string();
+    ASSERT_NE(nullptr, mkdtemp(temporaryDirectory.data()));
+    std::filesystem::path const cacheDirectory = std::filesystem::path(temporaryDirectory) / "cache";
+
+    storm::generator::NextStateGeneratorOptions generatorOptions(true, true);
+    storm::generator::NextStateGeneratorOptions jitOptions(true, true);
+    jitOptions.setJitCompilation();
+    jitOptions.setJitCacheDirectory(cacheDirectory.string());
+
+    uint64_t numberOfLibraries = 0;
+    for (std::string const& file : {"/dtmc/crowds-5-5.pm", "/dtmc/brp-16-2.pm", "/mdp/csma2-2.nm", "/ctmc/cluster2.sm"}) {
+        storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR + file, true);
+        auto interpretedModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).build();
+        auto compiledModel = storm::builder::ExplicitModelBuilder<double>(program, jitOptions).build();
+
+        // Compiled expressions have to yield exactly the same model.
+        EXPECT_EQ(interpretedModel->getNumberOfStates(), compiledModel->getNumberOfStates()) << file;
+        EXPECT_EQ(interpretedModel->getTransitionMatrix(), compiledModel->getTransitionMatrix()) << file;
+        EXPECT_EQ(interpretedModel->getStateLabeling(), compiledModel->getStateLabeling()) << file;
+
+        // Each program yields a new library whose source is stored next to it.
+        ++numberOfLibraries;
+        uint64_t libraries = 0;
+        ASSERT_TRUE(std::filesystem::is_directory(cacheDirectory)) << file;
+        for (auto const& entry : std::filesystem::directory_iterator(cacheDirectory)) {
+            if (entry.path().extension() == ".so") {
+                ++libraries;
+                auto sourcePath = entry.path();
+                EXPECT_TRUE(std::filesystem::is_regular_file(sourcePath.replace_extension(".cpp"))) << entry.path();
+            }
+        }
+        EXPECT_EQ(numberOfLibraries, libraries) << file;
+    }
+    // The cache directory is only accessible by the current user.
+    EXPECT_EQ(std::filesystem::perms::owner_all, std::filesystem::status(cacheDirectory).permissions() & std::filesystem::perms::all);
+    std::filesystem::remove_all(temporaryDirectory);
+}
+
+TEST_F(ExplicitPrismModelBuilderTest, BytecodeEvaluation) {
+    storm::generator::NextStateGeneratorOptions generatorOptions(true, true);
+    storm::generator::NextStateGeneratorOptions bytecodeOptions(true, true);
+    bytecodeOptions.setBytecodeEvaluation();
+
+    for (std::string const& file : {"/dtmc/crowds-5-5.pm", "/dtmc/nand-5-2.pm", "/mdp/firewire3-0.5.nm", "/mdp/csma2-2.nm", "/ctmc/polling2.sm"}) {
+        storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR + file, true);
+        auto interpretedModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).build();
+        auto bytecodeModel = storm::builder::ExplicitModelBuilder<double>(program, bytecodeOptions).build();
+
+        // Evaluating the expressions with bytecode has to yield exactly the same model.
+        EXPECT_EQ(interpretedModel->getNumberOfStates(), bytecodeModel->getNumberOfStates()) << file;
+        EXPECT_EQ(interpretedModel->getTransitionMatrix(), bytecodeModel->getTransitionMatrix()) << file;
+        EXPECT_EQ(interpretedModel->getStateLabeling(), bytecodeModel->getStateLabeling()) << file;
+    }
+}
+
+TEST_F(ExplicitPrismModelBuilderTest, BytecodeEvaluationNonFiniteRounding) {
+    // The untaken branches round an infinite and a huge value to an integer.
+    std::string input = R"(dtmc
+module test
+    x : [0..3] init 0;
+    [] x<3 -> 0.5 : (x'=(x=1 ? 2 : min(3, max(0, floor(1/(x-1)))))) + 0.5 : (x'=(x=2 ? 3 : min(3, ceil(pow(10.0, 30*(x-1))))));
+    [] x=3 -> 1 : true;
+endmodule
+)";
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(input, "bytecode.pm");
+    storm::generator::NextStateGeneratorOptions generatorOptions(true, true);
+    storm::generator::NextStateGeneratorOptions bytecodeOptions(true, true);
+    bytecodeOptions.setBytecodeEvaluation();
+    auto interpretedModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).build();
+    auto bytecodeModel = storm::builder::ExplicitModelBuilder<double>(program, bytecodeOptions).build();
+    EXPECT_EQ(interpretedModel->getNumberOfStates(), bytecodeModel->getNumberOfStates());
+    EXPECT_EQ(interpretedModel->getTransitionMatrix(), bytecodeModel->getTransitionMatrix());
+}
+
 TEST_F(ExplicitPrismModelBuilderTest, Ma) {
     storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/ma/simple.ma");
 
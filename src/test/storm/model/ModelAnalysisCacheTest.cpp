@@ -0,0 +1,105 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <thread>
+
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/ModelAnalysisCache.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/MaximalEndComponentDecomposition.h"
+#include "storm/utility/graph.h"
+
+TEST(ModelAnalysisCacheTest, SharesResults) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    auto mdp = storm::builder::ExplicitModelBuilder<double>(program).build()->as<storm::models::sparse::Mdp<double>>();
+    auto const& matrix = mdp->getTransitionMatrix();
+    storm::models::sparse::ModelAnalysisCache<double> cache(matrix, storm::models::sparse::ModelAnalysisCache<double>::defaultMemoryBudget);
+    EXPECT_TRUE(cache.isCacheFor(matrix));
+    EXPECT_EQ(0ull, cache.getMemoryUsage());
+
+    storm::storage::BitVector phiStates(mdp->getNumberOfStates(), true);
+    storm::storage::BitVector psiStates = mdp->getStates("two");
+    auto backwardTransitions = cache.getBackwardTransitions();
+    EXPECT_EQ(backwardTransitions, cache.getBackwardTransitions());
+    EXPECT_EQ(matrix.transpose(true), *backwardTransitions);
+
+    auto prob01Max = cache.getProb01(storm::OptimizationDirection::Maximize, phiStates, psiStates);
+    EXPECT_EQ(prob01Max, cache.getProb01(storm::OptimizationDirection::Maximize, phiStates, psiStates));
+    EXPECT_EQ(storm::utility::graph::performProb01Max(*mdp, phiStates, psiStates), *prob01Max);
+    auto prob01Min = cache.getProb01(storm::OptimizationDirection::Minimize, phiStates, psiStates);
+    EXPECT_NE(prob01Max, prob01Min);
+    EXPECT_EQ(storm::utility::graph::performProb01Min(*mdp, phiStates, psiStates), *prob01Min);
+
+    storm::storage::BitVector allStates(mdp->getNumberOfStates(), true);
+    auto mecs = cache.getMaximalEndComponentDecomposition(allStates);
+    EXPECT_EQ(mecs, cache.getMaximalEndComponentDecomposition(allStates));
+    EXPECT_EQ(storm::storage::MaximalEndComponentDecomposition<double>(*mdp).size(), mecs->size());
+
+    EXPECT_GT(cache.getMemoryUsage(), 0ull);
+    cache.clear();
+    EXPECT_EQ(0ull, cache.getMemoryUsage());
+    // Retrieved results stay valid after they have been removed.
+    EXPECT_EQ(matrix.transpose(true), *backwardTransitions);
+    EXPECT_NE(backwardTransitions, cache.getBackwardTransitions());
+}
+
+TEST(ModelAnalysisCacheTest, RespectsMemoryBudget) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    auto mdp = storm::builder::ExplicitModelBuilder<double>(program).build()->as<storm::models::sparse::Mdp<double>>();
+    storm::storage::BitVector phiStates(mdp->getNumberOfStates(), true);
+
+    // Without budget, nothing is kept.
+    storm::models::sparse::ModelAnalysisCache<double> emptyCache(mdp->getTransitionMatrix(), 0);
+    auto backwardTransitions = emptyCache.getBackwardTransitions();
+    EXPECT_EQ(0ull, emptyCache.getMemoryUsage());
+    EXPECT_NE(backwardTransitions, emptyCache.getBackwardTransitions());
+
+    // With a budget for only a few results, the least recently used ones are evicted.
+    storm::models::sparse::ModelAnalysisCache<double> cache(mdp->getTransitionMatrix(), 1024ull * 1024ull);
+    backwardTransitions = cache.getBackwardTransitions();
+    uint64_t budget = cache.getMemoryUsage() + 1;
+    storm::models::sparse::ModelAnalysisCache<double> smallCache(mdp->getTransitionMatrix(), budget);
+    backwardTransitions = smallCache.getBackwardTransitions();
+    auto prob01 = smallCache.getProb01(storm::OptimizationDirection::Maximize, phiStates, mdp->getStates("two"));
+    EXPECT_LE(smallCache.getMemoryUsage(), budget);
+    EXPECT_EQ(prob01, smallCache.getProb01(storm::OptimizationDirection::Maximize, phiStates, mdp->getStates("two")));
+    EXPECT_NE(backwardTransitions, smallCache.getBackwardTransitions());
+}
+
+TEST(ModelAnalysisCacheTest, ModelCache) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    auto mdp = storm::builder::ExplicitModelBuilder<double>(program).build()->as<storm::models::sparse::Mdp<double>>();
+    auto const& constMdp = *mdp;
+    auto cache = mdp->getAnalysisCache();
+    EXPECT_EQ(cache, mdp->getAnalysisCache());
+
+    // The backward transitions of the model are not kept in the cache.
+    EXPECT_EQ(constMdp.getTransitionMatrix().transpose(true), constMdp.getBackwardTransitions());
+    EXPECT_EQ(0ull, cache->getMemoryUsage());
+
+    // Copies of the model get their own cache.
+    storm::models::sparse::Mdp<double> copy(*mdp);
+    EXPECT_NE(cache, copy.getAnalysisCache());
+    EXPECT_TRUE(copy.getAnalysisCache()->isCacheFor(copy.getTransitionMatrix()));
+
+    // Reading the matrix keeps the cache, retrieving it for modification discards it.
+    EXPECT_EQ(cache, mdp->getAnalysisCache());
+    mdp->getTransitionMatrix();
+    EXPECT_NE(cache, mdp->getAnalysisCache());
+
+    // Concurrent retrievals yield the same cache.
+    mdp->invalidateAnalysisCache();
+    std::vector<std::shared_ptr<storm::models::sparse::ModelAnalysisCache<double>>> caches(4);
+    std::vector<std::thread> threads;
+    for (uint64_t i = 0; i < caches.size(); ++i) {
+        threads.emplace_back([&mdp, &caches, i]() { caches[i] = mdp->getAnalysisCache(); });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (auto const& c : caches) {
+        EXPECT_EQ(caches.front(), c);
+    }
+}
@@ -475,6 +475,35 @@ TEST(CtmcCslModelCheckerTest, TransientProbabilities) {
     EXPECT_NEAR(0.595957, result[1], 1e-6);
 }
 
+TEST(CtmcCslModelCheckerTest, BoundedUntilProbabilitiesForTimeBounds) {
+    storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/ctmc/tandem5.sm", true);
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram("P=? [ F<=10 \"network_full\" ]", program));
+    auto ctmc = storm::api::buildSparseModel<double>(program, formulas)->as<storm::models::sparse::Ctmc<double>>();
+    storm::storage::BitVector phiStates(ctmc->getNumberOfStates(), true);
+    storm::storage::BitVector psiStates = ctmc->getStates("network_full");
+    uint64_t initialState = *ctmc->getInitialStates().begin();
+    storm::Environment env;
+
+    // Includes a zero and a repeated time bound.
+    std::vector<double> timeBounds = {0.0, 0.5, 1.0, 2.5, 10.0, 10.0, 40.0};
+    std::vector<std::vector<double>> results = storm::modelchecker::helper::SparseCtmcCslHelper::computeBoundedUntilProbabilitiesForTimeBounds(
+        env, storm::solver::SolveGoal<double>(), ctmc->getTransitionMatrix(), ctmc->getBackwardTransitions(), phiStates, psiStates, ctmc->getExitRateVector(),
+        timeBounds);
+    ASSERT_EQ(timeBounds.size(), results.size());
+    EXPECT_NEAR(0.015446370562428037, results[4][initialState], 1e-6);
+
+    // The results have to coincide with the ones obtained for each time bound separately.
+    for (uint64_t boundIndex = 0; boundIndex < timeBounds.size(); ++boundIndex) {
+        std::vector<double> expected = storm::modelchecker::helper::SparseCtmcCslHelper::computeBoundedUntilProbabilities(
+            env, storm::solver::SolveGoal<double>(), ctmc->getTransitionMatrix(), ctmc->getBackwardTransitions(), phiStates, psiStates,
+            ctmc->getExitRateVector(), false, 0.0, timeBounds[boundIndex]);
+        ASSERT_EQ(expected.size(), results[boundIndex].size());
+        for (uint64_t state = 0; state < expected.size(); ++state) {
+            EXPECT_NEAR(expected[state], results[boundIndex][state], 1e-10) << "for time bound " << timeBounds[boundIndex] << " in state " << state;
+        }
+    }
+}
+
 TYPED_TEST(CtmcCslModelCheckerTest, LtlProbabilitiesEmbedded) {
 #ifdef STORM_HAVE_LTL_MODELCHECKING_SUPPORT
     std::string formulasString = "P=?  [ X F (!\"down\" U \"fail_sensors\") ]";
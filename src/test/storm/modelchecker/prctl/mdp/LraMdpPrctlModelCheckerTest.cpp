@@ -39,6 +39,21 @@ class SparseValueTypeValueIterationEnvironment {
     }
 };
 
+class SparseValueTypeConcurrentValueIterationEnvironment {
+   public:
+    static const bool isExact = false;
+    typedef double ValueType;
+    typedef storm::models::sparse::Mdp<ValueType> ModelType;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().lra().setNondetLraMethod(storm::solver::LraMethod::ValueIteration);
+        env.solver().lra().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-10));
+        env.solver().lra().setMecBatchSize(8);
+        env.solver().setNumberOfThreads(4);
+        return env;
+    }
+};
+
 class SparseValueTypeLinearProgrammingEnvironment {
    public:
     static const bool isExact = false;
@@ -126,7 +141,8 @@ class LraMdpPrctlModelCheckerTest : public ::testing::Test {
     storm::Environment _environment;
 };
 
-typedef ::testing::Types<SparseValueTypeValueIterationEnvironment, SparseValueTypeLinearProgrammingEnvironment, SparseSoundEnvironment
+typedef ::testing::Types<SparseValueTypeValueIterationEnvironment, SparseValueTypeConcurrentValueIterationEnvironment,
+                         SparseValueTypeLinearProgrammingEnvironment, SparseSoundEnvironment
 #ifdef STORM_HAVE_Z3_OPTIMIZE
                          ,
                          SparseRationalLinearProgrammingEnvironment
@@ -53,6 +53,30 @@ class DoublePIEnvironment {
         return env;
     }
 };
+class DoubleConcurrentViEnvironment {
+   public:
+    typedef double ValueType;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+        env.solver().lra().setNondetLraMethod(storm::solver::LraMethod::ValueIteration);
+        env.solver().setNumberOfThreads(4);
+        return env;
+    }
+};
+class DoubleBatchedViEnvironment {
+   public:
+    typedef double ValueType;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+        env.solver().lra().setNondetLraMethod(storm::solver::LraMethod::ValueIteration);
+        env.solver().lra().setMecBatchSize(8);
+        return env;
+    }
+};
 class RationalPIEnvironment {
    public:
     typedef storm::RationalNumber ValueType;
@@ -116,7 +140,8 @@ class SchedulerGenerationMdpPrctlModelCheckerTest : public ::testing::Test {
     storm::Environment _environment;
 };
 
-typedef ::testing::Types<DoubleViEnvironment, DoubleSoundViEnvironment, DoublePIEnvironment, RationalPIEnvironment
+typedef ::testing::Types<DoubleViEnvironment, DoubleSoundViEnvironment, DoublePIEnvironment, DoubleConcurrentViEnvironment, DoubleBatchedViEnvironment,
+                         RationalPIEnvironment
                          // RationalRationalSearchEnvironment
                          >
     TestingTypes;
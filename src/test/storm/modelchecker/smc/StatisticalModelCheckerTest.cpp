@@ -0,0 +1,171 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-parsers/api/properties.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/api/properties.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
+#include "storm/environment/modelchecker/StatisticalModelCheckerEnvironment.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/logic/Formulas.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/StatisticalCheckResult.h"
+#include "storm/modelchecker/smc/StatisticalModelChecker.h"
+#include "storm/modelchecker/smc/StatisticalTests.h"
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/jani/Property.h"
+
+namespace {
+
+class StatisticalModelCheckerTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+#ifndef STORM_HAVE_Z3
+        GTEST_SKIP() << "Z3 not available.";
+#endif
+        env.modelchecker().smc().setSeed(42);
+        env.modelchecker().smc().setNumberOfThreads(1);
+    }
+
+    std::vector<std::shared_ptr<storm::logic::Formula const>> parseFormulas(storm::prism::Program const& program, std::string const& formulasString) {
+        return storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasString, program));
+    }
+
+    storm::Environment env;
+};
+
+TEST_F(StatisticalModelCheckerTest, Die) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    auto formulas = parseFormulas(program, "P=? [F \"one\"]; P=? [F<=3 \"done\"]; R{\"coin_flips\"}=? [F \"done\"]; R{\"coin_flips\"}=? [C<=2]");
+    storm::modelchecker::StatisticalModelChecker<storm::models::sparse::Dtmc<double>> checker(program);
+    double epsilon = env.modelchecker().smc().getEpsilon();
+
+    for (auto const& formula : formulas) {
+        EXPECT_TRUE(checker.canHandle(storm::modelchecker::CheckTask<>(*formula, true)));
+    }
+
+    auto result = checker.check(env, storm::modelchecker::CheckTask<>(*formulas[0], true));
+    auto const& statisticalResult1 = result->asStatisticalCheckResult<double>();
+    EXPECT_NEAR(1.0 / 6.0, statisticalResult1.getEstimate(), epsilon);
+    EXPECT_LE(statisticalResult1.getLowerBound(), statisticalResult1.getEstimate());
+    EXPECT_GE(statisticalResult1.getUpperBound(), statisticalResult1.getEstimate());
+    EXPECT_EQ(storm::modelchecker::smc::getChernoffHoeffdingSampleCount(epsilon, env.modelchecker().smc().getConfidence()),
+              statisticalResult1.getNumberOfSamples());
+
+    result = checker.check(env, storm::modelchecker::CheckTask<>(*formulas[1], true));
+    EXPECT_NEAR(0.75, result->asStatisticalCheckResult<double>().getEstimate(), epsilon);
+
+    env.modelchecker().smc().setEpsilon(0.05);
+    result = checker.check(env, storm::modelchecker::CheckTask<>(*formulas[2], true));
+    EXPECT_NEAR(11.0 / 3.0, result->asStatisticalCheckResult<double>().getEstimate(), 0.05);
+
+    result = checker.check(env, storm::modelchecker::CheckTask<>(*formulas[3], true));
+    EXPECT_NEAR(2.0, result->asStatisticalCheckResult<double>().getEstimate(), 0.05);
+}
+
+TEST_F(StatisticalModelCheckerTest, DieLowerStepBound) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    auto formulas = parseFormulas(program, "P=? [F>=3 \"done\"]; P=? [!\"done\" U>=4 \"done\"]");
+    storm::modelchecker::StatisticalModelChecker<storm::models::sparse::Dtmc<double>> checker(program);
+    double epsilon = env.modelchecker().smc().getEpsilon();
+
+    for (auto const& formula : formulas) {
+        EXPECT_TRUE(checker.canHandle(storm::modelchecker::CheckTask<>(*formula, true)));
+    }
+
+    // Formulas without an upper step bound are sampled until the path is decided.
+    auto result = checker.check(env, storm::modelchecker::CheckTask<>(*formulas[0], true));
+    EXPECT_NEAR(1.0, result->asStatisticalCheckResult<double>().getEstimate(), epsilon);
+
+    result = checker.check(env, storm::modelchecker::CheckTask<>(*formulas[1], true));
+    EXPECT_NEAR(0.25, result->asStatisticalCheckResult<double>().getEstimate(), epsilon);
+}
+
+TEST_F(StatisticalModelCheckerTest, DieMultipleThreads) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    auto formulas = parseFormulas(program, "P=? [F \"two\"]");
+    storm::modelchecker::StatisticalModelChecker<storm::models::sparse::Dtmc<double>> checker(program);
+    env.modelchecker().smc().setStoppingCriterion(storm::modelchecker::smc::StoppingCriterion::ClopperPearson);
+    env.modelchecker().smc().setNumberOfThreads(4);
+
+    auto result = checker.check(env, storm::modelchecker::CheckTask<>(*formulas[0], true));
+    auto const& statisticalResult = result->asStatisticalCheckResult<double>();
+    EXPECT_NEAR(1.0 / 6.0, statisticalResult.getEstimate(), env.modelchecker().smc().getEpsilon());
+    EXPECT_LE(statisticalResult.getUpperBound() - statisticalResult.getLowerBound(), 2 * env.modelchecker().smc().getEpsilon());
+}
+
+TEST_F(StatisticalModelCheckerTest, DieSprt) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    auto formulas = parseFormulas(program, "P>=0.2 [F \"three\"]; P<0.2 [F \"three\"]; P>0.1 [F<=4 \"three\"]");
+    storm::modelchecker::StatisticalModelChecker<storm::models::sparse::Dtmc<double>> checker(program);
+    env.modelchecker().smc().setStoppingCriterion(storm::modelchecker::smc::StoppingCriterion::Sprt);
+
+    auto result = checker.check(env, storm::modelchecker::CheckTask<>(*formulas[0], true));
+    EXPECT_FALSE(result->asExplicitQualitativeCheckResult()[0]);
+
+    result = checker.check(env, storm::modelchecker::CheckTask<>(*formulas[1], true));
+    EXPECT_TRUE(result->asExplicitQualitativeCheckResult()[0]);
+
+    result = checker.check(env, storm::modelchecker::CheckTask<>(*formulas[2], true));
+    EXPECT_TRUE(result->asExplicitQualitativeCheckResult()[0]);
+}
+
+TEST_F(StatisticalModelCheckerTest, Tandem) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/ctmc/tandem5.sm");
+    auto formulas = parseFormulas(program, "P=? [ F<=10 \"network_full\" ]; P=? [ F<=10 \"first_queue_full\" ]; R=? [I=10]");
+    storm::modelchecker::StatisticalModelChecker<storm::models::sparse::Ctmc<double>> checker(program);
+    env.modelchecker().smc().setEpsilon(0.02);
+
+    auto result = checker.check(env, storm::modelchecker::CheckTask<>(*formulas[0], true));
+    EXPECT_NEAR(0.015446370562428037, result->asStatisticalCheckResult<double>().getEstimate(), 0.02);
+
+    result = checker.check(env, storm::modelchecker::CheckTask<>(*formulas[1], true));
+    EXPECT_NEAR(0.999999837225515, result->asStatisticalCheckResult<double>().getEstimate(), 0.02);
+
+    env.modelchecker().smc().setEpsilon(0.1);
+    result = checker.check(env, storm::modelchecker::CheckTask<>(*formulas[2], true));
+    EXPECT_NEAR(5.679243850315877, result->asStatisticalCheckResult<double>().getEstimate(), 0.1);
+}
+
+TEST_F(StatisticalModelCheckerTest, Unsupported) {
+    storm::prism::Program dtmc = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    auto formulas = parseFormulas(dtmc, "P=? [F P>0.5 [F \"one\"]]; P=? [X \"one\"]");
+    storm::modelchecker::StatisticalModelChecker<storm::models::sparse::Dtmc<double>> checker(dtmc);
+    for (auto const& formula : formulas) {
+        EXPECT_FALSE(checker.canHandle(storm::modelchecker::CheckTask<>(*formula, true)));
+    }
+    EXPECT_FALSE(checker.canHandle(storm::modelchecker::CheckTask<>(*formulas[0], false)));
+
+    storm::prism::Program mdp = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    STORM_SILENT_EXPECT_THROW(storm::modelchecker::StatisticalModelChecker<storm::models::sparse::Dtmc<double>> mdpChecker(mdp),
+                              storm::exceptions::NotSupportedException);
+}
+
+TEST(StatisticalTestsTest, Intervals) {
+    EXPECT_EQ(18445ull, storm::modelchecker::smc::getChernoffHoeffdingSampleCount(0.01, 0.95));
+
+    auto interval = storm::modelchecker::smc::getClopperPearsonInterval(0, 10, 0.95);
+    EXPECT_EQ(0.0, interval.first);
+    EXPECT_NEAR(1.0 - std::pow(0.025, 0.1), interval.second, 1e-10);
+
+    interval = storm::modelchecker::smc::getClopperPearsonInterval(10, 10, 0.95);
+    EXPECT_NEAR(std::pow(0.025, 0.1), interval.first, 1e-10);
+    EXPECT_EQ(1.0, interval.second);
+
+    interval = storm::modelchecker::smc::getClopperPearsonInterval(50, 100, 0.95);
+    EXPECT_LT(interval.first, 0.5);
+    EXPECT_GT(interval.second, 0.5);
+    EXPECT_NEAR(0.5 - interval.first, interval.second - 0.5, 1e-10);
+
+    storm::modelchecker::smc::SequentialProbabilityRatioTest test(0.5, 0.05, 0.01);
+    EXPECT_FALSE(test.hasDecision());
+    test.addSamples(1000, 1000);
+    EXPECT_TRUE(test.hasDecision());
+    EXPECT_TRUE(test.isAboveThreshold());
+}
+
+}  // namespace
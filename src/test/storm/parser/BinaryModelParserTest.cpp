@@ -0,0 +1,232 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <filesystem>
+#include <fstream>
+#include <functional>
+
+#include "storm-parsers/parser/BinaryModelParser.h"
+#include "storm-parsers/parser/DirectEncodingParser.h"
+#include "storm/exceptions/WrongFormatException.h"
+#include "storm/io/BinaryModelExporter.h"
+#include "storm/io/BinaryModelFormat.h"
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+
+namespace {
+
+class BinaryModelParserTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        std::string const testName = ::testing::UnitTest::GetInstance()->current_test_info()->name();
+        filename = (std::filesystem::temp_directory_path() / ("storm-binary-model-test-" + testName + ".drb")).string();
+    }
+
+    void TearDown() override {
+        std::filesystem::remove(filename);
+    }
+
+    std::shared_ptr<storm::models::sparse::Model<double>> exportAndLoad(std::shared_ptr<storm::models::sparse::Model<double>> const& model) {
+        std::ofstream stream(filename, std::ios::out | std::ios::binary);
+        storm::exporter::explicitExportSparseModelBinary(stream, model);
+        stream.close();
+        return storm::parser::BinaryModelParser::parseModel(filename);
+    }
+
+    /*!
+     * Exports the model, lets the given function modify the raw content of the file, and writes the modified content back.
+     */
+    void exportAndModify(std::shared_ptr<storm::models::sparse::Model<double>> const& model, std::function<void(std::vector<char>&)> const& modify) {
+        std::ofstream outStream(filename, std::ios::out | std::ios::binary);
+        storm::exporter::explicitExportSparseModelBinary(outStream, model);
+        outStream.close();
+        std::ifstream inStream(filename, std::ios::in | std::ios::binary);
+        std::vector<char> content((std::istreambuf_iterator<char>(inStream)), std::istreambuf_iterator<char>());
+        inStream.close();
+        modify(content);
+        outStream.open(filename, std::ios::out | std::ios::binary | std::ios::trunc);
+        outStream.write(content.data(), content.size());
+        outStream.close();
+    }
+
+    static storm::exporter::BinaryModelFormat::Header& getHeader(std::vector<char>& content) {
+        return *reinterpret_cast<storm::exporter::BinaryModelFormat::Header*>(content.data());
+    }
+
+    static uint64_t* getSectionData(std::vector<char>& content, storm::exporter::BinaryModelFormat::SectionKind kind) {
+        using storm::exporter::BinaryModelFormat;
+        auto const* sections = reinterpret_cast<BinaryModelFormat::Section const*>(content.data() + sizeof(BinaryModelFormat::Header));
+        for (uint64_t i = 0; i < getHeader(content).numberOfSections; ++i) {
+            if (sections[i].kind == static_cast<uint32_t>(kind)) {
+                return reinterpret_cast<uint64_t*>(content.data() + sections[i].offset);
+            }
+        }
+        return nullptr;
+    }
+
+    /*!
+     * Returns the position of the first entry of the first row of the transition matrix that has at least two entries.
+     * If there is no such row, the number of entries is returned.
+     */
+    static uint64_t getFirstEntryOfRowWithTwoEntries(storm::models::sparse::Model<double> const& model) {
+        auto const& matrix = model.getTransitionMatrix();
+        uint64_t entry = 0;
+        for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+            if (matrix.getRow(row).getNumberOfEntries() >= 2) {
+                return entry;
+            }
+            entry += matrix.getRow(row).getNumberOfEntries();
+        }
+        return entry;
+    }
+
+    void expectEqualModels(storm::models::sparse::Model<double> const& expected, storm::models::sparse::Model<double> const& actual) {
+        ASSERT_EQ(expected.getType(), actual.getType());
+        EXPECT_EQ(expected.getNumberOfStates(), actual.getNumberOfStates());
+        EXPECT_EQ(expected.getNumberOfChoices(), actual.getNumberOfChoices());
+        EXPECT_EQ(expected.getTransitionMatrix().hasTrivialRowGrouping(), actual.getTransitionMatrix().hasTrivialRowGrouping());
+        EXPECT_TRUE(expected.getTransitionMatrix() == actual.getTransitionMatrix());
+        EXPECT_TRUE(expected.getStateLabeling() == actual.getStateLabeling());
+        EXPECT_EQ(expected.hasChoiceLabeling(), actual.hasChoiceLabeling());
+        if (expected.hasChoiceLabeling() && actual.hasChoiceLabeling()) {
+            EXPECT_TRUE(expected.getChoiceLabeling() == actual.getChoiceLabeling());
+        }
+        ASSERT_EQ(expected.getNumberOfRewardModels(), actual.getNumberOfRewardModels());
+        for (auto const& [name, rewardModel] : expected.getRewardModels()) {
+            ASSERT_TRUE(actual.hasRewardModel(name));
+            auto const& actualRewardModel = actual.getRewardModel(name);
+            ASSERT_EQ(rewardModel.hasStateRewards(), actualRewardModel.hasStateRewards());
+            if (rewardModel.hasStateRewards()) {
+                EXPECT_EQ(rewardModel.getStateRewardVector(), actualRewardModel.getStateRewardVector());
+            }
+            ASSERT_EQ(rewardModel.hasStateActionRewards(), actualRewardModel.hasStateActionRewards());
+            if (rewardModel.hasStateActionRewards()) {
+                EXPECT_EQ(rewardModel.getStateActionRewardVector(), actualRewardModel.getStateActionRewardVector());
+            }
+        }
+    }
+
+    std::string filename;
+};
+
+TEST_F(BinaryModelParserTest, Dtmc) {
+    auto model = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.drn");
+    auto loadedModel = exportAndLoad(model);
+    expectEqualModels(*model, *loadedModel);
+    EXPECT_EQ(1260ul, loadedModel->getStates("observe0Greater1").getNumberOfSetBits());
+}
+
+TEST_F(BinaryModelParserTest, MdpWithChoiceLabels) {
+    storm::parser::DirectEncodingParserOptions options;
+    options.buildChoiceLabeling = true;
+    auto model = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.drn", options);
+    auto loadedModel = exportAndLoad(model);
+    expectEqualModels(*model, *loadedModel);
+    EXPECT_TRUE(loadedModel->hasRewardModel("coinflips"));
+}
+
+TEST_F(BinaryModelParserTest, Ctmc) {
+    auto model = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/ctmc/cluster2.drn");
+    auto loadedModel = exportAndLoad(model);
+    expectEqualModels(*model, *loadedModel);
+    EXPECT_EQ(model->as<storm::models::sparse::Ctmc<double>>()->getExitRateVector(),
+              loadedModel->as<storm::models::sparse::Ctmc<double>>()->getExitRateVector());
+}
+
+TEST_F(BinaryModelParserTest, MarkovAutomaton) {
+    auto model = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/ma/jobscheduler.drn");
+    auto loadedModel = exportAndLoad(model);
+    expectEqualModels(*model, *loadedModel);
+    auto const& ma = *model->as<storm::models::sparse::MarkovAutomaton<double>>();
+    auto const& loadedMa = *loadedModel->as<storm::models::sparse::MarkovAutomaton<double>>();
+    EXPECT_EQ(ma.getExitRates(), loadedMa.getExitRates());
+    EXPECT_EQ(ma.getMarkovianStates(), loadedMa.getMarkovianStates());
+}
+
+TEST_F(BinaryModelParserTest, InvalidFile) {
+    std::ofstream stream(filename);
+    stream << "This is not a binary model file, but it is long enough to contain a header.\n";
+    stream.close();
+    STORM_SILENT_EXPECT_THROW(storm::parser::BinaryModelParser::parseModel(filename), storm::exceptions::WrongFormatException);
+}
+
+TEST_F(BinaryModelParserTest, InvalidRowGroupIndices) {
+    using SectionKind = storm::exporter::BinaryModelFormat::SectionKind;
+    auto model = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.drn");
+    uint64_t const numberOfStates = model->getNumberOfStates();
+
+    // First row group does not start at row zero
+    exportAndModify(model, [](std::vector<char>& content) { getSectionData(content, SectionKind::RowGroupIndices)[0] = 1; });
+    STORM_SILENT_EXPECT_THROW(storm::parser::BinaryModelParser::parseModel(filename), storm::exceptions::WrongFormatException);
+
+    // Last row group does not end at the last row
+    exportAndModify(model, [&numberOfStates](std::vector<char>& content) { getSectionData(content, SectionKind::RowGroupIndices)[numberOfStates] += 1; });
+    STORM_SILENT_EXPECT_THROW(storm::parser::BinaryModelParser::parseModel(filename), storm::exceptions::WrongFormatException);
+
+    // Row group indices are not sorted
+    exportAndModify(model, [&numberOfStates](std::vector<char>& content) {
+        uint64_t* rowGroupIndices = getSectionData(content, SectionKind::RowGroupIndices);
+        rowGroupIndices[1] = rowGroupIndices[numberOfStates] + 1;
+    });
+    STORM_SILENT_EXPECT_THROW(storm::parser::BinaryModelParser::parseModel(filename), storm::exceptions::WrongFormatException);
+}
+
+TEST_F(BinaryModelParserTest, EmptyRowGroup) {
+    using SectionKind = storm::exporter::BinaryModelFormat::SectionKind;
+    auto model = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.drn");
+    // The second row group starts at the same row as the first one, so the indices are still sorted.
+    exportAndModify(model, [](std::vector<char>& content) { getSectionData(content, SectionKind::RowGroupIndices)[1] = 0; });
+    STORM_SILENT_EXPECT_THROW(storm::parser::BinaryModelParser::parseModel(filename), storm::exceptions::WrongFormatException);
+}
+
+TEST_F(BinaryModelParserTest, UnsortedColumns) {
+    using SectionKind = storm::exporter::BinaryModelFormat::SectionKind;
+    auto model = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.drn");
+    uint64_t const entry = getFirstEntryOfRowWithTwoEntries(*model);
+    ASSERT_LT(entry, model->getTransitionMatrix().getEntryCount());
+    exportAndModify(model, [&entry](std::vector<char>& content) {
+        uint64_t* columns = getSectionData(content, SectionKind::Columns);
+        std::swap(columns[entry], columns[entry + 1]);
+    });
+    STORM_SILENT_EXPECT_THROW(storm::parser::BinaryModelParser::parseModel(filename), storm::exceptions::WrongFormatException);
+}
+
+TEST_F(BinaryModelParserTest, DuplicateColumns) {
+    using SectionKind = storm::exporter::BinaryModelFormat::SectionKind;
+    auto model = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.drn");
+    uint64_t const entry = getFirstEntryOfRowWithTwoEntries(*model);
+    ASSERT_LT(entry, model->getTransitionMatrix().getEntryCount());
+    exportAndModify(model, [&entry](std::vector<char>& content) {
+        uint64_t* columns = getSectionData(content, SectionKind::Columns);
+        columns[entry + 1] = columns[entry];
+    });
+    STORM_SILENT_EXPECT_THROW(storm::parser::BinaryModelParser::parseModel(filename), storm::exceptions::WrongFormatException);
+}
+
+TEST_F(BinaryModelParserTest, DeterministicModelWithChoices) {
+    auto model = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.drn");
+    ASSERT_LT(model->getNumberOfStates(), model->getNumberOfChoices());
+    exportAndModify(model, [](std::vector<char>& content) {
+        getHeader(content).modelType = static_cast<uint32_t>(storm::exporter::BinaryModelFormat::ModelType::Dtmc);
+    });
+    STORM_SILENT_EXPECT_THROW(storm::parser::BinaryModelParser::parseModel(filename), storm::exceptions::WrongFormatException);
+}
+
+TEST_F(BinaryModelParserTest, OverflowingCounts) {
+    auto model = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.drn");
+    // With these counts, the section sizes in bytes wrap around to the sizes of the actual sections.
+    uint64_t const wrapAround = 1ull << 61;
+
+    exportAndModify(model, [&wrapAround](std::vector<char>& content) { getHeader(content).numberOfEntries += wrapAround; });
+    STORM_SILENT_EXPECT_THROW(storm::parser::BinaryModelParser::parseModel(filename), storm::exceptions::WrongFormatException);
+
+    exportAndModify(model, [&wrapAround](std::vector<char>& content) {
+        getHeader(content).numberOfRows += wrapAround;
+        getHeader(content).numberOfStates += wrapAround;
+        getHeader(content).numberOfColumns += wrapAround;
+    });
+    STORM_SILENT_EXPECT_THROW(storm::parser::BinaryModelParser::parseModel(filename), storm::exceptions::WrongFormatException);
+}
+
+}  // namespace
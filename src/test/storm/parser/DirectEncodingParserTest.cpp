@@ -1,11 +1,19 @@
 #include "storm-config.h"
 #include "test/storm_gtest.h"
 
+#include <filesystem>
+
 #include "storm-parsers/parser/DirectEncodingParser.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/api/export.h"
+#include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/models/sparse/Ctmc.h"
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
 #include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/Pomdp.h"
 #include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/utility/prism.h"
 
 TEST(DirectEncodingParserTest, DtmcParsing) {
     std::shared_ptr<storm::models::sparse::Model<double>> modelPtr =
@@ -97,3 +105,67 @@ TEST(DirectEncodingParserTest, IntervalDtmcTest) {
     ASSERT_EQ(613ul, dtmc->getNumberOfStates());
     EXPECT_TRUE(modelPtr->hasUncertainty());
 }
+
+namespace {
+void expectEqualModels(storm::models::sparse::Model<double> const& expected, storm::models::sparse::Model<double> const& actual, std::string const& file) {
+    ASSERT_EQ(expected.getType(), actual.getType()) << file;
+    EXPECT_TRUE(expected.getTransitionMatrix() == actual.getTransitionMatrix()) << file;
+    EXPECT_TRUE(expected.getStateLabeling() == actual.getStateLabeling()) << file;
+    ASSERT_EQ(expected.hasChoiceLabeling(), actual.hasChoiceLabeling()) << file;
+    if (expected.hasChoiceLabeling()) {
+        EXPECT_TRUE(expected.getChoiceLabeling() == actual.getChoiceLabeling()) << file;
+    }
+    ASSERT_EQ(expected.getNumberOfRewardModels(), actual.getNumberOfRewardModels()) << file;
+    for (auto const& [name, rewardModel] : expected.getRewardModels()) {
+        ASSERT_TRUE(actual.hasRewardModel(name)) << file;
+        auto const& actualRewardModel = actual.getRewardModel(name);
+        ASSERT_EQ(rewardModel.hasStateRewards(), actualRewardModel.hasStateRewards()) << file;
+        if (rewardModel.hasStateRewards()) {
+            EXPECT_EQ(rewardModel.getStateRewardVector(), actualRewardModel.getStateRewardVector()) << file;
+        }
+        ASSERT_EQ(rewardModel.hasStateActionRewards(), actualRewardModel.hasStateActionRewards()) << file;
+        if (rewardModel.hasStateActionRewards()) {
+            EXPECT_EQ(rewardModel.getStateActionRewardVector(), actualRewardModel.getStateActionRewardVector()) << file;
+        }
+    }
+    if (expected.isOfType(storm::models::ModelType::Ctmc)) {
+        EXPECT_EQ(expected.as<storm::models::sparse::Ctmc<double>>()->getExitRateVector(),
+                  actual.as<storm::models::sparse::Ctmc<double>>()->getExitRateVector())
+            << file;
+    } else if (expected.isOfType(storm::models::ModelType::MarkovAutomaton)) {
+        auto const& expectedMa = *expected.as<storm::models::sparse::MarkovAutomaton<double>>();
+        auto const& actualMa = *actual.as<storm::models::sparse::MarkovAutomaton<double>>();
+        EXPECT_EQ(expectedMa.getExitRates(), actualMa.getExitRates()) << file;
+        EXPECT_EQ(expectedMa.getMarkovianStates(), actualMa.getMarkovianStates()) << file;
+    } else if (expected.isOfType(storm::models::ModelType::Pomdp)) {
+        EXPECT_EQ(expected.as<storm::models::sparse::Pomdp<double>>()->getObservations(), actual.as<storm::models::sparse::Pomdp<double>>()->getObservations())
+            << file;
+    }
+}
+}  // namespace
+
+TEST(DirectEncodingParserTest, MultiThreadedParsing) {
+    // There is no DRN file of a POMDP among the test resources, so we export one.
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/pomdp/maze2.prism");
+    program = storm::utility::prism::preprocess(program, "sl=0.4");
+    std::string const pomdpFile = (std::filesystem::temp_directory_path() / "storm-drn-parser-test-maze2.drn").string();
+    storm::api::exportSparseModelAsDrn(storm::builder::ExplicitModelBuilder<double>(program).build(), pomdpFile);
+
+    for (std::string const file : {STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.drn", STORM_TEST_RESOURCES_DIR "/mdp/two_dice.drn",
+                                   STORM_TEST_RESOURCES_DIR "/ctmc/cluster2.drn", STORM_TEST_RESOURCES_DIR "/ma/jobscheduler.drn", pomdpFile.c_str()}) {
+        // The line-based parser serves as reference.
+        storm::parser::DirectEncodingParserOptions options;
+        options.buildChoiceLabeling = true;
+        options.useMemoryMappedFile = false;
+        auto expectedModel = storm::parser::DirectEncodingParser<double>::parseModel(file, options);
+
+        options.useMemoryMappedFile = true;
+        expectEqualModels(*expectedModel, *storm::parser::DirectEncodingParser<double>::parseModel(file, options), file);
+
+        // Use tiny chunks such that the model section is split into several chunks.
+        options.numberOfThreads = 4;
+        options.minimalChunkSize = 1;
+        expectEqualModels(*expectedModel, *storm::parser::DirectEncodingParser<double>::parseModel(file, options), file);
+    }
+    std::filesystem::remove(pomdpFile);
+}
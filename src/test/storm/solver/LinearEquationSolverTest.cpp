@@ -37,6 +37,21 @@ class NativeDoublePowerRegMultEnvironment {
     }
 };
 
+class NativeDoublePowerSlicedEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+        env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::Power);
+        env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber, std::string>("1e-10"));
+        env.solver().native().setPowerMethodMultiplicationStyle(storm::solver::MultiplicationStyle::Regular);
+        env.solver().native().setUseSlicedMatrix(true);
+        return env;
+    }
+};
+
 class NativeDoubleSoundValueIterationEnvironment {
    public:
     typedef double ValueType;
@@ -326,9 +341,9 @@ class LinearEquationSolverTest : public ::testing::Test {
     storm::Environment _environment;
 };
 
-typedef ::testing::Types<NativeDoublePowerEnvironment, NativeDoublePowerRegMultEnvironment, NativeDoubleSoundValueIterationEnvironment,
-                         NativeDoubleOptimisticValueIterationEnvironment, NativeDoubleIntervalIterationEnvironment, NativeDoubleJacobiEnvironment,
-                         NativeDoubleGaussSeidelEnvironment, NativeDoubleSorEnvironment, NativeDoubleWalkerChaeEnvironment,
+typedef ::testing::Types<NativeDoublePowerEnvironment, NativeDoublePowerRegMultEnvironment, NativeDoublePowerSlicedEnvironment,
+                         NativeDoubleSoundValueIterationEnvironment, NativeDoubleOptimisticValueIterationEnvironment, NativeDoubleIntervalIterationEnvironment,
+                         NativeDoubleJacobiEnvironment, NativeDoubleGaussSeidelEnvironment, NativeDoubleSorEnvironment, NativeDoubleWalkerChaeEnvironment,
                          NativeRationalRationalSearchEnvironment, EliminationRationalEnvironment, GmmGmresIluEnvironment, GmmGmresDiagonalEnvironment,
                          GmmGmresNoneEnvironment, GmmBicgstabIluEnvironment, GmmQmrDiagonalEnvironment, EigenDGmresDiagonalEnvironment,
                          EigenGmresIluEnvironment, EigenBicgstabNoneEnvironment, EigenDoubleLUEnvironment, EigenRationalLUEnvironment,
@@ -373,4 +388,49 @@ TYPED_TEST(LinearEquationSolverTest, solveEquationSystem) {
     EXPECT_NEAR(x[1], this->parseNumber("457/9"), this->precision());
     EXPECT_NEAR(x[2], this->parseNumber("875/18"), this->precision());
 }
+
+TEST(TopologicalLinearEquationSolverTest, MultiThreaded) {
+    // Chains of clusters with four states on a cycle, each followed by a trivial SCC that leads to the clusters below.
+    uint64_t const numberOfClusters = 250;
+    storm::storage::SparseMatrixBuilder<double> builder;
+    for (uint64_t cluster = 0; cluster < numberOfClusters; ++cluster) {
+        uint64_t const first = cluster * 5;
+        for (uint64_t offset = 0; offset < 4; ++offset) {
+            uint64_t const successor = first + (offset + 1) % 4;
+            if (cluster > 0) {
+                builder.addNextValue(first + offset, first - 1, 0.4);
+            }
+            builder.addNextValue(first + offset, successor, 0.5);
+        }
+        if (cluster > 1) {
+            builder.addNextValue(first + 4, first - 10, 0.45);
+        }
+        if (cluster > 0) {
+            builder.addNextValue(first + 4, first - 5, 0.45);
+        } else {
+            builder.addNextValue(first + 4, first, 0.9);
+        }
+    }
+    storm::storage::SparseMatrix<double> A = builder.build(numberOfClusters * 5, numberOfClusters * 5);
+    std::vector<double> b(A.getRowCount(), 1.0);
+
+    storm::Environment env;
+    env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Topological);
+    env.solver().topological().setUnderlyingEquationSolverType(storm::solver::EquationSolverType::Eigen);
+    env.solver().eigen().setMethod(storm::solver::EigenLinearEquationSolverMethod::SparseLU);
+    auto factory = storm::solver::GeneralLinearEquationSolverFactory<double>();
+
+    std::vector<double> expectedX(A.getRowGroupCount());
+    auto solver = factory.create(env, A);
+    ASSERT_NO_THROW(solver->solveEquations(env, expectedX, b));
+
+    env.solver().setNumberOfThreads(4);
+    std::vector<double> x(A.getRowGroupCount());
+    solver = factory.create(env, A);
+    ASSERT_NO_THROW(solver->solveEquations(env, x, b));
+    for (uint64_t state = 0; state < x.size(); ++state) {
+        EXPECT_NEAR(expectedX[state], x[state], 1e-6) << "for state " << state;
+    }
+    EXPECT_NEAR(2.0, x[0], 1e-6);
+}
 }  // namespace
\ No newline at end of file
@@ -177,4 +177,68 @@ TYPED_TEST(MinMaxLinearEquationSolverTest, SolveEquations) {
     ASSERT_NO_THROW(solver->solveEquations(this->env(), storm::OptimizationDirection::Maximize, x, b));
     EXPECT_NEAR(x[0], this->parseNumber("0.99"), this->precision());
 }
+
+TEST(TopologicalMinMaxLinearEquationSolverTest, MultiThreaded) {
+    // Chains of clusters with four states on a cycle, each followed by a trivial SCC that leads to the clusters below.
+    // Every state has a second choice that yields a different reward.
+    uint64_t const numberOfClusters = 250;
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    std::vector<double> b;
+    uint64_t row = 0;
+    for (uint64_t cluster = 0; cluster < numberOfClusters; ++cluster) {
+        uint64_t const first = cluster * 5;
+        for (uint64_t offset = 0; offset < 4; ++offset) {
+            builder.newRowGroup(row);
+            for (auto const& [stayProbability, reward] : {std::make_pair(0.5, 1.0), std::make_pair(0.3, 2.0)}) {
+                if (cluster > 0) {
+                    builder.addNextValue(row, first - 1, 0.9 - stayProbability);
+                }
+                builder.addNextValue(row, first + (offset + 1) % 4, stayProbability);
+                b.push_back(reward);
+                ++row;
+            }
+        }
+        builder.newRowGroup(row);
+        if (cluster > 1) {
+            builder.addNextValue(row, first - 10, 0.45);
+        }
+        builder.addNextValue(row, cluster > 0 ? first - 5 : first, cluster > 0 ? 0.45 : 0.9);
+        b.push_back(1.0);
+        ++row;
+        builder.addNextValue(row, cluster > 0 ? first - 4 : first + 1, 0.9);
+        b.push_back(0.5);
+        ++row;
+    }
+    storm::storage::SparseMatrix<double> A = builder.build(row, numberOfClusters * 5, numberOfClusters * 5);
+
+    storm::Environment env;
+    env.solver().minMax().setMethod(storm::solver::MinMaxMethod::Topological);
+    env.solver().topological().setUnderlyingMinMaxMethod(storm::solver::MinMaxMethod::ValueIteration);
+    env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+    auto factory = storm::solver::GeneralMinMaxLinearEquationSolverFactory<double>();
+    auto solve = [&](storm::OptimizationDirection dir, std::vector<double>& x) {
+        auto solver = factory.create(env, A);
+        solver->setHasUniqueSolution(true);
+        solver->setHasNoEndComponents(true);
+        solver->setBounds(0.0, 100.0);
+        solver->setTrackScheduler(true);
+        solver->setRequirementsChecked(true);
+        EXPECT_NO_THROW(solver->solveEquations(env, dir, x, b));
+        return solver->getSchedulerChoices();
+    };
+
+    for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+        env.solver().setNumberOfThreads(1);
+        std::vector<double> expectedX(A.getRowGroupCount());
+        std::vector<uint64_t> expectedChoices = solve(dir, expectedX);
+
+        env.solver().setNumberOfThreads(4);
+        std::vector<double> x(A.getRowGroupCount());
+        std::vector<uint64_t> choices = solve(dir, x);
+        for (uint64_t state = 0; state < x.size(); ++state) {
+            EXPECT_NEAR(expectedX[state], x[state], 1e-6) << "for state " << state;
+        }
+        EXPECT_EQ(expectedChoices, choices);
+    }
+}
 }  // namespace
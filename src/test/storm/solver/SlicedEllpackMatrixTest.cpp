@@ -0,0 +1,124 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <set>
+
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/solver/helper/SlicedEllpackMatrix.h"
+#include "storm/solver/helper/ValueIterationOperator.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace {
+
+using storm::solver::helper::SlicedEllpackMatrix;
+
+storm::storage::SparseMatrix<double> buildMatrix(uint64_t numberOfRows) {
+    storm::storage::SparseMatrixBuilder<double> builder(numberOfRows, numberOfRows, 0, false, false);
+    for (uint64_t row = 0; row < numberOfRows; ++row) {
+        // Rows have between one and three entries so that some padding is required.
+        std::set<uint64_t> columns;
+        for (uint64_t entry = 0; entry <= row % 3; ++entry) {
+            columns.insert((row * 7 + entry * 5) % numberOfRows);
+        }
+        for (auto column : columns) {
+            builder.addNextValue(row, column, 1.0 / (column + 2));
+        }
+    }
+    return builder.build();
+}
+
+std::vector<double> multiplyReference(storm::storage::SparseMatrix<double> const& matrix, std::vector<double> const& x) {
+    std::vector<double> result(matrix.getRowCount(), 0.0);
+    for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+        for (auto const& entry : matrix.getRow(row)) {
+            result[row] += x[entry.getColumn()] * entry.getValue();
+        }
+    }
+    return result;
+}
+
+TEST(SlicedEllpackMatrixTest, Kernels) {
+    for (uint64_t numberOfRows : {1ull, 8ull, 13ull, 100ull}) {
+        auto matrix = buildMatrix(numberOfRows);
+        std::vector<double> x(numberOfRows);
+        for (uint64_t i = 0; i < numberOfRows; ++i) {
+            x[i] = 1.0 / (i + 1);
+        }
+        auto expected = multiplyReference(matrix, x);
+
+        for (bool reverseRowOrder : {false, true}) {
+            SlicedEllpackMatrix slicedMatrix(matrix, reverseRowOrder);
+            EXPECT_EQ(numberOfRows, slicedMatrix.getNumberOfRows());
+            for (auto kernel : {SlicedEllpackMatrix::Kernel::Scalar, SlicedEllpackMatrix::Kernel::Avx2, SlicedEllpackMatrix::Kernel::Avx512}) {
+                if (!SlicedEllpackMatrix::isSupported(kernel)) {
+                    STORM_SILENT_EXPECT_THROW(slicedMatrix.setKernel(kernel), storm::exceptions::NotSupportedException);
+                    continue;
+                }
+                slicedMatrix.setKernel(kernel);
+                std::vector<double> result(slicedMatrix.getNumberOfSlices() * SlicedEllpackMatrix::SliceSize, 0.0);
+                slicedMatrix.multiplyAdd(0, slicedMatrix.getNumberOfSlices(), x.data(), result.data());
+                for (uint64_t position = 0; position < numberOfRows; ++position) {
+                    EXPECT_NEAR(expected[reverseRowOrder ? numberOfRows - 1 - position : position], result[position], 1e-12);
+                }
+            }
+        }
+    }
+}
+
+// Backend that just stores the row results.
+class StoreBackend {
+   public:
+    void startNewIteration() {}
+    void firstRow(double&& value, uint64_t, uint64_t) {
+        current = value;
+    }
+    void applyUpdate(double& currValue, uint64_t) {
+        currValue = current;
+    }
+    void endOfIteration() const {}
+    bool abort() const {
+        return false;
+    }
+    bool converged() const {
+        return true;
+    }
+
+   private:
+    double current;
+};
+
+TEST(SlicedEllpackMatrixTest, ValueIterationOperator) {
+    // All rows have the same length so that the operator uses the sliced representation (if enabled).
+    uint64_t const numberOfRows = 1000;
+    storm::storage::SparseMatrixBuilder<double> builder(numberOfRows, numberOfRows, 0, false, false);
+    for (uint64_t row = 0; row < numberOfRows; ++row) {
+        uint64_t const column = (row * 3) % (numberOfRows - 1);
+        builder.addNextValue(row, column, 0.5);
+        builder.addNextValue(row, column + 1, 0.5);
+    }
+    auto matrix = builder.build();
+    std::vector<double> operandIn(numberOfRows);
+    for (uint64_t i = 0; i < numberOfRows; ++i) {
+        operandIn[i] = static_cast<double>(i % 10) / 10.0;
+    }
+    std::vector<double> offsets(numberOfRows, 0.1);
+    auto expected = multiplyReference(matrix, operandIn);
+
+    for (bool backwards : {false, true}) {
+        storm::solver::helper::ValueIterationOperator<double, true> viOperator;
+        viOperator.setUseSlicedMatrix(true);
+        if (backwards) {
+            viOperator.setMatrixBackwards(matrix);
+        } else {
+            viOperator.setMatrixForwards(matrix);
+        }
+        std::vector<double> operandOut(numberOfRows);
+        StoreBackend backend;
+        viOperator.apply(operandIn, operandOut, offsets, backend);
+        for (uint64_t i = 0; i < numberOfRows; ++i) {
+            EXPECT_NEAR(expected[i] + 0.1, operandOut[i], 1e-12);
+        }
+    }
+}
+
+}  // namespace
@@ -0,0 +1,139 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm/solver/helper/ValueIterationOperator.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace {
+
+// Backend that maximizes over the rows of each row group and stores the result.
+class MaxBackend {
+   public:
+    void startNewIteration() {}
+    void firstRow(double&& value, uint64_t, uint64_t) {
+        best = value;
+    }
+    void nextRow(double&& value, uint64_t, uint64_t) {
+        best = std::max(best, value);
+    }
+    void applyUpdate(double& currValue, uint64_t) {
+        currValue = best;
+    }
+    void endOfIteration() const {}
+    bool abort() const {
+        return false;
+    }
+    bool converged() const {
+        return true;
+    }
+    void merge(MaxBackend const&) {}
+
+   private:
+    double best;
+};
+
+storm::storage::SparseMatrix<double> buildMatrix(uint64_t columnCount) {
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    builder.newRowGroup(0);
+    builder.addNextValue(0, 0, 0.5);
+    builder.addNextValue(0, 1, 0.5);
+    builder.addNextValue(1, 2, 1.0);
+    builder.newRowGroup(2);
+    builder.addNextValue(2, 0, 0.3);
+    builder.addNextValue(2, 2, 0.7);
+    builder.newRowGroup(3);
+    builder.addNextValue(3, 1, 0.1);
+    builder.addNextValue(3, 2, 0.9);
+    builder.addNextValue(4, 1, 1.0);
+    return builder.build(5, columnCount, 3);
+}
+
+std::vector<double> applyOperator(storm::storage::SparseMatrix<double> const& matrix, bool backwards, bool ignoreRows) {
+    storm::solver::helper::ValueIterationOperator<double, false> viOperator;
+    if (backwards) {
+        viOperator.setMatrixBackwards(matrix);
+    } else {
+        viOperator.setMatrixForwards(matrix);
+    }
+    if (ignoreRows) {
+        viOperator.setIgnoredRows(false, [](uint64_t, uint64_t row) { return row == 1 || row == 4; });
+    }
+    std::vector<double> operandIn = {0.2, 0.4, 1.0};
+    std::vector<double> operandOut(3);
+    std::vector<double> offsets = {0.0, 0.0, 0.1, 0.0, 0.0};
+    MaxBackend backend;
+    viOperator.apply(operandIn, operandOut, offsets, backend);
+    return operandOut;
+}
+
+TEST(ValueIterationOperatorTest, CompactAndWideColumns) {
+    // The second matrix has too many columns to use 32-bit column indices.
+    auto compactMatrix = buildMatrix(3);
+    auto wideMatrix = buildMatrix(1ull << 32);
+
+    for (bool backwards : {false, true}) {
+        auto compactResult = applyOperator(compactMatrix, backwards, false);
+        auto wideResult = applyOperator(wideMatrix, backwards, false);
+        ASSERT_EQ(3ul, compactResult.size());
+        EXPECT_NEAR(1.0, compactResult[0], 1e-12);
+        EXPECT_NEAR(0.86, compactResult[1], 1e-12);
+        EXPECT_NEAR(0.94, compactResult[2], 1e-12);
+        EXPECT_EQ(compactResult, wideResult);
+
+        compactResult = applyOperator(compactMatrix, backwards, true);
+        wideResult = applyOperator(wideMatrix, backwards, true);
+        EXPECT_NEAR(0.3, compactResult[0], 1e-12);
+        EXPECT_NEAR(0.86, compactResult[1], 1e-12);
+        EXPECT_NEAR(0.94, compactResult[2], 1e-12);
+        EXPECT_EQ(compactResult, wideResult);
+    }
+}
+
+TEST(ValueIterationOperatorTest, ParallelApply) {
+    // The matrix needs to be large enough such that it is split into several chunks.
+    uint64_t const numberOfGroups = 100000;
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    uint64_t row = 0;
+    for (uint64_t group = 0; group < numberOfGroups; ++group) {
+        builder.newRowGroup(row);
+        for (uint64_t choice = 0; choice < 2; ++choice, ++row) {
+            uint64_t first = (group * 7 + choice * 13) % numberOfGroups;
+            uint64_t second = (group * 31 + choice * 17 + 1) % numberOfGroups;
+            if (first > second) {
+                std::swap(first, second);
+            }
+            if (first == second) {
+                builder.addNextValue(row, first, 1.0);
+            } else {
+                builder.addNextValue(row, first, 0.25 + 0.5 * choice);
+                builder.addNextValue(row, second, 0.75 - 0.5 * choice);
+            }
+        }
+    }
+    auto matrix = builder.build(row, numberOfGroups, numberOfGroups);
+
+    std::vector<double> operandIn(numberOfGroups);
+    for (uint64_t group = 0; group < numberOfGroups; ++group) {
+        operandIn[group] = static_cast<double>(group % 101) / 100.0;
+    }
+    std::vector<double> offsets(row, 0.0);
+
+    for (bool backwards : {false, true}) {
+        storm::solver::helper::ValueIterationOperator<double, false> viOperator;
+        if (backwards) {
+            viOperator.setMatrixBackwards(matrix);
+        } else {
+            viOperator.setMatrixForwards(matrix);
+        }
+        MaxBackend backend;
+        std::vector<double> sequentialResult(numberOfGroups);
+        viOperator.apply(operandIn, sequentialResult, offsets, backend);
+
+        viOperator.setNumberOfThreads(4);
+        std::vector<double> parallelResult(numberOfGroups);
+        viOperator.apply(operandIn, parallelResult, offsets, backend);
+        EXPECT_EQ(sequentialResult, parallelResult);
+    }
+}
+
+}  // namespace
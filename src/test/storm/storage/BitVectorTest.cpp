@@ -1,6 +1,7 @@
 #include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/OutOfRangeException.h"
 #include "storm/storage/BitVector.h"
+#include "storm/storage/BitVectorRankIndex.h"
 #include "test/storm_gtest.h"
 
 TEST(BitVectorTest, InitToZero) {
@@ -595,6 +596,30 @@ TEST(BitVectorTest, Iterator) {
     ASSERT_EQ(i, 32ull);
 }
 
+TEST(BitVectorTest, IteratorRange) {
+    storm::storage::BitVector vector(300);
+    std::vector<uint64_t> setBits = {0, 1, 63, 64, 65, 127, 190, 191, 192, 255, 256, 299};
+    vector.set(setBits.begin(), setBits.end());
+
+    std::vector<uint64_t> iteratedBits(vector.begin(), vector.end());
+    EXPECT_EQ(setBits, iteratedBits);
+
+    for (uint64_t lowerBound = 0; lowerBound <= vector.size(); ++lowerBound) {
+        std::vector<uint64_t> expected;
+        std::copy_if(setBits.begin(), setBits.end(), std::back_inserter(expected), [lowerBound](uint64_t bit) { return bit >= lowerBound; });
+        std::vector<uint64_t> actual(vector.begin(lowerBound), vector.end());
+        ASSERT_EQ(expected, actual) << " lower bound is " << lowerBound;
+    }
+
+    auto it = vector.begin();
+    it += 5;
+    EXPECT_EQ(127ull, *it);
+    it += 6;
+    EXPECT_EQ(299ull, *it);
+    ++it;
+    EXPECT_TRUE(it == vector.end());
+}
+
 TEST(BitVectorTest, ReverseIterator) {
     storm::storage::BitVector vector(547490);
 
@@ -653,3 +678,73 @@ TEST(BitVectorTest, Assignment) {
     v1.set(9999);
     ASSERT_TRUE(v1.get(9999));
 }
+
+TEST(BitVectorTest, BulkOperationsLarge) {
+    // Use sizes that are not a multiple of the vectorization width.
+    for (uint64_t size : {1ull, 63ull, 64ull, 255ull, 256ull, 1000ull}) {
+        storm::storage::BitVector vector1(size), vector2(size);
+        for (uint64_t i = 0; i < size; ++i) {
+            vector1.set(i, i % 3 == 0);
+            vector2.set(i, i % 5 == 0);
+        }
+
+        storm::storage::BitVector conjunction = vector1 & vector2;
+        storm::storage::BitVector disjunction = vector1 | vector2;
+        storm::storage::BitVector exclusiveDisjunction = vector1 ^ vector2;
+        storm::storage::BitVector implication = vector1.implies(vector2);
+        storm::storage::BitVector negation = ~vector1;
+        for (uint64_t i = 0; i < size; ++i) {
+            ASSERT_EQ(i % 15 == 0, conjunction.get(i));
+            ASSERT_EQ(i % 3 == 0 || i % 5 == 0, disjunction.get(i));
+            ASSERT_EQ((i % 3 == 0) != (i % 5 == 0), exclusiveDisjunction.get(i));
+            ASSERT_EQ(i % 3 != 0 || i % 5 == 0, implication.get(i));
+            ASSERT_EQ(i % 3 != 0, negation.get(i));
+        }
+        EXPECT_EQ(size - vector1.getNumberOfSetBits(), negation.getNumberOfSetBits());
+        EXPECT_EQ((size + 14) / 15, conjunction.getNumberOfSetBits());
+
+        EXPECT_TRUE(conjunction.isSubsetOf(vector1));
+        EXPECT_EQ(size <= 5, vector2.isSubsetOf(disjunction) && disjunction.isSubsetOf(vector2));
+        EXPECT_TRUE(vector1.isDisjointFrom(negation));
+        EXPECT_FALSE(vector1.isDisjointFrom(vector2));
+
+        vector1 &= vector2;
+        EXPECT_EQ(conjunction, vector1);
+        vector1 |= disjunction;
+        EXPECT_EQ(disjunction, vector1);
+    }
+}
+
+TEST(BitVectorTest, NumberOfSetBitsBeforeIndices) {
+    storm::storage::BitVector vector(200, {3, 64, 65, 130});
+    std::vector<uint_fast64_t> bitsSetBeforeIndices = vector.getNumberOfSetBitsBeforeIndices();
+    ASSERT_EQ(131ul, bitsSetBeforeIndices.size());
+    for (uint64_t i = 0; i < bitsSetBeforeIndices.size(); ++i) {
+        ASSERT_EQ(vector.getNumberOfSetBitsBeforeIndex(i), bitsSetBeforeIndices[i]) << " index is i=" << i;
+    }
+    EXPECT_TRUE(storm::storage::BitVector(200).getNumberOfSetBitsBeforeIndices().empty());
+}
+
+TEST(BitVectorTest, RankIndex) {
+    storm::storage::BitVector vector(5000);
+    for (uint64_t i = 0; i < vector.size(); ++i) {
+        // Leave some blocks and buckets completely empty.
+        vector.set(i, (i < 1024 || i >= 2048) && i % 7 < 2 && i % 64 != 0);
+    }
+    storm::storage::BitVectorRankIndex rankIndex(vector);
+    EXPECT_EQ(vector.getNumberOfSetBits(), rankIndex.getNumberOfSetBits());
+    for (uint64_t i = 0; i <= vector.size(); ++i) {
+        ASSERT_EQ(vector.getNumberOfSetBitsBeforeIndex(i), rankIndex.getNumberOfSetBitsBeforeIndex(i)) << " index is i=" << i;
+    }
+    uint64_t numberOfSetBitsBefore = 0;
+    for (auto bit : vector) {
+        ASSERT_EQ(bit, rankIndex.getIndexOfSetBit(numberOfSetBitsBefore));
+        ++numberOfSetBitsBefore;
+    }
+    EXPECT_EQ(vector.size(), rankIndex.getIndexOfSetBit(numberOfSetBitsBefore));
+
+    storm::storage::BitVector emptyVector(128);
+    storm::storage::BitVectorRankIndex emptyRankIndex(emptyVector);
+    EXPECT_EQ(0ull, emptyRankIndex.getNumberOfSetBitsBeforeIndex(128));
+    EXPECT_EQ(128ull, emptyRankIndex.getIndexOfSetBit(0));
+}
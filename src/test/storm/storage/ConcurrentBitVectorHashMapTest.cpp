@@ -0,0 +1,117 @@
+#include "test/storm_gtest.h"
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/ConcurrentBitVectorHashMap.h"
+
+TEST(ConcurrentBitVectorHashMapTest, FindOrAdd) {
+    storm::storage::ConcurrentBitVectorHashMap<uint64_t> map(64, 3);
+
+    storm::storage::BitVector first(64);
+    first.set(4);
+    first.set(47);
+    EXPECT_EQ(1ul, map.findOrAdd(first, 1));
+
+    storm::storage::BitVector second(64);
+    second.set(8);
+    second.set(18);
+    EXPECT_EQ(2ul, map.findOrAdd(second, 2));
+
+    EXPECT_EQ(1ul, map.findOrAdd(first, 3));
+    EXPECT_EQ(2ul, map.findOrAdd(second, 3));
+
+    storm::storage::BitVector third(64);
+    third.set(10);
+    third.set(63);
+    EXPECT_EQ(3ul, map.findOrAdd(third, 3));
+
+    storm::storage::BitVector fourth(64);
+    fourth.set(12);
+    fourth.set(14);
+    EXPECT_EQ(4ul, map.findOrAdd(fourth, 4));
+
+    storm::storage::BitVector fifth(64);
+    fifth.set(44);
+    fifth.set(55);
+    EXPECT_EQ(5ul, map.findOrAdd(fifth, 5));
+
+    EXPECT_EQ(1ul, map.findOrAdd(first, 2));
+    EXPECT_EQ(2ul, map.findOrAdd(second, 1));
+    EXPECT_EQ(3ul, map.findOrAdd(third, 1));
+    EXPECT_EQ(4ul, map.findOrAdd(fourth, 1));
+    EXPECT_EQ(5ul, map.findOrAdd(fifth, 1));
+    EXPECT_EQ(5ul, map.size());
+
+    storm::storage::BitVector sixth(64);
+    sixth.set(45);
+    sixth.set(55);
+    EXPECT_FALSE(map.contains(sixth));
+    EXPECT_FALSE(map.find(sixth).has_value());
+    EXPECT_TRUE(map.contains(fifth));
+    EXPECT_EQ(3ul, map.getValue(third));
+
+    uint64_t numberOfIteratedElements = 0;
+    for (auto const& keyValuePair : map) {
+        EXPECT_EQ(map.getValue(keyValuePair.first), keyValuePair.second);
+        ++numberOfIteratedElements;
+    }
+    EXPECT_EQ(5ul, numberOfIteratedElements);
+}
+
+TEST(ConcurrentBitVectorHashMapTest, ConcurrentFindOrAddConsecutive) {
+    uint64_t const numberOfThreads = 4;
+    uint64_t const numberOfKeys = 20000;
+
+    // Start with a small map to force several concurrent resizes.
+    storm::storage::ConcurrentBitVectorHashMap<uint64_t> map(128, 16);
+
+    auto getKey = [](uint64_t index) {
+        storm::storage::BitVector key(128);
+        key.setFromInt(0, 64, index);
+        key.setFromInt(64, 64, index * 31 + 7);
+        return key;
+    };
+
+    // Every thread inserts all keys, but in a different order.
+    std::vector<std::vector<uint64_t>> values(numberOfThreads, std::vector<uint64_t>(numberOfKeys));
+    std::vector<uint64_t> numberOfInsertions(numberOfThreads, 0);
+    std::vector<std::thread> threads;
+    for (uint64_t thread = 0; thread < numberOfThreads; ++thread) {
+        threads.emplace_back([&, thread]() {
+            for (uint64_t step = 0; step < numberOfKeys; ++step) {
+                uint64_t index = (thread % 2 == 0) ? step : numberOfKeys - 1 - step;
+                auto result = map.findOrAddConsecutive(getKey(index));
+                values[thread][index] = result.first;
+                if (result.second) {
+                    ++numberOfInsertions[thread];
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    map.releaseRetiredStorage();
+
+    EXPECT_EQ(numberOfKeys, map.size());
+    uint64_t totalNumberOfInsertions = 0;
+    for (uint64_t thread = 0; thread < numberOfThreads; ++thread) {
+        totalNumberOfInsertions += numberOfInsertions[thread];
+    }
+    EXPECT_EQ(numberOfKeys, totalNumberOfInsertions);
+
+    // All threads must agree on the values and the values must be a permutation of 0, ..., numberOfKeys - 1.
+    storm::storage::BitVector usedValues(numberOfKeys);
+    for (uint64_t index = 0; index < numberOfKeys; ++index) {
+        for (uint64_t thread = 1; thread < numberOfThreads; ++thread) {
+            EXPECT_EQ(values[0][index], values[thread][index]);
+        }
+        ASSERT_LT(values[0][index], numberOfKeys);
+        EXPECT_FALSE(usedValues.get(values[0][index]));
+        usedValues.set(values[0][index]);
+        EXPECT_EQ(values[0][index], map.getValue(getKey(index)));
+    }
+}
@@ -9,6 +9,9 @@
 #include "storm/storage/SymbolicModelDescription.h"
 #include "test/storm_gtest.h"
 
+#include <random>
+#include <set>
+
 TEST(MaximalEndComponentDecomposition, FullSystem1) {
     std::shared_ptr<storm::models::sparse::Model<double>> abstractModel =
         storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/tiny1.tra", STORM_TEST_RESOURCES_DIR "/lab/tiny1.lab", "", "");
@@ -141,6 +144,64 @@ TEST(MaximalEndComponentDecomposition, Subsystem) {
     }
 }
 
+TEST(MaximalEndComponentDecomposition, MultiThreaded) {
+    // Build a system whose states are arranged in clusters. Each state has a choice that stays in its cluster and a choice to a lower cluster.
+    // Some states have a choice that might lead to a higher cluster but might also lead to the absorbing last state.
+    uint64_t const numberOfStates = 20001;
+    uint64_t const absorbingState = numberOfStates - 1;
+    std::mt19937 generator(42);
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(0, numberOfStates, 0, false, true, numberOfStates);
+    uint64_t row = 0;
+    for (uint64_t state = 0; state < absorbingState; ++state) {
+        matrixBuilder.newRowGroup(row);
+        uint64_t const clusterStart = state - state % 50;
+        matrixBuilder.addNextValue(row++, clusterStart + (state + 1) % 50, 1.0);
+        if (state % 3 == 0) {
+            matrixBuilder.addNextValue(row, (clusterStart + 50 + generator() % 1000) % absorbingState, 0.5);
+            matrixBuilder.addNextValue(row++, absorbingState, 0.5);
+        }
+        matrixBuilder.addNextValue(row++, clusterStart == 0 ? state : generator() % clusterStart, 1.0);
+    }
+    matrixBuilder.newRowGroup(row);
+    matrixBuilder.addNextValue(row++, absorbingState, 1.0);
+    storm::storage::SparseMatrix<double> matrix = matrixBuilder.build();
+    storm::storage::SparseMatrix<double> backwardTransitions = matrix.transpose(true);
+    storm::storage::BitVector subsystem(numberOfStates);
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        subsystem.set(state, state % 101 != 0);
+    }
+    storm::storage::BitVector choices(matrix.getRowCount(), true);
+    for (uint64_t choice = 2; choice < matrix.getRowCount(); choice += 3) {
+        choices.set(choice, false);
+    }
+
+    // The MECs might be found in a different order, so we compare the sets of MECs.
+    auto getMecs = [](storm::storage::MaximalEndComponentDecomposition<double> const& decomposition) {
+        std::set<std::set<std::pair<uint64_t, std::vector<uint64_t>>>> result;
+        for (auto const& mec : decomposition) {
+            std::set<std::pair<uint64_t, std::vector<uint64_t>>> mecStatesAndChoices;
+            for (auto const& [state, mecChoices] : mec) {
+                mecStatesAndChoices.emplace(state, std::vector<uint64_t>(mecChoices.begin(), mecChoices.end()));
+            }
+            result.insert(std::move(mecStatesAndChoices));
+        }
+        return result;
+    };
+
+    storm::storage::MaximalEndComponentDecomposition<double> sequential(matrix, backwardTransitions);
+    storm::storage::MaximalEndComponentDecomposition<double> parallel(matrix, backwardTransitions, 4);
+    EXPECT_EQ(getMecs(sequential), getMecs(parallel));
+    EXPECT_EQ(401ul, sequential.size());
+
+    sequential = storm::storage::MaximalEndComponentDecomposition<double>(matrix, backwardTransitions, subsystem);
+    parallel = storm::storage::MaximalEndComponentDecomposition<double>(matrix, backwardTransitions, subsystem, 4);
+    EXPECT_EQ(getMecs(sequential), getMecs(parallel));
+
+    sequential = storm::storage::MaximalEndComponentDecomposition<double>(matrix, backwardTransitions, subsystem, choices);
+    parallel = storm::storage::MaximalEndComponentDecomposition<double>(matrix, backwardTransitions, subsystem, choices, 4);
+    EXPECT_EQ(getMecs(sequential), getMecs(parallel));
+}
+
 TEST(MaximalEndComponentDecomposition, Example1) {
 #ifndef STORM_HAVE_Z3
     GTEST_SKIP() << "Z3 not available.";
@@ -6,6 +6,9 @@
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
 #include "test/storm_gtest.h"
 
+#include <random>
+#include <set>
+
 TEST(StronglyConnectedComponentDecomposition, SmallSystemFromMatrix) {
     storm::storage::SparseMatrixBuilder<double> matrixBuilder(6, 6);
     ASSERT_NO_THROW(matrixBuilder.addNextValue(0, 0, 0.3));
@@ -90,3 +93,118 @@ TEST(StronglyConnectedComponentDecomposition, FullSystem2) {
 
     markovAutomaton = nullptr;
 }
+
+namespace {
+
+// Builds a system with a large SCC, many small SCCs and many transient states. Every state has two choices, the second one leads to a random state.
+storm::storage::SparseMatrix<double> buildSystemWithManySccs(uint64_t numberOfStates) {
+    std::mt19937 generator(42);
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(0, numberOfStates, 0, false, true, numberOfStates);
+    uint64_t row = 0;
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        matrixBuilder.newRowGroup(row);
+        std::set<uint64_t> successors;
+        if (state < numberOfStates / 3) {
+            // The states of the first third form a cycle with shortcuts.
+            successors.insert((state + 1) % (numberOfStates / 3));
+            successors.insert(generator() % (numberOfStates / 3));
+        } else if (state < 2 * numberOfStates / 3) {
+            // The states of the second third form cycles of length 10 that lead to states with smaller indices.
+            successors.insert(state - state % 10 + (state + 1) % 10);
+            successors.insert(generator() % (state - state % 10));
+        } else {
+            // The remaining states are transient.
+            successors.insert(generator() % state);
+            if (state % 7 == 0) {
+                successors.insert(state);
+            }
+        }
+        for (auto const successor : successors) {
+            matrixBuilder.addNextValue(row, successor, 1.0 / successors.size());
+        }
+        ++row;
+        matrixBuilder.addNextValue(row, generator() % numberOfStates, 1.0);
+        ++row;
+    }
+    return matrixBuilder.build();
+}
+
+void expectEqualDecompositions(storm::storage::StronglyConnectedComponentDecomposition<double> const& expected,
+                               storm::storage::StronglyConnectedComponentDecomposition<double> const& actual, uint64_t numberOfStates) {
+    ASSERT_EQ(expected.size(), actual.size());
+    auto const expectedMap = expected.computeStateToSccIndexMap(numberOfStates);
+    auto const actualMap = actual.computeStateToSccIndexMap(numberOfStates);
+    std::vector<uint64_t> sccIndexMapping(expected.size(), std::numeric_limits<uint64_t>::max());
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        ASSERT_EQ(expectedMap[state] == std::numeric_limits<uint64_t>::max(), actualMap[state] == std::numeric_limits<uint64_t>::max());
+        if (expectedMap[state] == std::numeric_limits<uint64_t>::max()) {
+            continue;
+        }
+        if (sccIndexMapping[expectedMap[state]] == std::numeric_limits<uint64_t>::max()) {
+            sccIndexMapping[expectedMap[state]] = actualMap[state];
+        }
+        ASSERT_EQ(sccIndexMapping[expectedMap[state]], actualMap[state]);
+    }
+    for (uint64_t sccIndex = 0; sccIndex < expected.size(); ++sccIndex) {
+        EXPECT_EQ(expected.getBlock(sccIndex).isTrivial(), actual.getBlock(sccIndexMapping[sccIndex]).isTrivial());
+        EXPECT_EQ(expected.hasSccDepth(), actual.hasSccDepth());
+        if (expected.hasSccDepth()) {
+            EXPECT_EQ(expected.getSccDepth(sccIndex), actual.getSccDepth(sccIndexMapping[sccIndex]));
+        }
+    }
+}
+
+}  // namespace
+
+TEST(StronglyConnectedComponentDecomposition, MultiThreaded) {
+    uint64_t const numberOfStates = 30000;
+    storm::storage::SparseMatrix<double> matrix = buildSystemWithManySccs(numberOfStates);
+    storm::storage::BitVector subsystem(numberOfStates);
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        subsystem.set(state, state % 1000 != 0);
+    }
+    storm::storage::BitVector choices(matrix.getRowCount(), true);
+    for (uint64_t row = 1; row < matrix.getRowCount(); row += 2) {
+        choices.set(row, row % 4 == 1);
+    }
+
+    // Consider the full system, a subsystem, and a subsystem with restricted choices.
+    for (uint64_t variant = 0; variant < 3; ++variant) {
+        storm::storage::StronglyConnectedComponentDecompositionOptions options;
+        options.computeSccDepths();
+        if (variant >= 1) {
+            options.subsystem(subsystem);
+        }
+        if (variant == 2) {
+            options.choices(choices);
+        }
+        storm::storage::StronglyConnectedComponentDecomposition<double> sequentialDecomposition(matrix, options);
+        options.useThreads(4);
+        storm::storage::StronglyConnectedComponentDecomposition<double> parallelDecomposition(matrix, options);
+        expectEqualDecompositions(sequentialDecomposition, parallelDecomposition, numberOfStates);
+
+        // SCCs that are reachable from an SCC have a smaller index.
+        auto const stateToSccMap = parallelDecomposition.computeStateToSccIndexMap(numberOfStates);
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            if (stateToSccMap[state] == std::numeric_limits<uint64_t>::max()) {
+                continue;
+            }
+            for (uint64_t row = matrix.getRowGroupIndices()[state]; row < matrix.getRowGroupIndices()[state + 1]; ++row) {
+                if (variant == 2 && !choices.get(row)) {
+                    continue;
+                }
+                for (auto const& entry : matrix.getRow(row)) {
+                    if (stateToSccMap[entry.getColumn()] != std::numeric_limits<uint64_t>::max()) {
+                        EXPECT_LE(stateToSccMap[entry.getColumn()], stateToSccMap[state]);
+                    }
+                }
+            }
+        }
+
+        options.dropNaiveSccs().onlyBottomSccs().useThreads(1);
+        sequentialDecomposition = storm::storage::StronglyConnectedComponentDecomposition<double>(matrix, options);
+        options.useThreads(4);
+        parallelDecomposition = storm::storage::StronglyConnectedComponentDecomposition<double>(matrix, options);
+        expectEqualDecompositions(sequentialDecomposition, parallelDecomposition, numberOfStates);
+    }
+}
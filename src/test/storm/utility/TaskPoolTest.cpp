@@ -0,0 +1,75 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <atomic>
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/utility/TaskPool.h"
+#include "storm/utility/macros.h"
+
+namespace {
+
+// Recursively splits the range into tasks and sums up the numbers in the range.
+void sumRange(storm::utility::TaskPool& pool, uint64_t first, uint64_t end, std::atomic<uint64_t>& sum) {
+    if (end - first <= 16) {
+        for (uint64_t number = first; number < end; ++number) {
+            sum += number;
+        }
+    } else {
+        uint64_t const middle = first + (end - first) / 2;
+        pool.submit([&pool, first, middle, &sum]() { sumRange(pool, first, middle, sum); });
+        pool.submit([&pool, middle, end, &sum]() { sumRange(pool, middle, end, sum); });
+    }
+}
+
+}  // namespace
+
+TEST(TaskPoolTest, NestedTasks) {
+    for (uint64_t numberOfThreads : {1ull, 4ull}) {
+        storm::utility::TaskPool pool(numberOfThreads);
+        EXPECT_EQ(numberOfThreads, pool.getNumberOfThreads());
+        std::atomic<uint64_t> sum(0);
+        sumRange(pool, 0, 100000, sum);
+        pool.wait();
+        EXPECT_EQ(4999950000ull, sum.load());
+
+        // The pool can be reused after waiting.
+        sum = 0;
+        sumRange(pool, 0, 1000, sum);
+        pool.wait();
+        EXPECT_EQ(499500ull, sum.load());
+    }
+}
+
+TEST(TaskPoolTest, ThreadIndices) {
+    storm::utility::TaskPool pool(4);
+    std::vector<std::atomic<uint64_t>> tasksPerThread(pool.getNumberOfThreads());
+    for (uint64_t task = 0; task < 1000; ++task) {
+        pool.submit([&pool, &tasksPerThread]() { ++tasksPerThread[pool.getCurrentThreadIndex()]; });
+    }
+    pool.wait();
+    uint64_t numberOfTasks = 0;
+    for (auto const& tasks : tasksPerThread) {
+        numberOfTasks += tasks;
+    }
+    EXPECT_EQ(1000ull, numberOfTasks);
+}
+
+TEST(TaskPoolTest, Exception) {
+    storm::utility::TaskPool pool(4);
+    std::atomic<uint64_t> finishedTasks(0);
+    for (uint64_t task = 0; task < 100; ++task) {
+        pool.submit([task, &finishedTasks]() {
+            STORM_LOG_THROW(task != 50, storm::exceptions::InvalidArgumentException, "Task failed.");
+            ++finishedTasks;
+        });
+    }
+    STORM_SILENT_EXPECT_THROW(pool.wait(), storm::exceptions::InvalidArgumentException);
+    EXPECT_GT(100ull, finishedTasks.load());
+
+    // The pool can be used again after an exception.
+    finishedTasks = 0;
+    pool.submit([&finishedTasks]() { ++finishedTasks; });
+    pool.wait();
+    EXPECT_EQ(1ull, finishedTasks.load());
+}